@@ -0,0 +1,365 @@
+/*
+ * Converts a XML property list into a binary property list or vice versa
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fplisttools_libfplist.h"
+
+#define FPLISTCONVERT_READ_BUFFER_SIZE	65536
+
+/* Prints usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use fplistconvert to convert a XML property list into a binary\n"
+	                 "property list (bplist00) or a binary property list into a XML\n"
+	                 "property list. The format of the source is determined by its\n"
+	                 "signature.\n\n" );
+
+	fprintf( stream, "Usage: fplistconvert [ -hV ] source destination\n\n" );
+
+	fprintf( stream, "\tsource:      the source property list file\n" );
+	fprintf( stream, "\tdestination: the destination property list file\n\n" );
+
+	fprintf( stream, "\t-h:          shows this help\n" );
+	fprintf( stream, "\t-V:          print version\n" );
+}
+
+/* Reads the data of a file
+ * The data is newly allocated and the caller is responsible for freeing it
+ * Returns 1 if successful or -1 on error
+ */
+int fplistconvert_read_file(
+     const char *filename,
+     uint8_t **data,
+     size_t *data_size )
+{
+	FILE *file_stream     = NULL;
+	uint8_t *reallocation = NULL;
+	uint8_t *safe_data    = NULL;
+	size_t allocated_size = 0;
+	size_t read_count     = 0;
+	size_t safe_data_size = 0;
+
+	if( ( filename == NULL )
+	 || ( data == NULL )
+	 || ( data_size == NULL ) )
+	{
+		return( -1 );
+	}
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_READ );
+
+	if( file_stream == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source file: %s.\n",
+		 filename );
+
+		goto on_error;
+	}
+	do
+	{
+		if( ( allocated_size - safe_data_size ) < FPLISTCONVERT_READ_BUFFER_SIZE )
+		{
+			if( allocated_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				fprintf(
+				 stderr,
+				 "Source file: %s is too large.\n",
+				 filename );
+
+				goto on_error;
+			}
+			if( allocated_size == 0 )
+			{
+				allocated_size = FPLISTCONVERT_READ_BUFFER_SIZE;
+			}
+			else
+			{
+				allocated_size *= 2;
+			}
+			reallocation = (uint8_t *) memory_reallocate(
+			                            safe_data,
+			                            sizeof( uint8_t ) * allocated_size );
+
+			if( reallocation == NULL )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to resize data.\n" );
+
+				goto on_error;
+			}
+			safe_data = reallocation;
+		}
+		read_count = file_stream_read(
+		              file_stream,
+		              &( safe_data[ safe_data_size ] ),
+		              allocated_size - safe_data_size );
+
+		safe_data_size += read_count;
+	}
+	while( read_count > 0 );
+
+	if( ferror( file_stream ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to read source file: %s.\n",
+		 filename );
+
+		goto on_error;
+	}
+	file_stream_close(
+	 file_stream );
+
+	*data      = safe_data;
+	*data_size = safe_data_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_data != NULL )
+	{
+		memory_free(
+		 safe_data );
+	}
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	return( -1 );
+}
+
+/* Writes data to a file
+ * Returns 1 if successful or -1 on error
+ */
+int fplistconvert_write_file(
+     const char *filename,
+     const uint8_t *data,
+     size_t data_size )
+{
+	FILE *file_stream  = NULL;
+	size_t write_count = 0;
+
+	if( ( filename == NULL )
+	 || ( data == NULL ) )
+	{
+		return( -1 );
+	}
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( file_stream == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open destination file: %s.\n",
+		 filename );
+
+		return( -1 );
+	}
+	write_count = file_stream_write(
+	               file_stream,
+	               data,
+	               data_size );
+
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		write_count = 0;
+	}
+	if( write_count != data_size )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write destination file: %s.\n",
+		 filename );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* The main program
+ */
+int main(
+     int argc,
+     char * const argv[] )
+{
+	libfplist_error_t *error         = NULL;
+	const char *destination_filename = NULL;
+	const char *option_string        = NULL;
+	const char *source_filename      = NULL;
+	uint8_t *destination_data        = NULL;
+	uint8_t *source_data             = NULL;
+	size_t destination_data_size     = 0;
+	size_t source_data_size          = 0;
+	int argument_index               = 1;
+	int result                       = 0;
+
+	if( ( argument_index < argc )
+	 && ( argv[ argument_index ][ 0 ] == '-' )
+	 && ( argv[ argument_index ][ 1 ] != 0 ) )
+	{
+		option_string = &( argv[ argument_index ][ 1 ] );
+
+		if( narrow_string_compare(
+		     option_string,
+		     "h",
+		     2 ) == 0 )
+		{
+			usage_fprint(
+			 stdout );
+
+			return( EXIT_SUCCESS );
+		}
+		else if( narrow_string_compare(
+		          option_string,
+		          "V",
+		          2 ) == 0 )
+		{
+			fprintf(
+			 stdout,
+			 "fplistconvert %s\n",
+			 libfplist_get_version() );
+
+			return( EXIT_SUCCESS );
+		}
+		fprintf(
+		 stderr,
+		 "Invalid argument: %s\n",
+		 argv[ argument_index ] );
+
+		usage_fprint(
+		 stderr );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( argc - argument_index ) != 2 )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source or destination.\n" );
+
+		usage_fprint(
+		 stderr );
+
+		return( EXIT_FAILURE );
+	}
+	source_filename      = argv[ argument_index ];
+	destination_filename = argv[ argument_index + 1 ];
+
+	if( fplistconvert_read_file(
+	     source_filename,
+	     &source_data,
+	     &source_data_size ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ( source_data_size >= 8 )
+	 && ( memory_compare(
+	       source_data,
+	       "bplist",
+	       6 ) == 0 ) )
+	{
+		result = libfplist_transcoder_copy_binary_to_xml(
+		          source_data,
+		          source_data_size,
+		          &destination_data,
+		          &destination_data_size,
+		          &error );
+	}
+	else
+	{
+		result = libfplist_transcoder_copy_xml_to_binary(
+		          source_data,
+		          source_data_size,
+		          &destination_data,
+		          &destination_data_size,
+		          &error );
+	}
+	if( result != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to convert property list: %s.\n",
+		 source_filename );
+
+		goto on_error;
+	}
+	memory_free(
+	 source_data );
+
+	source_data = NULL;
+
+	if( fplistconvert_write_file(
+	     destination_filename,
+	     destination_data,
+	     destination_data_size ) != 1 )
+	{
+		goto on_error;
+	}
+	memory_free(
+	 destination_data );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libfplist_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libfplist_error_free(
+		 &error );
+	}
+	if( destination_data != NULL )
+	{
+		memory_free(
+		 destination_data );
+	}
+	if( source_data != NULL )
+	{
+		memory_free(
+		 source_data );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,2466 @@
+/*
+ * NSKeyedArchiver archive functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libfplist_archive.h"
+#include "libfplist_binary_writer.h"
+#include "libfplist_date_time.h"
+#include "libfplist_definitions.h"
+#include "libfplist_floating_point.h"
+#include "libfplist_libcdata.h"
+#include "libfplist_libcerror.h"
+#include "libfplist_property.h"
+#include "libfplist_property_list.h"
+#include "libfplist_types.h"
+#include "libfplist_xml_tag.h"
+
+/* The number of seconds between January 1, 1970 and January 1, 2001
+ */
+#define LIBFPLIST_ARCHIVE_DATE_TIME_EPOCH_OFFSET	978307200
+
+typedef struct libfplist_archive_class_name libfplist_archive_class_name_t;
+
+struct libfplist_archive_class_name
+{
+	/* The class name
+	 */
+	const char *class_name;
+
+	/* The class name length
+	 */
+	size_t class_name_length;
+
+	/* The class type
+	 */
+	uint8_t class_type;
+};
+
+/* The class names of which the archived objects are decoded into plist values
+ */
+static const libfplist_archive_class_name_t libfplist_archive_class_names[ 13 ] = {
+	{ "NSArray", 7, LIBFPLIST_ARCHIVE_CLASS_TYPE_ARRAY },
+	{ "NSData", 6, LIBFPLIST_ARCHIVE_CLASS_TYPE_DATA },
+	{ "NSDate", 6, LIBFPLIST_ARCHIVE_CLASS_TYPE_DATE },
+	{ "NSDictionary", 12, LIBFPLIST_ARCHIVE_CLASS_TYPE_DICTIONARY },
+	{ "NSMutableArray", 14, LIBFPLIST_ARCHIVE_CLASS_TYPE_ARRAY },
+	{ "NSMutableData", 13, LIBFPLIST_ARCHIVE_CLASS_TYPE_DATA },
+	{ "NSMutableDictionary", 19, LIBFPLIST_ARCHIVE_CLASS_TYPE_DICTIONARY },
+	{ "NSMutableOrderedSet", 19, LIBFPLIST_ARCHIVE_CLASS_TYPE_ARRAY },
+	{ "NSMutableSet", 12, LIBFPLIST_ARCHIVE_CLASS_TYPE_ARRAY },
+	{ "NSMutableString", 15, LIBFPLIST_ARCHIVE_CLASS_TYPE_STRING },
+	{ "NSOrderedSet", 12, LIBFPLIST_ARCHIVE_CLASS_TYPE_ARRAY },
+	{ "NSSet", 5, LIBFPLIST_ARCHIVE_CLASS_TYPE_ARRAY },
+	{ "NSString", 8, LIBFPLIST_ARCHIVE_CLASS_TYPE_STRING } };
+
+/* Creates an archive
+ * Make sure the value archive is referencing, is set to NULL
+ * The archive references the XML tags of the property list, which must remain
+ * available while the archive is used
+ * The objects of the $objects array are indexed by their UID
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_archive_initialize(
+     libfplist_archive_t **archive,
+     libfplist_property_list_t *property_list,
+     libcerror_error_t **error )
+{
+	libfplist_internal_archive_t *internal_archive             = NULL;
+	libfplist_internal_property_list_t *internal_property_list = NULL;
+	libfplist_xml_tag_t *element_tag                           = NULL;
+	libfplist_xml_tag_t *objects_tag                           = NULL;
+	static char *function                                      = "libfplist_archive_initialize";
+	size_t objects_size                                        = 0;
+	int element_index                                          = 0;
+	int number_of_elements                                     = 0;
+	int number_of_entries                                      = 0;
+	int object_index                                           = 0;
+	int result                                                 = 0;
+	int value_type                                             = 0;
+
+	if( archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive.",
+		 function );
+
+		return( -1 );
+	}
+	if( *archive != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid archive value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( property_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property_list = (libfplist_internal_property_list_t *) property_list;
+
+	if( internal_property_list->dict_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property list - missing dict XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	internal_archive = memory_allocate_structure(
+	                    libfplist_internal_archive_t );
+
+	if( internal_archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create archive.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_archive,
+	     0,
+	     sizeof( libfplist_internal_archive_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear archive.",
+		 function );
+
+		memory_free(
+		 internal_archive );
+
+		return( -1 );
+	}
+	result = libfplist_archive_get_dictionary_value_tag(
+	          internal_property_list->dict_tag,
+	          (uint8_t *) "$objects",
+	          8,
+	          &objects_tag,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve $objects XML tag.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     objects_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of $objects XML tag.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( result == 0 )
+	 || ( value_type != LIBFPLIST_VALUE_TYPE_ARRAY ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported property list - missing $objects array.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfplist_archive_get_dictionary_value_tag(
+	          internal_property_list->dict_tag,
+	          (uint8_t *) "$top",
+	          4,
+	          &( internal_archive->top_tag ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve $top XML tag.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_archive->top_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of $top XML tag.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( result == 0 )
+	 || ( value_type != LIBFPLIST_VALUE_TYPE_DICTIONARY ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported property list - missing $top dict.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_xml_tag_get_number_of_entries(
+	     objects_tag,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries of $objects XML tag.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_entries < 0 )
+	 || ( (size_t) number_of_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfplist_archive_object_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_entries > 0 )
+	{
+		objects_size = sizeof( libfplist_archive_object_t ) * number_of_entries;
+
+		internal_archive->objects = (libfplist_archive_object_t *) memory_allocate(
+		                                                            objects_size );
+
+		if( internal_archive->objects == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create objects.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     internal_archive->objects,
+		     0,
+		     objects_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear objects.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     objects_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements of $objects XML tag.",
+		 function );
+
+		goto on_error;
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfplist_xml_tag_get_element(
+		     objects_tag,
+		     element_index,
+		     &element_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     element_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of element: %d.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		/* Ignore text nodes
+		 */
+		if( value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+		{
+			continue;
+		}
+		if( object_index >= number_of_entries )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid object index value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		internal_archive->objects[ object_index++ ].object_tag = element_tag;
+	}
+	internal_archive->number_of_objects = object_index;
+
+	if( libcdata_array_initialize(
+	     &( internal_archive->decoded_tags_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decoded tags array.",
+		 function );
+
+		goto on_error;
+	}
+	*archive = (libfplist_archive_t *) internal_archive;
+
+	return( 1 );
+
+on_error:
+	if( internal_archive != NULL )
+	{
+		if( internal_archive->objects != NULL )
+		{
+			memory_free(
+			 internal_archive->objects );
+		}
+		memory_free(
+		 internal_archive );
+	}
+	return( -1 );
+}
+
+/* Frees an archive
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_archive_free(
+     libfplist_archive_t **archive,
+     libcerror_error_t **error )
+{
+	libfplist_internal_archive_t *internal_archive = NULL;
+	libfplist_xml_tag_t *decoded_tag               = NULL;
+	static char *function                          = "libfplist_archive_free";
+	int entry_index                                = 0;
+	int number_of_entries                          = 0;
+	int result                                     = 1;
+
+	if( archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive.",
+		 function );
+
+		return( -1 );
+	}
+	if( *archive != NULL )
+	{
+		internal_archive = (libfplist_internal_archive_t *) *archive;
+		*archive         = NULL;
+
+		/* The elements of the decoded XML tags are owned by the property list
+		 * or are decoded XML tags themselves, hence they are not freed with
+		 * the decoded XML tag
+		 */
+		if( libcdata_array_get_number_of_entries(
+		     internal_archive->decoded_tags_array,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of decoded tags.",
+			 function );
+
+			result = -1;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_archive->decoded_tags_array,
+			     entry_index,
+			     (intptr_t **) &decoded_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve decoded tag: %d.",
+				 function,
+				 entry_index );
+
+				result = -1;
+
+				continue;
+			}
+			if( libcdata_array_empty(
+			     decoded_tag->elements_array,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to empty elements array of decoded tag: %d.",
+				 function,
+				 entry_index );
+
+				result = -1;
+			}
+		}
+		if( libcdata_array_free(
+		     &( internal_archive->decoded_tags_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfplist_xml_tag_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decoded tags array.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_archive->objects != NULL )
+		{
+			memory_free(
+			 internal_archive->objects );
+		}
+		memory_free(
+		 internal_archive );
+	}
+	return( result );
+}
+
+/* Retrieves the value XML tag of a specific key of a dict XML tag
+ * Returns 1 if successful, 0 if no such key or -1 on error
+ */
+int libfplist_archive_get_dictionary_value_tag(
+     libfplist_xml_tag_t *dictionary_tag,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfplist_xml_tag_t **value_tag,
+     libcerror_error_t **error )
+{
+	libfplist_xml_tag_t *element_tag = NULL;
+	static char *function            = "libfplist_archive_get_dictionary_value_tag";
+	int element_index                = 0;
+	int is_match                     = 0;
+	int number_of_elements           = 0;
+	int result                       = 0;
+	int value_type                   = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     dictionary_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfplist_xml_tag_get_element(
+		     dictionary_tag,
+		     element_index,
+		     &element_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		result = libfplist_xml_tag_compare_name(
+		          element_tag,
+		          (uint8_t *) "key",
+		          3,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			is_match = (int) ( ( element_tag->value_size == ( utf8_string_length + 1 ) )
+			                && ( narrow_string_compare(
+			                      element_tag->value,
+			                      utf8_string,
+			                      utf8_string_length ) == 0 ) );
+
+			continue;
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     element_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		/* Ignore text nodes
+		 */
+		if( value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+		{
+			continue;
+		}
+		if( is_match != 0 )
+		{
+			*value_tag = element_tag;
+
+			return( 1 );
+		}
+		is_match = 0;
+	}
+	return( 0 );
+}
+
+/* Retrieves the UID value of a XML tag
+ * A UID is represented as a dict with a single CF$UID key and a non-negative integer value:
+ * <dict><key>CF$UID</key><integer>#</integer></dict>
+ * Returns 1 if successful, 0 if the XML tag does not represent a UID or -1 on error
+ */
+int libfplist_archive_get_uid_value(
+     libfplist_xml_tag_t *tag,
+     uint64_t *uid_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_archive_get_uid_value";
+	int result            = 0;
+	int value_type        = 0;
+
+	if( libfplist_xml_tag_get_value_type(
+	     tag,
+	     &value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_type != LIBFPLIST_VALUE_TYPE_DICTIONARY )
+	{
+		return( 0 );
+	}
+	result = libfplist_binary_writer_get_uid_value(
+	          tag,
+	          uid_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UID value.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the class type of an archived object
+ * The class type is determined from the $classname of the $class object,
+ * which is determined once per $class object
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_archive_get_class_type(
+     libfplist_internal_archive_t *internal_archive,
+     libfplist_xml_tag_t *object_tag,
+     uint8_t *class_type,
+     libcerror_error_t **error )
+{
+	libfplist_archive_object_t *class_object = NULL;
+	libfplist_xml_tag_t *class_name_tag      = NULL;
+	libfplist_xml_tag_t *class_tag           = NULL;
+	static char *function                    = "libfplist_archive_get_class_type";
+	uint64_t uid_value                       = 0;
+	int class_name_index                     = 0;
+	int result                               = 0;
+	int value_type                           = 0;
+
+	if( internal_archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive.",
+		 function );
+
+		return( -1 );
+	}
+	if( class_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid class type.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfplist_archive_get_dictionary_value_tag(
+	          object_tag,
+	          (uint8_t *) "$class",
+	          6,
+	          &class_tag,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve $class XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		result = libfplist_archive_get_uid_value(
+		          class_tag,
+		          &uid_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve $class UID value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* A dict without a $class UID is not an archived object and its members
+	 * are decoded as those of an object
+	 */
+	if( result == 0 )
+	{
+		*class_type = LIBFPLIST_ARCHIVE_CLASS_TYPE_OBJECT;
+
+		return( 1 );
+	}
+	if( uid_value >= (uint64_t) internal_archive->number_of_objects )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid $class UID value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	class_object = &( internal_archive->objects[ uid_value ] );
+
+	if( class_object->class_type != LIBFPLIST_ARCHIVE_CLASS_TYPE_UNKNOWN )
+	{
+		*class_type = class_object->class_type;
+
+		return( 1 );
+	}
+	class_object->class_type = LIBFPLIST_ARCHIVE_CLASS_TYPE_OBJECT;
+
+	if( libfplist_xml_tag_get_value_type(
+	     class_object->object_tag,
+	     &value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type of $class object.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_type == LIBFPLIST_VALUE_TYPE_DICTIONARY )
+	{
+		result = libfplist_archive_get_dictionary_value_tag(
+		          class_object->object_tag,
+		          (uint8_t *) "$classname",
+		          10,
+		          &class_name_tag,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve $classname XML tag.",
+			 function );
+
+			return( -1 );
+		}
+		else if( ( result != 0 )
+		      && ( class_name_tag->value != NULL ) )
+		{
+			for( class_name_index = 0;
+			     class_name_index < 13;
+			     class_name_index++ )
+			{
+				if( ( class_name_tag->value_size == ( libfplist_archive_class_names[ class_name_index ].class_name_length + 1 ) )
+				 && ( narrow_string_compare(
+				       class_name_tag->value,
+				       libfplist_archive_class_names[ class_name_index ].class_name,
+				       libfplist_archive_class_names[ class_name_index ].class_name_length ) == 0 ) )
+				{
+					class_object->class_type = libfplist_archive_class_names[ class_name_index ].class_type;
+
+					break;
+				}
+			}
+		}
+	}
+	*class_type = class_object->class_type;
+
+	return( 1 );
+}
+
+/* Creates a decoded XML tag that is owned by the archive
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_archive_create_decoded_tag(
+     libfplist_internal_archive_t *internal_archive,
+     const uint8_t *name,
+     size_t name_length,
+     libfplist_xml_tag_t **decoded_tag,
+     libcerror_error_t **error )
+{
+	libfplist_xml_tag_t *safe_decoded_tag = NULL;
+	static char *function                 = "libfplist_archive_create_decoded_tag";
+	int entry_index                       = 0;
+
+	if( internal_archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoded_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoded tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_initialize(
+	     &safe_decoded_tag,
+	     name,
+	     name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decoded tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_append_entry(
+	     internal_archive->decoded_tags_array,
+	     &entry_index,
+	     (intptr_t *) safe_decoded_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append decoded tag to array.",
+		 function );
+
+		libfplist_xml_tag_free(
+		 &safe_decoded_tag,
+		 NULL );
+
+		return( -1 );
+	}
+	*decoded_tag = safe_decoded_tag;
+
+	return( 1 );
+}
+
+/* Appends an element to a decoded array or dict XML tag
+ * The element XML tag is referenced, unlike libfplist_xml_tag_append_element
+ * its parent XML tag is not changed
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_archive_append_decoded_element(
+     libfplist_xml_tag_t *decoded_tag,
+     libfplist_xml_tag_t *element_tag,
+     uint8_t is_key,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_archive_append_decoded_element";
+	int entry_index       = 0;
+
+	if( decoded_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoded tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( element_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_append_entry(
+	     decoded_tag->elements_array,
+	     &entry_index,
+	     (intptr_t *) element_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append element tag to array.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_key == 0 )
+	{
+		decoded_tag->number_of_entries += 1;
+	}
+	return( 1 );
+}
+
+/* Decodes an element of an archived object
+ * An element that is a UID is replaced by the decoded object it references,
+ * except for $null and for an object that is being decoded, such as an object
+ * that references itself, which remain a UID
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_archive_decode_element(
+     libfplist_internal_archive_t *internal_archive,
+     libfplist_xml_tag_t *element_tag,
+     int recursion_depth,
+     libfplist_xml_tag_t **decoded_tag,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_archive_decode_element";
+	uint64_t uid_value    = 0;
+	int result            = 0;
+
+	if( decoded_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoded tag.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfplist_archive_get_uid_value(
+	          element_tag,
+	          &uid_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UID value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		result = libfplist_archive_decode_object(
+		          internal_archive,
+		          uid_value,
+		          recursion_depth,
+		          decoded_tag,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to decode object: %" PRIu64 ".",
+			 function,
+			 uid_value );
+
+			return( -1 );
+		}
+	}
+	if( result == 0 )
+	{
+		*decoded_tag = element_tag;
+	}
+	return( 1 );
+}
+
+/* Decodes a NSDate object into a date XML tag
+ * The NS.time member contains the number of seconds since January 1, 2001
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_archive_decode_date(
+     libfplist_internal_archive_t *internal_archive,
+     libfplist_xml_tag_t *object_tag,
+     libfplist_xml_tag_t **decoded_tag,
+     libcerror_error_t **error )
+{
+	uint8_t value_string[ LIBFPLIST_DATE_TIME_UTF8_STRING_SIZE ];
+
+	libfplist_xml_tag_t *time_tag = NULL;
+	static char *function         = "libfplist_archive_decode_date";
+	double floating_point_value   = 0.0;
+	size_t value_string_length    = 0;
+	int64_t posix_time            = 0;
+	uint32_t nanoseconds          = 0;
+	int result                    = 0;
+
+	result = libfplist_archive_get_dictionary_value_tag(
+	          object_tag,
+	          (uint8_t *) "NS.time",
+	          7,
+	          &time_tag,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve NS.time XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( time_tag->value != NULL )
+	      && ( time_tag->value_size > 1 ) )
+	{
+		result = libfplist_floating_point_copy_from_utf8_string(
+		          time_tag->value,
+		          time_tag->value_size - 1,
+		          &floating_point_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy NS.time value from string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		result = 0;
+	}
+	/* Values that are not a number or outside the supported range fail the comparison
+	 */
+	if( ( result == 0 )
+	 || !( ( floating_point_value > -1.0e12 )
+	    && ( floating_point_value < 1.0e12 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported NS.time value.",
+		 function );
+
+		return( -1 );
+	}
+	posix_time = (int64_t) floating_point_value;
+
+	if( (double) posix_time > floating_point_value )
+	{
+		posix_time -= 1;
+	}
+	nanoseconds = (uint32_t) ( ( floating_point_value - (double) posix_time ) * 1000000000.0 );
+
+	if( nanoseconds > 999999999UL )
+	{
+		nanoseconds = 999999999UL;
+	}
+	posix_time += LIBFPLIST_ARCHIVE_DATE_TIME_EPOCH_OFFSET;
+
+	if( libfplist_date_time_copy_to_utf8_string(
+	     posix_time,
+	     nanoseconds,
+	     value_string,
+	     LIBFPLIST_DATE_TIME_UTF8_STRING_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy date and time value to string.",
+		 function );
+
+		return( -1 );
+	}
+	value_string_length = narrow_string_length(
+	                       (char *) value_string );
+
+	if( libfplist_archive_create_decoded_tag(
+	     internal_archive,
+	     (uint8_t *) "date",
+	     4,
+	     decoded_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create date tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_set_value(
+	     *decoded_tag,
+	     value_string,
+	     value_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set date tag value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decodes the NS.objects member of a NSArray, NSSet or NSOrderedSet object
+ * into the elements of an array XML tag
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_archive_decode_array(
+     libfplist_internal_archive_t *internal_archive,
+     libfplist_xml_tag_t *object_tag,
+     libfplist_xml_tag_t *decoded_tag,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfplist_xml_tag_t *decoded_element_tag = NULL;
+	libfplist_xml_tag_t *element_tag         = NULL;
+	libfplist_xml_tag_t *objects_tag         = NULL;
+	static char *function                    = "libfplist_archive_decode_array";
+	int element_index                        = 0;
+	int number_of_elements                   = 0;
+	int result                               = 0;
+	int value_type                           = 0;
+
+	result = libfplist_archive_get_dictionary_value_tag(
+	          object_tag,
+	          (uint8_t *) "NS.objects",
+	          10,
+	          &objects_tag,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve NS.objects XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     objects_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of NS.objects XML tag.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( result == 0 )
+	 || ( value_type != LIBFPLIST_VALUE_TYPE_ARRAY ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported object - missing NS.objects array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     objects_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfplist_xml_tag_get_element(
+		     objects_tag,
+		     element_index,
+		     &element_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     element_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		/* Ignore text nodes
+		 */
+		if( value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+		{
+			continue;
+		}
+		if( libfplist_archive_decode_element(
+		     internal_archive,
+		     element_tag,
+		     recursion_depth + 1,
+		     &decoded_element_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to decode element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		if( libfplist_archive_append_decoded_element(
+		     decoded_tag,
+		     decoded_element_tag,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append decoded element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Decodes the NS.keys and NS.objects members of a NSDictionary object
+ * into the elements of a dict XML tag
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_archive_decode_dictionary(
+     libfplist_internal_archive_t *internal_archive,
+     libfplist_xml_tag_t *object_tag,
+     libfplist_xml_tag_t *decoded_tag,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfplist_xml_tag_t *decoded_element_tag = NULL;
+	libfplist_xml_tag_t *element_tag         = NULL;
+	libfplist_xml_tag_t *key_tag             = NULL;
+	libfplist_xml_tag_t *keys_tag            = NULL;
+	libfplist_xml_tag_t *objects_tag         = NULL;
+	static char *function                    = "libfplist_archive_decode_dictionary";
+	int key_element_index                    = 0;
+	int number_of_key_elements               = 0;
+	int number_of_keys                       = 0;
+	int number_of_object_elements            = 0;
+	int number_of_objects                    = 0;
+	int object_element_index                 = 0;
+	int result                               = 0;
+	int value_type                           = 0;
+
+	result = libfplist_archive_get_dictionary_value_tag(
+	          object_tag,
+	          (uint8_t *) "NS.keys",
+	          7,
+	          &keys_tag,
+	          error );
+
+	if( result == 1 )
+	{
+		result = libfplist_archive_get_dictionary_value_tag(
+		          object_tag,
+		          (uint8_t *) "NS.objects",
+		          10,
+		          &objects_tag,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve NS.keys and NS.objects XML tags.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libfplist_xml_tag_get_number_of_entries(
+		     keys_tag,
+		     &number_of_keys,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of keys.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfplist_xml_tag_get_number_of_entries(
+		     objects_tag,
+		     &number_of_objects,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of objects.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     keys_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of NS.keys XML tag.",
+			 function );
+
+			return( -1 );
+		}
+		if( value_type == LIBFPLIST_VALUE_TYPE_ARRAY )
+		{
+			if( libfplist_xml_tag_get_value_type(
+			     objects_tag,
+			     &value_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value type of NS.objects XML tag.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( ( result == 0 )
+	 || ( value_type != LIBFPLIST_VALUE_TYPE_ARRAY )
+	 || ( number_of_keys != number_of_objects ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported object - missing or mismatching NS.keys and NS.objects arrays.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     keys_tag,
+	     &number_of_key_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of key elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     objects_tag,
+	     &number_of_object_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of object elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( key_element_index = 0;
+	     key_element_index < number_of_key_elements;
+	     key_element_index++ )
+	{
+		if( libfplist_xml_tag_get_element(
+		     keys_tag,
+		     key_element_index,
+		     &element_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key element: %d.",
+			 function,
+			 key_element_index );
+
+			return( -1 );
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     element_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of key element: %d.",
+			 function,
+			 key_element_index );
+
+			return( -1 );
+		}
+		/* Ignore text nodes
+		 */
+		if( value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+		{
+			continue;
+		}
+		if( libfplist_archive_decode_element(
+		     internal_archive,
+		     element_tag,
+		     recursion_depth + 1,
+		     &decoded_element_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to decode key element: %d.",
+			 function,
+			 key_element_index );
+
+			return( -1 );
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     decoded_element_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of decoded key element: %d.",
+			 function,
+			 key_element_index );
+
+			return( -1 );
+		}
+		if( value_type != LIBFPLIST_VALUE_TYPE_STRING )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported key element: %d - not a string.",
+			 function,
+			 key_element_index );
+
+			return( -1 );
+		}
+		if( libfplist_archive_create_decoded_tag(
+		     internal_archive,
+		     (uint8_t *) "key",
+		     3,
+		     &key_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create key tag.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( decoded_element_tag->value != NULL )
+		 && ( decoded_element_tag->value_size > 1 ) )
+		{
+			if( libfplist_xml_tag_set_value(
+			     key_tag,
+			     decoded_element_tag->value,
+			     decoded_element_tag->value_size - 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set key tag value.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libfplist_archive_append_decoded_element(
+		     decoded_tag,
+		     key_tag,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append key tag.",
+			 function );
+
+			return( -1 );
+		}
+		/* The object elements are matched with the key elements in order
+		 */
+		do
+		{
+			if( object_element_index >= number_of_object_elements )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid object element index value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( libfplist_xml_tag_get_element(
+			     objects_tag,
+			     object_element_index,
+			     &element_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve object element: %d.",
+				 function,
+				 object_element_index );
+
+				return( -1 );
+			}
+			if( libfplist_xml_tag_get_value_type(
+			     element_tag,
+			     &value_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value type of object element: %d.",
+				 function,
+				 object_element_index );
+
+				return( -1 );
+			}
+			object_element_index++;
+		}
+		while( value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN );
+
+		if( libfplist_archive_decode_element(
+		     internal_archive,
+		     element_tag,
+		     recursion_depth + 1,
+		     &decoded_element_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to decode object element: %d.",
+			 function,
+			 object_element_index - 1 );
+
+			return( -1 );
+		}
+		if( libfplist_archive_append_decoded_element(
+		     decoded_tag,
+		     decoded_element_tag,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append decoded object element: %d.",
+			 function,
+			 object_element_index - 1 );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Decodes the members of an archived object, other than $class, into the elements of a dict XML tag
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_archive_decode_members(
+     libfplist_internal_archive_t *internal_archive,
+     libfplist_xml_tag_t *object_tag,
+     libfplist_xml_tag_t *decoded_tag,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfplist_xml_tag_t *decoded_element_tag = NULL;
+	libfplist_xml_tag_t *element_tag         = NULL;
+	libfplist_xml_tag_t *key_tag             = NULL;
+	static char *function                    = "libfplist_archive_decode_members";
+	int element_index                        = 0;
+	int number_of_elements                   = 0;
+	int result                               = 0;
+	int value_type                           = 0;
+
+	if( libfplist_xml_tag_get_number_of_elements(
+	     object_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfplist_xml_tag_get_element(
+		     object_tag,
+		     element_index,
+		     &element_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		result = libfplist_xml_tag_compare_name(
+		          element_tag,
+		          (uint8_t *) "key",
+		          3,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			key_tag = element_tag;
+
+			/* The $class member is represented by the decoded value type
+			 */
+			if( ( key_tag->value_size == 7 )
+			 && ( narrow_string_compare(
+			       (char *) key_tag->value,
+			       "$class",
+			       6 ) == 0 ) )
+			{
+				key_tag = NULL;
+			}
+			continue;
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     element_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		/* Ignore text nodes and values without a key
+		 */
+		if( ( value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+		 || ( key_tag == NULL ) )
+		{
+			continue;
+		}
+		if( libfplist_archive_decode_element(
+		     internal_archive,
+		     element_tag,
+		     recursion_depth + 1,
+		     &decoded_element_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to decode element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		if( libfplist_archive_append_decoded_element(
+		     decoded_tag,
+		     key_tag,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append key tag.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfplist_archive_append_decoded_element(
+		     decoded_tag,
+		     decoded_element_tag,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append decoded element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		key_tag = NULL;
+	}
+	return( 1 );
+}
+
+/* Decodes an archived object
+ * The decoded object is memoized so that an object referenced by multiple
+ * UIDs is only decoded once
+ * Returns 1 if successful, 0 if the object is $null or is being decoded or -1 on error
+ */
+int libfplist_archive_decode_object(
+     libfplist_internal_archive_t *internal_archive,
+     uint64_t uid_value,
+     int recursion_depth,
+     libfplist_xml_tag_t **decoded_tag,
+     libcerror_error_t **error )
+{
+	libfplist_archive_object_t *archive_object = NULL;
+	libfplist_xml_tag_t *member_tag            = NULL;
+	static char *function                      = "libfplist_archive_decode_object";
+	uint8_t class_type                         = 0;
+	int result                                 = 0;
+	int value_type                             = 0;
+
+	if( internal_archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive.",
+		 function );
+
+		return( -1 );
+	}
+	if( uid_value >= (uint64_t) internal_archive->number_of_objects )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UID value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFPLIST_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoded_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoded tag.",
+		 function );
+
+		return( -1 );
+	}
+	archive_object = &( internal_archive->objects[ uid_value ] );
+
+	if( archive_object->decoding_state == LIBFPLIST_ARCHIVE_DECODING_STATE_DECODED )
+	{
+		if( archive_object->decoded_tag == NULL )
+		{
+			return( 0 );
+		}
+		*decoded_tag = archive_object->decoded_tag;
+
+		return( 1 );
+	}
+	else if( archive_object->decoding_state == LIBFPLIST_ARCHIVE_DECODING_STATE_IN_PROGRESS )
+	{
+		return( 0 );
+	}
+	if( libfplist_xml_tag_get_value_type(
+	     archive_object->object_tag,
+	     &value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type of object: %" PRIu64 ".",
+		 function,
+		 uid_value );
+
+		return( -1 );
+	}
+	if( value_type != LIBFPLIST_VALUE_TYPE_DICTIONARY )
+	{
+		archive_object->decoding_state = LIBFPLIST_ARCHIVE_DECODING_STATE_DECODED;
+
+		if( ( value_type == LIBFPLIST_VALUE_TYPE_STRING )
+		 && ( archive_object->object_tag->value_size == 6 )
+		 && ( narrow_string_compare(
+		       (char *) archive_object->object_tag->value,
+		       "$null",
+		       5 ) == 0 ) )
+		{
+			return( 0 );
+		}
+		archive_object->decoded_tag = archive_object->object_tag;
+
+		*decoded_tag = archive_object->decoded_tag;
+
+		return( 1 );
+	}
+	/* Mark the object as being decoded to detect objects that (indirectly)
+	 * reference themselves
+	 */
+	archive_object->decoding_state = LIBFPLIST_ARCHIVE_DECODING_STATE_IN_PROGRESS;
+
+	if( libfplist_archive_get_class_type(
+	     internal_archive,
+	     archive_object->object_tag,
+	     &class_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve class type of object: %" PRIu64 ".",
+		 function,
+		 uid_value );
+
+		goto on_error;
+	}
+	switch( class_type )
+	{
+		case LIBFPLIST_ARCHIVE_CLASS_TYPE_DATA:
+		case LIBFPLIST_ARCHIVE_CLASS_TYPE_STRING:
+			if( class_type == LIBFPLIST_ARCHIVE_CLASS_TYPE_DATA )
+			{
+				result = libfplist_archive_get_dictionary_value_tag(
+				          archive_object->object_tag,
+				          (uint8_t *) "NS.data",
+				          7,
+				          &member_tag,
+				          error );
+			}
+			else
+			{
+				result = libfplist_archive_get_dictionary_value_tag(
+				          archive_object->object_tag,
+				          (uint8_t *) "NS.string",
+				          9,
+				          &member_tag,
+				          error );
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value XML tag of object: %" PRIu64 ".",
+				 function,
+				 uid_value );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported object: %" PRIu64 " - missing value.",
+				 function,
+				 uid_value );
+
+				goto on_error;
+			}
+			result = libfplist_archive_decode_element(
+			          internal_archive,
+			          member_tag,
+			          recursion_depth + 1,
+			          &( archive_object->decoded_tag ),
+			          error );
+			break;
+
+		case LIBFPLIST_ARCHIVE_CLASS_TYPE_DATE:
+			result = libfplist_archive_decode_date(
+			          internal_archive,
+			          archive_object->object_tag,
+			          &( archive_object->decoded_tag ),
+			          error );
+			break;
+
+		case LIBFPLIST_ARCHIVE_CLASS_TYPE_ARRAY:
+			result = libfplist_archive_create_decoded_tag(
+			          internal_archive,
+			          (uint8_t *) "array",
+			          5,
+			          &( archive_object->decoded_tag ),
+			          error );
+
+			if( result == 1 )
+			{
+				result = libfplist_archive_decode_array(
+				          internal_archive,
+				          archive_object->object_tag,
+				          archive_object->decoded_tag,
+				          recursion_depth,
+				          error );
+			}
+			break;
+
+		case LIBFPLIST_ARCHIVE_CLASS_TYPE_DICTIONARY:
+			result = libfplist_archive_create_decoded_tag(
+			          internal_archive,
+			          (uint8_t *) "dict",
+			          4,
+			          &( archive_object->decoded_tag ),
+			          error );
+
+			if( result == 1 )
+			{
+				result = libfplist_archive_decode_dictionary(
+				          internal_archive,
+				          archive_object->object_tag,
+				          archive_object->decoded_tag,
+				          recursion_depth,
+				          error );
+			}
+			break;
+
+		default:
+			result = libfplist_archive_create_decoded_tag(
+			          internal_archive,
+			          (uint8_t *) "dict",
+			          4,
+			          &( archive_object->decoded_tag ),
+			          error );
+
+			if( result == 1 )
+			{
+				result = libfplist_archive_decode_members(
+				          internal_archive,
+				          archive_object->object_tag,
+				          archive_object->decoded_tag,
+				          recursion_depth,
+				          error );
+			}
+			break;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to decode object: %" PRIu64 ".",
+		 function,
+		 uid_value );
+
+		goto on_error;
+	}
+	archive_object->decoding_state = LIBFPLIST_ARCHIVE_DECODING_STATE_DECODED;
+
+	*decoded_tag = archive_object->decoded_tag;
+
+	return( 1 );
+
+on_error:
+	/* The decoded tags are owned by the archive and freed when the archive is freed
+	 */
+	archive_object->decoded_tag    = NULL;
+	archive_object->decoding_state = LIBFPLIST_ARCHIVE_DECODING_STATE_NOT_DECODED;
+
+	return( -1 );
+}
+
+/* Retrieves the number of objects
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_archive_get_number_of_objects(
+     libfplist_archive_t *archive,
+     int *number_of_objects,
+     libcerror_error_t **error )
+{
+	libfplist_internal_archive_t *internal_archive = NULL;
+	static char *function                          = "libfplist_archive_get_number_of_objects";
+
+	if( archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive.",
+		 function );
+
+		return( -1 );
+	}
+	internal_archive = (libfplist_internal_archive_t *) archive;
+
+	if( number_of_objects == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of objects.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_objects = internal_archive->number_of_objects;
+
+	return( 1 );
+}
+
+/* Retrieves the decoded object of a specific UID
+ * The UID values of objects that reference themselves are not decoded
+ * Returns 1 if successful, 0 if the object is $null or -1 on error
+ */
+int libfplist_archive_get_object_by_uid(
+     libfplist_archive_t *archive,
+     uint64_t uid_value,
+     libfplist_property_t **property,
+     libcerror_error_t **error )
+{
+	libfplist_internal_archive_t *internal_archive = NULL;
+	libfplist_xml_tag_t *decoded_tag               = NULL;
+	static char *function                          = "libfplist_archive_get_object_by_uid";
+	int result                                     = 0;
+
+	if( archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive.",
+		 function );
+
+		return( -1 );
+	}
+	internal_archive = (libfplist_internal_archive_t *) archive;
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	if( *property != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid property value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfplist_archive_decode_object(
+	          internal_archive,
+	          uid_value,
+	          0,
+	          &decoded_tag,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to decode object: %" PRIu64 ".",
+		 function,
+		 uid_value );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libfplist_property_initialize(
+		     property,
+		     NULL,
+		     decoded_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create property.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the decoded top-level object of a specific UTF-8 encoded name
+ * Returns 1 if successful, 0 if no such object or -1 on error
+ */
+int libfplist_archive_get_top_object_by_utf8_name(
+     libfplist_archive_t *archive,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfplist_property_t **property,
+     libcerror_error_t **error )
+{
+	libfplist_internal_archive_t *internal_archive = NULL;
+	libfplist_xml_tag_t *decoded_tag               = NULL;
+	libfplist_xml_tag_t *value_tag                 = NULL;
+	static char *function                          = "libfplist_archive_get_top_object_by_utf8_name";
+	int result                                     = 0;
+
+	if( archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive.",
+		 function );
+
+		return( -1 );
+	}
+	internal_archive = (libfplist_internal_archive_t *) archive;
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	if( *property != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid property value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfplist_archive_get_dictionary_value_tag(
+	          internal_archive->top_tag,
+	          utf8_string,
+	          utf8_string_length,
+	          &value_tag,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve top-level value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfplist_archive_decode_element(
+	     internal_archive,
+	     value_tag,
+	     0,
+	     &decoded_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to decode top-level value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_property_initialize(
+	     property,
+	     NULL,
+	     decoded_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create property.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
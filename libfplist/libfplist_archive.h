@@ -0,0 +1,206 @@
+/*
+ * NSKeyedArchiver archive functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFPLIST_ARCHIVE_H )
+#define _LIBFPLIST_ARCHIVE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfplist_extern.h"
+#include "libfplist_libcdata.h"
+#include "libfplist_libcerror.h"
+#include "libfplist_types.h"
+#include "libfplist_xml_tag.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum LIBFPLIST_ARCHIVE_CLASS_TYPES
+{
+	LIBFPLIST_ARCHIVE_CLASS_TYPE_UNKNOWN		= 0,
+	LIBFPLIST_ARCHIVE_CLASS_TYPE_ARRAY		= 1,
+	LIBFPLIST_ARCHIVE_CLASS_TYPE_DATA		= 2,
+	LIBFPLIST_ARCHIVE_CLASS_TYPE_DATE		= 3,
+	LIBFPLIST_ARCHIVE_CLASS_TYPE_DICTIONARY		= 4,
+	LIBFPLIST_ARCHIVE_CLASS_TYPE_OBJECT		= 5,
+	LIBFPLIST_ARCHIVE_CLASS_TYPE_STRING		= 6
+};
+
+enum LIBFPLIST_ARCHIVE_DECODING_STATES
+{
+	LIBFPLIST_ARCHIVE_DECODING_STATE_NOT_DECODED	= 0,
+	LIBFPLIST_ARCHIVE_DECODING_STATE_IN_PROGRESS	= 1,
+	LIBFPLIST_ARCHIVE_DECODING_STATE_DECODED	= 2
+};
+
+typedef struct libfplist_archive_object libfplist_archive_object_t;
+
+struct libfplist_archive_object
+{
+	/* The object XML tag in the $objects array
+	 */
+	libfplist_xml_tag_t *object_tag;
+
+	/* The decoded XML tag
+	 */
+	libfplist_xml_tag_t *decoded_tag;
+
+	/* The decoding state
+	 */
+	uint8_t decoding_state;
+
+	/* The class type, used when the object is referenced as $class
+	 */
+	uint8_t class_type;
+};
+
+typedef struct libfplist_internal_archive libfplist_internal_archive_t;
+
+struct libfplist_internal_archive
+{
+	/* The $top XML tag
+	 */
+	libfplist_xml_tag_t *top_tag;
+
+	/* The objects, where the index of an object is its UID
+	 */
+	libfplist_archive_object_t *objects;
+
+	/* The number of objects
+	 */
+	int number_of_objects;
+
+	/* The XML tags created while decoding, which are owned by the archive
+	 */
+	libcdata_array_t *decoded_tags_array;
+};
+
+LIBFPLIST_EXTERN \
+int libfplist_archive_initialize(
+     libfplist_archive_t **archive,
+     libfplist_property_list_t *property_list,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_archive_free(
+     libfplist_archive_t **archive,
+     libcerror_error_t **error );
+
+int libfplist_archive_get_dictionary_value_tag(
+     libfplist_xml_tag_t *dictionary_tag,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfplist_xml_tag_t **value_tag,
+     libcerror_error_t **error );
+
+int libfplist_archive_get_uid_value(
+     libfplist_xml_tag_t *tag,
+     uint64_t *uid_value,
+     libcerror_error_t **error );
+
+int libfplist_archive_get_class_type(
+     libfplist_internal_archive_t *internal_archive,
+     libfplist_xml_tag_t *object_tag,
+     uint8_t *class_type,
+     libcerror_error_t **error );
+
+int libfplist_archive_create_decoded_tag(
+     libfplist_internal_archive_t *internal_archive,
+     const uint8_t *name,
+     size_t name_length,
+     libfplist_xml_tag_t **decoded_tag,
+     libcerror_error_t **error );
+
+int libfplist_archive_append_decoded_element(
+     libfplist_xml_tag_t *decoded_tag,
+     libfplist_xml_tag_t *element_tag,
+     uint8_t is_key,
+     libcerror_error_t **error );
+
+int libfplist_archive_decode_element(
+     libfplist_internal_archive_t *internal_archive,
+     libfplist_xml_tag_t *element_tag,
+     int recursion_depth,
+     libfplist_xml_tag_t **decoded_tag,
+     libcerror_error_t **error );
+
+int libfplist_archive_decode_date(
+     libfplist_internal_archive_t *internal_archive,
+     libfplist_xml_tag_t *object_tag,
+     libfplist_xml_tag_t **decoded_tag,
+     libcerror_error_t **error );
+
+int libfplist_archive_decode_array(
+     libfplist_internal_archive_t *internal_archive,
+     libfplist_xml_tag_t *object_tag,
+     libfplist_xml_tag_t *decoded_tag,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libfplist_archive_decode_dictionary(
+     libfplist_internal_archive_t *internal_archive,
+     libfplist_xml_tag_t *object_tag,
+     libfplist_xml_tag_t *decoded_tag,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libfplist_archive_decode_members(
+     libfplist_internal_archive_t *internal_archive,
+     libfplist_xml_tag_t *object_tag,
+     libfplist_xml_tag_t *decoded_tag,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libfplist_archive_decode_object(
+     libfplist_internal_archive_t *internal_archive,
+     uint64_t uid_value,
+     int recursion_depth,
+     libfplist_xml_tag_t **decoded_tag,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_archive_get_number_of_objects(
+     libfplist_archive_t *archive,
+     int *number_of_objects,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_archive_get_object_by_uid(
+     libfplist_archive_t *archive,
+     uint64_t uid_value,
+     libfplist_property_t **property,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_archive_get_top_object_by_utf8_name(
+     libfplist_archive_t *archive,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfplist_property_t **property,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFPLIST_ARCHIVE_H ) */
@@ -0,0 +1,882 @@
+/*
+ * Base64 functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( __AVX2__ ) || defined( __SSSE3__ )
+#include <immintrin.h>
+#endif
+
+#include "libfplist_base64.h"
+#include "libfplist_libcerror.h"
+
+#define LIBFPLIST_BASE64_CHARACTER_VALUE_PADDING	0x40
+#define LIBFPLIST_BASE64_CHARACTER_VALUE_WHITESPACE	0x80
+#define LIBFPLIST_BASE64_CHARACTER_VALUE_INVALID	0xff
+
+/* The base64 character values
+ * 0x00 - 0x3f represent the 6-bit value of a character in the base64 alphabet
+ * 0x40 represents the padding character and 0x80 a whitespace character
+ */
+static const uint8_t libfplist_base64_character_values[ 256 ] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0xff, 0xff, 0x3f,
+	0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff,
+	0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+	0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+	0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+
+/* The base64 alphabet
+ */
+static const uint8_t libfplist_base64_alphabet[ 65 ] =
+	"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/* Decodes a base64 stream
+ * Whitespace characters, such as the line breaks and indentation used in XML plists,
+ * are ignored and padding is required
+ * If the byte stream is NULL only the size of the decoded data is determined
+ * Uses AVX2 or SSSE3 to decode consecutive runs of 32 or 16 base64 characters
+ * when available at compile time
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_base64_stream_decode(
+     const uint8_t *base64_stream,
+     size_t base64_stream_size,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *byte_stream_index,
+     libcerror_error_t **error )
+{
+	uint8_t quantum[ 4 ];
+
+#if defined( __AVX2__ ) || defined( __SSSE3__ )
+	uint8_t block_data[ 32 ];
+
+	__m128i hi_nibbles_128bit       = _mm_setzero_si128();
+	__m128i input_128bit            = _mm_setzero_si128();
+	__m128i lo_nibbles_128bit       = _mm_setzero_si128();
+	__m128i output_128bit           = _mm_setzero_si128();
+	__m128i validity_128bit         = _mm_setzero_si128();
+
+	const __m128i lut_lo_128bit     = _mm_setr_epi8(
+	                                   0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	                                   0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a );
+	const __m128i lut_hi_128bit     = _mm_setr_epi8(
+	                                   0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+	                                   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 );
+	const __m128i lut_roll_128bit   = _mm_setr_epi8(
+	                                   0, 16, 19, 4, -65, -65, -71, -71,
+	                                   0, 0, 0, 0, 0, 0, 0, 0 );
+	const __m128i shuffle_128bit    = _mm_setr_epi8(
+	                                   2, 1, 0, 6, 5, 4, 10, 9,
+	                                   8, 14, 13, 12, -1, -1, -1, -1 );
+	const __m128i mask_2f_128bit    = _mm_set1_epi8( 0x2f );
+	const __m128i nibble_mask_128bit = _mm_set1_epi8( 0x0f );
+#endif
+#if defined( __AVX2__ )
+	__m256i hi_nibbles_256bit       = _mm256_setzero_si256();
+	__m256i input_256bit            = _mm256_setzero_si256();
+	__m256i lo_nibbles_256bit       = _mm256_setzero_si256();
+	__m256i output_256bit           = _mm256_setzero_si256();
+	__m256i validity_256bit         = _mm256_setzero_si256();
+
+	const __m256i lut_lo_256bit     = _mm256_broadcastsi128_si256( lut_lo_128bit );
+	const __m256i lut_hi_256bit     = _mm256_broadcastsi128_si256( lut_hi_128bit );
+	const __m256i lut_roll_256bit   = _mm256_broadcastsi128_si256( lut_roll_128bit );
+	const __m256i shuffle_256bit    = _mm256_broadcastsi128_si256( shuffle_128bit );
+	const __m256i permute_256bit    = _mm256_setr_epi32( 0, 1, 2, 4, 5, 6, -1, -1 );
+	const __m256i mask_2f_256bit    = _mm256_set1_epi8( 0x2f );
+	const __m256i nibble_mask_256bit = _mm256_set1_epi8( 0x0f );
+#endif
+	static char *function           = "libfplist_base64_stream_decode";
+	size_t base64_stream_index      = 0;
+	size_t safe_byte_stream_index   = 0;
+	uint8_t character_value         = 0;
+	uint8_t number_of_bytes         = 0;
+	uint8_t padding_size            = 0;
+	int quantum_index               = 0;
+
+	if( ( base64_stream == NULL )
+	 && ( base64_stream_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base64 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( base64_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid base64 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream index.",
+		 function );
+
+		return( -1 );
+	}
+	while( base64_stream_index < base64_stream_size )
+	{
+		if( ( quantum_index == 0 )
+		 && ( padding_size == 0 ) )
+		{
+#if defined( __AVX2__ )
+			/* Decode 32 base64 characters into 24 bytes if none of the characters
+			 * is whitespace, padding or invalid
+			 */
+			if( ( base64_stream_size - base64_stream_index ) >= 32 )
+			{
+				input_256bit = _mm256_loadu_si256(
+				                (__m256i *) &( base64_stream[ base64_stream_index ] ) );
+
+				hi_nibbles_256bit = _mm256_and_si256(
+				                     _mm256_srli_epi32(
+				                      input_256bit,
+				                      4 ),
+				                     nibble_mask_256bit );
+
+				lo_nibbles_256bit = _mm256_and_si256(
+				                     input_256bit,
+				                     nibble_mask_256bit );
+
+				validity_256bit = _mm256_and_si256(
+				                   _mm256_shuffle_epi8(
+				                    lut_lo_256bit,
+				                    lo_nibbles_256bit ),
+				                   _mm256_shuffle_epi8(
+				                    lut_hi_256bit,
+				                    hi_nibbles_256bit ) );
+
+				if( _mm256_testz_si256(
+				     validity_256bit,
+				     validity_256bit ) != 0 )
+				{
+					output_256bit = _mm256_add_epi8(
+					                 input_256bit,
+					                 _mm256_shuffle_epi8(
+					                  lut_roll_256bit,
+					                  _mm256_add_epi8(
+					                   _mm256_cmpeq_epi8(
+					                    input_256bit,
+					                    mask_2f_256bit ),
+					                   hi_nibbles_256bit ) ) );
+
+					output_256bit = _mm256_madd_epi16(
+					                 _mm256_maddubs_epi16(
+					                  output_256bit,
+					                  _mm256_set1_epi32( 0x01400140 ) ),
+					                 _mm256_set1_epi32( 0x00011000 ) );
+
+					output_256bit = _mm256_permutevar8x32_epi32(
+					                 _mm256_shuffle_epi8(
+					                  output_256bit,
+					                  shuffle_256bit ),
+					                 permute_256bit );
+
+					if( byte_stream != NULL )
+					{
+						if( ( byte_stream_size - safe_byte_stream_index ) < 24 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+							 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+							 "%s: byte stream is too small.",
+							 function );
+
+							return( -1 );
+						}
+						if( ( byte_stream_size - safe_byte_stream_index ) >= 32 )
+						{
+							_mm256_storeu_si256(
+							 (__m256i *) &( byte_stream[ safe_byte_stream_index ] ),
+							 output_256bit );
+						}
+						else
+						{
+							_mm256_storeu_si256(
+							 (__m256i *) block_data,
+							 output_256bit );
+
+							memory_copy(
+							 &( byte_stream[ safe_byte_stream_index ] ),
+							 block_data,
+							 24 );
+						}
+					}
+					base64_stream_index    += 32;
+					safe_byte_stream_index += 24;
+
+					continue;
+				}
+			}
+#endif /* defined( __AVX2__ ) */
+
+#if defined( __AVX2__ ) || defined( __SSSE3__ )
+			/* Decode 16 base64 characters into 12 bytes if none of the characters
+			 * is whitespace, padding or invalid
+			 */
+			if( ( base64_stream_size - base64_stream_index ) >= 16 )
+			{
+				input_128bit = _mm_loadu_si128(
+				                (__m128i *) &( base64_stream[ base64_stream_index ] ) );
+
+				hi_nibbles_128bit = _mm_and_si128(
+				                     _mm_srli_epi32(
+				                      input_128bit,
+				                      4 ),
+				                     nibble_mask_128bit );
+
+				lo_nibbles_128bit = _mm_and_si128(
+				                     input_128bit,
+				                     nibble_mask_128bit );
+
+				validity_128bit = _mm_and_si128(
+				                   _mm_shuffle_epi8(
+				                    lut_lo_128bit,
+				                    lo_nibbles_128bit ),
+				                   _mm_shuffle_epi8(
+				                    lut_hi_128bit,
+				                    hi_nibbles_128bit ) );
+
+				if( _mm_movemask_epi8(
+				     _mm_cmpeq_epi8(
+				      validity_128bit,
+				      _mm_setzero_si128() ) ) == 0xffff )
+				{
+					output_128bit = _mm_add_epi8(
+					                 input_128bit,
+					                 _mm_shuffle_epi8(
+					                  lut_roll_128bit,
+					                  _mm_add_epi8(
+					                   _mm_cmpeq_epi8(
+					                    input_128bit,
+					                    mask_2f_128bit ),
+					                   hi_nibbles_128bit ) ) );
+
+					output_128bit = _mm_shuffle_epi8(
+					                 _mm_madd_epi16(
+					                  _mm_maddubs_epi16(
+					                   output_128bit,
+					                   _mm_set1_epi32( 0x01400140 ) ),
+					                  _mm_set1_epi32( 0x00011000 ) ),
+					                 shuffle_128bit );
+
+					if( byte_stream != NULL )
+					{
+						if( ( byte_stream_size - safe_byte_stream_index ) < 12 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+							 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+							 "%s: byte stream is too small.",
+							 function );
+
+							return( -1 );
+						}
+						if( ( byte_stream_size - safe_byte_stream_index ) >= 16 )
+						{
+							_mm_storeu_si128(
+							 (__m128i *) &( byte_stream[ safe_byte_stream_index ] ),
+							 output_128bit );
+						}
+						else
+						{
+							_mm_storeu_si128(
+							 (__m128i *) block_data,
+							 output_128bit );
+
+							memory_copy(
+							 &( byte_stream[ safe_byte_stream_index ] ),
+							 block_data,
+							 12 );
+						}
+					}
+					base64_stream_index    += 16;
+					safe_byte_stream_index += 12;
+
+					continue;
+				}
+			}
+#endif /* defined( __AVX2__ ) || defined( __SSSE3__ ) */
+		}
+		character_value = libfplist_base64_character_values[ base64_stream[ base64_stream_index ] ];
+
+		if( character_value == LIBFPLIST_BASE64_CHARACTER_VALUE_WHITESPACE )
+		{
+			base64_stream_index++;
+
+			continue;
+		}
+		if( character_value == LIBFPLIST_BASE64_CHARACTER_VALUE_INVALID )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid character: 0x%02" PRIx8 " at index: %" PRIzd ".",
+			 function,
+			 base64_stream[ base64_stream_index ],
+			 base64_stream_index );
+
+			return( -1 );
+		}
+		if( character_value == LIBFPLIST_BASE64_CHARACTER_VALUE_PADDING )
+		{
+			/* Padding is only allowed for the last 2 characters of a quantum
+			 */
+			if( quantum_index < 2 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid padding at index: %" PRIzd ".",
+				 function,
+				 base64_stream_index );
+
+				return( -1 );
+			}
+			padding_size   += 1;
+			character_value = 0;
+		}
+		else if( padding_size != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid character after padding at index: %" PRIzd ".",
+			 function,
+			 base64_stream_index );
+
+			return( -1 );
+		}
+		quantum[ quantum_index++ ] = character_value;
+
+		base64_stream_index++;
+
+		if( quantum_index < 4 )
+		{
+			continue;
+		}
+		number_of_bytes = 3 - padding_size;
+
+		if( byte_stream != NULL )
+		{
+			if( ( byte_stream_size - safe_byte_stream_index ) < (size_t) number_of_bytes )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: byte stream is too small.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream[ safe_byte_stream_index ] = (uint8_t) ( ( quantum[ 0 ] << 2 ) | ( quantum[ 1 ] >> 4 ) );
+
+			if( number_of_bytes > 1 )
+			{
+				byte_stream[ safe_byte_stream_index + 1 ] = (uint8_t) ( ( ( quantum[ 1 ] & 0x0f ) << 4 ) | ( quantum[ 2 ] >> 2 ) );
+			}
+			if( number_of_bytes > 2 )
+			{
+				byte_stream[ safe_byte_stream_index + 2 ] = (uint8_t) ( ( ( quantum[ 2 ] & 0x03 ) << 6 ) | quantum[ 3 ] );
+			}
+		}
+		safe_byte_stream_index += number_of_bytes;
+
+		quantum_index = 0;
+	}
+	if( quantum_index != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid base64 stream - missing padding.",
+		 function );
+
+		return( -1 );
+	}
+	*byte_stream_index = safe_byte_stream_index;
+
+	return( 1 );
+}
+
+/* Determines the size of a byte stream from a base64 stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_base64_stream_size_to_byte_stream(
+     const uint8_t *base64_stream,
+     size_t base64_stream_size,
+     size_t *byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_base64_stream_size_to_byte_stream";
+
+	if( libfplist_base64_stream_decode(
+	     base64_stream,
+	     base64_stream_size,
+	     NULL,
+	     0,
+	     byte_stream_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to decode base64 stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies a byte stream from a base64 stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_base64_stream_copy_to_byte_stream(
+     const uint8_t *base64_stream,
+     size_t base64_stream_size,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfplist_base64_stream_copy_to_byte_stream";
+	size_t byte_stream_index = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_base64_stream_decode(
+	     base64_stream,
+	     base64_stream_size,
+	     byte_stream,
+	     byte_stream_size,
+	     &byte_stream_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to decode base64 stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines the size of a base64 stream from a byte stream
+ * The base64 stream is padded and does not contain whitespace
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_base64_stream_size_from_byte_stream(
+     size_t byte_stream_size,
+     size_t *base64_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_base64_stream_size_from_byte_stream";
+
+	if( byte_stream_size > ( ( (size_t) SSIZE_MAX / 4 ) * 3 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( base64_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base64 stream size.",
+		 function );
+
+		return( -1 );
+	}
+	*base64_stream_size = ( ( byte_stream_size + 2 ) / 3 ) * 4;
+
+	return( 1 );
+}
+
+/* Copies a byte stream to a base64 stream
+ * The base64 stream is padded and does not contain whitespace
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_base64_stream_copy_from_byte_stream(
+     uint8_t *base64_stream,
+     size_t base64_stream_size,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfplist_base64_stream_copy_from_byte_stream";
+	size_t base64_stream_index = 0;
+	size_t byte_stream_index   = 0;
+	size_t required_size       = 0;
+	uint32_t value_24bit       = 0;
+
+	if( base64_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base64 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream == NULL )
+	 && ( byte_stream_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_base64_stream_size_from_byte_stream(
+	     byte_stream_size,
+	     &required_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine base64 stream size.",
+		 function );
+
+		return( -1 );
+	}
+	if( base64_stream_size < required_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid base64 stream size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( byte_stream_size - byte_stream_index ) >= 3 )
+	{
+		value_24bit = ( (uint32_t) byte_stream[ byte_stream_index ] << 16 )
+		            | ( (uint32_t) byte_stream[ byte_stream_index + 1 ] << 8 )
+		            | (uint32_t) byte_stream[ byte_stream_index + 2 ];
+
+		base64_stream[ base64_stream_index++ ] = libfplist_base64_alphabet[ ( value_24bit >> 18 ) & 0x3f ];
+		base64_stream[ base64_stream_index++ ] = libfplist_base64_alphabet[ ( value_24bit >> 12 ) & 0x3f ];
+		base64_stream[ base64_stream_index++ ] = libfplist_base64_alphabet[ ( value_24bit >> 6 ) & 0x3f ];
+		base64_stream[ base64_stream_index++ ] = libfplist_base64_alphabet[ value_24bit & 0x3f ];
+
+		byte_stream_index += 3;
+	}
+	if( byte_stream_index < byte_stream_size )
+	{
+		value_24bit = (uint32_t) byte_stream[ byte_stream_index ] << 16;
+
+		if( ( byte_stream_index + 1 ) < byte_stream_size )
+		{
+			value_24bit |= (uint32_t) byte_stream[ byte_stream_index + 1 ] << 8;
+		}
+		base64_stream[ base64_stream_index++ ] = libfplist_base64_alphabet[ ( value_24bit >> 18 ) & 0x3f ];
+		base64_stream[ base64_stream_index++ ] = libfplist_base64_alphabet[ ( value_24bit >> 12 ) & 0x3f ];
+
+		if( ( byte_stream_index + 1 ) < byte_stream_size )
+		{
+			base64_stream[ base64_stream_index++ ] = libfplist_base64_alphabet[ ( value_24bit >> 6 ) & 0x3f ];
+		}
+		else
+		{
+			base64_stream[ base64_stream_index++ ] = (uint8_t) '=';
+		}
+		base64_stream[ base64_stream_index++ ] = (uint8_t) '=';
+	}
+	return( 1 );
+}
+
+/* Determines the checkpoints of a base64 stream
+ * A checkpoint is the index of the base64 character at which a group of
+ * LIBFPLIST_BASE64_CHECKPOINT_INTERVAL significant characters starts and
+ * allows decoding to start at a multiple of LIBFPLIST_BASE64_CHECKPOINT_DATA_SIZE
+ * bytes without decoding the preceding data
+ * The caller is responsible for freeing the checkpoints
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_base64_stream_get_checkpoints(
+     const uint8_t *base64_stream,
+     size_t base64_stream_size,
+     size_t **checkpoints,
+     int *number_of_checkpoints,
+     size_t *byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function                = "libfplist_base64_stream_get_checkpoints";
+	size_t base64_stream_index           = 0;
+	size_t maximum_number_of_checkpoints = 0;
+	size_t number_of_characters          = 0;
+	uint8_t character_value              = 0;
+	uint8_t padding_size                 = 0;
+	int safe_number_of_checkpoints       = 0;
+
+	if( ( base64_stream == NULL )
+	 && ( base64_stream_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base64 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( base64_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid base64 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoints == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoints.",
+		 function );
+
+		return( -1 );
+	}
+	if( *checkpoints != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid checkpoints value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_checkpoints == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of checkpoints.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream size.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_number_of_checkpoints = ( base64_stream_size / LIBFPLIST_BASE64_CHECKPOINT_INTERVAL ) + 1;
+
+	if( maximum_number_of_checkpoints > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( size_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum number of checkpoints value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	*checkpoints = (size_t *) memory_allocate(
+	                           sizeof( size_t ) * maximum_number_of_checkpoints );
+
+	if( *checkpoints == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create checkpoints.",
+		 function );
+
+		goto on_error;
+	}
+	for( base64_stream_index = 0;
+	     base64_stream_index < base64_stream_size;
+	     base64_stream_index++ )
+	{
+		character_value = libfplist_base64_character_values[ base64_stream[ base64_stream_index ] ];
+
+		if( character_value == LIBFPLIST_BASE64_CHARACTER_VALUE_WHITESPACE )
+		{
+			continue;
+		}
+		if( character_value == LIBFPLIST_BASE64_CHARACTER_VALUE_INVALID )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid character: 0x%02" PRIx8 " at index: %" PRIzd ".",
+			 function,
+			 base64_stream[ base64_stream_index ],
+			 base64_stream_index );
+
+			goto on_error;
+		}
+		if( character_value == LIBFPLIST_BASE64_CHARACTER_VALUE_PADDING )
+		{
+			if( ( number_of_characters % 4 ) < 2 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid padding at index: %" PRIzd ".",
+				 function,
+				 base64_stream_index );
+
+				goto on_error;
+			}
+			padding_size += 1;
+		}
+		else if( padding_size != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid character after padding at index: %" PRIzd ".",
+			 function,
+			 base64_stream_index );
+
+			goto on_error;
+		}
+		else if( ( number_of_characters % LIBFPLIST_BASE64_CHECKPOINT_INTERVAL ) == 0 )
+		{
+			( *checkpoints )[ safe_number_of_checkpoints++ ] = base64_stream_index;
+		}
+		number_of_characters++;
+	}
+	if( ( number_of_characters % 4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid base64 stream - missing padding.",
+		 function );
+
+		goto on_error;
+	}
+	*number_of_checkpoints = safe_number_of_checkpoints;
+	*byte_stream_size      = ( ( number_of_characters / 4 ) * 3 ) - padding_size;
+
+	return( 1 );
+
+on_error:
+	if( *checkpoints != NULL )
+	{
+		memory_free(
+		 *checkpoints );
+
+		*checkpoints = NULL;
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,86 @@
+/*
+ * Base64 functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFPLIST_BASE64_H )
+#define _LIBFPLIST_BASE64_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfplist_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of significant base64 characters between checkpoints,
+ * which corresponds to 3072 bytes of decoded data
+ */
+#define LIBFPLIST_BASE64_CHECKPOINT_INTERVAL		4096
+#define LIBFPLIST_BASE64_CHECKPOINT_DATA_SIZE		3072
+
+int libfplist_base64_stream_decode(
+     const uint8_t *base64_stream,
+     size_t base64_stream_size,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *byte_stream_index,
+     libcerror_error_t **error );
+
+int libfplist_base64_stream_size_to_byte_stream(
+     const uint8_t *base64_stream,
+     size_t base64_stream_size,
+     size_t *byte_stream_size,
+     libcerror_error_t **error );
+
+int libfplist_base64_stream_copy_to_byte_stream(
+     const uint8_t *base64_stream,
+     size_t base64_stream_size,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+int libfplist_base64_stream_size_from_byte_stream(
+     size_t byte_stream_size,
+     size_t *base64_stream_size,
+     libcerror_error_t **error );
+
+int libfplist_base64_stream_copy_from_byte_stream(
+     uint8_t *base64_stream,
+     size_t base64_stream_size,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+int libfplist_base64_stream_get_checkpoints(
+     const uint8_t *base64_stream,
+     size_t base64_stream_size,
+     size_t **checkpoints,
+     int *number_of_checkpoints,
+     size_t *byte_stream_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFPLIST_BASE64_H ) */
+
@@ -0,0 +1,4573 @@
+/*
+ * Binary property list parser functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libfplist_binary_parser.h"
+#include "libfplist_date_time.h"
+#include "libfplist_definitions.h"
+#include "libfplist_floating_point.h"
+#include "libfplist_integer.h"
+#include "libfplist_libcdata.h"
+#include "libfplist_libcerror.h"
+#include "libfplist_libcnotify.h"
+#include "libfplist_types.h"
+#include "libfplist_utf16.h"
+#include "libfplist_uuid.h"
+#include "libfplist_xml_tag.h"
+
+/* The number of seconds between January 1, 1970 and January 1, 2001
+ */
+#define LIBFPLIST_BINARY_PARSER_DATE_TIME_EPOCH_OFFSET	978307200
+
+/* Reads a big-endian unsigned integer of 1 to 8 bytes
+ * The caller is expected to have checked the bounds of the data
+ */
+#define libfplist_binary_parser_copy_to_uint64_big_endian( data, data_size, value ) \
+	{ \
+		size_t libfplist_binary_parser_byte_index = 0; \
+		value = 0; \
+		for( libfplist_binary_parser_byte_index = 0; \
+		     libfplist_binary_parser_byte_index < (size_t) data_size; \
+		     libfplist_binary_parser_byte_index++ ) \
+		{ \
+			value <<= 8; \
+			value  |= ( data )[ libfplist_binary_parser_byte_index ]; \
+		} \
+	}
+
+/* Creates a binary parser state
+ * Make sure the value parser_state is referencing, is set to NULL
+ * If the LIBFPLIST_BINARY_PARSER_FLAG_MANAGED_BUFFER flag is set the buffer is copied,
+ * otherwise the buffer is referenced and must remain available while the parser state is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_parser_state_initialize(
+     libfplist_binary_parser_state_t **parser_state,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_binary_parser_state_initialize";
+
+	if( parser_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser state.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parser_state != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid parser state value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size > (size_t) SSIZE_MAX )
+	 || ( buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size < LIBFPLIST_BINARY_PARSER_HEADER_SIZE )
+	 || ( memory_compare(
+	       buffer,
+	       "bplist",
+	       6 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported binary property list signature.",
+		 function );
+
+		return( -1 );
+	}
+	*parser_state = memory_allocate_structure(
+	                 libfplist_binary_parser_state_t );
+
+	if( *parser_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create parser state.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *parser_state,
+	     0,
+	     sizeof( libfplist_binary_parser_state_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parser state.",
+		 function );
+
+		memory_free(
+		 *parser_state );
+
+		*parser_state = NULL;
+
+		return( -1 );
+	}
+	if( ( flags & LIBFPLIST_BINARY_PARSER_FLAG_MANAGED_BUFFER ) != 0 )
+	{
+		( *parser_state )->managed_buffer = (uint8_t *) memory_allocate(
+		                                                 sizeof( uint8_t ) * buffer_size );
+
+		if( ( *parser_state )->managed_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create managed buffer.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *parser_state )->managed_buffer,
+		     buffer,
+		     buffer_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy buffer.",
+			 function );
+
+			goto on_error;
+		}
+		buffer = ( *parser_state )->managed_buffer;
+	}
+	( *parser_state )->buffer    = buffer;
+	( *parser_state )->data_size = buffer_size;
+
+	if( libfplist_binary_parser_read_header(
+	     *parser_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read header.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *parser_state != NULL )
+	{
+		if( ( *parser_state )->managed_buffer != NULL )
+		{
+			memory_free(
+			 ( *parser_state )->managed_buffer );
+		}
+		memory_free(
+		 *parser_state );
+
+		*parser_state = NULL;
+	}
+	return( -1 );
+}
+
+/* Creates a binary parser state that reads the data on demand using a read function
+ * The read function is called with the IO handle and offsets relative to the start of
+ * the binary property list, a libbfio handle can be used with libbfio_handle_read_buffer_at_offset
+ * Only the header, the trailer, the offset table entries and the objects that are accessed are read,
+ * using a small cache of fixed size blocks
+ * Make sure the value parser_state is referencing, is set to NULL
+ * The IO handle must remain available while the parser state is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_parser_state_initialize_with_read_function(
+     libfplist_binary_parser_state_t **parser_state,
+     intptr_t *io_handle,
+     ssize_t (*read_buffer_at_offset)(
+                intptr_t *io_handle,
+                uint8_t *buffer,
+                size_t size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_binary_parser_state_initialize_with_read_function";
+
+	if( parser_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser state.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parser_state != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid parser state value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_buffer_at_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read function.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*parser_state = memory_allocate_structure(
+	                 libfplist_binary_parser_state_t );
+
+	if( *parser_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create parser state.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *parser_state,
+	     0,
+	     sizeof( libfplist_binary_parser_state_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parser state.",
+		 function );
+
+		memory_free(
+		 *parser_state );
+
+		*parser_state = NULL;
+
+		return( -1 );
+	}
+	( *parser_state )->cache_blocks = (libfplist_binary_parser_cache_block_t *) memory_allocate(
+	                                                                              sizeof( libfplist_binary_parser_cache_block_t ) * LIBFPLIST_BINARY_PARSER_CACHE_NUMBER_OF_BLOCKS );
+
+	if( ( *parser_state )->cache_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache blocks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *parser_state )->cache_blocks,
+	     0,
+	     sizeof( libfplist_binary_parser_cache_block_t ) * LIBFPLIST_BINARY_PARSER_CACHE_NUMBER_OF_BLOCKS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache blocks.",
+		 function );
+
+		goto on_error;
+	}
+	( *parser_state )->io_handle             = io_handle;
+	( *parser_state )->read_buffer_at_offset = read_buffer_at_offset;
+	( *parser_state )->data_size             = (size_t) data_size;
+
+	if( libfplist_binary_parser_read_header(
+	     *parser_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read header.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *parser_state != NULL )
+	{
+		libfplist_binary_parser_state_free(
+		 parser_state,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a binary parser state
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_parser_state_free(
+     libfplist_binary_parser_state_t **parser_state,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_binary_parser_state_free";
+
+	if( parser_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser state.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parser_state != NULL )
+	{
+		if( ( *parser_state )->read_buffer != NULL )
+		{
+			memory_free(
+			 ( *parser_state )->read_buffer );
+		}
+		if( ( *parser_state )->cache_blocks != NULL )
+		{
+			memory_free(
+			 ( *parser_state )->cache_blocks );
+		}
+		if( ( *parser_state )->managed_buffer != NULL )
+		{
+			memory_free(
+			 ( *parser_state )->managed_buffer );
+		}
+		memory_free(
+		 *parser_state );
+
+		*parser_state = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads data from the binary property list
+ * The data is either referenced in the buffer or read using the read function,
+ * in which case it remains valid until the next read
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_parser_read_data(
+     libfplist_binary_parser_state_t *parser_state,
+     uint64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	libfplist_binary_parser_cache_block_t *cache_block = NULL;
+	uint8_t *read_buffer                               = NULL;
+	static char *function                              = "libfplist_binary_parser_read_data";
+	size_t read_size                                   = 0;
+	ssize_t read_count                                 = 0;
+	uint64_t block_offset                              = 0;
+
+	if( parser_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parser_state->buffer == NULL )
+	 && ( parser_state->read_buffer_at_offset == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid parser state - missing buffer and read function.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset > (uint64_t) parser_state->data_size )
+	 || ( size > ( parser_state->data_size - (size_t) offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset or size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( parser_state->buffer != NULL )
+	{
+		*data = &( parser_state->buffer[ offset ] );
+
+		return( 1 );
+	}
+	block_offset = offset - ( offset % LIBFPLIST_BINARY_PARSER_CACHE_BLOCK_SIZE );
+
+	if( ( parser_state->cache_blocks != NULL )
+	 && ( ( offset - block_offset ) + size <= LIBFPLIST_BINARY_PARSER_CACHE_BLOCK_SIZE ) )
+	{
+		/* The cache is direct mapped, every block can only be stored in one cache block
+		 */
+		cache_block = &( parser_state->cache_blocks[ ( block_offset / LIBFPLIST_BINARY_PARSER_CACHE_BLOCK_SIZE ) % LIBFPLIST_BINARY_PARSER_CACHE_NUMBER_OF_BLOCKS ] );
+
+		if( ( cache_block->data_size == 0 )
+		 || ( cache_block->offset != block_offset ) )
+		{
+			read_size = parser_state->data_size - (size_t) block_offset;
+
+			if( read_size > LIBFPLIST_BINARY_PARSER_CACHE_BLOCK_SIZE )
+			{
+				read_size = LIBFPLIST_BINARY_PARSER_CACHE_BLOCK_SIZE;
+			}
+			cache_block->data_size = 0;
+
+			read_count = parser_state->read_buffer_at_offset(
+			              parser_state->io_handle,
+			              cache_block->data,
+			              read_size,
+			              (off64_t) block_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read block at offset: %" PRIu64 " (0x%08" PRIx64 ").",
+				 function,
+				 block_offset,
+				 block_offset );
+
+				return( -1 );
+			}
+			cache_block->offset    = block_offset;
+			cache_block->data_size = read_size;
+		}
+		*data = &( cache_block->data[ offset - block_offset ] );
+
+		return( 1 );
+	}
+	if( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Data that does not fit in a cache block is read into the read buffer
+	 */
+	if( size > parser_state->read_buffer_size )
+	{
+		read_buffer = (uint8_t *) memory_reallocate(
+		                           parser_state->read_buffer,
+		                           sizeof( uint8_t ) * size );
+
+		if( read_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize read buffer.",
+			 function );
+
+			return( -1 );
+		}
+		parser_state->read_buffer      = read_buffer;
+		parser_state->read_buffer_size = size;
+	}
+	read_count = parser_state->read_buffer_at_offset(
+	              parser_state->io_handle,
+	              parser_state->read_buffer,
+	              size,
+	              (off64_t) offset,
+	              error );
+
+	if( read_count != (ssize_t) size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data at offset: %" PRIu64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	*data = parser_state->read_buffer;
+
+	return( 1 );
+}
+
+/* Reads the binary property list header
+ * A bplist00 property list is followed by reading the trailer. A bplist15, bplist16
+ * or bplist17 property list has no offset table and trailer, instead the header is
+ * followed by the size of the property list as an integer object, the CRC-32 as
+ * a 4-byte integer object and the root object, with the elements of arrays, sets
+ * and dicts stored inline
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_parser_read_header(
+     libfplist_binary_parser_state_t *parser_state,
+     libcerror_error_t **error )
+{
+	const uint8_t *header_data = NULL;
+	static char *function      = "libfplist_binary_parser_read_header";
+	size_t header_data_offset  = 0;
+	uint64_t data_size         = 0;
+	uint8_t integer_marker     = 0;
+	uint8_t integer_size       = 0;
+
+	if( parser_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parser_state->buffer == NULL )
+	 && ( parser_state->read_buffer_at_offset == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid parser state - missing buffer and read function.",
+		 function );
+
+		return( -1 );
+	}
+	if( parser_state->data_size < LIBFPLIST_BINARY_PARSER_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported binary property list signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_binary_parser_read_data(
+	     parser_state,
+	     0,
+	     LIBFPLIST_BINARY_PARSER_HEADER_SIZE,
+	     &header_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read header data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     header_data,
+	     "bplist",
+	     6 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported binary property list signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( header_data[ 6 ] == (uint8_t) '0' )
+	 && ( header_data[ 7 ] == (uint8_t) '0' ) )
+	{
+		parser_state->format_version = 0;
+	}
+	else if( ( header_data[ 6 ] == (uint8_t) '1' )
+	      && ( header_data[ 7 ] >= (uint8_t) '5' )
+	      && ( header_data[ 7 ] <= (uint8_t) '7' ) )
+	{
+		parser_state->format_version = 10 + header_data[ 7 ] - (uint8_t) '0';
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported binary property list format version.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: format version\t\t\t: %" PRIu8 "\n",
+		 function,
+		 parser_state->format_version );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( parser_state->format_version == 0 )
+	{
+		if( libfplist_binary_parser_read_trailer(
+		     parser_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read trailer.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	/* The smallest bplist1x consists of the header, a 1-byte size integer object,
+	 * the CRC-32 integer object and a 1-byte root object
+	 */
+	if( parser_state->data_size < ( LIBFPLIST_BINARY_PARSER_HEADER_SIZE + 2 + 5 + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid parser state - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	header_data_offset = LIBFPLIST_BINARY_PARSER_HEADER_SIZE;
+
+	if( libfplist_binary_parser_read_data(
+	     parser_state,
+	     (uint64_t) header_data_offset,
+	     1,
+	     &header_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data size integer marker.",
+		 function );
+
+		return( -1 );
+	}
+	integer_marker = header_data[ 0 ];
+
+	if( ( ( integer_marker & 0xf0 ) != 0x10 )
+	 || ( ( integer_marker & 0x0f ) > 3 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported data size integer marker: 0x%02" PRIx8 ".",
+		 function,
+		 integer_marker );
+
+		return( -1 );
+	}
+	integer_size        = (uint8_t) ( 1 << ( integer_marker & 0x0f ) );
+	header_data_offset += 1;
+
+	if( (size_t) integer_size > ( parser_state->data_size - header_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size integer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_binary_parser_read_data(
+	     parser_state,
+	     (uint64_t) header_data_offset,
+	     (size_t) integer_size,
+	     &header_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data size integer.",
+		 function );
+
+		return( -1 );
+	}
+	libfplist_binary_parser_copy_to_uint64_big_endian(
+	 header_data,
+	 integer_size,
+	 data_size );
+
+	header_data_offset += integer_size;
+
+	/* The CRC-32 is followed by at least the root object
+	 */
+	if( ( data_size > (uint64_t) parser_state->data_size )
+	 || ( data_size < (uint64_t) ( header_data_offset + 5 + 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_binary_parser_read_data(
+	     parser_state,
+	     (uint64_t) header_data_offset,
+	     5,
+	     &header_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read CRC-32 integer.",
+		 function );
+
+		return( -1 );
+	}
+	if( header_data[ 0 ] != 0x12 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported CRC-32 integer marker: 0x%02" PRIx8 ".",
+		 function,
+		 header_data[ 0 ] );
+
+		return( -1 );
+	}
+	/* The CRC-32 value is not verified
+	 */
+	header_data_offset += 5;
+
+	/* The objects are stored up to the end of the property list
+	 */
+	parser_state->offset_table_offset = data_size;
+	parser_state->root_object_offset  = header_data_offset;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: data size\t\t\t: %" PRIu64 "\n",
+		 function,
+		 data_size );
+
+		libcnotify_printf(
+		 "%s: root object offset\t\t: %" PRIzd "\n",
+		 function,
+		 parser_state->root_object_offset );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	return( 1 );
+}
+
+/* Reads the binary property list trailer
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_parser_read_trailer(
+     libfplist_binary_parser_state_t *parser_state,
+     libcerror_error_t **error )
+{
+	const uint8_t *trailer_data           = NULL;
+	static char *function                 = "libfplist_binary_parser_read_trailer";
+	uint64_t maximum_number_of_references = 0;
+	uint64_t maximum_offset_table         = 0;
+
+	if( parser_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parser_state->buffer == NULL )
+	 && ( parser_state->read_buffer_at_offset == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid parser state - missing buffer and read function.",
+		 function );
+
+		return( -1 );
+	}
+	if( parser_state->data_size < ( LIBFPLIST_BINARY_PARSER_HEADER_SIZE + 1 + LIBFPLIST_BINARY_PARSER_TRAILER_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid parser state - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_binary_parser_read_data(
+	     parser_state,
+	     (uint64_t) ( parser_state->data_size - LIBFPLIST_BINARY_PARSER_TRAILER_SIZE ),
+	     LIBFPLIST_BINARY_PARSER_TRAILER_SIZE,
+	     &trailer_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read trailer data.",
+		 function );
+
+		return( -1 );
+	}
+
+	parser_state->offset_size           = trailer_data[ 6 ];
+	parser_state->object_reference_size = trailer_data[ 7 ];
+
+	byte_stream_copy_to_uint64_big_endian(
+	 &( trailer_data[ 8 ] ),
+	 parser_state->number_of_objects );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 &( trailer_data[ 16 ] ),
+	 parser_state->root_object );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 &( trailer_data[ 24 ] ),
+	 parser_state->offset_table_offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: offset size\t\t\t: %" PRIu8 "\n",
+		 function,
+		 parser_state->offset_size );
+
+		libcnotify_printf(
+		 "%s: object reference size\t\t: %" PRIu8 "\n",
+		 function,
+		 parser_state->object_reference_size );
+
+		libcnotify_printf(
+		 "%s: number of objects\t\t: %" PRIu64 "\n",
+		 function,
+		 parser_state->number_of_objects );
+
+		libcnotify_printf(
+		 "%s: root object\t\t\t: %" PRIu64 "\n",
+		 function,
+		 parser_state->root_object );
+
+		libcnotify_printf(
+		 "%s: offset table offset\t\t: %" PRIu64 "\n",
+		 function,
+		 parser_state->offset_table_offset );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( ( parser_state->offset_size == 0 )
+	 || ( parser_state->offset_size > 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported offset size: %" PRIu8 ".",
+		 function,
+		 parser_state->offset_size );
+
+		return( -1 );
+	}
+	if( ( parser_state->object_reference_size == 0 )
+	 || ( parser_state->object_reference_size > 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported object reference size: %" PRIu8 ".",
+		 function,
+		 parser_state->object_reference_size );
+
+		return( -1 );
+	}
+	/* The object table is stored between the header and the offset table
+	 */
+	if( ( parser_state->offset_table_offset <= LIBFPLIST_BINARY_PARSER_HEADER_SIZE )
+	 || ( parser_state->offset_table_offset > (uint64_t) ( parser_state->data_size - LIBFPLIST_BINARY_PARSER_TRAILER_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset table offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_offset_table = (uint64_t) ( parser_state->data_size - LIBFPLIST_BINARY_PARSER_TRAILER_SIZE ) - parser_state->offset_table_offset;
+
+	if( ( parser_state->number_of_objects == 0 )
+	 || ( parser_state->number_of_objects > ( maximum_offset_table / parser_state->offset_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of objects value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( parser_state->root_object >= parser_state->number_of_objects )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid root object value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The object references are stored between the header and the offset table,
+	 * hence the object graph is allowed to expand into a small multiple of the size
+	 * of the binary property list rather than exponentially in its number of objects
+	 */
+	maximum_number_of_references = ( parser_state->offset_table_offset - LIBFPLIST_BINARY_PARSER_HEADER_SIZE ) / parser_state->object_reference_size;
+
+	parser_state->maximum_number_of_expanded_objects = LIBFPLIST_BINARY_PARSER_MAXIMUM_EXPANSION_FACTOR
+	                                                 * ( parser_state->number_of_objects + maximum_number_of_references );
+
+	if( parser_state->maximum_number_of_expanded_objects > LIBFPLIST_BINARY_PARSER_MAXIMUM_NUMBER_OF_EXPANDED_OBJECTS )
+	{
+		parser_state->maximum_number_of_expanded_objects = LIBFPLIST_BINARY_PARSER_MAXIMUM_NUMBER_OF_EXPANDED_OBJECTS;
+	}
+	return( 1 );
+}
+
+/* Retrieves the offset of an object from the offset table
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_parser_get_object_offset(
+     libfplist_binary_parser_state_t *parser_state,
+     uint64_t object_index,
+     size_t *object_offset,
+     libcerror_error_t **error )
+{
+	const uint8_t *offset_data  = NULL;
+	static char *function       = "libfplist_binary_parser_get_object_offset";
+	uint64_t safe_object_offset = 0;
+
+	if( parser_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parser_state->buffer == NULL )
+	 && ( parser_state->read_buffer_at_offset == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid parser state - missing buffer and read function.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_index >= parser_state->number_of_objects )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid object index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_binary_parser_read_data(
+	     parser_state,
+	     parser_state->offset_table_offset + ( object_index * parser_state->offset_size ),
+	     (size_t) parser_state->offset_size,
+	     &offset_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read object: %" PRIu64 " offset data.",
+		 function,
+		 object_index );
+
+		return( -1 );
+	}
+	libfplist_binary_parser_copy_to_uint64_big_endian(
+	 offset_data,
+	 parser_state->offset_size,
+	 safe_object_offset );
+
+	if( ( safe_object_offset < LIBFPLIST_BINARY_PARSER_HEADER_SIZE )
+	 || ( safe_object_offset >= parser_state->offset_table_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid object: %" PRIu64 " offset value out of bounds.",
+		 function,
+		 object_index );
+
+		return( -1 );
+	}
+	*object_offset = (size_t) safe_object_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the object index of an object reference
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_parser_get_object_reference(
+     libfplist_binary_parser_state_t *parser_state,
+     size_t reference_offset,
+     uint64_t *object_index,
+     libcerror_error_t **error )
+{
+	const uint8_t *reference_data = NULL;
+	static char *function         = "libfplist_binary_parser_get_object_reference";
+	uint64_t safe_object_index    = 0;
+
+	if( parser_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parser_state->buffer == NULL )
+	 && ( parser_state->read_buffer_at_offset == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid parser state - missing buffer and read function.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (uint64_t) reference_offset >= parser_state->offset_table_offset )
+	 || ( (uint64_t) parser_state->object_reference_size > ( parser_state->offset_table_offset - reference_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid reference offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_binary_parser_read_data(
+	     parser_state,
+	     (uint64_t) reference_offset,
+	     (size_t) parser_state->object_reference_size,
+	     &reference_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read object reference data.",
+		 function );
+
+		return( -1 );
+	}
+	libfplist_binary_parser_copy_to_uint64_big_endian(
+	 reference_data,
+	 parser_state->object_reference_size,
+	 safe_object_index );
+
+	if( safe_object_index >= parser_state->number_of_objects )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid object reference value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*object_index = safe_object_index;
+
+	return( 1 );
+}
+
+/* Determines if an object is a null object
+ * Returns 1 if the object is a null object, 0 if not or -1 on error
+ */
+int libfplist_binary_parser_object_is_null(
+     libfplist_binary_parser_state_t *parser_state,
+     uint64_t object_index,
+     libcerror_error_t **error )
+{
+	const uint8_t *object_data = NULL;
+	static char *function      = "libfplist_binary_parser_object_is_null";
+	size_t object_offset       = 0;
+
+	if( libfplist_binary_parser_get_object_offset(
+	     parser_state,
+	     object_index,
+	     &object_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve object: %" PRIu64 " offset.",
+		 function,
+		 object_index );
+
+		return( -1 );
+	}
+	if( libfplist_binary_parser_read_data(
+	     parser_state,
+	     (uint64_t) object_offset,
+	     1,
+	     &object_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read object marker at offset: %" PRIzd ".",
+		 function,
+		 object_offset );
+
+		return( -1 );
+	}
+	if( object_data[ 0 ] == 0x00 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the size and data offset of an object, where the size is stored in
+ * the lower 4 bits of the object marker or in a subsequent integer object if
+ * the lower 4 bits are 0xf
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_parser_get_object_size(
+     libfplist_binary_parser_state_t *parser_state,
+     size_t object_offset,
+     size_t *object_data_offset,
+     uint64_t *object_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *object_data = NULL;
+	static char *function      = "libfplist_binary_parser_get_object_size";
+	uint64_t safe_object_size  = 0;
+	uint8_t integer_marker     = 0;
+	uint8_t integer_size       = 0;
+
+	if( parser_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parser_state->buffer == NULL )
+	 && ( parser_state->read_buffer_at_offset == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid parser state - missing buffer and read function.",
+		 function );
+
+		return( -1 );
+	}
+	if( (uint64_t) object_offset >= parser_state->offset_table_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid object offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_binary_parser_read_data(
+	     parser_state,
+	     (uint64_t) object_offset,
+	     1,
+	     &object_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read object marker.",
+		 function );
+
+		return( -1 );
+	}
+	safe_object_size = object_data[ 0 ] & 0x0f;
+
+	object_offset += 1;
+
+	if( safe_object_size == 0x0f )
+	{
+		if( (uint64_t) object_offset >= parser_state->offset_table_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid object size integer offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfplist_binary_parser_read_data(
+		     parser_state,
+		     (uint64_t) object_offset,
+		     1,
+		     &object_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read object size integer marker.",
+			 function );
+
+			return( -1 );
+		}
+		integer_marker = object_data[ 0 ];
+
+		if( ( integer_marker & 0xf0 ) != 0x10 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported object size integer marker: 0x%02" PRIx8 ".",
+			 function,
+			 integer_marker );
+
+			return( -1 );
+		}
+		if( ( integer_marker & 0x0f ) > 3 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported object size integer size.",
+			 function );
+
+			return( -1 );
+		}
+		integer_size   = (uint8_t) ( 1 << ( integer_marker & 0x0f ) );
+		object_offset += 1;
+
+		if( (uint64_t) integer_size > ( parser_state->offset_table_offset - object_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid object size integer size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfplist_binary_parser_read_data(
+		     parser_state,
+		     (uint64_t) object_offset,
+		     (size_t) integer_size,
+		     &object_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read object size integer.",
+			 function );
+
+			return( -1 );
+		}
+		libfplist_binary_parser_copy_to_uint64_big_endian(
+		 object_data,
+		 integer_size,
+		 safe_object_size );
+
+		object_offset += integer_size;
+	}
+	*object_data_offset = object_offset;
+	*object_size        = safe_object_size;
+
+	return( 1 );
+}
+
+/* Reads an object at a specific offset and creates a corresponding tag
+ * If is_key is set the object must be a string and a key tag is created
+ * The elements of a bplist00 array or dict are read on demand using the object index,
+ * the elements of a bplist1x array, set or dict are stored inline and read directly
+ * The object end offset is set to the offset directly after a bplist1x object
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_parser_read_object_at_offset(
+     libfplist_binary_parser_state_t *parser_state,
+     size_t object_offset,
+     uint64_t object_index,
+     uint8_t is_key,
+     int recursion_depth,
+     libfplist_xml_tag_t **tag,
+     size_t *object_end_offset,
+     libcerror_error_t **error )
+{
+	uint8_t value_string[ LIBFPLIST_INTEGER_UTF8_STRING_SIZE ];
+
+	libfplist_xml_tag_t *element_tag = NULL;
+	libfplist_xml_tag_t *object_tag  = NULL;
+	const uint8_t *object_data       = NULL;
+	uint8_t *value_data              = NULL;
+	const char *tag_name             = NULL;
+	static char *function            = "libfplist_binary_parser_read_object_at_offset";
+	size_t object_data_offset        = 0;
+	size_t safe_object_end_offset    = 0;
+	size_t value_data_size           = 0;
+	size_t value_string_length       = 0;
+	uint64_t lower_64bit             = 0;
+	uint64_t maximum_object_size     = 0;
+	uint64_t object_size             = 0;
+	uint64_t upper_64bit             = 0;
+	uint32_t nanoseconds             = 0;
+	uint32_t value_32bit             = 0;
+	int64_t posix_time               = 0;
+	double floating_point_value      = 0.0;
+	float single_precision_value     = 0.0f;
+	uint8_t is_negative              = 0;
+	uint8_t object_marker            = 0;
+	int element_index                = 0;
+	int result                       = 0;
+
+	if( parser_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parser_state->buffer == NULL )
+	 && ( parser_state->read_buffer_at_offset == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid parser state - missing buffer and read function.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( *tag != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid tag value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( (uint64_t) object_offset >= parser_state->offset_table_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid object offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFPLIST_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_end_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object end offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_binary_parser_read_data(
+	     parser_state,
+	     (uint64_t) object_offset,
+	     1,
+	     &object_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read object marker at offset: %" PRIzd ".",
+		 function,
+		 object_offset );
+
+		goto on_error;
+	}
+	object_marker          = object_data[ 0 ];
+	object_data_offset     = object_offset + 1;
+	safe_object_end_offset = object_data_offset;
+
+	/* Objects cannot extend into the offset table
+	 */
+	maximum_object_size = parser_state->offset_table_offset - object_data_offset;
+
+	/* A bplist1x key can also be an UTF-8 string
+	 */
+	if( ( is_key != 0 )
+	 && ( ( object_marker & 0xf0 ) != 0x50 )
+	 && ( ( object_marker & 0xf0 ) != 0x60 )
+	 && ( ( ( object_marker & 0xf0 ) != 0x70 )
+	  || ( parser_state->format_version == 0 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported key object marker: 0x%02" PRIx8 ".",
+		 function,
+		 object_marker );
+
+		goto on_error;
+	}
+	switch( object_marker & 0xf0 )
+	{
+		case 0x00:
+			if( object_marker == 0x08 )
+			{
+				tag_name = "false";
+			}
+			else if( object_marker == 0x09 )
+			{
+				tag_name = "true";
+			}
+			else if( parser_state->format_version != 0 )
+			{
+				/* A bplist1x URL and UUID are represented as a string,
+				 * an URL with a base URL as a dict
+				 */
+				if( ( object_marker == 0x0c )
+				 || ( object_marker == 0x0e ) )
+				{
+					tag_name = "string";
+				}
+				else if( object_marker == 0x0d )
+				{
+					tag_name = "dict";
+				}
+			}
+			break;
+
+		case 0x10:
+			if( ( object_marker & 0x0f ) <= 4 )
+			{
+				tag_name = "integer";
+			}
+			break;
+
+		case 0x20:
+			if( ( object_marker == 0x22 )
+			 || ( object_marker == 0x23 ) )
+			{
+				tag_name = "real";
+			}
+			break;
+
+		case 0x30:
+			if( object_marker == 0x33 )
+			{
+				tag_name = "date";
+			}
+			break;
+
+		case 0x40:
+			tag_name = "data";
+			break;
+
+		case 0x50:
+		case 0x60:
+		case 0x70:
+			if( ( ( object_marker & 0xf0 ) == 0x70 )
+			 && ( parser_state->format_version == 0 ) )
+			{
+				break;
+			}
+			if( is_key != 0 )
+			{
+				tag_name = "key";
+			}
+			else
+			{
+				tag_name = "string";
+			}
+			break;
+
+		case 0x80:
+			if( ( object_marker & 0x0f ) <= 7 )
+			{
+				tag_name = "dict";
+			}
+			break;
+
+		case 0xa0:
+		case 0xc0:
+			tag_name = "array";
+			break;
+
+		case 0xb0:
+			/* A bplist1x ordered set is represented as an array
+			 */
+			if( parser_state->format_version != 0 )
+			{
+				tag_name = "array";
+			}
+			break;
+
+		case 0xd0:
+			tag_name = "dict";
+			break;
+
+		default:
+			break;
+	}
+	if( tag_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported object marker: 0x%02" PRIx8 ".",
+		 function,
+		 object_marker );
+
+		goto on_error;
+	}
+	if( libfplist_xml_tag_initialize(
+	     &object_tag,
+	     (uint8_t *) tag_name,
+	     narrow_string_length(
+	      tag_name ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create %s tag.",
+		 function,
+		 tag_name );
+
+		goto on_error;
+	}
+	switch( object_marker & 0xf0 )
+	{
+		case 0x00:
+			if( object_marker != 0x0e )
+			{
+				break;
+			}
+			object_size = 16;
+
+			if( object_size > maximum_object_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid UUID object size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfplist_binary_parser_read_data(
+			     parser_state,
+			     (uint64_t) object_data_offset,
+			     (size_t) object_size,
+			     &object_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read UUID object data.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfplist_uuid_copy_to_utf8_string(
+			     object_data,
+			     (size_t) object_size,
+			     value_string,
+			     LIBFPLIST_INTEGER_UTF8_STRING_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UUID value to string.",
+				 function );
+
+				goto on_error;
+			}
+			safe_object_end_offset = object_data_offset + (size_t) object_size;
+
+			break;
+
+		case 0x10:
+			object_size = (uint64_t) 1 << ( object_marker & 0x0f );
+
+			if( object_size > maximum_object_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid integer object size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfplist_binary_parser_read_data(
+			     parser_state,
+			     (uint64_t) object_data_offset,
+			     (size_t) object_size,
+			     &object_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read integer object data.",
+				 function );
+
+				goto on_error;
+			}
+			/* 1, 2 and 4 byte integers are unsigned, 8 and 16 byte integers are signed
+			 */
+			if( object_size == 16 )
+			{
+				byte_stream_copy_to_uint64_big_endian(
+				 object_data,
+				 upper_64bit );
+
+				byte_stream_copy_to_uint64_big_endian(
+				 &( object_data[ 8 ] ),
+				 lower_64bit );
+			}
+			else
+			{
+				libfplist_binary_parser_copy_to_uint64_big_endian(
+				 object_data,
+				 object_size,
+				 lower_64bit );
+
+				if( ( object_size == 8 )
+				 && ( ( lower_64bit & 0x8000000000000000ULL ) != 0 ) )
+				{
+					upper_64bit = 0xffffffffffffffffULL;
+				}
+			}
+			if( ( upper_64bit & 0x8000000000000000ULL ) != 0 )
+			{
+				is_negative = 1;
+				upper_64bit = ~upper_64bit;
+				lower_64bit = ~lower_64bit + 1;
+
+				if( lower_64bit == 0 )
+				{
+					upper_64bit += 1;
+				}
+			}
+			if( libfplist_integer_copy_to_utf8_string(
+			     upper_64bit,
+			     lower_64bit,
+			     is_negative,
+			     value_string,
+			     LIBFPLIST_INTEGER_UTF8_STRING_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy integer value to string.",
+				 function );
+
+				goto on_error;
+			}
+			safe_object_end_offset = object_data_offset + (size_t) object_size;
+
+			break;
+
+		case 0x20:
+			object_size = (uint64_t) 1 << ( object_marker & 0x0f );
+
+			if( object_size > maximum_object_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid floating point object size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfplist_binary_parser_read_data(
+			     parser_state,
+			     (uint64_t) object_data_offset,
+			     (size_t) object_size,
+			     &object_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read floating point object data.",
+				 function );
+
+				goto on_error;
+			}
+			if( object_size == 4 )
+			{
+				byte_stream_copy_to_uint32_big_endian(
+				 object_data,
+				 value_32bit );
+
+				memory_copy(
+				 &single_precision_value,
+				 &value_32bit,
+				 sizeof( float ) );
+
+				floating_point_value = (double) single_precision_value;
+			}
+			else
+			{
+				byte_stream_copy_to_uint64_big_endian(
+				 object_data,
+				 lower_64bit );
+
+				memory_copy(
+				 &floating_point_value,
+				 &lower_64bit,
+				 sizeof( double ) );
+			}
+			if( libfplist_floating_point_copy_to_utf8_string(
+			     floating_point_value,
+			     value_string,
+			     LIBFPLIST_FLOATING_POINT_UTF8_STRING_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy floating point value to string.",
+				 function );
+
+				goto on_error;
+			}
+			safe_object_end_offset = object_data_offset + (size_t) object_size;
+
+			break;
+
+		case 0x30:
+			if( maximum_object_size < 8 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid date and time object size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfplist_binary_parser_read_data(
+			     parser_state,
+			     (uint64_t) object_data_offset,
+			     8,
+			     &object_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read date and time object data.",
+				 function );
+
+				goto on_error;
+			}
+			byte_stream_copy_to_uint64_big_endian(
+			 object_data,
+			 lower_64bit );
+
+			memory_copy(
+			 &floating_point_value,
+			 &lower_64bit,
+			 sizeof( double ) );
+
+			/* The date and time value is stored as the number of seconds since January 1, 2001
+			 * Values that are not a number or outside the supported range fail the comparison
+			 */
+			if( !( ( floating_point_value > -1.0e12 )
+			    && ( floating_point_value < 1.0e12 ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported date and time value.",
+				 function );
+
+				goto on_error;
+			}
+			posix_time = (int64_t) floating_point_value;
+
+			if( (double) posix_time > floating_point_value )
+			{
+				posix_time -= 1;
+			}
+			nanoseconds = (uint32_t) ( ( floating_point_value - (double) posix_time ) * 1000000000.0 );
+
+			if( nanoseconds > 999999999UL )
+			{
+				nanoseconds = 999999999UL;
+			}
+			posix_time += LIBFPLIST_BINARY_PARSER_DATE_TIME_EPOCH_OFFSET;
+
+			result = libfplist_date_time_copy_to_utf8_string(
+			          posix_time,
+			          nanoseconds,
+			          value_string,
+			          LIBFPLIST_DATE_TIME_UTF8_STRING_SIZE,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy date and time value to string.",
+				 function );
+
+				goto on_error;
+			}
+			safe_object_end_offset = object_data_offset + 8;
+
+			break;
+
+		case 0x80:
+			object_size = (uint64_t) ( object_marker & 0x0f ) + 1;
+
+			if( object_size > maximum_object_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid UID object size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfplist_binary_parser_read_data(
+			     parser_state,
+			     (uint64_t) object_data_offset,
+			     (size_t) object_size,
+			     &object_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read UID object data.",
+				 function );
+
+				goto on_error;
+			}
+			libfplist_binary_parser_copy_to_uint64_big_endian(
+			 object_data,
+			 object_size,
+			 lower_64bit );
+
+			if( libfplist_integer_copy_to_utf8_string(
+			     0,
+			     lower_64bit,
+			     0,
+			     value_string,
+			     LIBFPLIST_INTEGER_UTF8_STRING_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UID value to string.",
+				 function );
+
+				goto on_error;
+			}
+			safe_object_end_offset = object_data_offset + (size_t) object_size;
+
+			break;
+
+		case 0x40:
+		case 0x50:
+		case 0x60:
+		case 0x70:
+		case 0xa0:
+		case 0xb0:
+		case 0xc0:
+		case 0xd0:
+			if( libfplist_binary_parser_get_object_size(
+			     parser_state,
+			     object_offset,
+			     &object_data_offset,
+			     &object_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve object size at offset: %" PRIzd ".",
+				 function,
+				 object_offset );
+
+				goto on_error;
+			}
+			maximum_object_size    = parser_state->offset_table_offset - object_data_offset;
+			safe_object_end_offset = object_data_offset;
+
+			break;
+
+		default:
+			break;
+	}
+	switch( object_marker & 0xf0 )
+	{
+		case 0x00:
+			if( object_marker == 0x0c )
+			{
+				/* A bplist1x URL is followed by its string object
+				 */
+				if( libfplist_binary_parser_read_inline_object(
+				     parser_state,
+				     &safe_object_end_offset,
+				     0,
+				     recursion_depth + 1,
+				     &element_tag,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read URL string object.",
+					 function );
+
+					goto on_error;
+				}
+				result = libfplist_xml_tag_compare_name(
+				          element_tag,
+				          (uint8_t *) "string",
+				          6,
+				          error );
+
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported URL string object.",
+					 function );
+
+					goto on_error;
+				}
+				if( libfplist_xml_tag_set_value(
+				     object_tag,
+				     element_tag->value,
+				     element_tag->value_size - 1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set %s tag value.",
+					 function,
+					 tag_name );
+
+					goto on_error;
+				}
+				if( libfplist_xml_tag_free(
+				     &element_tag,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free URL string tag.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			else if( object_marker == 0x0d )
+			{
+				/* A bplist1x URL with a base URL is followed by the base URL object
+				 * and the relative URL string object and represented as it would
+				 * be by NSKeyedArchiver: <dict><key>NS.base</key>...<key>NS.relative</key>...</dict>
+				 */
+				for( element_index = 0;
+				     element_index < 2;
+				     element_index++ )
+				{
+					if( libfplist_binary_parser_read_inline_object(
+					     parser_state,
+					     &safe_object_end_offset,
+					     0,
+					     recursion_depth + 1,
+					     &element_tag,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read URL object.",
+						 function );
+
+						goto on_error;
+					}
+					if( element_index == 0 )
+					{
+						result = libfplist_binary_parser_append_dict_entry(
+						          object_tag,
+						          "NS.base",
+						          7,
+						          element_tag,
+						          error );
+					}
+					else
+					{
+						result = libfplist_binary_parser_append_dict_entry(
+						          object_tag,
+						          "NS.relative",
+						          11,
+						          element_tag,
+						          error );
+					}
+					if( result != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append URL entry.",
+						 function );
+
+						goto on_error;
+					}
+					element_tag = NULL;
+				}
+			}
+			else if( object_marker == 0x0e )
+			{
+				value_string_length = narrow_string_length(
+				                       (char *) value_string );
+
+				if( libfplist_xml_tag_set_value(
+				     object_tag,
+				     value_string,
+				     value_string_length,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set %s tag value.",
+					 function,
+					 tag_name );
+
+					goto on_error;
+				}
+			}
+			break;
+
+		case 0x10:
+		case 0x20:
+		case 0x30:
+			value_string_length = narrow_string_length(
+			                       (char *) value_string );
+
+			if( libfplist_xml_tag_set_value(
+			     object_tag,
+			     value_string,
+			     value_string_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set %s tag value.",
+				 function,
+				 tag_name );
+
+				goto on_error;
+			}
+			/* A 16 byte integer is marked as 128-bit so that values that
+			 * do not fit in 64-bit can be retrieved
+			 */
+			if( object_marker == 0x14 )
+			{
+				if( libfplist_xml_tag_append_attribute(
+				     object_tag,
+				     (uint8_t *) "size",
+				     4,
+				     (uint8_t *) "128",
+				     3,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append size attribute.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			break;
+
+		case 0x40:
+			if( object_size > maximum_object_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid data object size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( parser_state->buffer != NULL )
+			{
+				/* The data is not copied but referenced in the buffer
+				 */
+				object_tag->value_data_reference = &( parser_state->buffer[ object_data_offset ] );
+			}
+			else if( object_size > 0 )
+			{
+				if( object_size > (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid data object size value exceeds maximum.",
+					 function );
+
+					goto on_error;
+				}
+				if( libfplist_binary_parser_read_data(
+				     parser_state,
+				     (uint64_t) object_data_offset,
+				     (size_t) object_size,
+				     &object_data,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read data object data.",
+					 function );
+
+					goto on_error;
+				}
+				object_tag->managed_value_data = (uint8_t *) memory_allocate(
+				                                              sizeof( uint8_t ) * (size_t) object_size );
+
+				if( object_tag->managed_value_data == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create value data.",
+					 function );
+
+					goto on_error;
+				}
+				if( memory_copy(
+				     object_tag->managed_value_data,
+				     object_data,
+				     (size_t) object_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy value data.",
+					 function );
+
+					goto on_error;
+				}
+				object_tag->value_data_reference = object_tag->managed_value_data;
+			}
+			else
+			{
+				object_tag->value_data_reference = (const uint8_t *) "";
+			}
+			object_tag->value_data_size        = (size_t) object_size;
+			object_tag->value_data_size_is_set = 1;
+
+			safe_object_end_offset = object_data_offset + (size_t) object_size;
+
+			break;
+
+		case 0x50:
+		case 0x70:
+			/* The size contains the number of ASCII or UTF-8 bytes
+			 */
+			if( object_size > maximum_object_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid ASCII or UTF-8 string object size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfplist_binary_parser_read_data(
+			     parser_state,
+			     (uint64_t) object_data_offset,
+			     (size_t) object_size,
+			     &object_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read ASCII or UTF-8 string object data.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfplist_xml_tag_set_value(
+			     object_tag,
+			     object_data,
+			     (size_t) object_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set %s tag value.",
+				 function,
+				 tag_name );
+
+				goto on_error;
+			}
+			safe_object_end_offset = object_data_offset + (size_t) object_size;
+
+			break;
+
+		case 0x60:
+			/* The size contains the number of UTF-16 characters
+			 */
+			if( object_size > ( maximum_object_size / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid UTF-16 string object size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( object_size > 0 )
+			{
+				if( libfplist_binary_parser_read_data(
+				     parser_state,
+				     (uint64_t) object_data_offset,
+				     (size_t) ( object_size * 2 ),
+				     &object_data,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read UTF-16 string object data.",
+					 function );
+
+					goto on_error;
+				}
+				if( libfplist_utf16_stream_get_utf8_string_size(
+				     object_data,
+				     (size_t) ( object_size * 2 ),
+				     &value_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine size of UTF-8 string.",
+					 function );
+
+					goto on_error;
+				}
+				if( ( value_data_size == 0 )
+				 || ( value_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid UTF-8 string size value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
+				value_data = (uint8_t *) memory_allocate(
+				                          sizeof( uint8_t ) * value_data_size );
+
+				if( value_data == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create UTF-8 string.",
+					 function );
+
+					goto on_error;
+				}
+				if( libfplist_utf16_stream_copy_to_utf8_string(
+				     object_data,
+				     (size_t) ( object_size * 2 ),
+				     value_data,
+				     value_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy UTF-16 string to UTF-8.",
+					 function );
+
+					goto on_error;
+				}
+				/* Do not include the end of string character in the value
+				 */
+				value_data_size -= 1;
+			}
+			if( value_data == NULL )
+			{
+				value_data_size = 0;
+			}
+			if( libfplist_xml_tag_set_value(
+			     object_tag,
+			     ( value_data != NULL ) ? value_data : (uint8_t *) "",
+			     value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set %s tag value.",
+				 function,
+				 tag_name );
+
+				goto on_error;
+			}
+			safe_object_end_offset = object_data_offset + (size_t) ( object_size * 2 );
+
+			break;
+
+		case 0x80:
+			/* A UID is represented as it would be in a XML plist:
+			 * <dict><key>CF$UID</key><integer>#</integer></dict>
+			 */
+			if( libfplist_xml_tag_initialize(
+			     &element_tag,
+			     (uint8_t *) "key",
+			     3,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create key tag.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfplist_xml_tag_set_value(
+			     element_tag,
+			     (uint8_t *) "CF$UID",
+			     6,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set key tag value.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfplist_xml_tag_append_element(
+			     object_tag,
+			     element_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append key tag.",
+				 function );
+
+				goto on_error;
+			}
+			element_tag = NULL;
+
+			if( libfplist_xml_tag_initialize(
+			     &element_tag,
+			     (uint8_t *) "integer",
+			     7,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create integer tag.",
+				 function );
+
+				goto on_error;
+			}
+			value_string_length = narrow_string_length(
+			                       (char *) value_string );
+
+			if( libfplist_xml_tag_set_value(
+			     element_tag,
+			     value_string,
+			     value_string_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set integer tag value.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfplist_xml_tag_append_element(
+			     object_tag,
+			     element_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append integer tag.",
+				 function );
+
+				goto on_error;
+			}
+			element_tag = NULL;
+
+			break;
+
+		case 0xa0:
+		case 0xb0:
+		case 0xc0:
+		case 0xd0:
+			if( object_size > (uint64_t) INT_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of entries value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( parser_state->format_version == 0 )
+			{
+				/* The elements are read on demand
+				 */
+				object_tag->binary_parser_state = parser_state;
+				object_tag->binary_object_index = object_index;
+				object_tag->number_of_entries   = (int) object_size;
+			}
+			else if( libfplist_binary_parser_read_inline_elements(
+			          parser_state,
+			          object_tag,
+			          object_marker,
+			          object_data_offset,
+			          object_size,
+			          recursion_depth,
+			          &safe_object_end_offset,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read elements.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		default:
+			break;
+	}
+	if( value_data != NULL )
+	{
+		memory_free(
+		 value_data );
+	}
+	*tag               = object_tag;
+	*object_end_offset = safe_object_end_offset;
+
+	return( 1 );
+
+on_error:
+	if( value_data != NULL )
+	{
+		memory_free(
+		 value_data );
+	}
+	if( element_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &element_tag,
+		 NULL );
+	}
+	if( object_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &object_tag,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads an object and creates a corresponding tag
+ * If is_key is set the object must be a string and a key tag is created
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_parser_read_object(
+     libfplist_binary_parser_state_t *parser_state,
+     uint64_t object_index,
+     uint8_t is_key,
+     libfplist_xml_tag_t **tag,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfplist_binary_parser_read_object";
+	size_t object_end_offset = 0;
+	size_t object_offset     = 0;
+
+	if( libfplist_binary_parser_get_object_offset(
+	     parser_state,
+	     object_index,
+	     &object_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve object: %" PRIu64 " offset.",
+		 function,
+		 object_index );
+
+		return( -1 );
+	}
+	if( libfplist_binary_parser_read_object_at_offset(
+	     parser_state,
+	     object_offset,
+	     object_index,
+	     is_key,
+	     0,
+	     tag,
+	     &object_end_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read object: %" PRIu64 ".",
+		 function,
+		 object_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a bplist1x object that is stored inline and creates a corresponding tag
+ * Fill bytes preceding the object are skipped and the object offset is set to
+ * the offset directly after the object
+ * Returns 1 if successful, 0 if the object is null or -1 on error
+ */
+int libfplist_binary_parser_read_inline_object(
+     libfplist_binary_parser_state_t *parser_state,
+     size_t *object_offset,
+     uint8_t is_key,
+     int recursion_depth,
+     libfplist_xml_tag_t **tag,
+     libcerror_error_t **error )
+{
+	const uint8_t *object_data = NULL;
+	static char *function      = "libfplist_binary_parser_read_inline_object";
+	size_t object_end_offset   = 0;
+	size_t safe_object_offset  = 0;
+	uint8_t object_marker      = 0;
+
+	if( parser_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser state.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_object_offset = *object_offset;
+
+	do
+	{
+		if( (uint64_t) safe_object_offset >= parser_state->offset_table_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid object offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfplist_binary_parser_read_data(
+		     parser_state,
+		     (uint64_t) safe_object_offset,
+		     1,
+		     &object_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read object marker at offset: %" PRIzd ".",
+			 function,
+			 safe_object_offset );
+
+			return( -1 );
+		}
+		object_marker = object_data[ 0 ];
+
+		/* Skip fill bytes
+		 */
+		if( object_marker == 0x0f )
+		{
+			safe_object_offset += 1;
+		}
+	}
+	while( object_marker == 0x0f );
+
+	if( object_marker == 0x00 )
+	{
+		*object_offset = safe_object_offset + 1;
+
+		return( 0 );
+	}
+	if( libfplist_binary_parser_read_object_at_offset(
+	     parser_state,
+	     safe_object_offset,
+	     0,
+	     is_key,
+	     recursion_depth,
+	     tag,
+	     &object_end_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read object at offset: %" PRIzd ".",
+		 function,
+		 safe_object_offset );
+
+		return( -1 );
+	}
+	*object_offset = object_end_offset;
+
+	return( 1 );
+}
+
+/* Reads the elements of a bplist1x array, set or dict that are stored inline
+ * A dict stores the keys followed by the values. Null elements and dict entries
+ * with a null value are omitted
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_parser_read_inline_elements(
+     libfplist_binary_parser_state_t *parser_state,
+     libfplist_xml_tag_t *tag,
+     uint8_t object_marker,
+     size_t elements_offset,
+     uint64_t number_of_entries,
+     int recursion_depth,
+     size_t *elements_end_offset,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *key_tags_array = NULL;
+	libfplist_xml_tag_t *element_tag = NULL;
+	libfplist_xml_tag_t *key_tag     = NULL;
+	static char *function            = "libfplist_binary_parser_read_inline_elements";
+	uint64_t entry_index             = 0;
+	uint64_t maximum_number_of_bytes = 0;
+	int array_entry_index            = 0;
+	int result                       = 0;
+
+	if( parser_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser state.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( (uint64_t) elements_offset > parser_state->offset_table_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid elements offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( elements_end_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements end offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every element takes up at least 1 byte, which bounds the number of entries
+	 * before any memory is allocated for them
+	 */
+	maximum_number_of_bytes = parser_state->offset_table_offset - elements_offset;
+
+	if( ( object_marker & 0xf0 ) == 0xd0 )
+	{
+		maximum_number_of_bytes /= 2;
+	}
+	if( ( number_of_entries > maximum_number_of_bytes )
+	 || ( number_of_entries > (uint64_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( object_marker & 0xf0 ) == 0xd0 )
+	{
+		if( libcdata_array_initialize(
+		     &key_tags_array,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create key tags array.",
+			 function );
+
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			result = libfplist_binary_parser_read_inline_object(
+			          parser_state,
+			          &elements_offset,
+			          1,
+			          recursion_depth + 1,
+			          &key_tag,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read key: %" PRIu64 ".",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			if( libcdata_array_append_entry(
+			     key_tags_array,
+			     &array_entry_index,
+			     (intptr_t *) key_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append key tag to array.",
+				 function );
+
+				goto on_error;
+			}
+			key_tag = NULL;
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		result = libfplist_binary_parser_read_inline_object(
+		          parser_state,
+		          &elements_offset,
+		          0,
+		          recursion_depth + 1,
+		          &element_tag,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read element: %" PRIu64 ".",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( key_tags_array != NULL )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     key_tags_array,
+			     (int) entry_index,
+			     (intptr_t **) &key_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve key tag: %" PRIu64 ".",
+				 function,
+				 entry_index );
+
+				key_tag = NULL;
+
+				goto on_error;
+			}
+			/* The key tag is owned by the tag once appended
+			 */
+			if( libcdata_array_set_entry_by_index(
+			     key_tags_array,
+			     (int) entry_index,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set key tag: %" PRIu64 ".",
+				 function,
+				 entry_index );
+
+				key_tag = NULL;
+
+				goto on_error;
+			}
+			if( libfplist_xml_tag_append_element(
+			     tag,
+			     key_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append key tag.",
+				 function );
+
+				goto on_error;
+			}
+			key_tag = NULL;
+		}
+		if( libfplist_xml_tag_append_element(
+		     tag,
+		     element_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append element tag.",
+			 function );
+
+			goto on_error;
+		}
+		element_tag = NULL;
+	}
+	if( key_tags_array != NULL )
+	{
+		/* Frees the keys of the entries with a null value
+		 */
+		if( libcdata_array_free(
+		     &key_tags_array,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfplist_xml_tag_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free key tags array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*elements_end_offset = elements_offset;
+
+	return( 1 );
+
+on_error:
+	if( element_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &element_tag,
+		 NULL );
+	}
+	if( key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &key_tag,
+		 NULL );
+	}
+	if( key_tags_array != NULL )
+	{
+		libcdata_array_free(
+		 &key_tags_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfplist_xml_tag_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a key tag and a value tag to a dict tag
+ * The value tag is freed on error
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_parser_append_dict_entry(
+     libfplist_xml_tag_t *tag,
+     const char *key,
+     size_t key_length,
+     libfplist_xml_tag_t *value_tag,
+     libcerror_error_t **error )
+{
+	libfplist_xml_tag_t *key_tag = NULL;
+	static char *function        = "libfplist_binary_parser_append_dict_entry";
+
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tag.",
+		 function );
+
+		goto on_error;
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		goto on_error;
+	}
+	if( value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value tag.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_xml_tag_initialize(
+	     &key_tag,
+	     (uint8_t *) "key",
+	     3,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key tag.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_xml_tag_set_value(
+	     key_tag,
+	     (uint8_t *) key,
+	     key_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set key tag value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_xml_tag_append_element(
+	     tag,
+	     key_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append key tag.",
+		 function );
+
+		goto on_error;
+	}
+	key_tag = NULL;
+
+	if( libfplist_xml_tag_append_element(
+	     tag,
+	     value_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value tag.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &key_tag,
+		 NULL );
+	}
+	if( value_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &value_tag,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the root object and creates a corresponding tag
+ * The root object of a bplist00 property list is referenced by the trailer,
+ * the root object of a bplist1x property list directly follows the header
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_parser_read_root_object(
+     libfplist_binary_parser_state_t *parser_state,
+     libfplist_xml_tag_t **tag,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_binary_parser_read_root_object";
+	size_t object_offset  = 0;
+	int result            = 0;
+
+	if( parser_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser state.",
+		 function );
+
+		return( -1 );
+	}
+	if( parser_state->format_version == 0 )
+	{
+		result = libfplist_binary_parser_read_object(
+		          parser_state,
+		          parser_state->root_object,
+		          0,
+		          tag,
+		          error );
+
+		if( result == 1 )
+		{
+			parser_state->number_of_read_objects += 1;
+		}
+	}
+	else
+	{
+		object_offset = parser_state->root_object_offset;
+
+		result = libfplist_binary_parser_read_inline_object(
+		          parser_state,
+		          &object_offset,
+		          0,
+		          0,
+		          tag,
+		          error );
+
+		if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported null root object.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read root object.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the object marker, the offset of the object references and the number of entries
+ * of an array, set or dict object
+ * A dict contains a key and a value object reference per entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_parser_get_container_references(
+     libfplist_binary_parser_state_t *parser_state,
+     uint64_t object_index,
+     uint8_t *object_marker,
+     size_t *references_offset,
+     uint64_t *number_of_entries,
+     libcerror_error_t **error )
+{
+	const uint8_t *object_data    = NULL;
+	static char *function         = "libfplist_binary_parser_get_container_references";
+	size_t object_data_offset     = 0;
+	size_t object_offset          = 0;
+	uint64_t number_of_references = 0;
+	uint64_t object_size          = 0;
+	uint8_t safe_object_marker    = 0;
+
+	if( parser_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser state.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_marker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object marker.",
+		 function );
+
+		return( -1 );
+	}
+	if( references_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid references offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_binary_parser_get_object_offset(
+	     parser_state,
+	     object_index,
+	     &object_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve object: %" PRIu64 " offset.",
+		 function,
+		 object_index );
+
+		return( -1 );
+	}
+	if( libfplist_binary_parser_read_data(
+	     parser_state,
+	     (uint64_t) object_offset,
+	     1,
+	     &object_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read object: %" PRIu64 " marker.",
+		 function,
+		 object_index );
+
+		return( -1 );
+	}
+	safe_object_marker = object_data[ 0 ] & 0xf0;
+
+	if( ( safe_object_marker != 0xa0 )
+	 && ( safe_object_marker != 0xc0 )
+	 && ( safe_object_marker != 0xd0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported object marker: 0x%02" PRIx8 ".",
+		 function,
+		 object_data[ 0 ] );
+
+		return( -1 );
+	}
+	if( libfplist_binary_parser_get_object_size(
+	     parser_state,
+	     object_offset,
+	     &object_data_offset,
+	     &object_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve object: %" PRIu64 " size.",
+		 function,
+		 object_index );
+
+		return( -1 );
+	}
+	/* A dict stores the key references followed by the value references
+	 */
+	number_of_references = object_size;
+
+	if( safe_object_marker == 0xd0 )
+	{
+		if( object_size > ( (uint64_t) INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of dict entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_references *= 2;
+	}
+	if( ( number_of_references > (uint64_t) INT_MAX )
+	 || ( number_of_references > ( ( parser_state->offset_table_offset - object_data_offset ) / parser_state->object_reference_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of object references value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*object_marker     = safe_object_marker;
+	*references_offset = object_data_offset;
+	*number_of_entries = object_size;
+
+	return( 1 );
+}
+
+/* Reads the elements of a binary property list array or dict tag
+ * The key and value references of a dict are interleaved into key and value
+ * elements as they would be in a XML plist. Null elements and dict entries
+ * with a null value are omitted
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_parser_read_elements(
+     libfplist_binary_parser_state_t *parser_state,
+     libfplist_xml_tag_t *tag,
+     libcerror_error_t **error )
+{
+	libfplist_xml_tag_t *element_tag = NULL;
+	static char *function            = "libfplist_binary_parser_read_elements";
+	size_t object_data_offset        = 0;
+	uint64_t element_index           = 0;
+	uint64_t element_object_index    = 0;
+	uint64_t number_of_references    = 0;
+	uint64_t object_size             = 0;
+	uint64_t reference_index         = 0;
+	uint64_t value_object_index      = 0;
+	uint8_t object_marker            = 0;
+	int number_of_entries            = 0;
+	int result                       = 0;
+
+	if( parser_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parser_state->buffer == NULL )
+	 && ( parser_state->read_buffer_at_offset == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid parser state - missing buffer and read function.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag->binary_parser_state != parser_state )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid tag - elements already read or not a binary array or dict.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_binary_parser_get_container_references(
+	     parser_state,
+	     tag->binary_object_index,
+	     &object_marker,
+	     &object_data_offset,
+	     &object_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve object: %" PRIu64 " references.",
+		 function,
+		 tag->binary_object_index );
+
+		goto on_error;
+	}
+	/* A dict stores the key references followed by the value references
+	 */
+	number_of_references = object_size;
+
+	if( object_marker == 0xd0 )
+	{
+		number_of_references *= 2;
+	}
+	/* The object graph is not validated upfront when the data is read using
+	 * a read function, hence the number of objects read is bounded here
+	 */
+	if( ( parser_state->number_of_read_objects > parser_state->maximum_number_of_expanded_objects )
+	 || ( number_of_references > ( parser_state->maximum_number_of_expanded_objects - parser_state->number_of_read_objects ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid object: %" PRIu64 " number of expanded objects value exceeds maximum.",
+		 function,
+		 tag->binary_object_index );
+
+		return( -1 );
+	}
+	/* The number of entries is maintained by append element
+	 */
+	number_of_entries = tag->number_of_entries;
+
+	tag->binary_parser_state = NULL;
+	tag->number_of_entries   = 0;
+
+	for( element_index = 0;
+	     element_index < number_of_references;
+	     element_index++ )
+	{
+		if( object_marker != 0xd0 )
+		{
+			reference_index = element_index;
+		}
+		else if( ( element_index % 2 ) == 0 )
+		{
+			reference_index = element_index / 2;
+		}
+		else
+		{
+			reference_index = object_size + ( element_index / 2 );
+		}
+		if( libfplist_binary_parser_get_object_reference(
+		     parser_state,
+		     object_data_offset + (size_t) ( reference_index * parser_state->object_reference_size ),
+		     &element_object_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve object reference: %" PRIu64 ".",
+			 function,
+			 reference_index );
+
+			goto on_error;
+		}
+		/* Null elements and dict entries with a null value are omitted,
+		 * hence the value of a dict entry is checked before its key is read
+		 */
+		if( ( object_marker != 0xd0 )
+		 || ( ( element_index % 2 ) == 0 ) )
+		{
+			value_object_index = element_object_index;
+
+			if( object_marker == 0xd0 )
+			{
+				reference_index = object_size + ( element_index / 2 );
+
+				if( libfplist_binary_parser_get_object_reference(
+				     parser_state,
+				     object_data_offset + (size_t) ( reference_index * parser_state->object_reference_size ),
+				     &value_object_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve object reference: %" PRIu64 ".",
+					 function,
+					 reference_index );
+
+					goto on_error;
+				}
+			}
+			result = libfplist_binary_parser_object_is_null(
+			          parser_state,
+			          value_object_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if object: %" PRIu64 " is null.",
+				 function,
+				 value_object_index );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				if( object_marker == 0xd0 )
+				{
+					element_index++;
+				}
+				continue;
+			}
+		}
+		if( libfplist_binary_parser_read_object(
+		     parser_state,
+		     element_object_index,
+		     (uint8_t) ( ( object_marker == 0xd0 ) && ( ( element_index % 2 ) == 0 ) ),
+		     &element_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read object: %" PRIu64 ".",
+			 function,
+			 element_object_index );
+
+			goto on_error;
+		}
+		if( libfplist_xml_tag_append_element(
+		     tag,
+		     element_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append element tag.",
+			 function );
+
+			goto on_error;
+		}
+		element_tag = NULL;
+	}
+	/* The number of objects read is only increased when all the elements were read
+	 * since the elements are discarded on error
+	 */
+	parser_state->number_of_read_objects += number_of_references;
+
+	return( 1 );
+
+on_error:
+	if( element_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &element_tag,
+		 NULL );
+	}
+	/* Discard the elements that were read so that they are not read twice
+	 */
+	libcdata_array_empty(
+	 tag->elements_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfplist_xml_tag_free,
+	 NULL );
+
+	if( tag->binary_parser_state == NULL )
+	{
+		tag->binary_parser_state = parser_state;
+		tag->number_of_entries   = number_of_entries;
+	}
+
+	return( -1 );
+}
+
+
+/* Determines if a bit is set in a bitmap of objects
+ */
+#define libfplist_binary_parser_bitmap_is_set( bitmap, object_index ) \
+	( ( ( bitmap )[ ( object_index ) / 8 ] & ( 1 << ( ( object_index ) % 8 ) ) ) != 0 )
+
+/* Sets a bit in a bitmap of objects
+ */
+#define libfplist_binary_parser_bitmap_set( bitmap, object_index ) \
+	( bitmap )[ ( object_index ) / 8 ] |= (uint8_t) ( 1 << ( ( object_index ) % 8 ) )
+
+/* Clears a bit in a bitmap of objects
+ */
+#define libfplist_binary_parser_bitmap_clear( bitmap, object_index ) \
+	( bitmap )[ ( object_index ) / 8 ] &= (uint8_t) ~( 1 << ( ( object_index ) % 8 ) )
+
+/* Validates an object and the objects it references
+ * An object that was validated before is not validated again, instead the number
+ * of objects it expands into is retrieved from the previous validation
+ * If is_key is set the object must be a string
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_parser_validate_object(
+     libfplist_binary_parser_state_t *parser_state,
+     uint64_t object_index,
+     uint8_t is_key,
+     int recursion_depth,
+     uint64_t *number_of_expanded_objects,
+     libcerror_error_t **error )
+{
+	const uint8_t *object_data                = NULL;
+	static char *function                     = "libfplist_binary_parser_validate_object";
+	size_t object_data_offset                 = 0;
+	size_t object_offset                      = 0;
+	uint64_t element_number_of_objects        = 0;
+	uint64_t element_object_index             = 0;
+	uint64_t maximum_object_size              = 0;
+	uint64_t number_of_references             = 0;
+	uint64_t object_size                      = 0;
+	uint64_t reference_index                  = 0;
+	uint64_t safe_number_of_expanded_objects  = 1;
+	uint8_t object_marker                     = 0;
+	uint8_t object_marker_type                = 0;
+
+	if( parser_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( parser_state->buffer == NULL )
+	  && ( parser_state->read_buffer_at_offset == NULL ) )
+	 || ( parser_state->visited_objects_bitmap == NULL )
+	 || ( parser_state->path_objects_bitmap == NULL )
+	 || ( parser_state->number_of_expanded_objects == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid parser state - missing buffer and read function or validation values.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_index >= parser_state->number_of_objects )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid object index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFPLIST_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_expanded_objects == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of expanded objects.",
+		 function );
+
+		return( -1 );
+	}
+	/* An object that references itself directly or indirectly would expand infinitely
+	 */
+	if( libfplist_binary_parser_bitmap_is_set(
+	     parser_state->path_objects_bitmap,
+	     object_index ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported object: %" PRIu64 " references itself.",
+		 function,
+		 object_index );
+
+		return( -1 );
+	}
+	if( libfplist_binary_parser_get_object_offset(
+	     parser_state,
+	     object_index,
+	     &object_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve object: %" PRIu64 " offset.",
+		 function,
+		 object_index );
+
+		return( -1 );
+	}
+	if( libfplist_binary_parser_read_data(
+	     parser_state,
+	     (uint64_t) object_offset,
+	     1,
+	     &object_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read object: %" PRIu64 " marker.",
+		 function,
+		 object_index );
+
+		return( -1 );
+	}
+	object_marker      = object_data[ 0 ];
+	object_marker_type = object_marker & 0xf0;
+
+	if( ( is_key != 0 )
+	 && ( object_marker_type != 0x50 )
+	 && ( object_marker_type != 0x60 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported key object: %" PRIu64 " marker: 0x%02" PRIx8 ".",
+		 function,
+		 object_index,
+		 object_marker );
+
+		return( -1 );
+	}
+	if( libfplist_binary_parser_bitmap_is_set(
+	     parser_state->visited_objects_bitmap,
+	     object_index ) )
+	{
+		*number_of_expanded_objects = parser_state->number_of_expanded_objects[ object_index ];
+
+		return( 1 );
+	}
+	object_data_offset  = object_offset + 1;
+	maximum_object_size = parser_state->offset_table_offset - object_data_offset;
+
+	switch( object_marker_type )
+	{
+		case 0x00:
+			/* A null element or dict value is omitted when read
+			 */
+			if( ( object_marker != 0x00 )
+			 && ( object_marker != 0x08 )
+			 && ( object_marker != 0x09 ) )
+			{
+				object_marker_type = 0xff;
+			}
+			break;
+
+		case 0x10:
+			if( ( object_marker & 0x0f ) > 4 )
+			{
+				object_marker_type = 0xff;
+			}
+			object_size = (uint64_t) 1 << ( object_marker & 0x0f );
+
+			break;
+
+		case 0x20:
+			if( ( object_marker != 0x22 )
+			 && ( object_marker != 0x23 ) )
+			{
+				object_marker_type = 0xff;
+			}
+			object_size = (uint64_t) 1 << ( object_marker & 0x0f );
+
+			break;
+
+		case 0x30:
+			if( object_marker != 0x33 )
+			{
+				object_marker_type = 0xff;
+			}
+			object_size = 8;
+
+			break;
+
+		case 0x80:
+			if( ( object_marker & 0x0f ) > 7 )
+			{
+				object_marker_type = 0xff;
+			}
+			object_size = (uint64_t) ( object_marker & 0x0f ) + 1;
+
+			break;
+
+		case 0x40:
+		case 0x50:
+		case 0x60:
+		case 0xa0:
+		case 0xc0:
+		case 0xd0:
+			if( libfplist_binary_parser_get_object_size(
+			     parser_state,
+			     object_offset,
+			     &object_data_offset,
+			     &object_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve object: %" PRIu64 " size.",
+				 function,
+				 object_index );
+
+				return( -1 );
+			}
+			maximum_object_size = parser_state->offset_table_offset - object_data_offset;
+
+			break;
+
+		default:
+			object_marker_type = 0xff;
+			break;
+	}
+	if( object_marker_type == 0xff )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported object: %" PRIu64 " marker: 0x%02" PRIx8 ".",
+		 function,
+		 object_index,
+		 object_marker );
+
+		return( -1 );
+	}
+	/* A UTF-16 string contains 2 bytes per character and a dict stores
+	 * the key references followed by the value references
+	 */
+	if( object_marker_type == 0x60 )
+	{
+		maximum_object_size /= 2;
+	}
+	else if( ( object_marker_type == 0xa0 )
+	      || ( object_marker_type == 0xc0 )
+	      || ( object_marker_type == 0xd0 ) )
+	{
+		maximum_object_size /= parser_state->object_reference_size;
+
+		if( object_marker_type == 0xd0 )
+		{
+			maximum_object_size /= 2;
+		}
+	}
+	if( object_size > maximum_object_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid object: %" PRIu64 " size value out of bounds.",
+		 function,
+		 object_index );
+
+		return( -1 );
+	}
+	if( ( object_marker_type == 0xa0 )
+	 || ( object_marker_type == 0xc0 )
+	 || ( object_marker_type == 0xd0 ) )
+	{
+		number_of_references = object_size;
+
+		if( object_marker_type == 0xd0 )
+		{
+			number_of_references *= 2;
+		}
+		if( number_of_references > (uint64_t) INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid object: %" PRIu64 " number of object references value out of bounds.",
+			 function,
+			 object_index );
+
+			return( -1 );
+		}
+		libfplist_binary_parser_bitmap_set(
+		 parser_state->path_objects_bitmap,
+		 object_index );
+
+		for( reference_index = 0;
+		     reference_index < number_of_references;
+		     reference_index++ )
+		{
+			if( libfplist_binary_parser_get_object_reference(
+			     parser_state,
+			     object_data_offset + (size_t) ( reference_index * parser_state->object_reference_size ),
+			     &element_object_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve object: %" PRIu64 " reference: %" PRIu64 ".",
+				 function,
+				 object_index,
+				 reference_index );
+
+				goto on_error;
+			}
+			if( libfplist_binary_parser_validate_object(
+			     parser_state,
+			     element_object_index,
+			     (uint8_t) ( ( object_marker_type == 0xd0 ) && ( reference_index < object_size ) ),
+			     recursion_depth + 1,
+			     &element_number_of_objects,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: invalid object: %" PRIu64 " element: %" PRIu64 ".",
+				 function,
+				 object_index,
+				 element_object_index );
+
+				goto on_error;
+			}
+			if( element_number_of_objects > ( parser_state->maximum_number_of_expanded_objects - safe_number_of_expanded_objects ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid object: %" PRIu64 " number of expanded objects value exceeds maximum.",
+				 function,
+				 object_index );
+
+				goto on_error;
+			}
+			safe_number_of_expanded_objects += element_number_of_objects;
+		}
+		libfplist_binary_parser_bitmap_clear(
+		 parser_state->path_objects_bitmap,
+		 object_index );
+	}
+	libfplist_binary_parser_bitmap_set(
+	 parser_state->visited_objects_bitmap,
+	 object_index );
+
+	parser_state->number_of_expanded_objects[ object_index ] = safe_number_of_expanded_objects;
+
+	*number_of_expanded_objects = safe_number_of_expanded_objects;
+
+	return( 1 );
+
+on_error:
+	libfplist_binary_parser_bitmap_clear(
+	 parser_state->path_objects_bitmap,
+	 object_index );
+
+	return( -1 );
+}
+
+/* Validates the object graph of the binary property list
+ * Every object reachable from the root object is validated once, which bounds
+ * the validation to the number of objects and object references. Reference cycles
+ * and object graphs that expand into more than the maximum number of expanded objects
+ * determined from the trailer are considered invalid
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_parser_validate(
+     libfplist_binary_parser_state_t *parser_state,
+     uint64_t *number_of_expanded_objects,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_binary_parser_validate";
+	size_t bitmap_size    = 0;
+
+	if( parser_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parser_state->visited_objects_bitmap != NULL )
+	 || ( parser_state->path_objects_bitmap != NULL )
+	 || ( parser_state->number_of_expanded_objects != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid parser state - validation values already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_expanded_objects == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of expanded objects.",
+		 function );
+
+		return( -1 );
+	}
+	/* A bplist1x property list has no object references and is read sequentially
+	 */
+	if( parser_state->format_version != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu8 ".",
+		 function,
+		 parser_state->format_version );
+
+		return( -1 );
+	}
+	/* The number of objects is bounded by the size of the offset table
+	 */
+	if( ( parser_state->number_of_objects == 0 )
+	 || ( parser_state->number_of_objects > ( (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid parser state - number of objects value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	bitmap_size = (size_t) ( ( parser_state->number_of_objects + 7 ) / 8 );
+
+	parser_state->visited_objects_bitmap = (uint8_t *) memory_allocate(
+	                                                    sizeof( uint8_t ) * bitmap_size );
+
+	if( parser_state->visited_objects_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create visited objects bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	parser_state->path_objects_bitmap = (uint8_t *) memory_allocate(
+	                                                 sizeof( uint8_t ) * bitmap_size );
+
+	if( parser_state->path_objects_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path objects bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	/* The number of expanded objects is only read for visited objects
+	 * and therefore does not need to be initialized
+	 */
+	parser_state->number_of_expanded_objects = (uint64_t *) memory_allocate(
+	                                                         sizeof( uint64_t ) * (size_t) parser_state->number_of_objects );
+
+	if( parser_state->number_of_expanded_objects == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create number of expanded objects.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     parser_state->visited_objects_bitmap,
+	     0,
+	     bitmap_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear visited objects bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     parser_state->path_objects_bitmap,
+	     0,
+	     bitmap_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear path objects bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_binary_parser_validate_object(
+	     parser_state,
+	     parser_state->root_object,
+	     0,
+	     0,
+	     number_of_expanded_objects,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: invalid root object: %" PRIu64 ".",
+		 function,
+		 parser_state->root_object );
+
+		goto on_error;
+	}
+	memory_free(
+	 parser_state->number_of_expanded_objects );
+
+	parser_state->number_of_expanded_objects = NULL;
+
+	memory_free(
+	 parser_state->path_objects_bitmap );
+
+	parser_state->path_objects_bitmap = NULL;
+
+	memory_free(
+	 parser_state->visited_objects_bitmap );
+
+	parser_state->visited_objects_bitmap = NULL;
+
+	return( 1 );
+
+on_error:
+	if( parser_state->number_of_expanded_objects != NULL )
+	{
+		memory_free(
+		 parser_state->number_of_expanded_objects );
+
+		parser_state->number_of_expanded_objects = NULL;
+	}
+	if( parser_state->path_objects_bitmap != NULL )
+	{
+		memory_free(
+		 parser_state->path_objects_bitmap );
+
+		parser_state->path_objects_bitmap = NULL;
+	}
+	if( parser_state->visited_objects_bitmap != NULL )
+	{
+		memory_free(
+		 parser_state->visited_objects_bitmap );
+
+		parser_state->visited_objects_bitmap = NULL;
+	}
+	return( -1 );
+}
@@ -0,0 +1,311 @@
+/*
+ * Binary property list parser functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFPLIST_BINARY_PARSER_H )
+#define _LIBFPLIST_BINARY_PARSER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfplist_libcerror.h"
+#include "libfplist_xml_tag.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the binary property list header
+ */
+#define LIBFPLIST_BINARY_PARSER_HEADER_SIZE	8
+
+/* The size of the binary property list trailer
+ */
+#define LIBFPLIST_BINARY_PARSER_TRAILER_SIZE	32
+
+/* The maximum number of objects the object graph can expand into
+ * Since objects can be referenced more than once a small binary property list
+ * can expand into a number of tags that is exponential in its number of objects
+ */
+#define LIBFPLIST_BINARY_PARSER_MAXIMUM_NUMBER_OF_EXPANDED_OBJECTS	( 16 * 1024 * 1024 )
+
+/* The factor by which the number of objects and object references can expand
+ * Without shared arrays and dicts every object reference expands into a single object
+ */
+#define LIBFPLIST_BINARY_PARSER_MAXIMUM_EXPANSION_FACTOR		4
+
+/* The size of a block in the read cache
+ */
+#define LIBFPLIST_BINARY_PARSER_CACHE_BLOCK_SIZE	4096
+
+/* The number of blocks in the read cache
+ */
+#define LIBFPLIST_BINARY_PARSER_CACHE_NUMBER_OF_BLOCKS	8
+
+typedef struct libfplist_binary_parser_cache_block libfplist_binary_parser_cache_block_t;
+
+struct libfplist_binary_parser_cache_block
+{
+	/* The offset of the block
+	 */
+	uint64_t offset;
+
+	/* The size of the data in the block, which is 0 if the block is not used
+	 */
+	size_t data_size;
+
+	/* The data
+	 */
+	uint8_t data[ LIBFPLIST_BINARY_PARSER_CACHE_BLOCK_SIZE ];
+};
+
+typedef struct libfplist_binary_parser_state libfplist_binary_parser_state_t;
+
+struct libfplist_binary_parser_state
+{
+	/* The buffer
+	 */
+	const uint8_t *buffer;
+
+	/* The managed buffer, which is a copy of the buffer owned by the parser state
+	 */
+	uint8_t *managed_buffer;
+
+	/* The IO handle, which is passed to the read function
+	 */
+	intptr_t *io_handle;
+
+	/* The read function, which is used instead of the buffer to read data on demand
+	 */
+	ssize_t (*read_buffer_at_offset)(
+	           intptr_t *io_handle,
+	           uint8_t *buffer,
+	           size_t size,
+	           off64_t offset,
+	           libcerror_error_t **error );
+
+	/* The read cache blocks, used with the read function
+	 */
+	libfplist_binary_parser_cache_block_t *cache_blocks;
+
+	/* The read buffer, used with the read function for data that does not fit in a cache block
+	 */
+	uint8_t *read_buffer;
+
+	/* The read buffer size
+	 */
+	size_t read_buffer_size;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The offset byte size
+	 */
+	uint8_t offset_size;
+
+	/* The object reference byte size
+	 */
+	uint8_t object_reference_size;
+
+	/* The number of objects
+	 */
+	uint64_t number_of_objects;
+
+	/* The maximum number of objects the object graph can expand into
+	 */
+	uint64_t maximum_number_of_expanded_objects;
+
+	/* The number of objects read into tags, which bounds the expansion
+	 * of an object graph that is not validated upfront
+	 */
+	uint64_t number_of_read_objects;
+
+	/* The root object
+	 */
+	uint64_t root_object;
+
+	/* The offset table offset
+	 * A bplist1x property list has no offset table and this is the end of the objects
+	 */
+	uint64_t offset_table_offset;
+
+	/* The format version, which is 0 for bplist00 or 15, 16 or 17 for bplist15, bplist16 and bplist17
+	 */
+	uint8_t format_version;
+
+	/* The root object offset, used by bplist1x where the root object directly follows the header
+	 */
+	size_t root_object_offset;
+
+	/* The visited objects bitmap, used during validation
+	 */
+	uint8_t *visited_objects_bitmap;
+
+	/* The bitmap of the objects on the path from the root object, used during validation
+	 */
+	uint8_t *path_objects_bitmap;
+
+	/* The number of objects each visited object expands into, used during validation
+	 */
+	uint64_t *number_of_expanded_objects;
+};
+
+int libfplist_binary_parser_state_initialize(
+     libfplist_binary_parser_state_t **parser_state,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libfplist_binary_parser_state_initialize_with_read_function(
+     libfplist_binary_parser_state_t **parser_state,
+     intptr_t *io_handle,
+     ssize_t (*read_buffer_at_offset)(
+                intptr_t *io_handle,
+                uint8_t *buffer,
+                size_t size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     size64_t data_size,
+     libcerror_error_t **error );
+
+int libfplist_binary_parser_state_free(
+     libfplist_binary_parser_state_t **parser_state,
+     libcerror_error_t **error );
+
+int libfplist_binary_parser_read_data(
+     libfplist_binary_parser_state_t *parser_state,
+     uint64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
+int libfplist_binary_parser_read_header(
+     libfplist_binary_parser_state_t *parser_state,
+     libcerror_error_t **error );
+
+int libfplist_binary_parser_read_trailer(
+     libfplist_binary_parser_state_t *parser_state,
+     libcerror_error_t **error );
+
+int libfplist_binary_parser_get_object_offset(
+     libfplist_binary_parser_state_t *parser_state,
+     uint64_t object_index,
+     size_t *object_offset,
+     libcerror_error_t **error );
+
+int libfplist_binary_parser_get_object_reference(
+     libfplist_binary_parser_state_t *parser_state,
+     size_t reference_offset,
+     uint64_t *object_index,
+     libcerror_error_t **error );
+
+int libfplist_binary_parser_object_is_null(
+     libfplist_binary_parser_state_t *parser_state,
+     uint64_t object_index,
+     libcerror_error_t **error );
+
+int libfplist_binary_parser_get_object_size(
+     libfplist_binary_parser_state_t *parser_state,
+     size_t object_offset,
+     size_t *object_data_offset,
+     uint64_t *object_size,
+     libcerror_error_t **error );
+
+int libfplist_binary_parser_read_object_at_offset(
+     libfplist_binary_parser_state_t *parser_state,
+     size_t object_offset,
+     uint64_t object_index,
+     uint8_t is_key,
+     int recursion_depth,
+     libfplist_xml_tag_t **tag,
+     size_t *object_end_offset,
+     libcerror_error_t **error );
+
+int libfplist_binary_parser_read_object(
+     libfplist_binary_parser_state_t *parser_state,
+     uint64_t object_index,
+     uint8_t is_key,
+     libfplist_xml_tag_t **tag,
+     libcerror_error_t **error );
+
+int libfplist_binary_parser_read_inline_object(
+     libfplist_binary_parser_state_t *parser_state,
+     size_t *object_offset,
+     uint8_t is_key,
+     int recursion_depth,
+     libfplist_xml_tag_t **tag,
+     libcerror_error_t **error );
+
+int libfplist_binary_parser_read_inline_elements(
+     libfplist_binary_parser_state_t *parser_state,
+     libfplist_xml_tag_t *tag,
+     uint8_t object_marker,
+     size_t elements_offset,
+     uint64_t number_of_entries,
+     int recursion_depth,
+     size_t *elements_end_offset,
+     libcerror_error_t **error );
+
+int libfplist_binary_parser_append_dict_entry(
+     libfplist_xml_tag_t *tag,
+     const char *key,
+     size_t key_length,
+     libfplist_xml_tag_t *value_tag,
+     libcerror_error_t **error );
+
+int libfplist_binary_parser_read_root_object(
+     libfplist_binary_parser_state_t *parser_state,
+     libfplist_xml_tag_t **tag,
+     libcerror_error_t **error );
+
+int libfplist_binary_parser_get_container_references(
+     libfplist_binary_parser_state_t *parser_state,
+     uint64_t object_index,
+     uint8_t *object_marker,
+     size_t *references_offset,
+     uint64_t *number_of_entries,
+     libcerror_error_t **error );
+
+int libfplist_binary_parser_read_elements(
+     libfplist_binary_parser_state_t *parser_state,
+     libfplist_xml_tag_t *tag,
+     libcerror_error_t **error );
+
+int libfplist_binary_parser_validate_object(
+     libfplist_binary_parser_state_t *parser_state,
+     uint64_t object_index,
+     uint8_t is_key,
+     int recursion_depth,
+     uint64_t *number_of_expanded_objects,
+     libcerror_error_t **error );
+
+int libfplist_binary_parser_validate(
+     libfplist_binary_parser_state_t *parser_state,
+     uint64_t *number_of_expanded_objects,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFPLIST_BINARY_PARSER_H ) */
+
@@ -0,0 +1,3195 @@
+/*
+ * Binary property list writer functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libfplist_binary_writer.h"
+#include "libfplist_definitions.h"
+#include "libfplist_floating_point.h"
+#include "libfplist_hash.h"
+#include "libfplist_libcerror.h"
+#include "libfplist_libuna.h"
+#include "libfplist_xml_tag.h"
+
+/* Copies a 64-bit value to a big-endian byte stream of 1, 2, 4 or 8 bytes
+ */
+#define libfplist_binary_writer_copy_from_uint64_big_endian( byte_stream, size, value ) \
+	switch( size ) \
+	{ \
+		case 1: \
+			( byte_stream )[ 0 ] = (uint8_t) ( value ); \
+			break; \
+		case 2: \
+			byte_stream_copy_from_uint16_big_endian( byte_stream, ( value ) ); \
+			break; \
+		case 4: \
+			byte_stream_copy_from_uint32_big_endian( byte_stream, ( value ) ); \
+			break; \
+		default: \
+			byte_stream_copy_from_uint64_big_endian( byte_stream, ( value ) ); \
+			break; \
+	}
+
+/* Determines the smallest of 1, 2, 4 or 8 bytes that can hold an unsigned 64-bit value
+ */
+#define libfplist_binary_writer_get_value_size( value ) \
+	( ( ( value ) <= 0xffUL ) ? 1 : ( ( ( value ) <= 0xffffUL ) ? 2 : ( ( ( value ) <= 0xffffffffUL ) ? 4 : 8 ) ) )
+
+/* Inserts an entry into an open addressing hash table of which the size is a power of 2
+ */
+#define libfplist_binary_writer_insert_hash_table_entry( hash_table, hash_table_size, hash_value, entry ) \
+	{ \
+		int hash_table_entry_index = (int) ( ( hash_value ) & (uint32_t) ( ( hash_table_size ) - 1 ) ); \
+		while( ( hash_table )[ hash_table_entry_index ] != 0 ) \
+		{ \
+			hash_table_entry_index = ( hash_table_entry_index + 1 ) & ( ( hash_table_size ) - 1 ); \
+		} \
+		( hash_table )[ hash_table_entry_index ] = ( entry ); \
+	}
+
+/* Creates a binary writer
+ * Make sure the value binary_writer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_writer_initialize(
+     libfplist_binary_writer_t **binary_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_binary_writer_initialize";
+
+	if( binary_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *binary_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid binary writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*binary_writer = memory_allocate_structure(
+	                  libfplist_binary_writer_t );
+
+	if( *binary_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create binary writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *binary_writer,
+	     0,
+	     sizeof( libfplist_binary_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear binary writer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *binary_writer != NULL )
+	{
+		memory_free(
+		 *binary_writer );
+
+		*binary_writer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a binary writer
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_writer_free(
+     libfplist_binary_writer_t **binary_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_binary_writer_free";
+
+	if( binary_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *binary_writer != NULL )
+	{
+		if( ( *binary_writer )->hash_table != NULL )
+		{
+			memory_free(
+			 ( *binary_writer )->hash_table );
+		}
+		if( ( *binary_writer )->object_references != NULL )
+		{
+			memory_free(
+			 ( *binary_writer )->object_references );
+		}
+		if( ( *binary_writer )->object_data != NULL )
+		{
+			memory_free(
+			 ( *binary_writer )->object_data );
+		}
+		if( ( *binary_writer )->objects != NULL )
+		{
+			memory_free(
+			 ( *binary_writer )->objects );
+		}
+		memory_free(
+		 *binary_writer );
+
+		*binary_writer = NULL;
+	}
+	return( 1 );
+}
+
+/* Copies an object marker and its number of entries
+ * A number of entries of 15 or more is stored as an integer object that follows the marker
+ * If data is NULL only the object marker size is determined
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_writer_copy_object_marker(
+     uint8_t *data,
+     size_t data_size,
+     uint8_t object_marker,
+     uint64_t number_of_entries,
+     size_t *object_marker_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfplist_binary_writer_copy_object_marker";
+	size_t safe_size       = 1;
+	uint8_t integer_size   = 0;
+
+	if( object_marker_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object marker size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries >= 15 )
+	{
+		integer_size = (uint8_t) libfplist_binary_writer_get_value_size(
+		                          number_of_entries );
+
+		safe_size += 1 + integer_size;
+	}
+	if( data != NULL )
+	{
+		if( data_size < safe_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( number_of_entries < 15 )
+		{
+			data[ 0 ] = object_marker | (uint8_t) number_of_entries;
+		}
+		else
+		{
+			data[ 0 ] = object_marker | 0x0f;
+
+			/* The integer marker contains the base 2 logarithm of the integer size
+			 */
+			switch( integer_size )
+			{
+				case 1:
+					data[ 1 ] = 0x10;
+					break;
+
+				case 2:
+					data[ 1 ] = 0x11;
+					break;
+
+				case 4:
+					data[ 1 ] = 0x12;
+					break;
+
+				default:
+					data[ 1 ] = 0x13;
+					break;
+			}
+			libfplist_binary_writer_copy_from_uint64_big_endian(
+			 &( data[ 2 ] ),
+			 integer_size,
+			 number_of_entries );
+		}
+	}
+	*object_marker_size = safe_size;
+
+	return( 1 );
+}
+
+/* Appends object data to the encoded object data
+ * The object marker is copied and data points to the data_size bytes that follow it
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_writer_append_object_data(
+     libfplist_binary_writer_t *binary_writer,
+     uint8_t object_marker,
+     uint64_t number_of_entries,
+     size_t data_size,
+     uint8_t **data,
+     libcerror_error_t **error )
+{
+	uint8_t *object_data              = NULL;
+	static char *function             = "libfplist_binary_writer_append_object_data";
+	size_t allocated_object_data_size = 0;
+	size_t object_marker_size         = 0;
+
+	if( binary_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_binary_writer_copy_object_marker(
+	     NULL,
+	     0,
+	     object_marker,
+	     number_of_entries,
+	     &object_marker_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine object marker size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE - object_marker_size - binary_writer->object_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( binary_writer->object_data_size + object_marker_size + data_size ) > binary_writer->allocated_object_data_size )
+	{
+		allocated_object_data_size = binary_writer->allocated_object_data_size;
+
+		if( allocated_object_data_size == 0 )
+		{
+			allocated_object_data_size = 4096;
+		}
+		while( allocated_object_data_size < ( binary_writer->object_data_size + object_marker_size + data_size ) )
+		{
+			if( allocated_object_data_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				allocated_object_data_size = MEMORY_MAXIMUM_ALLOCATION_SIZE;
+
+				break;
+			}
+			allocated_object_data_size *= 2;
+		}
+		object_data = (uint8_t *) memory_reallocate(
+		                           binary_writer->object_data,
+		                           sizeof( uint8_t ) * allocated_object_data_size );
+
+		if( object_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize object data.",
+			 function );
+
+			return( -1 );
+		}
+		binary_writer->object_data                = object_data;
+		binary_writer->allocated_object_data_size = allocated_object_data_size;
+	}
+	if( libfplist_binary_writer_copy_object_marker(
+	     &( binary_writer->object_data[ binary_writer->object_data_size ] ),
+	     object_marker_size,
+	     object_marker,
+	     number_of_entries,
+	     &object_marker_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy object marker.",
+		 function );
+
+		return( -1 );
+	}
+	*data = &( binary_writer->object_data[ binary_writer->object_data_size + object_marker_size ] );
+
+	binary_writer->object_data_size += object_marker_size + data_size;
+
+	return( 1 );
+}
+
+/* Appends an object
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_writer_append_object(
+     libfplist_binary_writer_t *binary_writer,
+     int *object_index,
+     libcerror_error_t **error )
+{
+	libfplist_binary_writer_object_t *objects = NULL;
+	static char *function                     = "libfplist_binary_writer_append_object";
+	int number_of_allocated_objects           = 0;
+
+	if( binary_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object index.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_writer->number_of_objects >= binary_writer->number_of_allocated_objects )
+	{
+		if( binary_writer->number_of_allocated_objects == 0 )
+		{
+			number_of_allocated_objects = 256;
+		}
+		else if( binary_writer->number_of_allocated_objects <= ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_objects = binary_writer->number_of_allocated_objects * 2;
+		}
+		if( ( number_of_allocated_objects == 0 )
+		 || ( (size_t) number_of_allocated_objects > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfplist_binary_writer_object_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated objects value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		objects = (libfplist_binary_writer_object_t *) memory_reallocate(
+		                                                binary_writer->objects,
+		                                                sizeof( libfplist_binary_writer_object_t ) * number_of_allocated_objects );
+
+		if( objects == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize objects.",
+			 function );
+
+			return( -1 );
+		}
+		binary_writer->objects                     = objects;
+		binary_writer->number_of_allocated_objects = number_of_allocated_objects;
+	}
+	if( memory_set(
+	     &( binary_writer->objects[ binary_writer->number_of_objects ] ),
+	     0,
+	     sizeof( libfplist_binary_writer_object_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear object.",
+		 function );
+
+		return( -1 );
+	}
+	*object_index = binary_writer->number_of_objects;
+
+	binary_writer->number_of_objects += 1;
+
+	return( 1 );
+}
+
+/* Appends object references of an array or dict object
+ * The object references are set after the objects they reference have been added
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_writer_append_object_references(
+     libfplist_binary_writer_t *binary_writer,
+     size_t number_of_object_references,
+     size_t *object_references_offset,
+     libcerror_error_t **error )
+{
+	int *object_references                       = NULL;
+	static char *function                        = "libfplist_binary_writer_append_object_references";
+	size_t maximum_number_of_object_references   = 0;
+	size_t number_of_allocated_object_references = 0;
+
+	if( binary_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_references_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object references offset.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_number_of_object_references = MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int );
+
+	if( number_of_object_references > ( maximum_number_of_object_references - binary_writer->number_of_object_references ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of object references value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( binary_writer->number_of_object_references + number_of_object_references ) > binary_writer->number_of_allocated_object_references )
+	{
+		number_of_allocated_object_references = binary_writer->number_of_allocated_object_references;
+
+		if( number_of_allocated_object_references == 0 )
+		{
+			number_of_allocated_object_references = 1024;
+		}
+		while( number_of_allocated_object_references < ( binary_writer->number_of_object_references + number_of_object_references ) )
+		{
+			if( number_of_allocated_object_references > ( maximum_number_of_object_references / 2 ) )
+			{
+				number_of_allocated_object_references = maximum_number_of_object_references;
+
+				break;
+			}
+			number_of_allocated_object_references *= 2;
+		}
+		object_references = (int *) memory_reallocate(
+		                             binary_writer->object_references,
+		                             sizeof( int ) * number_of_allocated_object_references );
+
+		if( object_references == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize object references.",
+			 function );
+
+			return( -1 );
+		}
+		binary_writer->object_references                     = object_references;
+		binary_writer->number_of_allocated_object_references = number_of_allocated_object_references;
+	}
+	*object_references_offset = binary_writer->number_of_object_references;
+
+	binary_writer->number_of_object_references += number_of_object_references;
+
+	return( 1 );
+}
+
+/* Inserts the object data that was appended at a specific offset as an object
+ * If an object with identical object data was inserted before the appended object
+ * data is discarded and the index of the existing object is returned
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_writer_insert_object_data(
+     libfplist_binary_writer_t *binary_writer,
+     size_t data_offset,
+     int *object_index,
+     libcerror_error_t **error )
+{
+	libfplist_binary_writer_object_t *object = NULL;
+	int *hash_table                          = NULL;
+	static char *function                    = "libfplist_binary_writer_insert_object_data";
+	size_t data_size                         = 0;
+	uint32_t hash_value                      = 0;
+	int hash_table_index                     = 0;
+	int hash_table_size                      = 0;
+	int safe_object_index                    = 0;
+
+	if( binary_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object index.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset >= binary_writer->object_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_size = binary_writer->object_data_size - data_offset;
+
+	if( libfplist_hash_calculate_utf8_string(
+	     &hash_value,
+	     &( binary_writer->object_data[ data_offset ] ),
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate hash of object data.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_writer->hash_table_size != 0 )
+	{
+		hash_table_index = (int) ( hash_value & (uint32_t) ( binary_writer->hash_table_size - 1 ) );
+
+		while( binary_writer->hash_table[ hash_table_index ] != 0 )
+		{
+			object = &( binary_writer->objects[ binary_writer->hash_table[ hash_table_index ] - 1 ] );
+
+			if( ( object->hash_value == hash_value )
+			 && ( object->data_size == data_size )
+			 && ( memory_compare(
+			       &( binary_writer->object_data[ object->data_offset ] ),
+			       &( binary_writer->object_data[ data_offset ] ),
+			       data_size ) == 0 ) )
+			{
+				/* Discard the duplicate object data
+				 */
+				binary_writer->object_data_size = data_offset;
+
+				*object_index = binary_writer->hash_table[ hash_table_index ] - 1;
+
+				return( 1 );
+			}
+			hash_table_index = ( hash_table_index + 1 ) & ( binary_writer->hash_table_size - 1 );
+		}
+	}
+	if( libfplist_binary_writer_append_object(
+	     binary_writer,
+	     &safe_object_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append object.",
+		 function );
+
+		return( -1 );
+	}
+	object = &( binary_writer->objects[ safe_object_index ] );
+
+	object->hash_value  = hash_value;
+	object->data_offset = data_offset;
+	object->data_size   = data_size;
+
+	/* Use a hash table that is at most half full
+	 */
+	if( ( binary_writer->number_of_hashed_objects + 1 ) > ( binary_writer->hash_table_size / 2 ) )
+	{
+		hash_table_size = binary_writer->hash_table_size;
+
+		if( hash_table_size == 0 )
+		{
+			hash_table_size = 1024;
+		}
+		else if( hash_table_size <= ( INT_MAX / 2 ) )
+		{
+			hash_table_size *= 2;
+		}
+		else
+		{
+			hash_table_size = 0;
+		}
+		if( ( hash_table_size == 0 )
+		 || ( (size_t) hash_table_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid hash table size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		hash_table = (int *) memory_allocate(
+		                      sizeof( int ) * hash_table_size );
+
+		if( hash_table == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create hash table.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     hash_table,
+		     0,
+		     sizeof( int ) * hash_table_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear hash table.",
+			 function );
+
+			memory_free(
+			 hash_table );
+
+			return( -1 );
+		}
+		/* Rehash the objects other than array and dict objects
+		 */
+		for( hash_table_index = 0;
+		     hash_table_index < binary_writer->hash_table_size;
+		     hash_table_index++ )
+		{
+			if( binary_writer->hash_table[ hash_table_index ] != 0 )
+			{
+				libfplist_binary_writer_insert_hash_table_entry(
+				 hash_table,
+				 hash_table_size,
+				 binary_writer->objects[ binary_writer->hash_table[ hash_table_index ] - 1 ].hash_value,
+				 binary_writer->hash_table[ hash_table_index ] );
+			}
+		}
+		if( binary_writer->hash_table != NULL )
+		{
+			memory_free(
+			 binary_writer->hash_table );
+		}
+		binary_writer->hash_table      = hash_table;
+		binary_writer->hash_table_size = hash_table_size;
+	}
+	libfplist_binary_writer_insert_hash_table_entry(
+	 binary_writer->hash_table,
+	 binary_writer->hash_table_size,
+	 hash_value,
+	 safe_object_index + 1 );
+
+	binary_writer->number_of_hashed_objects += 1;
+
+	*object_index = safe_object_index;
+
+	return( 1 );
+}
+
+/* Adds a string or key tag as an ASCII or UTF-16 big-endian string object
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_writer_add_string_tag(
+     libfplist_binary_writer_t *binary_writer,
+     libfplist_xml_tag_t *tag,
+     int *object_index,
+     libcerror_error_t **error )
+{
+	libuna_utf16_character_t utf16_characters[ 2 ];
+
+	const uint8_t *utf8_string                   = NULL;
+	uint8_t *data                                = NULL;
+	static char *function                        = "libfplist_binary_writer_add_string_tag";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t data_offset                           = 0;
+	size_t number_of_utf16_characters            = 0;
+	size_t utf16_character_index                 = 0;
+	size_t utf16_character_size                  = 0;
+	size_t utf16_string_index                    = 0;
+	size_t utf8_string_index                     = 0;
+	size_t utf8_string_length                    = 0;
+	uint8_t is_ascii                             = 1;
+
+	if( binary_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( tag->value != NULL )
+	 && ( tag->value_size > 0 ) )
+	{
+		utf8_string        = tag->value;
+		utf8_string_length = tag->value_size - 1;
+	}
+	for( utf8_string_index = 0;
+	     utf8_string_index < utf8_string_length;
+	     utf8_string_index++ )
+	{
+		if( utf8_string[ utf8_string_index ] >= 0x80 )
+		{
+			is_ascii = 0;
+
+			break;
+		}
+	}
+	data_offset = binary_writer->object_data_size;
+
+	if( is_ascii != 0 )
+	{
+		if( libfplist_binary_writer_append_object_data(
+		     binary_writer,
+		     0x50,
+		     (uint64_t) utf8_string_length,
+		     utf8_string_length,
+		     &data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append ASCII string object data.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf8_string_length > 0 )
+		{
+			if( memory_copy(
+			     data,
+			     utf8_string,
+			     utf8_string_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy ASCII string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	else
+	{
+		/* Determine the number of UTF-16 characters
+		 */
+		utf8_string_index = 0;
+
+		while( utf8_string_index < utf8_string_length )
+		{
+			if( libuna_unicode_character_copy_from_utf8(
+			     &unicode_character,
+			     utf8_string,
+			     utf8_string_length,
+			     &utf8_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to copy Unicode character from UTF-8.",
+				 function );
+
+				return( -1 );
+			}
+			if( libuna_unicode_character_size_to_utf16(
+			     unicode_character,
+			     &utf16_character_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to determine size of Unicode character in UTF-16.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_utf16_characters += utf16_character_size;
+		}
+		if( number_of_utf16_characters > ( (size_t) SSIZE_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of UTF-16 characters value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfplist_binary_writer_append_object_data(
+		     binary_writer,
+		     0x60,
+		     (uint64_t) number_of_utf16_characters,
+		     number_of_utf16_characters * 2,
+		     &data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append UTF-16 string object data.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string_index = 0;
+
+		while( utf8_string_index < utf8_string_length )
+		{
+			if( libuna_unicode_character_copy_from_utf8(
+			     &unicode_character,
+			     utf8_string,
+			     utf8_string_length,
+			     &utf8_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to copy Unicode character from UTF-8.",
+				 function );
+
+				return( -1 );
+			}
+			utf16_string_index = 0;
+
+			if( libuna_unicode_character_copy_to_utf16(
+			     unicode_character,
+			     utf16_characters,
+			     2,
+			     &utf16_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+				 "%s: unable to copy Unicode character to UTF-16.",
+				 function );
+
+				return( -1 );
+			}
+			for( utf16_character_index = 0;
+			     utf16_character_index < utf16_string_index;
+			     utf16_character_index++ )
+			{
+				byte_stream_copy_from_uint16_big_endian(
+				 data,
+				 utf16_characters[ utf16_character_index ] );
+
+				data += 2;
+			}
+		}
+	}
+	if( libfplist_binary_writer_insert_object_data(
+	     binary_writer,
+	     data_offset,
+	     object_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to insert string object.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Adds an integer tag as an integer object of 1, 2, 4, 8 or 16 bytes
+ * 1, 2 and 4 byte integers are unsigned, 8 and 16 byte integers are signed
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_writer_add_integer_tag(
+     libfplist_binary_writer_t *binary_writer,
+     libfplist_xml_tag_t *tag,
+     int *object_index,
+     libcerror_error_t **error )
+{
+	uint8_t *data         = NULL;
+	static char *function = "libfplist_binary_writer_add_integer_tag";
+	size_t data_offset    = 0;
+	uint64_t lower_64bit  = 0;
+	uint64_t upper_64bit  = 0;
+	uint8_t integer_size  = 0;
+	uint8_t is_negative   = 0;
+
+	if( binary_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_integer_value(
+	     tag,
+	     &upper_64bit,
+	     &lower_64bit,
+	     &is_negative,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve integer value.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_negative == 0 )
+	{
+		if( ( upper_64bit == 0 )
+		 && ( lower_64bit <= (uint64_t) INT64_MAX ) )
+		{
+			integer_size = (uint8_t) libfplist_binary_writer_get_value_size(
+			                          lower_64bit );
+		}
+		else if( ( upper_64bit & 0x8000000000000000ULL ) == 0 )
+		{
+			integer_size = 16;
+		}
+	}
+	else
+	{
+		if( ( upper_64bit == 0 )
+		 && ( lower_64bit <= 0x8000000000000000ULL ) )
+		{
+			integer_size = 8;
+		}
+		else if( ( upper_64bit < 0x8000000000000000ULL )
+		      || ( ( upper_64bit == 0x8000000000000000ULL )
+		       && ( lower_64bit == 0 ) ) )
+		{
+			integer_size = 16;
+		}
+		/* Store the magnitude as a two's complement value
+		 */
+		upper_64bit = ~upper_64bit;
+		lower_64bit = ~lower_64bit + 1;
+
+		if( lower_64bit == 0 )
+		{
+			upper_64bit += 1;
+		}
+	}
+	if( integer_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid integer value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = binary_writer->object_data_size;
+
+	/* The integer marker contains the base 2 logarithm of the integer size
+	 */
+	if( libfplist_binary_writer_append_object_data(
+	     binary_writer,
+	     (uint8_t) ( 0x10 | ( integer_size == 1 ? 0 : ( integer_size == 2 ? 1 : ( integer_size == 4 ? 2 : ( integer_size == 8 ? 3 : 4 ) ) ) ) ),
+	     0,
+	     (size_t) integer_size,
+	     &data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append integer object data.",
+		 function );
+
+		return( -1 );
+	}
+	if( integer_size == 16 )
+	{
+		byte_stream_copy_from_uint64_big_endian(
+		 data,
+		 upper_64bit );
+
+		byte_stream_copy_from_uint64_big_endian(
+		 &( data[ 8 ] ),
+		 lower_64bit );
+	}
+	else
+	{
+		libfplist_binary_writer_copy_from_uint64_big_endian(
+		 data,
+		 integer_size,
+		 lower_64bit );
+	}
+	if( libfplist_binary_writer_insert_object_data(
+	     binary_writer,
+	     data_offset,
+	     object_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to insert integer object.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UID value of a dict tag
+ * A UID is represented as a dict with a single CF$UID key and a non-negative integer value:
+ * <dict><key>CF$UID</key><integer>#</integer></dict>
+ * Returns 1 if successful, 0 if the dict tag does not represent a UID or -1 on error
+ */
+int libfplist_binary_writer_get_uid_value(
+     libfplist_xml_tag_t *tag,
+     uint64_t *uid_value,
+     libcerror_error_t **error )
+{
+	libfplist_xml_tag_t *element_tag = NULL;
+	libfplist_xml_tag_t *value_tag   = NULL;
+	static char *function            = "libfplist_binary_writer_get_uid_value";
+	uint64_t lower_64bit             = 0;
+	uint64_t upper_64bit             = 0;
+	uint8_t is_negative              = 0;
+	int element_index                = 0;
+	int number_of_elements           = 0;
+	int number_of_entries            = 0;
+	int number_of_keys               = 0;
+	int result                       = 0;
+	int value_type                   = 0;
+
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( uid_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UID value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_entries(
+	     tag,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries != 1 )
+	{
+		return( 0 );
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfplist_xml_tag_get_element(
+		     tag,
+		     element_index,
+		     &element_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		result = libfplist_xml_tag_compare_name(
+		          element_tag,
+		          (uint8_t *) "key",
+		          3,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of element tag: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( ( element_tag->value_size != 7 )
+			 || ( narrow_string_compare(
+			       element_tag->value,
+			       "CF$UID",
+			       6 ) != 0 ) )
+			{
+				return( 0 );
+			}
+			number_of_keys++;
+
+			continue;
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     element_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of element tag: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		if( value_type == LIBFPLIST_VALUE_TYPE_INTEGER )
+		{
+			value_tag = element_tag;
+		}
+		else if( value_type != LIBFPLIST_VALUE_TYPE_UNKNOWN )
+		{
+			return( 0 );
+		}
+	}
+	if( ( number_of_keys != 1 )
+	 || ( value_tag == NULL ) )
+	{
+		return( 0 );
+	}
+	if( libfplist_xml_tag_get_integer_value(
+	     value_tag,
+	     &upper_64bit,
+	     &lower_64bit,
+	     &is_negative,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve integer value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( is_negative != 0 )
+	 || ( upper_64bit != 0 ) )
+	{
+		return( 0 );
+	}
+	*uid_value = lower_64bit;
+
+	return( 1 );
+}
+
+/* Adds a UID value as an UID object
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_writer_add_uid_value(
+     libfplist_binary_writer_t *binary_writer,
+     uint64_t uid_value,
+     int *object_index,
+     libcerror_error_t **error )
+{
+	uint8_t *data          = NULL;
+	static char *function  = "libfplist_binary_writer_add_uid_value";
+	size_t data_offset     = 0;
+	uint8_t uid_value_size = 0;
+
+	if( binary_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary writer.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = binary_writer->object_data_size;
+
+	uid_value_size = (uint8_t) libfplist_binary_writer_get_value_size(
+	                            uid_value );
+
+	/* The UID marker contains the UID size - 1
+	 */
+	if( libfplist_binary_writer_append_object_data(
+	     binary_writer,
+	     (uint8_t) ( 0x80 | ( uid_value_size - 1 ) ),
+	     0,
+	     (size_t) uid_value_size,
+	     &data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append UID object data.",
+		 function );
+
+		return( -1 );
+	}
+	libfplist_binary_writer_copy_from_uint64_big_endian(
+	 data,
+	 uid_value_size,
+	 uid_value );
+
+	if( libfplist_binary_writer_insert_object_data(
+	     binary_writer,
+	     data_offset,
+	     object_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to insert object.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Adds an array or dict object of which the element objects were added before
+ * The element object indexes of a dict contain the key and value object index of each entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_writer_add_container_object(
+     libfplist_binary_writer_t *binary_writer,
+     uint8_t container_marker,
+     const int *element_object_indexes,
+     size_t number_of_entries,
+     int *object_index,
+     libcerror_error_t **error )
+{
+	static char *function              = "libfplist_binary_writer_add_container_object";
+	size_t entry_index                 = 0;
+	size_t number_of_object_references = 0;
+	size_t object_references_offset    = 0;
+	int safe_object_index              = 0;
+
+	if( binary_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( container_marker != 0xa0 )
+	 && ( container_marker != 0xd0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported container marker: 0x%02" PRIx8 ".",
+		 function,
+		 container_marker );
+
+		return( -1 );
+	}
+	if( ( element_object_indexes == NULL )
+	 && ( number_of_entries > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element object indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries > ( (size_t) INT_MAX / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object index.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_object_references = number_of_entries;
+
+	if( container_marker == 0xd0 )
+	{
+		number_of_object_references *= 2;
+	}
+	if( libfplist_binary_writer_append_object(
+	     binary_writer,
+	     &safe_object_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append container object.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_binary_writer_append_object_references(
+	     binary_writer,
+	     number_of_object_references,
+	     &object_references_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append container object references.",
+		 function );
+
+		return( -1 );
+	}
+	binary_writer->objects[ safe_object_index ].container_marker = container_marker;
+	binary_writer->objects[ safe_object_index ].data_offset      = object_references_offset;
+	binary_writer->objects[ safe_object_index ].data_size        = number_of_entries;
+
+	/* The key references of a dict are followed by the value references
+	 */
+	if( container_marker == 0xa0 )
+	{
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			binary_writer->object_references[ object_references_offset + entry_index ] = element_object_indexes[ entry_index ];
+		}
+	}
+	else
+	{
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			binary_writer->object_references[ object_references_offset + entry_index ]                     = element_object_indexes[ entry_index * 2 ];
+			binary_writer->object_references[ object_references_offset + number_of_entries + entry_index ] = element_object_indexes[ ( entry_index * 2 ) + 1 ];
+		}
+	}
+	*object_index = safe_object_index;
+
+	return( 1 );
+}
+
+/* Adds an array tag and its elements as an array object
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_writer_add_array_tag(
+     libfplist_binary_writer_t *binary_writer,
+     libfplist_xml_tag_t *tag,
+     int recursion_depth,
+     int *object_index,
+     libcerror_error_t **error )
+{
+	libfplist_xml_tag_t *element_tag = NULL;
+	static char *function            = "libfplist_binary_writer_add_array_tag";
+	size_t object_references_offset  = 0;
+	size_t value_index               = 0;
+	size_t number_of_values          = 0;
+	int element_index                = 0;
+	int element_object_index         = 0;
+	int number_of_elements           = 0;
+	int safe_object_index            = 0;
+	int value_type                   = 0;
+
+	if( binary_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	/* Ignore text nodes
+	 */
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfplist_xml_tag_get_element(
+		     tag,
+		     element_index,
+		     &element_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     element_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of element tag: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		if( value_type != LIBFPLIST_VALUE_TYPE_UNKNOWN )
+		{
+			number_of_values++;
+		}
+	}
+	/* The array object is added before its elements so that it precedes them in the object table
+	 */
+	if( libfplist_binary_writer_append_object(
+	     binary_writer,
+	     &safe_object_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append array object.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_binary_writer_append_object_references(
+	     binary_writer,
+	     number_of_values,
+	     &object_references_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append array object references.",
+		 function );
+
+		return( -1 );
+	}
+	binary_writer->objects[ safe_object_index ].container_marker = 0xa0;
+	binary_writer->objects[ safe_object_index ].data_offset      = object_references_offset;
+	binary_writer->objects[ safe_object_index ].data_size        = number_of_values;
+
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfplist_xml_tag_get_element(
+		     tag,
+		     element_index,
+		     &element_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     element_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of element tag: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		if( value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+		{
+			continue;
+		}
+		if( libfplist_binary_writer_add_tag(
+		     binary_writer,
+		     element_tag,
+		     recursion_depth + 1,
+		     &element_object_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to add element tag: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		binary_writer->object_references[ object_references_offset + value_index ] = element_object_index;
+
+		value_index++;
+	}
+	*object_index = safe_object_index;
+
+	return( 1 );
+}
+
+/* Adds a dict tag and its key and value elements as a dict object
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_writer_add_dict_tag(
+     libfplist_binary_writer_t *binary_writer,
+     libfplist_xml_tag_t *tag,
+     int recursion_depth,
+     int *object_index,
+     libcerror_error_t **error )
+{
+	libfplist_xml_tag_t *element_tag = NULL;
+	libfplist_xml_tag_t *key_tag     = NULL;
+	static char *function            = "libfplist_binary_writer_add_dict_tag";
+	size_t entry_index               = 0;
+	size_t number_of_entries         = 0;
+	size_t object_references_offset  = 0;
+	int element_index                = 0;
+	int element_object_index         = 0;
+	int number_of_elements           = 0;
+	int result                       = 0;
+	int safe_object_index            = 0;
+	int value_type                   = 0;
+
+	if( binary_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	/* Ignore text nodes and values without a key
+	 */
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfplist_xml_tag_get_element(
+		     tag,
+		     element_index,
+		     &element_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		result = libfplist_xml_tag_compare_name(
+		          element_tag,
+		          (uint8_t *) "key",
+		          3,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of element tag: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			key_tag = element_tag;
+
+			continue;
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     element_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of element tag: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		if( ( value_type != LIBFPLIST_VALUE_TYPE_UNKNOWN )
+		 && ( key_tag != NULL ) )
+		{
+			number_of_entries++;
+
+			key_tag = NULL;
+		}
+	}
+	/* The dict object is added before its keys and values so that it precedes them in the object table
+	 */
+	if( libfplist_binary_writer_append_object(
+	     binary_writer,
+	     &safe_object_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append dict object.",
+		 function );
+
+		return( -1 );
+	}
+	/* The key references are followed by the value references
+	 */
+	if( libfplist_binary_writer_append_object_references(
+	     binary_writer,
+	     number_of_entries * 2,
+	     &object_references_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append dict object references.",
+		 function );
+
+		return( -1 );
+	}
+	binary_writer->objects[ safe_object_index ].container_marker = 0xd0;
+	binary_writer->objects[ safe_object_index ].data_offset      = object_references_offset;
+	binary_writer->objects[ safe_object_index ].data_size        = number_of_entries;
+
+	/* The keys are added before the values as in the object table of other
+	 * implementations
+	 */
+	key_tag = NULL;
+
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfplist_xml_tag_get_element(
+		     tag,
+		     element_index,
+		     &element_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		result = libfplist_xml_tag_compare_name(
+		          element_tag,
+		          (uint8_t *) "key",
+		          3,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of element tag: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			key_tag = element_tag;
+
+			continue;
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     element_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of element tag: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		if( ( value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+		 || ( key_tag == NULL ) )
+		{
+			continue;
+		}
+		if( libfplist_binary_writer_add_string_tag(
+		     binary_writer,
+		     key_tag,
+		     &element_object_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to add key tag of element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		binary_writer->object_references[ object_references_offset + entry_index ] = element_object_index;
+
+		entry_index++;
+
+		key_tag = NULL;
+	}
+	entry_index = 0;
+	key_tag     = NULL;
+
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfplist_xml_tag_get_element(
+		     tag,
+		     element_index,
+		     &element_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		result = libfplist_xml_tag_compare_name(
+		          element_tag,
+		          (uint8_t *) "key",
+		          3,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of element tag: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			key_tag = element_tag;
+
+			continue;
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     element_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of element tag: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		if( ( value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+		 || ( key_tag == NULL ) )
+		{
+			continue;
+		}
+		if( libfplist_binary_writer_add_tag(
+		     binary_writer,
+		     element_tag,
+		     recursion_depth + 1,
+		     &element_object_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to add element tag: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		binary_writer->object_references[ object_references_offset + number_of_entries + entry_index ] = element_object_index;
+
+		entry_index++;
+
+		key_tag = NULL;
+	}
+	*object_index = safe_object_index;
+
+	return( 1 );
+}
+
+/* Adds a tag and its elements as objects
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_writer_add_tag(
+     libfplist_binary_writer_t *binary_writer,
+     libfplist_xml_tag_t *tag,
+     int recursion_depth,
+     int *object_index,
+     libcerror_error_t **error )
+{
+	uint8_t *data                = NULL;
+	static char *function        = "libfplist_binary_writer_add_tag";
+	size_t data_offset           = 0;
+	size_t value_data_index      = 0;
+	size_t value_data_size       = 0;
+	uint64_t floating_point_bits = 0;
+	uint64_t uid_value           = 0;
+	uint32_t nanoseconds         = 0;
+	int64_t posix_time           = 0;
+	double floating_point_value  = 0.0;
+	uint8_t object_marker        = 0;
+	int result                   = 0;
+	int value_type               = 0;
+
+	if( binary_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFPLIST_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_value_type(
+	     tag,
+	     &value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = binary_writer->object_data_size;
+
+	switch( value_type )
+	{
+		case LIBFPLIST_VALUE_TYPE_ARRAY:
+			if( libfplist_binary_writer_add_array_tag(
+			     binary_writer,
+			     tag,
+			     recursion_depth,
+			     object_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add array tag.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+
+		case LIBFPLIST_VALUE_TYPE_BINARY_DATA:
+			if( libfplist_xml_tag_get_value_data_size(
+			     tag,
+			     &value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value data size.",
+				 function );
+
+				return( -1 );
+			}
+			if( libfplist_binary_writer_append_object_data(
+			     binary_writer,
+			     0x40,
+			     (uint64_t) value_data_size,
+			     value_data_size,
+			     &data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append data object data.",
+				 function );
+
+				return( -1 );
+			}
+			if( value_data_size > 0 )
+			{
+				if( libfplist_xml_tag_copy_value_data(
+				     tag,
+				     data,
+				     value_data_size,
+				     &value_data_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy value data.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			break;
+
+		case LIBFPLIST_VALUE_TYPE_BOOLEAN:
+			result = libfplist_xml_tag_compare_name(
+			          tag,
+			          (uint8_t *) "true",
+			          4,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to compare name of tag.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				object_marker = 0x09;
+			}
+			else
+			{
+				object_marker = 0x08;
+			}
+			if( libfplist_binary_writer_append_object_data(
+			     binary_writer,
+			     object_marker,
+			     0,
+			     0,
+			     &data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append boolean object data.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case LIBFPLIST_VALUE_TYPE_DATE:
+			if( libfplist_xml_tag_get_date_time_value(
+			     tag,
+			     &posix_time,
+			     &nanoseconds,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve date and time value.",
+				 function );
+
+				return( -1 );
+			}
+			/* The date is stored as the number of seconds since January 1, 2001 00:00:00 UTC
+			 */
+			floating_point_value = (double) ( posix_time - 978307200 ) + ( (double) nanoseconds / 1000000000.0 );
+
+			if( libfplist_binary_writer_append_object_data(
+			     binary_writer,
+			     0x33,
+			     0,
+			     8,
+			     &data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append date object data.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     &floating_point_bits,
+			     &floating_point_value,
+			     sizeof( double ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy date and time value.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_copy_from_uint64_big_endian(
+			 data,
+			 floating_point_bits );
+
+			break;
+
+		case LIBFPLIST_VALUE_TYPE_DICTIONARY:
+			result = libfplist_binary_writer_get_uid_value(
+			          tag,
+			          &uid_value,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve UID value.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				if( libfplist_binary_writer_add_dict_tag(
+				     binary_writer,
+				     tag,
+				     recursion_depth,
+				     object_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to add dict tag.",
+					 function );
+
+					return( -1 );
+				}
+				return( 1 );
+			}
+			if( libfplist_binary_writer_add_uid_value(
+			     binary_writer,
+			     uid_value,
+			     object_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add UID value.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+
+		case LIBFPLIST_VALUE_TYPE_FLOATING_POINT:
+			if( ( tag->value == NULL )
+			 || ( tag->value_size == 0 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: invalid tag - missing value.",
+				 function );
+
+				return( -1 );
+			}
+			result = libfplist_floating_point_copy_from_utf8_string(
+			          tag->value,
+			          tag->value_size - 1,
+			          &floating_point_value,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy value to floating point.",
+				 function );
+
+				return( -1 );
+			}
+			if( libfplist_binary_writer_append_object_data(
+			     binary_writer,
+			     0x23,
+			     0,
+			     8,
+			     &data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append real object data.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     &floating_point_bits,
+			     &floating_point_value,
+			     sizeof( double ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy floating point value.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_copy_from_uint64_big_endian(
+			 data,
+			 floating_point_bits );
+
+			break;
+
+		case LIBFPLIST_VALUE_TYPE_INTEGER:
+			if( libfplist_binary_writer_add_integer_tag(
+			     binary_writer,
+			     tag,
+			     object_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add integer tag.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+
+		case LIBFPLIST_VALUE_TYPE_STRING:
+			if( libfplist_binary_writer_add_string_tag(
+			     binary_writer,
+			     tag,
+			     object_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add string tag.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value type.",
+			 function );
+
+			return( -1 );
+	}
+	if( libfplist_binary_writer_insert_object_data(
+	     binary_writer,
+	     data_offset,
+	     object_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to insert object.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reorders the objects so that every object precedes the objects it references
+ * The objects are ordered as libfplist_binary_writer_add_tag adds them, where the keys
+ * of a dict precede its values and the root object is the first object
+ * Objects that cannot be reached from the root object are kept after the other objects
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_writer_reorder_objects(
+     libfplist_binary_writer_t *binary_writer,
+     int *root_object_index,
+     libcerror_error_t **error )
+{
+	libfplist_binary_writer_object_t *object      = NULL;
+	libfplist_binary_writer_object_t *new_objects = NULL;
+	int *new_object_indexes                       = NULL;
+	int *object_index_stack                       = NULL;
+	static char *function                         = "libfplist_binary_writer_reorder_objects";
+	size_t entry_index                            = 0;
+	size_t object_reference_index                 = 0;
+	size_t object_references_offset               = 0;
+	size_t stack_depth                            = 0;
+	int hash_table_index                          = 0;
+	int new_object_index                          = 0;
+	int object_index                              = 0;
+	int referenced_object_index                   = 0;
+
+	if( binary_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( root_object_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid root object index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *root_object_index < 0 )
+	 || ( *root_object_index >= binary_writer->number_of_objects ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid root object index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	new_object_indexes = (int *) memory_allocate(
+	                              sizeof( int ) * binary_writer->number_of_objects );
+
+	if( new_object_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create new object indexes.",
+		 function );
+
+		goto on_error;
+	}
+	/* Every object index on the stack is the root object index or an object reference
+	 */
+	object_index_stack = (int *) memory_allocate(
+	                              sizeof( int ) * ( binary_writer->number_of_object_references + 1 ) );
+
+	if( object_index_stack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create object index stack.",
+		 function );
+
+		goto on_error;
+	}
+	new_objects = (libfplist_binary_writer_object_t *) memory_allocate(
+	                                                    sizeof( libfplist_binary_writer_object_t ) * binary_writer->number_of_allocated_objects );
+
+	if( new_objects == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create new objects.",
+		 function );
+
+		goto on_error;
+	}
+	for( object_index = 0;
+	     object_index < binary_writer->number_of_objects;
+	     object_index++ )
+	{
+		new_object_indexes[ object_index ] = -1;
+	}
+	object_index_stack[ stack_depth++ ] = *root_object_index;
+
+	while( stack_depth > 0 )
+	{
+		object_index = object_index_stack[ --stack_depth ];
+
+		if( new_object_indexes[ object_index ] != -1 )
+		{
+			continue;
+		}
+		new_object_indexes[ object_index ] = new_object_index++;
+
+		object = &( binary_writer->objects[ object_index ] );
+
+		if( object->container_marker == 0 )
+		{
+			continue;
+		}
+		object_references_offset = object->data_offset;
+
+		if( object->container_marker == 0xd0 )
+		{
+			/* The keys of a dict are added before its values
+			 */
+			for( entry_index = 0;
+			     entry_index < object->data_size;
+			     entry_index++ )
+			{
+				referenced_object_index = binary_writer->object_references[ object_references_offset + entry_index ];
+
+				if( ( referenced_object_index < 0 )
+				 || ( referenced_object_index >= binary_writer->number_of_objects ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid object reference: %" PRIzd " value out of bounds.",
+					 function,
+					 object_references_offset + entry_index );
+
+					goto on_error;
+				}
+				if( new_object_indexes[ referenced_object_index ] == -1 )
+				{
+					new_object_indexes[ referenced_object_index ] = new_object_index++;
+				}
+			}
+			object_references_offset += object->data_size;
+		}
+		/* The element objects are pushed in reverse order so that the first element is visited first
+		 */
+		for( entry_index = object->data_size;
+		     entry_index > 0;
+		     entry_index-- )
+		{
+			referenced_object_index = binary_writer->object_references[ object_references_offset + entry_index - 1 ];
+
+			if( ( referenced_object_index < 0 )
+			 || ( referenced_object_index >= binary_writer->number_of_objects ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid object reference: %" PRIzd " value out of bounds.",
+				 function,
+				 object_references_offset + entry_index - 1 );
+
+				goto on_error;
+			}
+			object_index_stack[ stack_depth++ ] = referenced_object_index;
+		}
+	}
+	for( object_index = 0;
+	     object_index < binary_writer->number_of_objects;
+	     object_index++ )
+	{
+		if( new_object_indexes[ object_index ] == -1 )
+		{
+			new_object_indexes[ object_index ] = new_object_index++;
+		}
+		new_objects[ new_object_indexes[ object_index ] ] = binary_writer->objects[ object_index ];
+	}
+	for( object_reference_index = 0;
+	     object_reference_index < binary_writer->number_of_object_references;
+	     object_reference_index++ )
+	{
+		binary_writer->object_references[ object_reference_index ] = new_object_indexes[ binary_writer->object_references[ object_reference_index ] ];
+	}
+	for( hash_table_index = 0;
+	     hash_table_index < binary_writer->hash_table_size;
+	     hash_table_index++ )
+	{
+		if( binary_writer->hash_table[ hash_table_index ] != 0 )
+		{
+			binary_writer->hash_table[ hash_table_index ] = new_object_indexes[ binary_writer->hash_table[ hash_table_index ] - 1 ] + 1;
+		}
+	}
+	*root_object_index = new_object_indexes[ *root_object_index ];
+
+	memory_free(
+	 binary_writer->objects );
+
+	binary_writer->objects = new_objects;
+
+	memory_free(
+	 object_index_stack );
+
+	memory_free(
+	 new_object_indexes );
+
+	return( 1 );
+
+on_error:
+	if( new_objects != NULL )
+	{
+		memory_free(
+		 new_objects );
+	}
+	if( object_index_stack != NULL )
+	{
+		memory_free(
+		 object_index_stack );
+	}
+	if( new_object_indexes != NULL )
+	{
+		memory_free(
+		 new_object_indexes );
+	}
+	return( -1 );
+}
+
+/* Copies the objects to a newly allocated binary property list byte stream
+ * The smallest object reference and offset sizes that can hold the values are used
+ * The caller is responsible for freeing the byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_binary_writer_copy_to_byte_stream(
+     libfplist_binary_writer_t *binary_writer,
+     int root_object_index,
+     uint8_t **byte_stream,
+     size_t *byte_stream_size,
+     libcerror_error_t **error )
+{
+	libfplist_binary_writer_object_t *object = NULL;
+	uint8_t *safe_byte_stream                = NULL;
+	uint8_t *trailer_data                    = NULL;
+	static char *function                    = "libfplist_binary_writer_copy_to_byte_stream";
+	size_t byte_stream_offset                = 0;
+	size_t last_object_offset                = 0;
+	size_t number_of_object_references       = 0;
+	size_t object_marker_size                = 0;
+	size_t object_reference_index            = 0;
+	size_t object_size                       = 0;
+	size_t offset_table_offset               = 0;
+	size_t safe_byte_stream_size             = 0;
+	uint8_t object_reference_size            = 0;
+	uint8_t offset_size                      = 0;
+	int object_index                         = 0;
+
+	if( binary_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *byte_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid byte stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( root_object_index < 0 )
+	 || ( root_object_index >= binary_writer->number_of_objects ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid root object index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	object_reference_size = (uint8_t) libfplist_binary_writer_get_value_size(
+	                                   (uint64_t) ( binary_writer->number_of_objects - 1 ) );
+
+	/* Determine the object offsets and the offset of the offset table
+	 */
+	byte_stream_offset = LIBFPLIST_BINARY_WRITER_HEADER_SIZE;
+
+	for( object_index = 0;
+	     object_index < binary_writer->number_of_objects;
+	     object_index++ )
+	{
+		object = &( binary_writer->objects[ object_index ] );
+
+		if( object->container_marker == 0 )
+		{
+			object_size = object->data_size;
+		}
+		else
+		{
+			if( libfplist_binary_writer_copy_object_marker(
+			     NULL,
+			     0,
+			     object->container_marker,
+			     (uint64_t) object->data_size,
+			     &object_marker_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine object marker size.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_object_references = object->data_size;
+
+			if( object->container_marker == 0xd0 )
+			{
+				number_of_object_references *= 2;
+			}
+			object_size = object_marker_size + ( number_of_object_references * object_reference_size );
+		}
+		if( object_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE - byte_stream_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid byte stream size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		last_object_offset  = byte_stream_offset;
+		byte_stream_offset += object_size;
+	}
+	offset_table_offset = byte_stream_offset;
+
+	offset_size = (uint8_t) libfplist_binary_writer_get_value_size(
+	                         (uint64_t) last_object_offset );
+
+	if( (size_t) binary_writer->number_of_objects > ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBFPLIST_BINARY_WRITER_TRAILER_SIZE - offset_table_offset ) / offset_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_byte_stream_size = offset_table_offset
+	                      + ( (size_t) binary_writer->number_of_objects * offset_size )
+	                      + LIBFPLIST_BINARY_WRITER_TRAILER_SIZE;
+
+	safe_byte_stream = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * safe_byte_stream_size );
+
+	if( safe_byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     safe_byte_stream,
+	     "bplist00",
+	     LIBFPLIST_BINARY_WRITER_HEADER_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy header.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_offset = LIBFPLIST_BINARY_WRITER_HEADER_SIZE;
+
+	for( object_index = 0;
+	     object_index < binary_writer->number_of_objects;
+	     object_index++ )
+	{
+		object = &( binary_writer->objects[ object_index ] );
+
+		libfplist_binary_writer_copy_from_uint64_big_endian(
+		 &( safe_byte_stream[ offset_table_offset + ( (size_t) object_index * offset_size ) ] ),
+		 offset_size,
+		 (uint64_t) byte_stream_offset );
+
+		if( object->container_marker == 0 )
+		{
+			if( memory_copy(
+			     &( safe_byte_stream[ byte_stream_offset ] ),
+			     &( binary_writer->object_data[ object->data_offset ] ),
+			     object->data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy object: %d data.",
+				 function,
+				 object_index );
+
+				goto on_error;
+			}
+			byte_stream_offset += object->data_size;
+		}
+		else
+		{
+			if( libfplist_binary_writer_copy_object_marker(
+			     &( safe_byte_stream[ byte_stream_offset ] ),
+			     offset_table_offset - byte_stream_offset,
+			     object->container_marker,
+			     (uint64_t) object->data_size,
+			     &object_marker_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy object: %d marker.",
+				 function,
+				 object_index );
+
+				goto on_error;
+			}
+			byte_stream_offset += object_marker_size;
+
+			number_of_object_references = object->data_size;
+
+			if( object->container_marker == 0xd0 )
+			{
+				number_of_object_references *= 2;
+			}
+			for( object_reference_index = 0;
+			     object_reference_index < number_of_object_references;
+			     object_reference_index++ )
+			{
+				libfplist_binary_writer_copy_from_uint64_big_endian(
+				 &( safe_byte_stream[ byte_stream_offset ] ),
+				 object_reference_size,
+				 (uint64_t) binary_writer->object_references[ object->data_offset + object_reference_index ] );
+
+				byte_stream_offset += object_reference_size;
+			}
+		}
+	}
+	/* The trailer starts with 5 unused bytes and a sort version
+	 */
+	trailer_data = &( safe_byte_stream[ safe_byte_stream_size - LIBFPLIST_BINARY_WRITER_TRAILER_SIZE ] );
+
+	if( memory_set(
+	     trailer_data,
+	     0,
+	     6 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear trailer.",
+		 function );
+
+		goto on_error;
+	}
+	trailer_data[ 6 ] = offset_size;
+	trailer_data[ 7 ] = object_reference_size;
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( trailer_data[ 8 ] ),
+	 (uint64_t) binary_writer->number_of_objects );
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( trailer_data[ 16 ] ),
+	 (uint64_t) root_object_index );
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( trailer_data[ 24 ] ),
+	 (uint64_t) offset_table_offset );
+
+	*byte_stream      = safe_byte_stream;
+	*byte_stream_size = safe_byte_stream_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_byte_stream != NULL )
+	{
+		memory_free(
+		 safe_byte_stream );
+	}
+	return( -1 );
+}
+
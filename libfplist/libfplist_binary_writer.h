@@ -0,0 +1,230 @@
+/*
+ * Binary property list writer functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFPLIST_BINARY_WRITER_H )
+#define _LIBFPLIST_BINARY_WRITER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfplist_libcerror.h"
+#include "libfplist_xml_tag.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the binary property list header
+ */
+#define LIBFPLIST_BINARY_WRITER_HEADER_SIZE	8
+
+/* The size of the binary property list trailer
+ */
+#define LIBFPLIST_BINARY_WRITER_TRAILER_SIZE	32
+
+typedef struct libfplist_binary_writer_object libfplist_binary_writer_object_t;
+
+struct libfplist_binary_writer_object
+{
+	/* The object marker of an array or dict object or 0 for other objects
+	 */
+	uint8_t container_marker;
+
+	/* The hash value of the encoded object data
+	 */
+	uint32_t hash_value;
+
+	/* The offset of the encoded object data in the object data
+	 * or of the first object reference in the object references of an array or dict object
+	 */
+	size_t data_offset;
+
+	/* The size of the encoded object data
+	 * or the number of entries of an array or dict object
+	 */
+	size_t data_size;
+};
+
+typedef struct libfplist_binary_writer libfplist_binary_writer_t;
+
+struct libfplist_binary_writer
+{
+	/* The objects
+	 */
+	libfplist_binary_writer_object_t *objects;
+
+	/* The number of objects
+	 */
+	int number_of_objects;
+
+	/* The number of allocated objects
+	 */
+	int number_of_allocated_objects;
+
+	/* The encoded object data of the objects other than array and dict objects
+	 */
+	uint8_t *object_data;
+
+	/* The object data size
+	 */
+	size_t object_data_size;
+
+	/* The allocated object data size
+	 */
+	size_t allocated_object_data_size;
+
+	/* The object references of the array and dict objects
+	 */
+	int *object_references;
+
+	/* The number of object references
+	 */
+	size_t number_of_object_references;
+
+	/* The number of allocated object references
+	 */
+	size_t number_of_allocated_object_references;
+
+	/* The hash table used to share identical objects
+	 * contains the object index + 1 or 0 if the slot is empty
+	 */
+	int *hash_table;
+
+	/* The hash table size, which is a power of 2
+	 */
+	int hash_table_size;
+
+	/* The number of objects in the hash table
+	 */
+	int number_of_hashed_objects;
+};
+
+int libfplist_binary_writer_initialize(
+     libfplist_binary_writer_t **binary_writer,
+     libcerror_error_t **error );
+
+int libfplist_binary_writer_free(
+     libfplist_binary_writer_t **binary_writer,
+     libcerror_error_t **error );
+
+int libfplist_binary_writer_copy_object_marker(
+     uint8_t *data,
+     size_t data_size,
+     uint8_t object_marker,
+     uint64_t number_of_entries,
+     size_t *object_marker_size,
+     libcerror_error_t **error );
+
+int libfplist_binary_writer_append_object_data(
+     libfplist_binary_writer_t *binary_writer,
+     uint8_t object_marker,
+     uint64_t number_of_entries,
+     size_t data_size,
+     uint8_t **data,
+     libcerror_error_t **error );
+
+int libfplist_binary_writer_append_object(
+     libfplist_binary_writer_t *binary_writer,
+     int *object_index,
+     libcerror_error_t **error );
+
+int libfplist_binary_writer_append_object_references(
+     libfplist_binary_writer_t *binary_writer,
+     size_t number_of_object_references,
+     size_t *object_references_offset,
+     libcerror_error_t **error );
+
+int libfplist_binary_writer_insert_object_data(
+     libfplist_binary_writer_t *binary_writer,
+     size_t data_offset,
+     int *object_index,
+     libcerror_error_t **error );
+
+int libfplist_binary_writer_add_string_tag(
+     libfplist_binary_writer_t *binary_writer,
+     libfplist_xml_tag_t *tag,
+     int *object_index,
+     libcerror_error_t **error );
+
+int libfplist_binary_writer_add_integer_tag(
+     libfplist_binary_writer_t *binary_writer,
+     libfplist_xml_tag_t *tag,
+     int *object_index,
+     libcerror_error_t **error );
+
+int libfplist_binary_writer_get_uid_value(
+     libfplist_xml_tag_t *tag,
+     uint64_t *uid_value,
+     libcerror_error_t **error );
+
+int libfplist_binary_writer_add_uid_value(
+     libfplist_binary_writer_t *binary_writer,
+     uint64_t uid_value,
+     int *object_index,
+     libcerror_error_t **error );
+
+int libfplist_binary_writer_add_container_object(
+     libfplist_binary_writer_t *binary_writer,
+     uint8_t container_marker,
+     const int *element_object_indexes,
+     size_t number_of_entries,
+     int *object_index,
+     libcerror_error_t **error );
+
+int libfplist_binary_writer_add_array_tag(
+     libfplist_binary_writer_t *binary_writer,
+     libfplist_xml_tag_t *tag,
+     int recursion_depth,
+     int *object_index,
+     libcerror_error_t **error );
+
+int libfplist_binary_writer_add_dict_tag(
+     libfplist_binary_writer_t *binary_writer,
+     libfplist_xml_tag_t *tag,
+     int recursion_depth,
+     int *object_index,
+     libcerror_error_t **error );
+
+int libfplist_binary_writer_add_tag(
+     libfplist_binary_writer_t *binary_writer,
+     libfplist_xml_tag_t *tag,
+     int recursion_depth,
+     int *object_index,
+     libcerror_error_t **error );
+
+int libfplist_binary_writer_reorder_objects(
+     libfplist_binary_writer_t *binary_writer,
+     int *root_object_index,
+     libcerror_error_t **error );
+
+int libfplist_binary_writer_copy_to_byte_stream(
+     libfplist_binary_writer_t *binary_writer,
+     int root_object_index,
+     uint8_t **byte_stream,
+     size_t *byte_stream_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFPLIST_BINARY_WRITER_H ) */
+
@@ -0,0 +1,526 @@
+/*
+ * Date and time functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfplist_date_time.h"
+#include "libfplist_libcerror.h"
+
+/* Copies a date and time from an ISO 8601 formatted UTF-8 string
+ * The string is expected to be formatted as: YYYY-MM-DDThh:mm:ss[.fraction][Z]
+ * The date and time is returned as a signed number of seconds since
+ * January 1, 1970 00:00:00 UTC and the number of nanoseconds within the second
+ * Returns 1 if successful, 0 if the string is not a supported date and time or -1 on error
+ */
+int libfplist_date_time_copy_from_utf8_string(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int64_t *posix_time,
+     uint32_t *nanoseconds,
+     libcerror_error_t **error )
+{
+	static char *function              = "libfplist_date_time_copy_from_utf8_string";
+	const char *format_string          = "dddd-dd-ddTdd:dd:dd";
+	size_t utf8_string_index           = 0;
+	int64_t number_of_days             = 0;
+	uint32_t day_of_year               = 0;
+	uint32_t fraction_of_second        = 0;
+	uint32_t fraction_of_second_digits = 0;
+	uint32_t values[ 6 ]               = { 0, 0, 0, 0, 0, 0 };
+	uint8_t days_per_month             = 0;
+	uint8_t value_index                = 0;
+	int32_t year                       = 0;
+	uint32_t year_of_era               = 0;
+	int32_t era                        = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	if( nanoseconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid nanoseconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length < 19 )
+	{
+		return( 0 );
+	}
+	for( utf8_string_index = 0;
+	     utf8_string_index < 19;
+	     utf8_string_index++ )
+	{
+		if( format_string[ utf8_string_index ] == 'd' )
+		{
+			if( ( utf8_string[ utf8_string_index ] < (uint8_t) '0' )
+			 || ( utf8_string[ utf8_string_index ] > (uint8_t) '9' ) )
+			{
+				return( 0 );
+			}
+			values[ value_index ] *= 10;
+			values[ value_index ] += utf8_string[ utf8_string_index ] - (uint8_t) '0';
+		}
+		else if( utf8_string[ utf8_string_index ] != (uint8_t) format_string[ utf8_string_index ] )
+		{
+			return( 0 );
+		}
+		else
+		{
+			value_index++;
+		}
+	}
+	if( ( utf8_string_index < utf8_string_length )
+	 && ( utf8_string[ utf8_string_index ] == (uint8_t) '.' ) )
+	{
+		utf8_string_index++;
+
+		while( ( utf8_string_index < utf8_string_length )
+		    && ( utf8_string[ utf8_string_index ] >= (uint8_t) '0' )
+		    && ( utf8_string[ utf8_string_index ] <= (uint8_t) '9' ) )
+		{
+			/* Digits beyond nanosecond precision are ignored
+			 */
+			if( fraction_of_second_digits < 9 )
+			{
+				fraction_of_second *= 10;
+				fraction_of_second += utf8_string[ utf8_string_index ] - (uint8_t) '0';
+			}
+			fraction_of_second_digits++;
+
+			utf8_string_index++;
+		}
+		if( fraction_of_second_digits == 0 )
+		{
+			return( 0 );
+		}
+		while( fraction_of_second_digits < 9 )
+		{
+			fraction_of_second *= 10;
+
+			fraction_of_second_digits++;
+		}
+	}
+	if( ( utf8_string_index < utf8_string_length )
+	 && ( utf8_string[ utf8_string_index ] == (uint8_t) 'Z' ) )
+	{
+		utf8_string_index++;
+	}
+	if( utf8_string_index != utf8_string_length )
+	{
+		return( 0 );
+	}
+	/* values contains: year, month, day of month, hours, minutes and seconds
+	 */
+	if( ( values[ 1 ] < 1 )
+	 || ( values[ 1 ] > 12 ) )
+	{
+		return( 0 );
+	}
+	switch( values[ 1 ] )
+	{
+		case 2:
+			if( ( ( ( values[ 0 ] % 4 ) == 0 )
+			  &&  ( ( values[ 0 ] % 100 ) != 0 ) )
+			 || ( ( values[ 0 ] % 400 ) == 0 ) )
+			{
+				days_per_month = 29;
+			}
+			else
+			{
+				days_per_month = 28;
+			}
+			break;
+
+		case 4:
+		case 6:
+		case 9:
+		case 11:
+			days_per_month = 30;
+			break;
+
+		default:
+			days_per_month = 31;
+			break;
+	}
+	if( ( values[ 2 ] < 1 )
+	 || ( values[ 2 ] > days_per_month ) )
+	{
+		return( 0 );
+	}
+	if( ( values[ 3 ] > 23 )
+	 || ( values[ 4 ] > 59 )
+	 || ( values[ 5 ] > 59 ) )
+	{
+		return( 0 );
+	}
+	/* Determine the number of days since January 1, 1970 using
+	 * a calendar where the year starts in March, such that the leap day
+	 * is the last day of the year
+	 */
+	year = (int32_t) values[ 0 ];
+
+	if( values[ 1 ] <= 2 )
+	{
+		year -= 1;
+	}
+	if( year >= 0 )
+	{
+		era = year / 400;
+	}
+	else
+	{
+		era = ( year - 399 ) / 400;
+	}
+	year_of_era = (uint32_t) ( year - ( era * 400 ) );
+
+	if( values[ 1 ] > 2 )
+	{
+		day_of_year = ( ( 153 * ( values[ 1 ] - 3 ) ) + 2 ) / 5;
+	}
+	else
+	{
+		day_of_year = ( ( 153 * ( values[ 1 ] + 9 ) ) + 2 ) / 5;
+	}
+	day_of_year += values[ 2 ] - 1;
+
+	number_of_days  = (int64_t) era * 146097;
+	number_of_days += ( year_of_era * 365 ) + ( year_of_era / 4 ) - ( year_of_era / 100 ) + day_of_year;
+	number_of_days -= 719468;
+
+	*posix_time  = number_of_days * 86400;
+	*posix_time += ( values[ 3 ] * 3600 ) + ( values[ 4 ] * 60 ) + values[ 5 ];
+	*nanoseconds = fraction_of_second;
+
+	return( 1 );
+}
+
+/* Copies a date and time to a signed 64-bit POSIX time in nanoseconds
+ * Returns 1 if successful, 0 if the date and time cannot be represented or -1 on error
+ */
+int libfplist_date_time_copy_to_posix_time_in_nanoseconds(
+     int64_t posix_time,
+     uint32_t nanoseconds,
+     int64_t *posix_time_in_nanoseconds,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_date_time_copy_to_posix_time_in_nanoseconds";
+
+	if( posix_time_in_nanoseconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time in nanoseconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( nanoseconds >= 1000000000 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid nanoseconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( posix_time > ( INT64_MAX / 1000000000 ) - 1 )
+	 || ( posix_time < ( INT64_MIN / 1000000000 ) + 1 ) )
+	{
+		return( 0 );
+	}
+	*posix_time_in_nanoseconds = ( posix_time * 1000000000 ) + nanoseconds;
+
+	return( 1 );
+}
+
+/* Copies a date and time to a FILETIME
+ * A FILETIME contains the number of 100th nano seconds since January 1, 1601 00:00:00 UTC
+ * Returns 1 if successful, 0 if the date and time cannot be represented or -1 on error
+ */
+int libfplist_date_time_copy_to_filetime(
+     int64_t posix_time,
+     uint32_t nanoseconds,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_date_time_copy_to_filetime";
+
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	if( nanoseconds >= 1000000000 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid nanoseconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Note that 11644473600 is the number of seconds between
+	 * January 1, 1601 and January 1, 1970
+	 */
+	if( ( posix_time < -11644473600LL )
+	 || ( posix_time > (int64_t) ( ( UINT64_MAX / 10000000 ) - 11644473601ULL ) ) )
+	{
+		return( 0 );
+	}
+	*filetime = ( (uint64_t) ( posix_time + 11644473600LL ) * 10000000 ) + ( nanoseconds / 100 );
+
+	return( 1 );
+}
+
+/* Copies a date and time to an ISO 8601 formatted UTF-8 string
+ * The string is formatted as: YYYY-MM-DDThh:mm:ss[.fraction]Z where trailing zeros of
+ * the fraction are omitted. The UTF-8 string size should include the end of string character
+ * Returns 1 if successful, 0 if the date and time cannot be represented or -1 on error
+ */
+int libfplist_date_time_copy_to_utf8_string(
+     int64_t posix_time,
+     uint32_t nanoseconds,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t safe_utf8_string[ LIBFPLIST_DATE_TIME_UTF8_STRING_SIZE ];
+
+	static char *function    = "libfplist_date_time_copy_to_utf8_string";
+	size_t utf8_string_index = 0;
+	int64_t era              = 0;
+	int64_t number_of_days   = 0;
+	int64_t seconds_of_day   = 0;
+	int64_t year             = 0;
+	uint32_t day_of_era      = 0;
+	uint32_t day_of_year     = 0;
+	uint32_t month_index     = 0;
+	uint32_t values[ 6 ]     = { 0, 0, 0, 0, 0, 0 };
+	uint32_t year_of_era     = 0;
+	uint8_t digit_index      = 0;
+	uint8_t value_index      = 0;
+
+	if( nanoseconds >= 1000000000 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid nanoseconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Note that -62167219200 and 253402300799 are the number of seconds between
+	 * January 1, 1970 and January 1, 0000 00:00:00 and December 31, 9999 23:59:59
+	 */
+	if( ( posix_time < (int64_t) -62167219200LL )
+	 || ( posix_time > (int64_t) 253402300799LL ) )
+	{
+		return( 0 );
+	}
+	number_of_days = posix_time / 86400;
+	seconds_of_day = posix_time % 86400;
+
+	if( seconds_of_day < 0 )
+	{
+		number_of_days -= 1;
+		seconds_of_day += 86400;
+	}
+	/* Determine the date from the number of days since January 1, 1970 using
+	 * a calendar where the year starts in March, such that the leap day
+	 * is the last day of the year
+	 */
+	number_of_days += 719468;
+
+	if( number_of_days >= 0 )
+	{
+		era = number_of_days / 146097;
+	}
+	else
+	{
+		era = ( number_of_days - 146096 ) / 146097;
+	}
+	day_of_era  = (uint32_t) ( number_of_days - ( era * 146097 ) );
+	year_of_era = ( day_of_era - ( day_of_era / 1460 ) + ( day_of_era / 36524 ) - ( day_of_era / 146096 ) ) / 365;
+	day_of_year = day_of_era - ( ( 365 * year_of_era ) + ( year_of_era / 4 ) - ( year_of_era / 100 ) );
+	month_index = ( ( 5 * day_of_year ) + 2 ) / 153;
+
+	year = (int64_t) year_of_era + ( era * 400 );
+
+	values[ 2 ] = day_of_year - ( ( ( 153 * month_index ) + 2 ) / 5 ) + 1;
+
+	if( month_index < 10 )
+	{
+		values[ 1 ] = month_index + 3;
+	}
+	else
+	{
+		values[ 1 ] = month_index - 9;
+		year       += 1;
+	}
+	values[ 0 ] = (uint32_t) year;
+	values[ 3 ] = (uint32_t) ( seconds_of_day / 3600 );
+	values[ 4 ] = (uint32_t) ( ( seconds_of_day % 3600 ) / 60 );
+	values[ 5 ] = (uint32_t) ( seconds_of_day % 60 );
+
+	/* values contains: year, month, day of month, hours, minutes and seconds
+	 */
+	for( value_index = 0;
+	     value_index < 6;
+	     value_index++ )
+	{
+		if( value_index == 0 )
+		{
+			safe_utf8_string[ utf8_string_index++ ] = (uint8_t) '0' + (uint8_t) ( values[ 0 ] / 1000 );
+			safe_utf8_string[ utf8_string_index++ ] = (uint8_t) '0' + (uint8_t) ( ( values[ 0 ] / 100 ) % 10 );
+		}
+		safe_utf8_string[ utf8_string_index++ ] = (uint8_t) '0' + (uint8_t) ( ( values[ value_index ] / 10 ) % 10 );
+		safe_utf8_string[ utf8_string_index++ ] = (uint8_t) '0' + (uint8_t) ( values[ value_index ] % 10 );
+
+		if( value_index < 2 )
+		{
+			safe_utf8_string[ utf8_string_index++ ] = (uint8_t) '-';
+		}
+		else if( value_index == 2 )
+		{
+			safe_utf8_string[ utf8_string_index++ ] = (uint8_t) 'T';
+		}
+		else if( value_index < 5 )
+		{
+			safe_utf8_string[ utf8_string_index++ ] = (uint8_t) ':';
+		}
+	}
+	if( nanoseconds != 0 )
+	{
+		safe_utf8_string[ utf8_string_index++ ] = (uint8_t) '.';
+
+		for( digit_index = 0;
+		     ( digit_index < 9 ) && ( nanoseconds != 0 );
+		     digit_index++ )
+		{
+			safe_utf8_string[ utf8_string_index++ ] = (uint8_t) '0' + (uint8_t) ( nanoseconds / 100000000 );
+
+			nanoseconds = ( nanoseconds % 100000000 ) * 10;
+		}
+	}
+	safe_utf8_string[ utf8_string_index++ ] = (uint8_t) 'Z';
+	safe_utf8_string[ utf8_string_index++ ] = 0;
+
+	if( utf8_string_size < utf8_string_index )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     utf8_string,
+	     safe_utf8_string,
+	     utf8_string_index ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy date and time to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,70 @@
+/*
+ * Date and time functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFPLIST_DATE_TIME_H )
+#define _LIBFPLIST_DATE_TIME_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfplist_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of an ISO 8601 formatted UTF-8 string with a fraction of second
+ * including the end of string character
+ */
+#define LIBFPLIST_DATE_TIME_UTF8_STRING_SIZE		32
+
+int libfplist_date_time_copy_from_utf8_string(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int64_t *posix_time,
+     uint32_t *nanoseconds,
+     libcerror_error_t **error );
+
+int libfplist_date_time_copy_to_posix_time_in_nanoseconds(
+     int64_t posix_time,
+     uint32_t nanoseconds,
+     int64_t *posix_time_in_nanoseconds,
+     libcerror_error_t **error );
+
+int libfplist_date_time_copy_to_filetime(
+     int64_t posix_time,
+     uint32_t nanoseconds,
+     uint64_t *filetime,
+     libcerror_error_t **error );
+
+int libfplist_date_time_copy_to_utf8_string(
+     int64_t posix_time,
+     uint32_t nanoseconds,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFPLIST_DATE_TIME_H ) */
+
@@ -0,0 +1,68 @@
+/*
+ * Floating point functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFPLIST_FLOATING_POINT_H )
+#define _LIBFPLIST_FLOATING_POINT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfplist_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of a floating point UTF-8 string, which consists of a sign,
+ * 17 significant digits, a decimal separator, an exponent and the end of string character
+ */
+#define LIBFPLIST_FLOATING_POINT_UTF8_STRING_SIZE	32
+
+void libfplist_floating_point_multiply_64bit(
+      uint64_t value1,
+      uint64_t value2,
+      uint64_t *upper_64bit,
+      uint64_t *lower_64bit );
+
+int libfplist_floating_point_eisel_lemire(
+     uint64_t significand,
+     int decimal_exponent,
+     uint8_t is_negative,
+     double *value );
+
+int libfplist_floating_point_copy_from_utf8_string(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     double *value,
+     libcerror_error_t **error );
+
+int libfplist_floating_point_copy_to_utf8_string(
+     double value,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFPLIST_FLOATING_POINT_H ) */
+
@@ -0,0 +1,87 @@
+/*
+ * Hash functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfplist_hash.h"
+#include "libfplist_libcerror.h"
+
+/* Calculates the hash of an UTF-8 string
+ * The hash is a 32-bit Fowler-Noll-Vo (FNV-1a) hash of the string bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_hash_calculate_utf8_string(
+     uint32_t *hash_value,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfplist_hash_calculate_utf8_string";
+	size_t utf8_string_index = 0;
+	uint32_t safe_hash_value = 0x811c9dc5UL;
+
+	if( hash_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string == NULL )
+	 && ( utf8_string_length != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( utf8_string_index = 0;
+	     utf8_string_index < utf8_string_length;
+	     utf8_string_index++ )
+	{
+		safe_hash_value ^= utf8_string[ utf8_string_index ];
+		safe_hash_value *= 0x01000193UL;
+	}
+	*hash_value = safe_hash_value;
+
+	return( 1 );
+}
+
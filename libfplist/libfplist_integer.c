@@ -0,0 +1,314 @@
+/*
+ * Integer functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfplist_integer.h"
+#include "libfplist_libcerror.h"
+
+/* Copies an integer value from an UTF-8 string
+ * The string is expected to be formatted as: [+-]digits or [+-]0xhexdigits
+ * The value is returned as a 128-bit magnitude and a sign
+ * Returns 1 if successful, 0 if the string is not a supported integer value or -1 on error
+ */
+int libfplist_integer_copy_from_utf8_string(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint64_t *upper_64bit,
+     uint64_t *lower_64bit,
+     uint8_t *is_negative,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfplist_integer_copy_from_utf8_string";
+	size_t utf8_string_index   = 0;
+	uint64_t carry             = 0;
+	uint64_t lower_product     = 0;
+	uint64_t safe_lower_64bit  = 0;
+	uint64_t safe_upper_64bit  = 0;
+	uint64_t upper_product     = 0;
+	uint8_t character_value    = 0;
+	uint8_t is_hexadecimal     = 0;
+	uint8_t safe_is_negative   = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( upper_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid upper 64-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	if( lower_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lower 64-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_negative == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid is negative.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length > 0 )
+	 && ( ( utf8_string[ 0 ] == (uint8_t) '-' )
+	  ||  ( utf8_string[ 0 ] == (uint8_t) '+' ) ) )
+	{
+		safe_is_negative = (uint8_t) ( utf8_string[ 0 ] == (uint8_t) '-' );
+
+		utf8_string_index++;
+	}
+	if( ( ( utf8_string_length - utf8_string_index ) > 2 )
+	 && ( utf8_string[ utf8_string_index ] == (uint8_t) '0' )
+	 && ( ( utf8_string[ utf8_string_index + 1 ] == (uint8_t) 'x' )
+	  ||  ( utf8_string[ utf8_string_index + 1 ] == (uint8_t) 'X' ) ) )
+	{
+		is_hexadecimal = 1;
+
+		utf8_string_index += 2;
+	}
+	if( utf8_string_index >= utf8_string_length )
+	{
+		return( 0 );
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		character_value = utf8_string[ utf8_string_index++ ];
+
+		if( is_hexadecimal != 0 )
+		{
+			if( ( character_value >= (uint8_t) '0' )
+			 && ( character_value <= (uint8_t) '9' ) )
+			{
+				character_value -= (uint8_t) '0';
+			}
+			else if( ( character_value >= (uint8_t) 'a' )
+			      && ( character_value <= (uint8_t) 'f' ) )
+			{
+				character_value -= (uint8_t) 'a' - 10;
+			}
+			else if( ( character_value >= (uint8_t) 'A' )
+			      && ( character_value <= (uint8_t) 'F' ) )
+			{
+				character_value -= (uint8_t) 'A' - 10;
+			}
+			else
+			{
+				return( 0 );
+			}
+			if( ( safe_upper_64bit >> 60 ) != 0 )
+			{
+				return( 0 );
+			}
+			safe_upper_64bit = ( safe_upper_64bit << 4 ) | ( safe_lower_64bit >> 60 );
+			safe_lower_64bit = ( safe_lower_64bit << 4 ) | character_value;
+		}
+		else
+		{
+			if( ( character_value < (uint8_t) '0' )
+			 || ( character_value > (uint8_t) '9' ) )
+			{
+				return( 0 );
+			}
+			character_value -= (uint8_t) '0';
+
+			/* Multiply the 128-bit value by 10 in 32-bit parts
+			 */
+			lower_product = ( safe_lower_64bit & 0xffffffffUL ) * 10;
+			upper_product = ( safe_lower_64bit >> 32 ) * 10 + ( lower_product >> 32 );
+			carry         = upper_product >> 32;
+
+			if( safe_upper_64bit > ( ( (uint64_t) 0xffffffffffffffffULL - carry ) / 10 ) )
+			{
+				return( 0 );
+			}
+			safe_upper_64bit = ( safe_upper_64bit * 10 ) + carry;
+			safe_lower_64bit = ( upper_product << 32 ) | ( lower_product & 0xffffffffUL );
+
+			safe_lower_64bit += character_value;
+
+			if( safe_lower_64bit < character_value )
+			{
+				if( safe_upper_64bit == (uint64_t) 0xffffffffffffffffULL )
+				{
+					return( 0 );
+				}
+				safe_upper_64bit++;
+			}
+		}
+	}
+	if( ( safe_upper_64bit == 0 )
+	 && ( safe_lower_64bit == 0 ) )
+	{
+		safe_is_negative = 0;
+	}
+	/* A negative value is limited to -2^127
+	 */
+	else if( ( safe_is_negative != 0 )
+	      && ( ( safe_upper_64bit > (uint64_t) 0x8000000000000000ULL )
+	       || ( ( safe_upper_64bit == (uint64_t) 0x8000000000000000ULL )
+	        &&  ( safe_lower_64bit != 0 ) ) ) )
+	{
+		return( 0 );
+	}
+	*upper_64bit = safe_upper_64bit;
+	*lower_64bit = safe_lower_64bit;
+	*is_negative = safe_is_negative;
+
+	return( 1 );
+}
+
+/* Copies an integer value to an UTF-8 string
+ * The value is provided as a 128-bit magnitude and a sign and formatted as: [-]digits
+ * The UTF-8 string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_integer_copy_to_utf8_string(
+     uint64_t upper_64bit,
+     uint64_t lower_64bit,
+     uint8_t is_negative,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t digits[ LIBFPLIST_INTEGER_UTF8_STRING_SIZE ];
+	uint32_t value_32bit[ 4 ];
+
+	static char *function    = "libfplist_integer_copy_to_utf8_string";
+	size_t utf8_string_index = 0;
+	uint64_t remainder       = 0;
+	uint8_t digit_index      = 0;
+	uint8_t number_of_digits = 0;
+	uint8_t value_index      = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	value_32bit[ 0 ] = (uint32_t) ( upper_64bit >> 32 );
+	value_32bit[ 1 ] = (uint32_t) upper_64bit;
+	value_32bit[ 2 ] = (uint32_t) ( lower_64bit >> 32 );
+	value_32bit[ 3 ] = (uint32_t) lower_64bit;
+
+	/* Determine the decimal digits, least significant first, by repeatedly
+	 * dividing the 128-bit value, stored as 32-bit parts, by 10
+	 */
+	do
+	{
+		remainder = 0;
+
+		for( value_index = 0;
+		     value_index < 4;
+		     value_index++ )
+		{
+			remainder                  = ( remainder << 32 ) | value_32bit[ value_index ];
+			value_32bit[ value_index ] = (uint32_t) ( remainder / 10 );
+			remainder                 %= 10;
+		}
+		digits[ number_of_digits++ ] = (uint8_t) '0' + (uint8_t) remainder;
+	}
+	while( ( value_32bit[ 0 ] | value_32bit[ 1 ] | value_32bit[ 2 ] | value_32bit[ 3 ] ) != 0 );
+
+	if( ( is_negative != 0 )
+	 && ( ( upper_64bit | lower_64bit ) != 0 ) )
+	{
+		utf8_string_index = 1;
+	}
+	if( utf8_string_size < ( utf8_string_index + number_of_digits + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == 1 )
+	{
+		utf8_string[ 0 ] = (uint8_t) '-';
+	}
+	for( digit_index = number_of_digits;
+	     digit_index > 0;
+	     digit_index-- )
+	{
+		utf8_string[ utf8_string_index++ ] = digits[ digit_index - 1 ];
+	}
+	utf8_string[ utf8_string_index ] = 0;
+
+	return( 1 );
+}
+
@@ -0,0 +1,60 @@
+/*
+ * Integer functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFPLIST_INTEGER_H )
+#define _LIBFPLIST_INTEGER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfplist_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of an integer UTF-8 string, which consists of a sign,
+ * 39 decimal digits and the end of string character
+ */
+#define LIBFPLIST_INTEGER_UTF8_STRING_SIZE		41
+
+int libfplist_integer_copy_from_utf8_string(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint64_t *upper_64bit,
+     uint64_t *lower_64bit,
+     uint8_t *is_negative,
+     libcerror_error_t **error );
+
+int libfplist_integer_copy_to_utf8_string(
+     uint64_t upper_64bit,
+     uint64_t lower_64bit,
+     uint8_t is_negative,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFPLIST_INTEGER_H ) */
+
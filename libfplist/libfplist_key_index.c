@@ -0,0 +1,572 @@
+/*
+ * Key index functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libfplist_definitions.h"
+#include "libfplist_key_index.h"
+#include "libfplist_libcerror.h"
+#include "libfplist_xml_tag.h"
+
+/* Creates a key index
+ * Make sure the value key_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_key_index_initialize(
+     libfplist_key_index_t **key_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_key_index_initialize";
+
+	if( key_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*key_index = memory_allocate_structure(
+	              libfplist_key_index_t );
+
+	if( *key_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *key_index,
+	     0,
+	     sizeof( libfplist_key_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *key_index != NULL )
+	{
+		memory_free(
+		 *key_index );
+
+		*key_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a key index
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_key_index_free(
+     libfplist_key_index_t **key_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_key_index_free";
+
+	if( key_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_index != NULL )
+	{
+		/* The key_tag and value_tag of the entries are referenced and freed elsewhere */
+
+		if( ( *key_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *key_index )->entries );
+		}
+		memory_free(
+		 *key_index );
+
+		*key_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_key_index_append_entry(
+     libfplist_key_index_t *key_index,
+     libfplist_xml_tag_t *key_tag,
+     libfplist_xml_tag_t *value_tag,
+     libcerror_error_t **error )
+{
+	libfplist_key_index_entry_t *entries = NULL;
+	libfplist_key_index_entry_t *entry   = NULL;
+	static char *function                = "libfplist_key_index_append_entry";
+	int number_of_allocated_entries      = 0;
+
+	if( key_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key index.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_index->number_of_entries >= key_index->number_of_allocated_entries )
+	{
+		if( key_index->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 64;
+		}
+		else if( key_index->number_of_allocated_entries <= ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_entries = key_index->number_of_allocated_entries * 2;
+		}
+		if( ( number_of_allocated_entries == 0 )
+		 || ( (size_t) number_of_allocated_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfplist_key_index_entry_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (libfplist_key_index_entry_t *) memory_reallocate(
+		                                           key_index->entries,
+		                                           sizeof( libfplist_key_index_entry_t ) * number_of_allocated_entries );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		key_index->entries                     = entries;
+		key_index->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	entry = &( key_index->entries[ key_index->number_of_entries ] );
+
+	if( libfplist_xml_tag_get_value_hash(
+	     key_tag,
+	     &( entry->hash_value ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hash of key tag.",
+		 function );
+
+		return( -1 );
+	}
+	entry->document_index = key_index->number_of_entries;
+	entry->key_tag        = key_tag;
+	entry->value_tag      = value_tag;
+
+	key_index->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Reads the key and value pairs of a dictionary or array tag and its sub elements
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_key_index_read_tag(
+     libfplist_key_index_t *key_index,
+     libfplist_xml_tag_t *tag,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfplist_xml_tag_t *element_tag = NULL;
+	libfplist_xml_tag_t *key_tag     = NULL;
+	static char *function            = "libfplist_key_index_read_tag";
+	int element_index                = 0;
+	int number_of_elements           = 0;
+	int result                       = 0;
+	int value_type                   = 0;
+
+	if( key_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFPLIST_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfplist_xml_tag_get_element(
+		     tag,
+		     element_index,
+		     &element_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		result = libfplist_xml_tag_compare_name(
+		          element_tag,
+		          (uint8_t *) "key",
+		          3,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of element tag: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			key_tag = element_tag;
+
+			continue;
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     element_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of element tag: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		/* Ignore text nodes
+		 */
+		if( value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+		{
+			continue;
+		}
+		if( key_tag != NULL )
+		{
+			if( libfplist_key_index_append_entry(
+			     key_index,
+			     key_tag,
+			     element_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append entry.",
+				 function );
+
+				return( -1 );
+			}
+			key_tag = NULL;
+		}
+		if( ( value_type == LIBFPLIST_VALUE_TYPE_ARRAY )
+		 || ( value_type == LIBFPLIST_VALUE_TYPE_DICTIONARY ) )
+		{
+			if( libfplist_key_index_read_tag(
+			     key_index,
+			     element_tag,
+			     recursion_depth + 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read element tag: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Compares two entries by hash value and document order
+ * Returns -1 if the first entry sorts before the second, 1 if after or 0 if equal
+ */
+int libfplist_key_index_compare_entries(
+     const void *first_entry,
+     const void *second_entry )
+{
+	const libfplist_key_index_entry_t *first_key_index_entry  = (const libfplist_key_index_entry_t *) first_entry;
+	const libfplist_key_index_entry_t *second_key_index_entry = (const libfplist_key_index_entry_t *) second_entry;
+
+	if( first_key_index_entry->hash_value < second_key_index_entry->hash_value )
+	{
+		return( -1 );
+	}
+	else if( first_key_index_entry->hash_value > second_key_index_entry->hash_value )
+	{
+		return( 1 );
+	}
+	if( first_key_index_entry->document_index < second_key_index_entry->document_index )
+	{
+		return( -1 );
+	}
+	else if( first_key_index_entry->document_index > second_key_index_entry->document_index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Builds the key index from a root tag
+ * The entries are sorted by hash value, entries with the same hash value remain in document order
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_key_index_build(
+     libfplist_key_index_t *key_index,
+     libfplist_xml_tag_t *root_tag,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_key_index_build";
+
+	if( key_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key index.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_index->number_of_entries != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key index - entries already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_key_index_read_tag(
+	     key_index,
+	     root_tag,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read root tag.",
+		 function );
+
+		goto on_error;
+	}
+	if( key_index->number_of_entries > 1 )
+	{
+		qsort(
+		 key_index->entries,
+		 (size_t) key_index->number_of_entries,
+		 sizeof( libfplist_key_index_entry_t ),
+		 &libfplist_key_index_compare_entries );
+	}
+	return( 1 );
+
+on_error:
+	key_index->number_of_entries = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the index of the first entry with a specific hash value
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libfplist_key_index_get_first_entry_index_by_hash(
+     libfplist_key_index_t *key_index,
+     uint32_t hash_value,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_key_index_get_first_entry_index_by_hash";
+	int lower_index       = 0;
+	int middle_index      = 0;
+	int upper_index       = 0;
+
+	if( key_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key index.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	upper_index = key_index->number_of_entries;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( key_index->entries[ middle_index ].hash_value < hash_value )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	if( ( lower_index >= key_index->number_of_entries )
+	 || ( key_index->entries[ lower_index ].hash_value != hash_value ) )
+	{
+		return( 0 );
+	}
+	*entry_index = lower_index;
+
+	return( 1 );
+}
+
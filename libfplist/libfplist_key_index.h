@@ -0,0 +1,113 @@
+/*
+ * Key index functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFPLIST_KEY_INDEX_H )
+#define _LIBFPLIST_KEY_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfplist_libcerror.h"
+#include "libfplist_xml_tag.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfplist_key_index_entry libfplist_key_index_entry_t;
+
+struct libfplist_key_index_entry
+{
+	/* The hash value of the key
+	 */
+	uint32_t hash_value;
+
+	/* The index of the entry in document order
+	 */
+	int document_index;
+
+	/* The key XML tag
+	 */
+	libfplist_xml_tag_t *key_tag;
+
+	/* The value XML tag
+	 */
+	libfplist_xml_tag_t *value_tag;
+};
+
+typedef struct libfplist_key_index libfplist_key_index_t;
+
+struct libfplist_key_index
+{
+	/* The entries
+	 */
+	libfplist_key_index_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+};
+
+int libfplist_key_index_initialize(
+     libfplist_key_index_t **key_index,
+     libcerror_error_t **error );
+
+int libfplist_key_index_free(
+     libfplist_key_index_t **key_index,
+     libcerror_error_t **error );
+
+int libfplist_key_index_append_entry(
+     libfplist_key_index_t *key_index,
+     libfplist_xml_tag_t *key_tag,
+     libfplist_xml_tag_t *value_tag,
+     libcerror_error_t **error );
+
+int libfplist_key_index_read_tag(
+     libfplist_key_index_t *key_index,
+     libfplist_xml_tag_t *tag,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libfplist_key_index_compare_entries(
+     const void *first_entry,
+     const void *second_entry );
+
+int libfplist_key_index_build(
+     libfplist_key_index_t *key_index,
+     libfplist_xml_tag_t *root_tag,
+     libcerror_error_t **error );
+
+int libfplist_key_index_get_first_entry_index_by_hash(
+     libfplist_key_index_t *key_index,
+     uint32_t hash_value,
+     int *entry_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFPLIST_KEY_INDEX_H ) */
+
@@ -0,0 +1,225 @@
+/*
+ * Key token functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfplist_hash.h"
+#include "libfplist_key_token.h"
+#include "libfplist_libcerror.h"
+#include "libfplist_types.h"
+
+/* Creates a key token
+ * Make sure the value key_token is referencing, is set to NULL
+ * The key token contains a copy of the UTF-8 string, its length and hash
+ * so that these do not need to be determined on every lookup
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_key_token_initialize(
+     libfplist_key_token_t **key_token,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	libfplist_internal_key_token_t *internal_key_token = NULL;
+	static char *function                              = "libfplist_key_token_initialize";
+
+	if( key_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key token.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_token != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key token value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_token = memory_allocate_structure(
+	                      libfplist_internal_key_token_t );
+
+	if( internal_key_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key token.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_key_token,
+	     0,
+	     sizeof( libfplist_internal_key_token_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key token.",
+		 function );
+
+		memory_free(
+		 internal_key_token );
+
+		return( -1 );
+	}
+	internal_key_token->utf8_string = (uint8_t *) memory_allocate(
+	                                               sizeof( uint8_t ) * ( utf8_string_length + 1 ) );
+
+	if( internal_key_token->utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( utf8_string_length > 0 )
+	{
+		if( memory_copy(
+		     internal_key_token->utf8_string,
+		     utf8_string,
+		     utf8_string_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_key_token->utf8_string[ utf8_string_length ] = 0;
+
+	internal_key_token->utf8_string_length = utf8_string_length;
+
+	if( libfplist_hash_calculate_utf8_string(
+	     &( internal_key_token->hash_value ),
+	     internal_key_token->utf8_string,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate hash of UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	*key_token = (libfplist_key_token_t *) internal_key_token;
+
+	return( 1 );
+
+on_error:
+	if( internal_key_token != NULL )
+	{
+		if( internal_key_token->utf8_string != NULL )
+		{
+			memory_free(
+			 internal_key_token->utf8_string );
+		}
+		memory_free(
+		 internal_key_token );
+	}
+	return( -1 );
+}
+
+/* Frees a key token
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_key_token_free(
+     libfplist_key_token_t **key_token,
+     libcerror_error_t **error )
+{
+	libfplist_internal_key_token_t *internal_key_token = NULL;
+	static char *function                              = "libfplist_key_token_free";
+
+	if( key_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key token.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_token != NULL )
+	{
+		internal_key_token = (libfplist_internal_key_token_t *) *key_token;
+		*key_token         = NULL;
+
+		if( internal_key_token->utf8_string != NULL )
+		{
+			memory_free(
+			 internal_key_token->utf8_string );
+		}
+		memory_free(
+		 internal_key_token );
+	}
+	return( 1 );
+}
+
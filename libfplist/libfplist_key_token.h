@@ -0,0 +1,70 @@
+/*
+ * Key token functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFPLIST_KEY_TOKEN_H )
+#define _LIBFPLIST_KEY_TOKEN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfplist_extern.h"
+#include "libfplist_libcerror.h"
+#include "libfplist_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfplist_internal_key_token libfplist_internal_key_token_t;
+
+struct libfplist_internal_key_token
+{
+	/* The UTF-8 string
+	 */
+	uint8_t *utf8_string;
+
+	/* The UTF-8 string length
+	 */
+	size_t utf8_string_length;
+
+	/* The hash value
+	 */
+	uint32_t hash_value;
+};
+
+LIBFPLIST_EXTERN \
+int libfplist_key_token_initialize(
+     libfplist_key_token_t **key_token,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_key_token_free(
+     libfplist_key_token_t **key_token,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFPLIST_KEY_TOKEN_H ) */
+
@@ -24,14 +24,17 @@
 #include <narrow_string.h>
 #include <types.h>
 
+#include "libfplist_binary_writer.h"
+#include "libfplist_date_time.h"
 #include "libfplist_definitions.h"
+#include "libfplist_floating_point.h"
+#include "libfplist_hash.h"
+#include "libfplist_key_token.h"
 #include "libfplist_libcerror.h"
 #include "libfplist_libcnotify.h"
-#include "libfplist_libfguid.h"
-#include "libfplist_libfvalue.h"
-#include "libfplist_libuna.h"
 #include "libfplist_property.h"
 #include "libfplist_types.h"
+#include "libfplist_uuid.h"
 #include "libfplist_xml_tag.h"
 
 /* Creates a property
@@ -273,18 +276,24 @@ int libfplist_property_get_value_type(
 	return( 1 );
 }
 
-/* Retrieves the value (binary) data size
+/* Retrieves the value type and decoded value
+ * The decoded value depends on the value type:
+ * array and dictionary: the number of entries
+ * binary data: the size of the binary data
+ * boolean: 1 for true and 0 for false
+ * date: a signed 64-bit POSIX time in nanoseconds
+ * floating point: a 64-bit floating point value
+ * integer: a 128-bit integer in two's complement
+ * string: a reference to the UTF-8 string value, which remains valid until the property list is freed
  * Returns 1 if successful or -1 on error
  */
-int libfplist_property_get_value_data_size(
+int libfplist_property_get_value(
      libfplist_property_t *property,
-     size_t *data_size,
+     libfplist_value_t *value,
      libcerror_error_t **error )
 {
 	libfplist_internal_property_t *internal_property = NULL;
-	uint8_t *value_data                              = NULL;
-	static char *function                            = "libfplist_property_get_value_data_size";
-	size_t value_length                              = 0;
+	static char *function                            = "libfplist_property_get_value";
 
 	if( property == NULL )
 	{
@@ -310,13 +319,13 @@ int libfplist_property_get_value_data_size(
 
 		return( -1 );
 	}
-	if( data_size == NULL )
+	if( value == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data size.",
+		 "%s: invalid value.",
 		 function );
 
 		return( -1 );
@@ -338,7 +347,7 @@ int libfplist_property_get_value_data_size(
 			return( -1 );
 		}
 	}
-	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_BINARY_DATA )
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
 	{
 		libcerror_error_set(
 		 error,
@@ -349,62 +358,151 @@ int libfplist_property_get_value_data_size(
 
 		return( -1 );
 	}
-	value_data   = internal_property->value_tag->value;
-	value_length = internal_property->value_tag->value_size - 1;
-
-	/* The base64 conversion function does not like an empty first line
-	 */
-	if( ( value_data != NULL )
-	 && ( value_data[ 0 ] == '\n' ) )
-	{
-		value_data   += 1;
-		value_length -= 1;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: base64 encoded data:\n",
-		 function );
-		libcnotify_print_data(
-		 value_data,
-		 value_length,
-		 0 );
-	}
-#endif
-	if( libuna_base64_stream_size_to_byte_stream(
-	     value_data,
-	     value_length,
-	     data_size,
-	     LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED,
-	     LIBUNA_BASE64_FLAG_STRIP_WHITESPACE,
-	     error ) != 1 )
+	if( memory_set(
+	     value,
+	     0,
+	     sizeof( libfplist_value_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to determine size of base64 encoded data.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear value.",
 		 function );
 
 		return( -1 );
 	}
+	value->value_type = internal_property->value_type;
+
+	switch( internal_property->value_type )
+	{
+		case LIBFPLIST_VALUE_TYPE_ARRAY:
+		case LIBFPLIST_VALUE_TYPE_DICTIONARY:
+			if( libfplist_xml_tag_get_number_of_entries(
+			     internal_property->value_tag,
+			     &( value->data.number_of_entries ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of entries.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case LIBFPLIST_VALUE_TYPE_BINARY_DATA:
+			if( libfplist_property_get_value_data_size(
+			     property,
+			     &( value->data.data_size ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data size.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case LIBFPLIST_VALUE_TYPE_BOOLEAN:
+			if( libfplist_property_get_value_boolean(
+			     property,
+			     &( value->data.boolean ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve boolean value.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case LIBFPLIST_VALUE_TYPE_DATE:
+			if( libfplist_property_get_value_date_time(
+			     property,
+			     &( value->data.posix_time_in_nanoseconds ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve date and time value.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case LIBFPLIST_VALUE_TYPE_FLOATING_POINT:
+			if( libfplist_property_get_value_floating_point(
+			     property,
+			     &( value->data.floating_point ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve floating point value.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case LIBFPLIST_VALUE_TYPE_INTEGER:
+			if( libfplist_property_get_value_128bit_integer(
+			     property,
+			     &( value->data.integer.upper_64bit ),
+			     &( value->data.integer.lower_64bit ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve integer value.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case LIBFPLIST_VALUE_TYPE_STRING:
+			if( internal_property->value_tag->value != NULL )
+			{
+				value->data.string.utf8_string      = internal_property->value_tag->value;
+				value->data.string.utf8_string_size = internal_property->value_tag->value_size;
+			}
+			break;
+	}
 	return( 1 );
 }
 
-/* Copies the value (binary) data
+/* Retrieves a boolean value
+ * The value is returned as 1 for true and 0 for false
  * Returns 1 if successful or -1 on error
  */
-int libfplist_property_get_value_data(
+int libfplist_property_get_value_boolean(
      libfplist_property_t *property,
-     uint8_t *data,
-     size_t data_size,
+     uint8_t *value_boolean,
      libcerror_error_t **error )
 {
 	libfplist_internal_property_t *internal_property = NULL;
-	uint8_t *value_data                              = NULL;
-	static char *function                            = "libfplist_property_get_value_data";
-	size_t value_length                              = 0;
+	static char *function                            = "libfplist_property_get_value_boolean";
+	int result                                       = 0;
 
 	if( property == NULL )
 	{
@@ -430,24 +528,110 @@ int libfplist_property_get_value_data(
 
 		return( -1 );
 	}
-	if( data == NULL )
+	if( value_boolean == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data.",
+		 "%s: invalid value boolean.",
 		 function );
 
 		return( -1 );
 	}
-	if( data_size > (size_t) SSIZE_MAX )
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_BOOLEAN )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid data size value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfplist_xml_tag_compare_name(
+	          internal_property->value_tag,
+	          (uint8_t *) "true",
+	          4,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to compare name of value tag.",
+		 function );
+
+		return( -1 );
+	}
+	*value_boolean = (uint8_t) result;
+
+	return( 1 );
+}
+
+/* Retrieves the value (binary) data size
+ * The size is determined on first use and cached
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_get_value_data_size(
+     libfplist_property_t *property,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	static char *function                            = "libfplist_property_get_value_data_size";
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
 		 function );
 
 		return( -1 );
@@ -480,43 +664,30 @@ int libfplist_property_get_value_data(
 
 		return( -1 );
 	}
-	value_data   = internal_property->value_tag->value;
-	value_length = internal_property->value_tag->value_size - 1;
-
-	/* The base64 conversion function does not like an empty first line
-	 */
-	if( ( value_data != NULL )
-	 && ( value_data[ 0 ] == '\n' ) )
-	{
-		value_data   += 1;
-		value_length -= 1;
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( ( libcnotify_verbose != 0 )
+	 && ( internal_property->value_tag->value != NULL )
+	 && ( internal_property->value_tag->value_size > 0 ) )
 	{
 		libcnotify_printf(
 		 "%s: base64 encoded data:\n",
 		 function );
 		libcnotify_print_data(
-		 value_data,
-		 value_length,
+		 internal_property->value_tag->value,
+		 internal_property->value_tag->value_size - 1,
 		 0 );
 	}
 #endif
-	if( libuna_base64_stream_copy_to_byte_stream(
-	     value_data,
-	     value_length,
-	     data,
+	if( libfplist_xml_tag_get_value_data_size(
+	     internal_property->value_tag,
 	     data_size,
-	     LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED,
-	     LIBUNA_BASE64_FLAG_STRIP_WHITESPACE,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy base64 encoded data to byte stream.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of base64 encoded data.",
 		 function );
 
 		return( -1 );
@@ -524,17 +695,18 @@ int libfplist_property_get_value_data(
 	return( 1 );
 }
 
-/* Retrieves an integer value
+/* Copies the value (binary) data
  * Returns 1 if successful or -1 on error
  */
-int libfplist_property_get_value_integer(
+int libfplist_property_get_value_data(
      libfplist_property_t *property,
-     uint64_t *value_64bit,
+     uint8_t *data,
+     size_t data_size,
      libcerror_error_t **error )
 {
 	libfplist_internal_property_t *internal_property = NULL;
-	static char *function                            = "libfplist_property_get_value_integer";
-	uint32_t string_format_flags                     = 0;
+	static char *function                            = "libfplist_property_get_value_data";
+	size_t data_index                                = 0;
 
 	if( property == NULL )
 	{
@@ -560,13 +732,24 @@ int libfplist_property_get_value_integer(
 
 		return( -1 );
 	}
-	if( internal_property->value_tag->value == NULL )
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid property - invalid value XML tag - missing value.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
@@ -588,7 +771,7 @@ int libfplist_property_get_value_integer(
 			return( -1 );
 		}
 	}
-	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_INTEGER )
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_BINARY_DATA )
 	{
 		libcerror_error_set(
 		 error,
@@ -599,31 +782,32 @@ int libfplist_property_get_value_integer(
 
 		return( -1 );
 	}
-	if( ( internal_property->value_tag->value_size > 4 )
-	 && ( internal_property->value_tag->value[ 0 ] == '0' )
-	 && ( ( internal_property->value_tag->value[ 1 ] == 'x' )
-	  ||  ( internal_property->value_tag->value[ 1 ] == 'X' ) ) )
-	{
-		string_format_flags = LIBFVALUE_INTEGER_FORMAT_TYPE_HEXADECIMAL;
-	}
-	else
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( ( libcnotify_verbose != 0 )
+	 && ( internal_property->value_tag->value != NULL )
+	 && ( internal_property->value_tag->value_size > 0 ) )
 	{
-		string_format_flags = LIBFVALUE_INTEGER_FORMAT_TYPE_DECIMAL | LIBFVALUE_INTEGER_FORMAT_FLAG_UNSIGNED;
+		libcnotify_printf(
+		 "%s: base64 encoded data:\n",
+		 function );
+		libcnotify_print_data(
+		 internal_property->value_tag->value,
+		 internal_property->value_tag->value_size - 1,
+		 0 );
 	}
-/* TODO add support for size attribute e.g. size="64" */
-	if( libfvalue_utf8_string_copy_to_integer(
-	     internal_property->value_tag->value,
-	     internal_property->value_tag->value_size - 1,
-	     (uint64_t *) value_64bit,
-	     64,
-	     string_format_flags,
+#endif
+	if( libfplist_xml_tag_copy_value_data(
+	     internal_property->value_tag,
+	     data,
+	     data_size,
+	     &data_index,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to convert value to integer.",
+		 "%s: unable to copy base64 encoded data to byte stream.",
 		 function );
 
 		return( -1 );
@@ -631,17 +815,21 @@ int libfplist_property_get_value_integer(
 	return( 1 );
 }
 
-/* Retrieves a string value
+/* Retrieves the value (binary) data
+ * The data is decoded in a single pass into a newly allocated buffer
+ * The caller is responsible for freeing the data
+ * If the data is empty no buffer is allocated and data is set to NULL
  * Returns 1 if successful or -1 on error
  */
-int libfplist_property_get_value_string(
+int libfplist_property_get_value_data_allocated(
      libfplist_property_t *property,
-     uint8_t **string,
-     size_t *string_size,
+     uint8_t **data,
+     size_t *data_size,
      libcerror_error_t **error )
 {
 	libfplist_internal_property_t *internal_property = NULL;
-	static char *function                            = "libfplist_property_get_value_string";
+	static char *function                            = "libfplist_property_get_value_data_allocated";
+	size_t maximum_data_size                         = 0;
 
 	if( property == NULL )
 	{
@@ -667,46 +855,35 @@ int libfplist_property_get_value_string(
 
 		return( -1 );
 	}
-	if( internal_property->value_tag->value == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid property - invalid value XML tag - missing value.",
-		 function );
-
-		return( -1 );
-	}
-	if( string == NULL )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid string.",
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	if( *string != NULL )
+	if( *data != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid string value already set.",
+		 "%s: invalid data value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( string_size == NULL )
+	if( data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid string size.",
+		 "%s: invalid data size.",
 		 function );
 
 		return( -1 );
@@ -728,7 +905,7 @@ int libfplist_property_get_value_string(
 			return( -1 );
 		}
 	}
-	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_STRING )
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_BINARY_DATA )
 	{
 		libcerror_error_set(
 		 error,
@@ -739,197 +916,202 @@ int libfplist_property_get_value_string(
 
 		return( -1 );
 	}
-	if( ( internal_property->value_tag->value_size == 0 )
-	 || ( internal_property->value_tag->value_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( ( libcnotify_verbose != 0 )
+	 && ( internal_property->value_tag->value != NULL )
+	 && ( internal_property->value_tag->value_size > 0 ) )
+	{
+		libcnotify_printf(
+		 "%s: base64 encoded data:\n",
+		 function );
+		libcnotify_print_data(
+		 internal_property->value_tag->value,
+		 internal_property->value_tag->value_size - 1,
+		 0 );
+	}
+#endif
+	if( internal_property->value_tag->value_data_size_is_set != 0 )
+	{
+		maximum_data_size = internal_property->value_tag->value_data_size;
+
+		if( maximum_data_size == 0 )
+		{
+			*data_size = 0;
+
+			return( 1 );
+		}
+	}
+	else
+	{
+		/* Every 4 base64 characters decode into at most 3 bytes
+		 */
+		maximum_data_size = ( ( internal_property->value_tag->value_size / 4 ) + 1 ) * 3;
+	}
+	if( maximum_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid property - invalid value tag - value size value out of bounds.",
+		 "%s: invalid maximum data size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	*string = memory_allocate(
-	           sizeof( uint8_t ) * internal_property->value_tag->value_size );
+	*data = (uint8_t *) memory_allocate(
+	                     sizeof( uint8_t ) * maximum_data_size );
 
-	if( *string == NULL )
+	if( *data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create string.",
+		 "%s: unable to create data.",
 		 function );
 
 		goto on_error;
 	}
-	*string_size = internal_property->value_tag->value_size;
-
-	if( memory_copy(
-	     *string,
-	     internal_property->value_tag->value,
-	     internal_property->value_tag->value_size ) == NULL )
+	if( libfplist_xml_tag_copy_value_data(
+	     internal_property->value_tag,
+	     *data,
+	     maximum_data_size,
+	     data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy base64 encoded data to byte stream.",
 		 function );
 
 		goto on_error;
 	}
+	if( *data_size == 0 )
+	{
+		memory_free(
+		 *data );
+
+		*data = NULL;
+	}
 	return( 1 );
 
 on_error:
-	if( *string != NULL )
+	if( *data != NULL )
 	{
 		memory_free(
-		 *string );
+		 *data );
 
-		*string = NULL;
+		*data = NULL;
 	}
-	*string_size = 0;
+	*data_size = 0;
 
 	return( -1 );
 }
 
-/* Copies an UUID string value to a byte stream
- * Returns 1 if successful or -1 on error
+/* Reads value (binary) data at a specific offset of the decoded data
+ * Only the part of the base64 encoded data that contains the requested range is decoded
+ * Returns the number of bytes read, 0 if the offset is at or beyond the end of the data or -1 on error
  */
-int libfplist_property_value_uuid_string_copy_to_byte_stream(
-     libfplist_property_t *property,
-     uint8_t *byte_stream,
-     size_t byte_stream_size,
-     libcerror_error_t **error )
+ssize_t libfplist_property_read_value_data_at_offset(
+         libfplist_property_t *property,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
 {
-	libfguid_identifier_t *guid = NULL;
-	uint8_t *string             = NULL;
-	static char *function       = "libfplist_property_value_uuid_string_copy_to_byte_stream";
-	size_t string_size          = 0;
-
-	if( libfplist_property_get_value_string(
-	     property,
-	     &string,
-	     &string_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve logical volume family identifier.",
-		 function );
+	libfplist_internal_property_t *internal_property = NULL;
+	static char *function                            = "libfplist_property_read_value_data_at_offset";
+	ssize_t read_count                               = 0;
 
-		goto on_error;
-	}
-	if( string_size == 0 )
+	if( property == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid string size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfguid_identifier_initialize(
-	     &guid,
-	     error ) != 1 )
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create GUID.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfguid_identifier_copy_from_utf8_string(
-	     guid,
-	     string,
-	     string_size - 1,
-	     LIBFGUID_STRING_FORMAT_FLAG_USE_MIXED_CASE,
-	     error ) != 1 )
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to copy GUID from string.",
-		 function );
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
 
-		goto on_error;
+			return( -1 );
+		}
 	}
-	memory_free(
-	 string );
-
-	string = NULL;
-
-	if( libfguid_identifier_copy_to_byte_stream(
-	     guid,
-	     byte_stream,
-	     byte_stream_size,
-	     LIBFGUID_ENDIAN_BIG,
-	     error ) != 1 )
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_BINARY_DATA )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to copy GUID to byte stream.",
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfguid_identifier_free(
-	     &guid,
-	     error ) != 1 )
+	read_count = libfplist_xml_tag_read_value_data_at_offset(
+	              internal_property->value_tag,
+	              buffer,
+	              buffer_size,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free GUID.",
-		 function );
-
-		goto on_error;
-	}
-	return( 1 );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read value data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
 
-on_error:
-	if( string != NULL )
-	{
-		memory_free(
-		 string );
-	}
-	if( guid != NULL )
-	{
-		libfguid_identifier_free(
-		 &guid,
-		 NULL );
+		return( -1 );
 	}
-	return( -1 );
+	return( read_count );
 }
 
-/* Retrieves the number of array entries
- * Returns 1 if successful or -1 on error
+/* Retrieves the property list embedded in the value (binary) data
+ * The embedded property list is parsed on first use and cached by the value,
+ * it remains owned by the property list that contains the value and must not be freed
+ * Returns 1 if successful, 0 if the value data does not contain a property list or -1 on error
  */
-int libfplist_property_get_array_number_of_entries(
+int libfplist_property_get_value_as_property_list(
      libfplist_property_t *property,
-     int *number_of_entries,
+     libfplist_property_list_t **property_list,
      libcerror_error_t **error )
 {
 	libfplist_internal_property_t *internal_property = NULL;
-	libfplist_xml_tag_t *element_tag                 = NULL;
-	static char *function                            = "libfplist_property_get_array_number_of_entries";
-	int element_index                                = 0;
-	int number_of_elements                           = 0;
-	int number_of_nodes                              = 0;
+	static char *function                            = "libfplist_property_get_value_as_property_list";
 	int result                                       = 0;
 
 	if( property == NULL )
@@ -956,13 +1138,13 @@ int libfplist_property_get_array_number_of_entries(
 
 		return( -1 );
 	}
-	if( number_of_entries == NULL )
+	if( property_list == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid number of entries.",
+		 "%s: invalid property list.",
 		 function );
 
 		return( -1 );
@@ -984,7 +1166,7 @@ int libfplist_property_get_array_number_of_entries(
 			return( -1 );
 		}
 	}
-	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_ARRAY )
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_BINARY_DATA )
 	{
 		libcerror_error_set(
 		 error,
@@ -995,85 +1177,38 @@ int libfplist_property_get_array_number_of_entries(
 
 		return( -1 );
 	}
-	if( libfplist_xml_tag_get_number_of_elements(
-	     internal_property->value_tag,
-	     &number_of_elements,
-	     error ) != 1 )
+	result = libfplist_xml_tag_get_embedded_property_list(
+	          internal_property->value_tag,
+	          property_list,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements.",
+		 "%s: unable to retrieve embedded property list.",
 		 function );
 
 		return( -1 );
 	}
-	for( element_index = 0;
-	     element_index < number_of_elements;
-	     element_index++ )
-	{
-		if( libfplist_xml_tag_get_element(
-		     internal_property->value_tag,
-		     element_index,
-		     &element_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve element: %d.",
-			 function,
-			 element_index );
-
-			return( -1 );
-		}
-		/* Ignore text nodes
-		 */
-		result = libfplist_xml_tag_compare_name(
-		          element_tag,
-		          (uint8_t *) "text",
-		          4,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to compare name of value tag.",
-			 function );
-
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			number_of_nodes++;
-		}
-	}
-	*number_of_entries = number_of_nodes;
-
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves a specific array entry
+/* Retrieves an integer value
  * Returns 1 if successful or -1 on error
  */
-int libfplist_property_get_array_entry_by_index(
+int libfplist_property_get_value_integer(
      libfplist_property_t *property,
-     int array_entry_index,
-     libfplist_property_t **array_entry,
+     uint64_t *value_64bit,
      libcerror_error_t **error )
 {
 	libfplist_internal_property_t *internal_property = NULL;
-	libfplist_xml_tag_t *value_tag                   = NULL;
-	static char *function                            = "libfplist_property_get_array_entry_by_index";
-	int entry_index                                  = 0;
-	int element_index                                = 0;
-	int number_of_elements                           = 0;
-	int result                                       = 0;
+	static char *function                            = "libfplist_property_get_value_integer";
+	uint64_t lower_64bit                             = 0;
+	uint64_t upper_64bit                             = 0;
+	uint8_t is_negative                              = 0;
 
 	if( property == NULL )
 	{
@@ -1099,35 +1234,24 @@ int libfplist_property_get_array_entry_by_index(
 
 		return( -1 );
 	}
-	if( array_entry_index < 0 )
+	if( internal_property->value_tag->value == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid array entry index value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - invalid value XML tag - missing value.",
 		 function );
 
 		return( -1 );
 	}
-	if( array_entry == NULL )
+	if( value_64bit == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid array entry.",
-		 function );
-
-		return( -1 );
-	}
-	if( *array_entry != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid array entry value already set.",
+		 "%s: invalid value 64-bit.",
 		 function );
 
 		return( -1 );
@@ -1149,7 +1273,7 @@ int libfplist_property_get_array_entry_by_index(
 			return( -1 );
 		}
 	}
-	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_ARRAY )
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_INTEGER )
 	{
 		libcerror_error_set(
 		 error,
@@ -1160,111 +1284,140 @@ int libfplist_property_get_array_entry_by_index(
 
 		return( -1 );
 	}
-	if( libfplist_xml_tag_get_number_of_elements(
+	if( libfplist_xml_tag_get_integer_value(
 	     internal_property->value_tag,
-	     &number_of_elements,
+	     &upper_64bit,
+	     &lower_64bit,
+	     &is_negative,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements.",
+		 "%s: unable to retrieve integer value.",
 		 function );
 
 		return( -1 );
 	}
-	entry_index = array_entry_index;
+	if( ( is_negative != 0 )
+	 || ( upper_64bit != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid integer value out of bounds.",
+		 function );
 
-	element_index = 0;
+		return( -1 );
+	}
+	*value_64bit = lower_64bit;
 
-	while( element_index < number_of_elements )
+	return( 1 );
+}
+
+/* Retrieves an UID value
+ * An UID value is represented by a dict with a single CF$UID integer
+ * Returns 1 if successful, 0 if the value is not an UID or -1 on error
+ */
+int libfplist_property_get_value_uid(
+     libfplist_property_t *property,
+     uint64_t *uid_value,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	static char *function                            = "libfplist_property_get_value_uid";
+	int result                                       = 0;
+
+	if( property == NULL )
 	{
-		if( libfplist_xml_tag_get_element(
-		     internal_property->value_tag,
-		     element_index,
-		     &value_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve element: %d.",
-			 function,
-			 element_index );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
 
-			return( -1 );
-		}
-		/* Ignore text nodes
-		 */
-		result = libfplist_xml_tag_compare_name(
-		          value_tag,
-		          (uint8_t *) "text",
-		          4,
-		          error );
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
 
-		if( result == -1 )
-		{
+	if( internal_property->value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( uid_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UID value.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to compare name of value tag.",
+			 "%s: unable to retrieve value type.",
 			 function );
 
 			return( -1 );
 		}
-		else if( result == 0 )
-		{
-			if( entry_index == 0 )
-			{
-				break;
-			}
-			entry_index--;
-		}
-		element_index++;
 	}
-	if( element_index >= number_of_elements )
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_DICTIONARY )
 	{
 		return( 0 );
 	}
-	if( libfplist_property_initialize(
-	     array_entry,
-	     NULL,
-	     value_tag,
-	     error ) != 1 )
+	result = libfplist_binary_writer_get_uid_value(
+	          internal_property->value_tag,
+	          uid_value,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create array entry: %d.",
-		 function,
-		 array_entry_index );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UID value.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the sub property for the specific UTF-8 encoded name
- * Returns 1 if successful, 0 if no such sub property or -1 on error
+/* Retrieves a signed integer value
+ * Returns 1 if successful or -1 on error
  */
-int libfplist_property_get_sub_property_by_utf8_name(
+int libfplist_property_get_value_signed_integer(
      libfplist_property_t *property,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libfplist_property_t **sub_property,
+     int64_t *value_64bit,
      libcerror_error_t **error )
 {
 	libfplist_internal_property_t *internal_property = NULL;
-	libfplist_xml_tag_t *key_tag                     = NULL;
-	libfplist_xml_tag_t *value_tag                   = NULL;
-	static char *function                            = "libfplist_property_get_sub_property_by_utf8_name";
-	int element_index                                = 0;
-	int number_of_elements                           = 0;
-	int result                                       = 0;
+	static char *function                            = "libfplist_property_get_value_signed_integer";
+	uint64_t lower_64bit                             = 0;
+	uint64_t upper_64bit                             = 0;
+	uint8_t is_negative                              = 0;
 
 	if( property == NULL )
 	{
@@ -1290,46 +1443,168 @@ int libfplist_property_get_sub_property_by_utf8_name(
 
 		return( -1 );
 	}
-	if( utf8_string == NULL )
+	if( internal_property->value_tag->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - invalid value XML tag - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
+		 "%s: invalid value 64-bit.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_length > (size_t) ( SSIZE_MAX - 1 ) )
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_INTEGER )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
 		 function );
 
 		return( -1 );
 	}
-	if( sub_property == NULL )
+	if( libfplist_xml_tag_get_integer_value(
+	     internal_property->value_tag,
+	     &upper_64bit,
+	     &lower_64bit,
+	     &is_negative,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve integer value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( upper_64bit != 0 )
+	 || ( ( is_negative == 0 )
+	  &&  ( lower_64bit > (uint64_t) INT64_MAX ) )
+	 || ( ( is_negative != 0 )
+	  &&  ( lower_64bit > ( (uint64_t) INT64_MAX + 1 ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid integer value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_negative != 0 )
+	{
+		*value_64bit = (int64_t) ( 0 - lower_64bit );
+	}
+	else
+	{
+		*value_64bit = (int64_t) lower_64bit;
+	}
+	return( 1 );
+}
+
+/* Retrieves a 128-bit integer value
+ * The value is returned as a 128-bit two's complement integer, where
+ * a positive value of the tag with size="128" can be as large as 2^128 - 1
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_get_value_128bit_integer(
+     libfplist_property_t *property,
+     uint64_t *value_upper_64bit,
+     uint64_t *value_lower_64bit,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	static char *function                            = "libfplist_property_get_value_128bit_integer";
+	uint64_t lower_64bit                             = 0;
+	uint64_t upper_64bit                             = 0;
+	uint8_t is_negative                              = 0;
+
+	if( property == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sub property.",
+		 "%s: invalid property.",
 		 function );
 
 		return( -1 );
 	}
-	if( *sub_property != NULL )
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid sub property value already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property->value_tag->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - invalid value XML tag - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_upper_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value upper 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_lower_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value lower 64-bit.",
 		 function );
 
 		return( -1 );
@@ -1351,7 +1626,7 @@ int libfplist_property_get_sub_property_by_utf8_name(
 			return( -1 );
 		}
 	}
-	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_DICTIONARY )
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_INTEGER )
 	{
 		libcerror_error_set(
 		 error,
@@ -1362,138 +1637,5662 @@ int libfplist_property_get_sub_property_by_utf8_name(
 
 		return( -1 );
 	}
-	if( libfplist_xml_tag_get_number_of_elements(
+	if( libfplist_xml_tag_get_integer_value(
 	     internal_property->value_tag,
-	     &number_of_elements,
+	     &upper_64bit,
+	     &lower_64bit,
+	     &is_negative,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements.",
+		 "%s: unable to retrieve integer value.",
 		 function );
 
 		return( -1 );
 	}
-	element_index = 0;
-
-	while( element_index < number_of_elements )
+	if( is_negative != 0 )
 	{
-		if( libfplist_xml_tag_get_element(
-		     internal_property->value_tag,
-		     element_index,
-		     &key_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve element: %d.",
-			 function,
-			 element_index );
-
-			return( -1 );
-		}
-		result = libfplist_xml_tag_compare_name(
-		          key_tag,
-		          (uint8_t *) "key",
-		          3,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to compare name of key tag.",
-			 function );
+		*value_upper_64bit = ~upper_64bit;
+		*value_lower_64bit = ~lower_64bit + 1;
 
-			return( -1 );
-		}
-		else if( result != 0 )
+		if( *value_lower_64bit == 0 )
 		{
-			if( ( key_tag->value_size == ( utf8_string_length + 1 ) )
-			 && narrow_string_compare(
-			     key_tag->value,
-			     utf8_string,
-			     utf8_string_length ) == 0 )
-			{
-				break;
-			}
+			*value_upper_64bit += 1;
 		}
-		element_index++;
 	}
-	if( element_index >= number_of_elements )
+	else
 	{
-		return( 0 );
+		*value_upper_64bit = upper_64bit;
+		*value_lower_64bit = lower_64bit;
 	}
-	element_index++;
+	return( 1 );
+}
 
-	while( element_index < number_of_elements )
-	{
-		if( libfplist_xml_tag_get_element(
-		     internal_property->value_tag,
-		     element_index,
-		     &value_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve element: %d.",
-			 function,
-			 element_index );
+/* Retrieves a floating point value
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_get_value_floating_point(
+     libfplist_property_t *property,
+     double *value_floating_point,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	static char *function                            = "libfplist_property_get_value_floating_point";
+	int result                                       = 0;
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_property->value_tag->value == NULL )
+	 || ( internal_property->value_tag->value_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - invalid value XML tag - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_floating_point == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value floating point.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_FLOATING_POINT )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          internal_property->value_tag->value,
+	          internal_property->value_tag->value_size - 1,
+	          value_floating_point,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to convert value to floating point.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported floating point value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a string value
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_get_value_string(
+     libfplist_property_t *property,
+     uint8_t **string,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	static char *function                            = "libfplist_property_get_value_string";
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property->value_tag->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - invalid value XML tag - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_STRING )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_property->value_tag->value_size == 0 )
+	 || ( internal_property->value_tag->value_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid property - invalid value tag - value size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*string = memory_allocate(
+	           sizeof( uint8_t ) * internal_property->value_tag->value_size );
+
+	if( *string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string.",
+		 function );
+
+		goto on_error;
+	}
+	*string_size = internal_property->value_tag->value_size;
+
+	if( memory_copy(
+	     *string,
+	     internal_property->value_tag->value,
+	     internal_property->value_tag->value_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy string.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *string != NULL )
+	{
+		memory_free(
+		 *string );
+
+		*string = NULL;
+	}
+	*string_size = 0;
+
+	return( -1 );
+}
+
+/* Copies an UUID string value to a byte stream
+ * The UUID is parsed directly from the string value without allocating a copy
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_value_uuid_string_copy_to_byte_stream(
+     libfplist_property_t *property,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	static char *function                            = "libfplist_property_value_uuid_string_copy_to_byte_stream";
+	int result                                       = 0;
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property->value_tag->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - invalid value XML tag - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_STRING )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfplist_uuid_copy_from_utf8_string(
+	          internal_property->value_tag->value,
+	          internal_property->value_tag->value_size - 1,
+	          byte_stream,
+	          byte_stream_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UUID from string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported UUID string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a date and time value
+ * The value is returned as a signed 64-bit POSIX time in nanoseconds
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_get_value_date_time(
+     libfplist_property_t *property,
+     int64_t *posix_time_in_nanoseconds,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	static char *function                            = "libfplist_property_get_value_date_time";
+	int64_t posix_time                               = 0;
+	uint32_t nanoseconds                             = 0;
+	int result                                       = 0;
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_time_in_nanoseconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time in nanoseconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_DATE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_date_time_value(
+	     internal_property->value_tag,
+	     &posix_time,
+	     &nanoseconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve date and time value.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfplist_date_time_copy_to_posix_time_in_nanoseconds(
+	          posix_time,
+	          nanoseconds,
+	          posix_time_in_nanoseconds,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy date and time to POSIX time in nanoseconds.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: date and time value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a date and time value as a FILETIME
+ * A FILETIME contains the number of 100th nano seconds since January 1, 1601 00:00:00 UTC
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_get_value_filetime(
+     libfplist_property_t *property,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	static char *function                            = "libfplist_property_get_value_filetime";
+	int64_t posix_time                               = 0;
+	uint32_t nanoseconds                             = 0;
+	int result                                       = 0;
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_DATE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_date_time_value(
+	     internal_property->value_tag,
+	     &posix_time,
+	     &nanoseconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve date and time value.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfplist_date_time_copy_to_filetime(
+	          posix_time,
+	          nanoseconds,
+	          filetime,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy date and time to FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: date and time value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies the date and time values of an array
+ * Every array entry must be a date and time value, which is copied as
+ * a signed 64-bit POSIX time in nanoseconds
+ * The number of date and time values must be at least the number of array entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_copy_array_to_date_time(
+     libfplist_property_t *property,
+     int64_t *date_time_values,
+     int number_of_date_time_values,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	libfplist_xml_tag_t *value_tag                   = NULL;
+	static char *function                            = "libfplist_property_copy_array_to_date_time";
+	int64_t posix_time                               = 0;
+	uint32_t nanoseconds                             = 0;
+	int element_index                                = 0;
+	int entry_index                                  = 0;
+	int number_of_elements                           = 0;
+	int number_of_entries                            = 0;
+	int result                                       = 0;
+	int value_type                                   = 0;
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( date_time_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid date and time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_date_time_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of date and time values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_ARRAY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_entries(
+	     internal_property->value_tag,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_date_time_values < number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of date and time values value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     internal_property->value_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfplist_xml_tag_get_element(
+		     internal_property->value_tag,
+		     element_index,
+		     &value_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		/* Ignore text nodes
+		 */
+		result = libfplist_xml_tag_compare_name(
+		          value_tag,
+		          (uint8_t *) "text",
+		          4,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of value tag.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			continue;
+		}
+		if( entry_index >= number_of_entries )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     value_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( value_type != LIBFPLIST_VALUE_TYPE_DATE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value type of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( libfplist_xml_tag_get_date_time_value(
+		     value_tag,
+		     &posix_time,
+		     &nanoseconds,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve date and time value of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		result = libfplist_date_time_copy_to_posix_time_in_nanoseconds(
+		          posix_time,
+		          nanoseconds,
+		          &( date_time_values[ entry_index ] ),
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy date and time of array entry: %d to POSIX time in nanoseconds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		entry_index++;
+	}
+	return( 1 );
+}
+
+/* Copies the integer values of an array
+ * Every array entry must be an integer value that fits in a signed 64-bit integer
+ * The number of integer values must be at least the number of array entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_copy_array_to_int64(
+     libfplist_property_t *property,
+     int64_t *integer_values,
+     int number_of_integer_values,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	libfplist_xml_tag_t *value_tag                   = NULL;
+	static char *function                            = "libfplist_property_copy_array_to_int64";
+	uint64_t lower_64bit                             = 0;
+	uint64_t upper_64bit                             = 0;
+	uint8_t is_negative                              = 0;
+	int element_index                                = 0;
+	int entry_index                                  = 0;
+	int number_of_elements                           = 0;
+	int number_of_entries                            = 0;
+	int result                                       = 0;
+	int value_type                                   = 0;
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( integer_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integer values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_integer_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of integer values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_ARRAY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_entries(
+	     internal_property->value_tag,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_integer_values < number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of integer values value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     internal_property->value_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfplist_xml_tag_get_element(
+		     internal_property->value_tag,
+		     element_index,
+		     &value_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		/* Ignore text nodes
+		 */
+		result = libfplist_xml_tag_compare_name(
+		          value_tag,
+		          (uint8_t *) "text",
+		          4,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of value tag.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			continue;
+		}
+		if( entry_index >= number_of_entries )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     value_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( value_type != LIBFPLIST_VALUE_TYPE_INTEGER )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value type of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( libfplist_xml_tag_get_integer_value(
+		     value_tag,
+		     &upper_64bit,
+		     &lower_64bit,
+		     &is_negative,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve integer value of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( ( upper_64bit != 0 )
+		 || ( ( is_negative == 0 )
+		  &&  ( lower_64bit > (uint64_t) INT64_MAX ) )
+		 || ( ( is_negative != 0 )
+		  &&  ( lower_64bit > ( (uint64_t) INT64_MAX + 1 ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid integer value of array entry: %d out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( is_negative != 0 )
+		{
+			integer_values[ entry_index ] = (int64_t) ( 0 - lower_64bit );
+		}
+		else
+		{
+			integer_values[ entry_index ] = (int64_t) lower_64bit;
+		}
+		entry_index++;
+	}
+	return( 1 );
+}
+
+/* Copies the floating point values of an array
+ * Every array entry must be a floating point value
+ * The number of floating point values must be at least the number of array entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_copy_array_to_double(
+     libfplist_property_t *property,
+     double *floating_point_values,
+     int number_of_floating_point_values,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	libfplist_xml_tag_t *value_tag                   = NULL;
+	static char *function                            = "libfplist_property_copy_array_to_double";
+	int element_index                                = 0;
+	int entry_index                                  = 0;
+	int number_of_elements                           = 0;
+	int number_of_entries                            = 0;
+	int result                                       = 0;
+	int value_type                                   = 0;
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( floating_point_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid floating point values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_floating_point_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of floating point values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_ARRAY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_entries(
+	     internal_property->value_tag,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_floating_point_values < number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of floating point values value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     internal_property->value_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfplist_xml_tag_get_element(
+		     internal_property->value_tag,
+		     element_index,
+		     &value_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		/* Ignore text nodes
+		 */
+		result = libfplist_xml_tag_compare_name(
+		          value_tag,
+		          (uint8_t *) "text",
+		          4,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of value tag.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			continue;
+		}
+		if( entry_index >= number_of_entries )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     value_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( value_type != LIBFPLIST_VALUE_TYPE_FLOATING_POINT )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value type of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( ( value_tag->value == NULL )
+		 || ( value_tag->value_size == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid array entry: %d - missing value.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		result = libfplist_floating_point_copy_from_utf8_string(
+		          value_tag->value,
+		          value_tag->value_size - 1,
+		          &( floating_point_values[ entry_index ] ),
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy floating point value of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		entry_index++;
+	}
+	return( 1 );
+}
+
+/* Copies the boolean values of an array
+ * Every array entry must be a boolean value, which is copied as 1 for true and 0 for false
+ * The number of boolean values must be at least the number of array entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_copy_array_to_bool(
+     libfplist_property_t *property,
+     uint8_t *boolean_values,
+     int number_of_boolean_values,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	libfplist_xml_tag_t *value_tag                   = NULL;
+	static char *function                            = "libfplist_property_copy_array_to_bool";
+	int element_index                                = 0;
+	int entry_index                                  = 0;
+	int number_of_elements                           = 0;
+	int number_of_entries                            = 0;
+	int result                                       = 0;
+	int value_type                                   = 0;
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( boolean_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid boolean values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_boolean_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of boolean values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_ARRAY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_entries(
+	     internal_property->value_tag,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_boolean_values < number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of boolean values value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     internal_property->value_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfplist_xml_tag_get_element(
+		     internal_property->value_tag,
+		     element_index,
+		     &value_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		/* Ignore text nodes
+		 */
+		result = libfplist_xml_tag_compare_name(
+		          value_tag,
+		          (uint8_t *) "text",
+		          4,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of value tag.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			continue;
+		}
+		if( entry_index >= number_of_entries )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     value_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( value_type != LIBFPLIST_VALUE_TYPE_BOOLEAN )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value type of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		result = libfplist_xml_tag_compare_name(
+		          value_tag,
+		          (uint8_t *) "true",
+		          4,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		boolean_values[ entry_index ] = (uint8_t) result;
+		entry_index++;
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 string values of an array
+ * If a key path is provided every array entry must be a dictionary and the size of the
+ * string value of the key path is used, otherwise every array entry must be a string value
+ * The size does not include end of string characters
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_get_array_utf8_strings_size(
+     libfplist_property_t *property,
+     const uint8_t *utf8_key_path,
+     size_t utf8_key_path_length,
+     size_t *utf8_strings_size,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	libfplist_xml_tag_t *string_tag                  = NULL;
+	libfplist_xml_tag_t *value_tag                   = NULL;
+	static char *function                            = "libfplist_property_get_array_utf8_strings_size";
+	size_t string_size                               = 0;
+	size_t utf8_strings_offset                       = 0;
+	int element_index                                = 0;
+	int entry_index                                  = 0;
+	int number_of_elements                           = 0;
+	int number_of_entries                            = 0;
+	int result                                       = 0;
+	int value_type                                   = 0;
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_key_path == NULL )
+	 && ( utf8_key_path_length != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 key path.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_key_path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 key path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_strings_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_ARRAY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_entries(
+	     internal_property->value_tag,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     internal_property->value_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfplist_xml_tag_get_element(
+		     internal_property->value_tag,
+		     element_index,
+		     &value_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		/* Ignore text nodes
+		 */
+		result = libfplist_xml_tag_compare_name(
+		          value_tag,
+		          (uint8_t *) "text",
+		          4,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of value tag.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			continue;
+		}
+		if( entry_index >= number_of_entries )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfplist_xml_tag_get_value_tag_by_utf8_key_path(
+		          value_tag,
+		          utf8_key_path,
+		          utf8_key_path_length,
+		          &string_tag,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value tag of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing value tag of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     string_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( value_type != LIBFPLIST_VALUE_TYPE_STRING )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value type of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		string_size = 0;
+
+		if( ( string_tag->value != NULL )
+		 && ( string_tag->value_size > 1 ) )
+		{
+			string_size = string_tag->value_size - 1;
+		}
+		if( string_size > ( (size_t) SSIZE_MAX - utf8_strings_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 strings size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_strings_offset += string_size;
+
+		entry_index++;
+	}
+	*utf8_strings_size = utf8_strings_offset;
+
+	return( 1 );
+}
+
+/* Copies the UTF-8 string values of an array into a contiguous buffer
+ * If a key path is provided every array entry must be a dictionary and the string value
+ * of the key path is copied, otherwise every array entry must be a string value
+ * The key path consists of dictionary keys separated by '/'
+ * String i is stored in utf8_strings from utf8_string_offsets[ i ] up to utf8_string_offsets[ i + 1 ]
+ * without an end of string character, hence the number of UTF-8 string offsets must be
+ * at least the number of array entries + 1
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_copy_array_to_utf8_strings(
+     libfplist_property_t *property,
+     const uint8_t *utf8_key_path,
+     size_t utf8_key_path_length,
+     uint8_t *utf8_strings,
+     size_t utf8_strings_size,
+     size_t *utf8_string_offsets,
+     int number_of_utf8_string_offsets,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	libfplist_xml_tag_t *string_tag                  = NULL;
+	libfplist_xml_tag_t *value_tag                   = NULL;
+	static char *function                            = "libfplist_property_copy_array_to_utf8_strings";
+	size_t string_size                               = 0;
+	size_t utf8_strings_offset                       = 0;
+	int element_index                                = 0;
+	int entry_index                                  = 0;
+	int number_of_elements                           = 0;
+	int number_of_entries                            = 0;
+	int result                                       = 0;
+	int value_type                                   = 0;
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_key_path == NULL )
+	 && ( utf8_key_path_length != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 key path.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_key_path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 key path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_strings_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 strings size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_utf8_string_offsets < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of UTF-8 string offsets value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_ARRAY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_entries(
+	     internal_property->value_tag,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_utf8_string_offsets <= number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of UTF-8 string offsets value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     internal_property->value_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfplist_xml_tag_get_element(
+		     internal_property->value_tag,
+		     element_index,
+		     &value_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		/* Ignore text nodes
+		 */
+		result = libfplist_xml_tag_compare_name(
+		          value_tag,
+		          (uint8_t *) "text",
+		          4,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of value tag.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			continue;
+		}
+		if( entry_index >= number_of_entries )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfplist_xml_tag_get_value_tag_by_utf8_key_path(
+		          value_tag,
+		          utf8_key_path,
+		          utf8_key_path_length,
+		          &string_tag,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value tag of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing value tag of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     string_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( value_type != LIBFPLIST_VALUE_TYPE_STRING )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value type of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		string_size = 0;
+
+		if( ( string_tag->value != NULL )
+		 && ( string_tag->value_size > 1 ) )
+		{
+			string_size = string_tag->value_size - 1;
+		}
+		utf8_string_offsets[ entry_index ] = utf8_strings_offset;
+
+		if( string_size > ( utf8_strings_size - utf8_strings_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-8 strings size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( string_size > 0 )
+		{
+			if( memory_copy(
+			     &( utf8_strings[ utf8_strings_offset ] ),
+			     string_tag->value,
+			     string_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy string value of array entry: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+		}
+		utf8_strings_offset += string_size;
+
+		entry_index++;
+	}
+	utf8_string_offsets[ entry_index ] = utf8_strings_offset;
+
+	return( 1 );
+}
+
+/* Copies the UUID string values of an array to a byte stream
+ * Every array entry must be an UUID string value, which is copied as 16 big-endian bytes
+ * The byte stream size must be at least 16 times the number of array entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_copy_array_to_uuid_byte_stream(
+     libfplist_property_t *property,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	libfplist_xml_tag_t *value_tag                   = NULL;
+	static char *function                            = "libfplist_property_copy_array_to_uuid_byte_stream";
+	size_t byte_stream_offset                        = 0;
+	int element_index                                = 0;
+	int entry_index                                  = 0;
+	int number_of_elements                           = 0;
+	int number_of_entries                            = 0;
+	int result                                       = 0;
+	int value_type                                   = 0;
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_ARRAY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_entries(
+	     internal_property->value_tag,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream_size / 16 ) < (size_t) number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     internal_property->value_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfplist_xml_tag_get_element(
+		     internal_property->value_tag,
+		     element_index,
+		     &value_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		/* Ignore text nodes
+		 */
+		result = libfplist_xml_tag_compare_name(
+		          value_tag,
+		          (uint8_t *) "text",
+		          4,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of value tag.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			continue;
+		}
+		if( entry_index >= number_of_entries )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     value_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( ( value_type != LIBFPLIST_VALUE_TYPE_STRING )
+		 || ( value_tag->value == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value type of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		result = libfplist_uuid_copy_from_utf8_string(
+		          value_tag->value,
+		          value_tag->value_size - 1,
+		          &( byte_stream[ byte_stream_offset ] ),
+		          byte_stream_size - byte_stream_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UUID from string of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported UUID string of array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		byte_stream_offset += 16;
+
+		entry_index++;
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of entries of an array or dictionary
+ * The number of entries is determined when the property list is parsed
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_get_number_of_entries(
+     libfplist_property_t *property,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	static char *function                            = "libfplist_property_get_number_of_entries";
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( internal_property->value_type != LIBFPLIST_VALUE_TYPE_ARRAY )
+	 && ( internal_property->value_type != LIBFPLIST_VALUE_TYPE_DICTIONARY ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_entries(
+	     internal_property->value_tag,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of array entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_get_array_number_of_entries(
+     libfplist_property_t *property,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	static char *function                            = "libfplist_property_get_array_number_of_entries";
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_ARRAY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_entries(
+	     internal_property->value_tag,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific array entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_get_array_entry_by_index(
+     libfplist_property_t *property,
+     int array_entry_index,
+     libfplist_property_t **array_entry,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	libfplist_xml_tag_t *value_tag                   = NULL;
+	static char *function                            = "libfplist_property_get_array_entry_by_index";
+	int entry_index                                  = 0;
+	int element_index                                = 0;
+	int number_of_elements                           = 0;
+	int number_of_entries                            = 0;
+	int result                                       = 0;
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( array_entry_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid array entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( array_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *array_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid array entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_ARRAY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     internal_property->value_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_entries(
+	     internal_property->value_tag,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( array_entry_index >= number_of_entries )
+	{
+		return( 0 );
+	}
+	entry_index = array_entry_index;
+
+	element_index = 0;
+
+	while( element_index < number_of_elements )
+	{
+		if( libfplist_xml_tag_get_element(
+		     internal_property->value_tag,
+		     element_index,
+		     &value_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		/* Ignore text nodes
+		 */
+		result = libfplist_xml_tag_compare_name(
+		          value_tag,
+		          (uint8_t *) "text",
+		          4,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of value tag.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			if( entry_index == 0 )
+			{
+				break;
+			}
+			entry_index--;
+		}
+		element_index++;
+	}
+	if( element_index >= number_of_elements )
+	{
+		return( 0 );
+	}
+	if( libfplist_property_initialize(
+	     array_entry,
+	     NULL,
+	     value_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create array entry: %d.",
+		 function,
+		 array_entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the sub property for the specific UTF-8 encoded name
+ * Returns 1 if successful, 0 if no such sub property or -1 on error
+ */
+int libfplist_property_get_sub_property_by_utf8_name(
+     libfplist_property_t *property,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfplist_property_t **sub_property,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	libfplist_xml_tag_t *key_tag                     = NULL;
+	libfplist_xml_tag_t *value_tag                   = NULL;
+	static char *function                            = "libfplist_property_get_sub_property_by_utf8_name";
+	int element_index                                = 0;
+	int number_of_elements                           = 0;
+	int result                                       = 0;
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub property.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sub_property != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sub property value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_DICTIONARY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     internal_property->value_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	element_index = 0;
+
+	while( element_index < number_of_elements )
+	{
+		if( libfplist_xml_tag_get_element(
+		     internal_property->value_tag,
+		     element_index,
+		     &key_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		result = libfplist_xml_tag_compare_name(
+		          key_tag,
+		          (uint8_t *) "key",
+		          3,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of key tag.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( ( key_tag->value_size == ( utf8_string_length + 1 ) )
+			 && narrow_string_compare(
+			     key_tag->value,
+			     utf8_string,
+			     utf8_string_length ) == 0 )
+			{
+				break;
+			}
+		}
+		element_index++;
+	}
+	if( element_index >= number_of_elements )
+	{
+		return( 0 );
+	}
+	element_index++;
+
+	while( element_index < number_of_elements )
+	{
+		if( libfplist_xml_tag_get_element(
+		     internal_property->value_tag,
+		     element_index,
+		     &value_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		/* Ignore text nodes
+		 */
+		result = libfplist_xml_tag_compare_name(
+		          value_tag,
+		          (uint8_t *) "text",
+		          4,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of value tag.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		element_index++;
+	}
+	if( element_index >= number_of_elements )
+	{
+		return( 0 );
+	}
+	if( libfplist_property_initialize(
+	     sub_property,
+	     key_tag,
+	     value_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sub property.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the sub property for a specific key token
+ * The keys are compared by length and hash before their UTF-8 strings are compared
+ * Returns 1 if successful, 0 if no such sub property or -1 on error
+ */
+int libfplist_property_get_sub_property_by_key_token(
+     libfplist_property_t *property,
+     libfplist_key_token_t *key_token,
+     libfplist_property_t **sub_property,
+     libcerror_error_t **error )
+{
+	libfplist_internal_key_token_t *internal_key_token = NULL;
+	libfplist_internal_property_t *internal_property   = NULL;
+	libfplist_xml_tag_t *key_tag                       = NULL;
+	libfplist_xml_tag_t *value_tag                     = NULL;
+	static char *function                              = "libfplist_property_get_sub_property_by_key_token";
+	uint32_t key_hash_value                            = 0;
+	int element_index                                  = 0;
+	int number_of_elements                             = 0;
+	int result                                         = 0;
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key token.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_token = (libfplist_internal_key_token_t *) key_token;
+
+	if( sub_property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub property.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sub_property != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sub property value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_DICTIONARY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     internal_property->value_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	element_index = 0;
+
+	while( element_index < number_of_elements )
+	{
+		if( libfplist_xml_tag_get_element(
+		     internal_property->value_tag,
+		     element_index,
+		     &key_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		result = libfplist_xml_tag_compare_name(
+		          key_tag,
+		          (uint8_t *) "key",
+		          3,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of key tag.",
+			 function );
+
+			return( -1 );
+		}
+		else if( ( result != 0 )
+		      && ( key_tag->value_size == ( internal_key_token->utf8_string_length + 1 ) ) )
+		{
+			if( libfplist_xml_tag_get_value_hash(
+			     key_tag,
+			     &key_hash_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve hash of key tag.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( key_hash_value == internal_key_token->hash_value )
+			 && ( memory_compare(
+			       key_tag->value,
+			       internal_key_token->utf8_string,
+			       internal_key_token->utf8_string_length ) == 0 ) )
+			{
+				break;
+			}
+		}
+		element_index++;
+	}
+	if( element_index >= number_of_elements )
+	{
+		return( 0 );
+	}
+	element_index++;
+
+	while( element_index < number_of_elements )
+	{
+		if( libfplist_xml_tag_get_element(
+		     internal_property->value_tag,
+		     element_index,
+		     &value_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		/* Ignore text nodes
+		 */
+		result = libfplist_xml_tag_compare_name(
+		          value_tag,
+		          (uint8_t *) "text",
+		          4,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of value tag.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		element_index++;
+	}
+	if( element_index >= number_of_elements )
+	{
+		return( 0 );
+	}
+	if( libfplist_property_initialize(
+	     sub_property,
+	     key_tag,
+	     value_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sub property.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the sub properties for specific UTF-8 encoded names
+ * The dictionary is scanned once for all names, where the names are matched
+ * by length first and then by hash using a small hash table
+ * The sub properties array must contain number_of_names entries that are set to NULL,
+ * entries of names that were not found remain NULL
+ * Returns 1 if successful, 0 if no such sub properties or -1 on error
+ */
+int libfplist_property_get_sub_properties_by_utf8_names(
+     libfplist_property_t *property,
+     const uint8_t **utf8_strings,
+     const size_t *utf8_string_lengths,
+     int number_of_names,
+     libfplist_property_t **sub_properties,
+     libcerror_error_t **error )
+{
+	uint32_t stack_name_hash_values[ 32 ];
+	int stack_duplicate_name_indexes[ 32 ];
+	int stack_hash_table[ 64 ];
+
+	libfplist_internal_property_t *found_property    = NULL;
+	libfplist_internal_property_t *internal_property = NULL;
+	libfplist_xml_tag_t *key_tag                     = NULL;
+	libfplist_xml_tag_t *value_tag                   = NULL;
+	uint32_t *name_hash_values                       = NULL;
+	int *duplicate_name_indexes                      = NULL;
+	int *hash_table                                  = NULL;
+	static char *function                            = "libfplist_property_get_sub_properties_by_utf8_names";
+	size_t key_length                                = 0;
+	uint64_t name_lengths_mask                       = 0;
+	uint32_t key_hash_value                          = 0;
+	int element_index                                = 0;
+	int hash_table_index                             = 0;
+	int hash_table_size                              = 64;
+	int name_index                                   = 0;
+	int number_of_elements                           = 0;
+	int number_of_found_names                        = 0;
+	int number_of_unique_names                       = 0;
+	int result                                       = 0;
+	int value_element_index                          = 0;
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_lengths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string lengths.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_names <= 0 )
+	 || ( (size_t) number_of_names > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 4 * sizeof( uint32_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of names value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_properties == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub properties.",
+		 function );
+
+		return( -1 );
+	}
+	for( name_index = 0;
+	     name_index < number_of_names;
+	     name_index++ )
+	{
+		if( utf8_strings[ name_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-8 string: %d.",
+			 function,
+			 name_index );
+
+			return( -1 );
+		}
+		if( utf8_string_lengths[ name_index ] > (size_t) ( SSIZE_MAX - 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid UTF-8 string: %d length value exceeds maximum.",
+			 function,
+			 name_index );
+
+			return( -1 );
+		}
+		if( sub_properties[ name_index ] != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid sub property: %d value already set.",
+			 function,
+			 name_index );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_DICTIONARY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_names <= 32 )
+	{
+		name_hash_values       = stack_name_hash_values;
+		duplicate_name_indexes = stack_duplicate_name_indexes;
+		hash_table             = stack_hash_table;
+	}
+	else
+	{
+		/* Use a hash table that is at most half full
+		 */
+		while( hash_table_size < ( 2 * number_of_names ) )
+		{
+			hash_table_size *= 2;
+		}
+		name_hash_values = (uint32_t *) memory_allocate(
+		                                 sizeof( uint32_t ) * number_of_names );
+
+		if( name_hash_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create name hash values.",
+			 function );
+
+			goto on_error;
+		}
+		duplicate_name_indexes = (int *) memory_allocate(
+		                                  sizeof( int ) * number_of_names );
+
+		if( duplicate_name_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create duplicate name indexes.",
+			 function );
+
+			goto on_error;
+		}
+		hash_table = (int *) memory_allocate(
+		                      sizeof( int ) * hash_table_size );
+
+		if( hash_table == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create hash table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( memory_set(
+	     hash_table,
+	     0,
+	     sizeof( int ) * hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		goto on_error;
+	}
+	/* The hash table contains the name index + 1 of the unique names
+	 */
+	for( name_index = 0;
+	     name_index < number_of_names;
+	     name_index++ )
+	{
+		if( libfplist_hash_calculate_utf8_string(
+		     &( name_hash_values[ name_index ] ),
+		     utf8_strings[ name_index ],
+		     utf8_string_lengths[ name_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate hash of UTF-8 string: %d.",
+			 function,
+			 name_index );
+
+			goto on_error;
+		}
+		name_lengths_mask |= (uint64_t) 1 << ( utf8_string_lengths[ name_index ] & 0x3f );
+
+		duplicate_name_indexes[ name_index ] = -1;
+
+		hash_table_index = (int) ( name_hash_values[ name_index ] & (uint32_t) ( hash_table_size - 1 ) );
+
+		while( hash_table[ hash_table_index ] != 0 )
+		{
+			result = hash_table[ hash_table_index ] - 1;
+
+			if( ( name_hash_values[ result ] == name_hash_values[ name_index ] )
+			 && ( utf8_string_lengths[ result ] == utf8_string_lengths[ name_index ] )
+			 && ( memory_compare(
+			       utf8_strings[ result ],
+			       utf8_strings[ name_index ],
+			       utf8_string_lengths[ name_index ] ) == 0 ) )
+			{
+				duplicate_name_indexes[ name_index ] = result;
+
+				break;
+			}
+			hash_table_index = ( hash_table_index + 1 ) & ( hash_table_size - 1 );
+		}
+		if( duplicate_name_indexes[ name_index ] == -1 )
+		{
+			hash_table[ hash_table_index ] = name_index + 1;
+
+			number_of_unique_names++;
+		}
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     internal_property->value_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		goto on_error;
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( number_of_found_names >= number_of_unique_names )
+		{
+			break;
+		}
+		if( libfplist_xml_tag_get_element(
+		     internal_property->value_tag,
+		     element_index,
+		     &key_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		result = libfplist_xml_tag_compare_name(
+		          key_tag,
+		          (uint8_t *) "key",
+		          3,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of key tag.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		key_length = 0;
+
+		if( ( key_tag->value != NULL )
+		 && ( key_tag->value_size > 0 ) )
+		{
+			key_length = key_tag->value_size - 1;
+		}
+		if( ( name_lengths_mask & ( (uint64_t) 1 << ( key_length & 0x3f ) ) ) == 0 )
+		{
+			continue;
+		}
+		if( libfplist_xml_tag_get_value_hash(
+		     key_tag,
+		     &key_hash_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hash of key tag.",
+			 function );
+
+			goto on_error;
+		}
+		hash_table_index = (int) ( key_hash_value & (uint32_t) ( hash_table_size - 1 ) );
+
+		while( hash_table[ hash_table_index ] != 0 )
+		{
+			name_index = hash_table[ hash_table_index ] - 1;
+
+			if( ( name_hash_values[ name_index ] == key_hash_value )
+			 && ( utf8_string_lengths[ name_index ] == key_length )
+			 && ( ( key_length == 0 )
+			  ||  ( memory_compare(
+			         key_tag->value,
+			         utf8_strings[ name_index ],
+			         key_length ) == 0 ) ) )
+			{
+				break;
+			}
+			hash_table_index = ( hash_table_index + 1 ) & ( hash_table_size - 1 );
+		}
+		if( hash_table[ hash_table_index ] == 0 )
+		{
+			continue;
+		}
+		name_index = hash_table[ hash_table_index ] - 1;
+
+		/* Only the first occurrence of a key is used
+		 */
+		if( sub_properties[ name_index ] != NULL )
+		{
+			continue;
+		}
+		for( value_element_index = element_index + 1;
+		     value_element_index < number_of_elements;
+		     value_element_index++ )
+		{
+			if( libfplist_xml_tag_get_element(
+			     internal_property->value_tag,
+			     value_element_index,
+			     &value_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve element: %d.",
+				 function,
+				 value_element_index );
+
+				goto on_error;
+			}
+			/* Ignore text nodes
+			 */
+			result = libfplist_xml_tag_compare_name(
+			          value_tag,
+			          (uint8_t *) "text",
+			          4,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to compare name of value tag.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+		if( value_element_index >= number_of_elements )
+		{
+			break;
+		}
+		if( libfplist_property_initialize(
+		     &( sub_properties[ name_index ] ),
+		     key_tag,
+		     value_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sub property: %d.",
+			 function,
+			 name_index );
+
+			goto on_error;
+		}
+		number_of_found_names++;
+	}
+	/* Names that were requested multiple times each receive their own sub property
+	 */
+	for( name_index = 0;
+	     name_index < number_of_names;
+	     name_index++ )
+	{
+		if( duplicate_name_indexes[ name_index ] == -1 )
+		{
+			continue;
+		}
+		found_property = (libfplist_internal_property_t *) sub_properties[ duplicate_name_indexes[ name_index ] ];
+
+		if( found_property == NULL )
+		{
+			continue;
+		}
+		if( libfplist_property_initialize(
+		     &( sub_properties[ name_index ] ),
+		     found_property->key_tag,
+		     found_property->value_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sub property: %d.",
+			 function,
+			 name_index );
+
+			goto on_error;
+		}
+	}
+	if( hash_table != stack_hash_table )
+	{
+		memory_free(
+		 hash_table );
+		memory_free(
+		 duplicate_name_indexes );
+		memory_free(
+		 name_hash_values );
+	}
+	if( number_of_found_names == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	for( name_index = 0;
+	     name_index < number_of_names;
+	     name_index++ )
+	{
+		if( sub_properties[ name_index ] != NULL )
+		{
+			libfplist_property_free(
+			 &( sub_properties[ name_index ] ),
+			 NULL );
+		}
+	}
+	if( ( hash_table != NULL )
+	 && ( hash_table != stack_hash_table ) )
+	{
+		memory_free(
+		 hash_table );
+	}
+	if( ( duplicate_name_indexes != NULL )
+	 && ( duplicate_name_indexes != stack_duplicate_name_indexes ) )
+	{
+		memory_free(
+		 duplicate_name_indexes );
+	}
+	if( ( name_hash_values != NULL )
+	 && ( name_hash_values != stack_name_hash_values ) )
+	{
+		memory_free(
+		 name_hash_values );
+	}
+	return( -1 );
+}
+
+/* Retrieves the value of a field
+ * The field status is set to indicate if the value could be retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_get_field_value(
+     libfplist_xml_tag_t *key_tag,
+     libfplist_xml_tag_t *value_tag,
+     const libfplist_field_descriptor_t *field_descriptor,
+     uint8_t *fields,
+     int *field_status,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t value_property;
+
+	uint8_t *field        = NULL;
+	static char *function = "libfplist_property_get_field_value";
+	size_t data_size      = 0;
+	size_t value_size     = 0;
+	uint64_t upper_64bit  = 0;
+	uint64_t value_64bit  = 0;
+	int64_t posix_time    = 0;
+	uint32_t nanoseconds  = 0;
+	uint32_t value_32bit  = 0;
+	uint8_t boolean_value = 0;
+	uint8_t is_negative   = 0;
+	int result            = 0;
+
+	if( value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( field_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid field descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( fields == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fields.",
+		 function );
+
+		return( -1 );
+	}
+	if( field_status == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid field status.",
+		 function );
+
+		return( -1 );
+	}
+	value_property.key_tag    = key_tag;
+	value_property.value_tag  = value_tag;
+	value_property.value_type = LIBFPLIST_VALUE_TYPE_UNKNOWN;
+
+	if( libfplist_xml_tag_get_value_type(
+	     value_tag,
+	     &( value_property.value_type ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		return( -1 );
+	}
+	field = &( fields[ field_descriptor->field_offset ] );
+
+	*field_status = LIBFPLIST_FIELD_STATUS_UNSUPPORTED_VALUE_TYPE;
+
+	/* Values that cannot be converted are not considered an error
+	 * but are reported by the field status instead
+	 */
+	switch( field_descriptor->field_type )
+	{
+		case LIBFPLIST_FIELD_TYPE_BINARY_DATA:
+			if( value_property.value_type != LIBFPLIST_VALUE_TYPE_BINARY_DATA )
+			{
+				break;
+			}
+			*field_status = LIBFPLIST_FIELD_STATUS_INVALID_VALUE;
+
+			if( libfplist_property_get_value_data_size(
+			     (libfplist_property_t *) &value_property,
+			     &data_size,
+			     NULL ) != 1 )
+			{
+				break;
+			}
+			if( data_size > field_descriptor->field_size )
+			{
+				break;
+			}
+			if( memory_set(
+			     field,
+			     0,
+			     field_descriptor->field_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear field.",
+				 function );
+
+				return( -1 );
+			}
+			if( data_size > 0 )
+			{
+				if( libfplist_property_get_value_data(
+				     (libfplist_property_t *) &value_property,
+				     field,
+				     data_size,
+				     NULL ) != 1 )
+				{
+					break;
+				}
+			}
+			*field_status = LIBFPLIST_FIELD_STATUS_SET;
+
+			break;
+
+		case LIBFPLIST_FIELD_TYPE_BOOLEAN:
+			if( value_property.value_type != LIBFPLIST_VALUE_TYPE_BOOLEAN )
+			{
+				break;
+			}
+			result = libfplist_xml_tag_compare_name(
+			          value_tag,
+			          (uint8_t *) "true",
+			          4,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to compare name of value tag.",
+				 function );
+
+				return( -1 );
+			}
+			boolean_value = (uint8_t) result;
+
+			if( memory_copy(
+			     field,
+			     &boolean_value,
+			     sizeof( uint8_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy boolean value to field.",
+				 function );
+
+				return( -1 );
+			}
+			*field_status = LIBFPLIST_FIELD_STATUS_SET;
+
+			break;
+
+		case LIBFPLIST_FIELD_TYPE_DATE_TIME:
+			if( value_property.value_type != LIBFPLIST_VALUE_TYPE_DATE )
+			{
+				break;
+			}
+			*field_status = LIBFPLIST_FIELD_STATUS_INVALID_VALUE;
+
+			if( ( value_tag->value == NULL )
+			 || ( value_tag->value_size == 0 ) )
+			{
+				break;
+			}
+			result = libfplist_date_time_copy_from_utf8_string(
+			          value_tag->value,
+			          value_tag->value_size - 1,
+			          &posix_time,
+			          &nanoseconds,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy date and time from value.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			/* The field contains a signed 64-bit POSIX time in nanoseconds
+			 */
+			result = libfplist_date_time_copy_to_posix_time_in_nanoseconds(
+			          posix_time,
+			          nanoseconds,
+			          &posix_time,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy date and time to POSIX time in nanoseconds.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( memory_copy(
+			     field,
+			     &posix_time,
+			     sizeof( int64_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy date and time value to field.",
+				 function );
+
+				return( -1 );
+			}
+			*field_status = LIBFPLIST_FIELD_STATUS_SET;
+
+			break;
+
+		case LIBFPLIST_FIELD_TYPE_INTEGER_32BIT:
+		case LIBFPLIST_FIELD_TYPE_INTEGER_64BIT:
+			if( value_property.value_type != LIBFPLIST_VALUE_TYPE_INTEGER )
+			{
+				break;
+			}
+			*field_status = LIBFPLIST_FIELD_STATUS_INVALID_VALUE;
+
+			if( libfplist_xml_tag_get_integer_value(
+			     value_tag,
+			     &upper_64bit,
+			     &value_64bit,
+			     &is_negative,
+			     NULL ) != 1 )
+			{
+				break;
+			}
+			if( upper_64bit != 0 )
+			{
+				break;
+			}
+			/* Negative values are stored as two's complement
+			 */
+			if( field_descriptor->field_type == LIBFPLIST_FIELD_TYPE_INTEGER_64BIT )
+			{
+				if( is_negative != 0 )
+				{
+					if( value_64bit > ( (uint64_t) INT64_MAX + 1 ) )
+					{
+						break;
+					}
+					value_64bit = 0 - value_64bit;
+				}
+				if( memory_copy(
+				     field,
+				     &value_64bit,
+				     sizeof( uint64_t ) ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy integer value to field.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			else
+			{
+				if( is_negative != 0 )
+				{
+					if( value_64bit > ( (uint64_t) INT32_MAX + 1 ) )
+					{
+						break;
+					}
+					value_64bit = 0 - value_64bit;
+				}
+				else if( value_64bit > (uint64_t) UINT32_MAX )
+				{
+					break;
+				}
+				value_32bit = (uint32_t) value_64bit;
+
+				if( memory_copy(
+				     field,
+				     &value_32bit,
+				     sizeof( uint32_t ) ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy integer value to field.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			*field_status = LIBFPLIST_FIELD_STATUS_SET;
+
+			break;
+
+		case LIBFPLIST_FIELD_TYPE_UTF8_STRING:
+			if( value_property.value_type != LIBFPLIST_VALUE_TYPE_STRING )
+			{
+				break;
+			}
+			*field_status = LIBFPLIST_FIELD_STATUS_INVALID_VALUE;
+
+			if( value_tag->value != NULL )
+			{
+				value_size = value_tag->value_size;
+			}
+			if( ( value_size > field_descriptor->field_size )
+			 || ( field_descriptor->field_size == 0 ) )
+			{
+				break;
+			}
+			if( value_size == 0 )
+			{
+				field[ 0 ] = 0;
+			}
+			else if( memory_copy(
+			          field,
+			          value_tag->value,
+			          value_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy string value to field.",
+				 function );
+
+				return( -1 );
+			}
+			*field_status = LIBFPLIST_FIELD_STATUS_SET;
+
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported field type: %d.",
+			 function,
+			 field_descriptor->field_type );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the values of fields from a dictionary tag
+ * The field descriptor indexes contain the field descriptors that are applicable
+ * to the dictionary, the key path offsets contain the offset of the key path segment
+ * that corresponds with the keys of the dictionary
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_get_fields_from_dictionary_tag(
+     libfplist_xml_tag_t *dictionary_tag,
+     const libfplist_field_descriptor_t *field_descriptors,
+     int *field_descriptor_indexes,
+     int number_of_field_descriptor_indexes,
+     size_t *key_path_offsets,
+     size_t *key_path_segment_lengths,
+     uint32_t *key_path_segment_hashes,
+     uint8_t *fields,
+     int *field_statuses,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfplist_xml_tag_t *key_tag   = NULL;
+	libfplist_xml_tag_t *value_tag = NULL;
+	const char *key_path_segment   = NULL;
+	static char *function          = "libfplist_property_get_fields_from_dictionary_tag";
+	size_t key_length              = 0;
+	size_t key_path_segment_length = 0;
+	uint32_t key_hash_value        = 0;
+	int element_index              = 0;
+	int field_descriptor_index     = 0;
+	int index                      = 0;
+	int match_index                = 0;
+	int number_of_elements         = 0;
+	int number_of_matches          = 0;
+	int number_of_nested_matches   = 0;
+	int result                     = 0;
+	int value_element_index        = 0;
+	int value_type                 = 0;
+
+	if( dictionary_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dictionary tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( field_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid field descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( field_descriptor_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid field descriptor indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_path_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_path_segment_lengths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path segment lengths.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_path_segment_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path segment hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( field_statuses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid field statuses.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFPLIST_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the key path segment that corresponds with this dictionary
+	 */
+	for( index = 0;
+	     index < number_of_field_descriptor_indexes;
+	     index++ )
+	{
+		field_descriptor_index = field_descriptor_indexes[ index ];
+
+		key_path_segment        = &( field_descriptors[ field_descriptor_index ].key_path[ key_path_offsets[ field_descriptor_index ] ] );
+		key_path_segment_length = 0;
+
+		while( ( key_path_segment[ key_path_segment_length ] != 0 )
+		    && ( key_path_segment[ key_path_segment_length ] != '/' ) )
+		{
+			key_path_segment_length++;
+		}
+		if( libfplist_hash_calculate_utf8_string(
+		     &( key_path_segment_hashes[ field_descriptor_index ] ),
+		     (uint8_t *) key_path_segment,
+		     key_path_segment_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate hash of key path segment of field descriptor: %d.",
+			 function,
+			 field_descriptor_index );
+
+			return( -1 );
+		}
+		key_path_segment_lengths[ field_descriptor_index ] = key_path_segment_length;
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     dictionary_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( number_of_field_descriptor_indexes <= 0 )
+		{
+			break;
+		}
+		if( libfplist_xml_tag_get_element(
+		     dictionary_tag,
+		     element_index,
+		     &key_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		result = libfplist_xml_tag_compare_name(
+		          key_tag,
+		          (uint8_t *) "key",
+		          3,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of key tag.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		key_length = 0;
+
+		if( ( key_tag->value != NULL )
+		 && ( key_tag->value_size > 0 ) )
+		{
+			key_length = key_tag->value_size - 1;
+		}
+		if( libfplist_xml_tag_get_value_hash(
+		     key_tag,
+		     &key_hash_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hash of key tag.",
+			 function );
+
+			return( -1 );
+		}
+		/* Move the field descriptors that match the key to the end of the indexes
+		 * so that they are no longer considered for other keys
+		 */
+		number_of_matches = 0;
+
+		index = 0;
+
+		while( index < number_of_field_descriptor_indexes )
+		{
+			field_descriptor_index = field_descriptor_indexes[ index ];
+
+			if( ( key_path_segment_hashes[ field_descriptor_index ] == key_hash_value )
+			 && ( key_path_segment_lengths[ field_descriptor_index ] == key_length )
+			 && ( ( key_length == 0 )
+			  ||  ( memory_compare(
+			         key_tag->value,
+			         &( field_descriptors[ field_descriptor_index ].key_path[ key_path_offsets[ field_descriptor_index ] ] ),
+			         key_length ) == 0 ) ) )
+			{
+				number_of_field_descriptor_indexes--;
+
+				field_descriptor_indexes[ index ]                              = field_descriptor_indexes[ number_of_field_descriptor_indexes ];
+				field_descriptor_indexes[ number_of_field_descriptor_indexes ] = field_descriptor_index;
+
+				number_of_matches++;
+			}
+			else
+			{
+				index++;
+			}
+		}
+		if( number_of_matches == 0 )
+		{
+			continue;
+		}
+		for( value_element_index = element_index + 1;
+		     value_element_index < number_of_elements;
+		     value_element_index++ )
+		{
+			if( libfplist_xml_tag_get_element(
+			     dictionary_tag,
+			     value_element_index,
+			     &value_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve element: %d.",
+				 function,
+				 value_element_index );
+
+				return( -1 );
+			}
+			/* Ignore text nodes
+			 */
+			result = libfplist_xml_tag_compare_name(
+			          value_tag,
+			          (uint8_t *) "text",
+			          4,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to compare name of value tag.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+		if( value_element_index >= number_of_elements )
+		{
+			break;
+		}
+		/* Retrieve the values of the fields for which the key path ends with the key
+		 * and move the field descriptors with a longer key path to the start of the matches
+		 */
+		number_of_nested_matches = 0;
+
+		for( match_index = number_of_field_descriptor_indexes;
+		     match_index < number_of_field_descriptor_indexes + number_of_matches;
+		     match_index++ )
+		{
+			field_descriptor_index = field_descriptor_indexes[ match_index ];
+
+			key_path_segment = &( field_descriptors[ field_descriptor_index ].key_path[ key_path_offsets[ field_descriptor_index ] + key_length ] );
+
+			if( key_path_segment[ 0 ] == 0 )
+			{
+				if( libfplist_property_get_field_value(
+				     key_tag,
+				     value_tag,
+				     &( field_descriptors[ field_descriptor_index ] ),
+				     fields,
+				     &( field_statuses[ field_descriptor_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve value of field: %d.",
+					 function,
+					 field_descriptor_index );
+
+					return( -1 );
+				}
+			}
+			else
+			{
+				key_path_offsets[ field_descriptor_index ] += key_length + 1;
+
+				index = number_of_field_descriptor_indexes + number_of_nested_matches;
+
+				field_descriptor_indexes[ match_index ] = field_descriptor_indexes[ index ];
+				field_descriptor_indexes[ index ]       = field_descriptor_index;
+
+				number_of_nested_matches++;
+			}
+		}
+		if( number_of_nested_matches == 0 )
+		{
+			continue;
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     value_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+		if( value_type != LIBFPLIST_VALUE_TYPE_DICTIONARY )
+		{
+			for( match_index = number_of_field_descriptor_indexes;
+			     match_index < number_of_field_descriptor_indexes + number_of_nested_matches;
+			     match_index++ )
+			{
+				field_descriptor_index = field_descriptor_indexes[ match_index ];
+
+				field_statuses[ field_descriptor_index ] = LIBFPLIST_FIELD_STATUS_UNSUPPORTED_VALUE_TYPE;
+			}
+			continue;
+		}
+		if( libfplist_property_get_fields_from_dictionary_tag(
+		     value_tag,
+		     field_descriptors,
+		     &( field_descriptor_indexes[ number_of_field_descriptor_indexes ] ),
+		     number_of_nested_matches,
+		     key_path_offsets,
+		     key_path_segment_lengths,
+		     key_path_segment_hashes,
+		     fields,
+		     field_statuses,
+		     recursion_depth + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve fields from sub dictionary.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the values of fields as described by the field descriptors
+ * The field values are stored in the fields structure at the offsets of the field descriptors
+ * The dictionary and its sub dictionaries are traversed once for all field descriptors
+ * Negative integer values are stored in integer fields as two's complement
+ * If not NULL the field statuses receive a LIBFPLIST_FIELD_STATUS value for every field descriptor
+ * Returns 1 if successful, 0 if a required field was not set or -1 on error
+ */
+int libfplist_property_get_fields(
+     libfplist_property_t *property,
+     const libfplist_field_descriptor_t *field_descriptors,
+     int number_of_field_descriptors,
+     uint8_t *fields,
+     size_t fields_size,
+     int *field_statuses,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	int *field_descriptor_indexes                    = NULL;
+	int *safe_field_statuses                         = NULL;
+	size_t *key_path_offsets                         = NULL;
+	size_t *key_path_segment_lengths                 = NULL;
+	uint32_t *key_path_segment_hashes                = NULL;
+	static char *function                            = "libfplist_property_get_fields";
+	size_t field_size                                = 0;
+	int field_descriptor_index                       = 0;
+	int result                                       = 1;
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( internal_property->value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property - missing value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( field_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid field descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_field_descriptors <= 0 )
+	 || ( (size_t) number_of_field_descriptors > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( size_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of field descriptors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( fields == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fields.",
+		 function );
+
+		return( -1 );
+	}
+	if( fields_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid fields size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( field_descriptor_index = 0;
+	     field_descriptor_index < number_of_field_descriptors;
+	     field_descriptor_index++ )
+	{
+		if( field_descriptors[ field_descriptor_index ].key_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid field descriptor: %d - missing key path.",
+			 function,
+			 field_descriptor_index );
+
+			return( -1 );
+		}
+		switch( field_descriptors[ field_descriptor_index ].field_type )
+		{
+			case LIBFPLIST_FIELD_TYPE_BINARY_DATA:
+			case LIBFPLIST_FIELD_TYPE_UTF8_STRING:
+				field_size = field_descriptors[ field_descriptor_index ].field_size;
+				break;
+
+			case LIBFPLIST_FIELD_TYPE_BOOLEAN:
+				field_size = sizeof( uint8_t );
+				break;
+
+			case LIBFPLIST_FIELD_TYPE_INTEGER_32BIT:
+				field_size = sizeof( uint32_t );
+				break;
+
+			case LIBFPLIST_FIELD_TYPE_DATE_TIME:
+			case LIBFPLIST_FIELD_TYPE_INTEGER_64BIT:
+				field_size = sizeof( uint64_t );
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid field descriptor: %d - unsupported field type.",
+				 function,
+				 field_descriptor_index );
+
+				return( -1 );
+		}
+		if( ( field_size == 0 )
+		 || ( field_size > fields_size )
+		 || ( field_descriptors[ field_descriptor_index ].field_offset > ( fields_size - field_size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid field descriptor: %d - field offset or size value out of bounds.",
+			 function,
+			 field_descriptor_index );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+	{
+		if( libfplist_xml_tag_get_value_type(
+		     internal_property->value_tag,
+		     &( internal_property->value_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_property->value_type != LIBFPLIST_VALUE_TYPE_DICTIONARY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	field_descriptor_indexes = (int *) memory_allocate(
+	                                    sizeof( int ) * number_of_field_descriptors );
+
+	if( field_descriptor_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create field descriptor indexes.",
+		 function );
+
+		goto on_error;
+	}
+	key_path_offsets = (size_t *) memory_allocate(
+	                               sizeof( size_t ) * number_of_field_descriptors );
+
+	if( key_path_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key path offsets.",
+		 function );
+
+		goto on_error;
+	}
+	key_path_segment_lengths = (size_t *) memory_allocate(
+	                                       sizeof( size_t ) * number_of_field_descriptors );
+
+	if( key_path_segment_lengths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key path segment lengths.",
+		 function );
+
+		goto on_error;
+	}
+	key_path_segment_hashes = (uint32_t *) memory_allocate(
+	                                        sizeof( uint32_t ) * number_of_field_descriptors );
+
+	if( key_path_segment_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key path segment hashes.",
+		 function );
+
+		goto on_error;
+	}
+	if( field_statuses != NULL )
+	{
+		safe_field_statuses = field_statuses;
+	}
+	else
+	{
+		safe_field_statuses = (int *) memory_allocate(
+		                               sizeof( int ) * number_of_field_descriptors );
+
+		if( safe_field_statuses == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create field statuses.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( field_descriptor_index = 0;
+	     field_descriptor_index < number_of_field_descriptors;
+	     field_descriptor_index++ )
+	{
+		field_descriptor_indexes[ field_descriptor_index ] = field_descriptor_index;
+		key_path_offsets[ field_descriptor_index ]         = 0;
+		safe_field_statuses[ field_descriptor_index ]      = LIBFPLIST_FIELD_STATUS_NOT_SET;
+	}
+	if( libfplist_property_get_fields_from_dictionary_tag(
+	     internal_property->value_tag,
+	     field_descriptors,
+	     field_descriptor_indexes,
+	     number_of_field_descriptors,
+	     key_path_offsets,
+	     key_path_segment_lengths,
+	     key_path_segment_hashes,
+	     fields,
+	     safe_field_statuses,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve fields from dictionary.",
+		 function );
+
+		goto on_error;
+	}
+	for( field_descriptor_index = 0;
+	     field_descriptor_index < number_of_field_descriptors;
+	     field_descriptor_index++ )
+	{
+		if( ( ( field_descriptors[ field_descriptor_index ].flags & LIBFPLIST_FIELD_FLAG_REQUIRED ) != 0 )
+		 && ( safe_field_statuses[ field_descriptor_index ] != LIBFPLIST_FIELD_STATUS_SET ) )
+		{
+			result = 0;
+		}
+	}
+	if( safe_field_statuses != field_statuses )
+	{
+		memory_free(
+		 safe_field_statuses );
+	}
+	memory_free(
+	 key_path_segment_hashes );
+	memory_free(
+	 key_path_segment_lengths );
+	memory_free(
+	 key_path_offsets );
+	memory_free(
+	 field_descriptor_indexes );
+
+	return( result );
+
+on_error:
+	if( ( safe_field_statuses != NULL )
+	 && ( safe_field_statuses != field_statuses ) )
+	{
+		memory_free(
+		 safe_field_statuses );
+	}
+	if( key_path_segment_hashes != NULL )
+	{
+		memory_free(
+		 key_path_segment_hashes );
+	}
+	if( key_path_segment_lengths != NULL )
+	{
+		memory_free(
+		 key_path_segment_lengths );
+	}
+	if( key_path_offsets != NULL )
+	{
+		memory_free(
+		 key_path_offsets );
+	}
+	if( field_descriptor_indexes != NULL )
+	{
+		memory_free(
+		 field_descriptor_indexes );
+	}
+	return( -1 );
+}
+
+/* Copies the path of a value tag to an UTF-8 string
+ * If the UTF-8 string is NULL the UTF-8 string index is advanced without copying,
+ * which is used to determine the size of the path
+ * The key tag is optional and is determined from the parent tag if not provided
+ * Returns 1 if successful, 0 if the value tag is the root of the path or -1 on error
+ */
+int libfplist_property_copy_tag_path_to_utf8_string(
+     libfplist_xml_tag_t *key_tag,
+     libfplist_xml_tag_t *value_tag,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfplist_xml_tag_t *element_tag = NULL;
+	libfplist_xml_tag_t *parent_tag  = NULL;
+	static char *function            = "libfplist_property_copy_tag_path_to_utf8_string";
+	size_t segment_length            = 0;
+	size_t string_index              = 0;
+	int array_index                  = 0;
+	int divider                      = 0;
+	int element_index                = 0;
+	int number_of_elements           = 0;
+	int parent_value_type            = 0;
+	int result                       = 0;
+	int value_type                   = 0;
+
+	if( value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFPLIST_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	parent_tag = value_tag->parent_tag;
+
+	if( parent_tag == NULL )
+	{
+		return( 0 );
+	}
+	if( libfplist_xml_tag_get_value_type(
+	     parent_tag,
+	     &parent_value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type of parent tag.",
+		 function );
+
+		return( -1 );
+	}
+	/* The dict or array tag inside the plist tag is the root of the path
+	 */
+	if( ( parent_value_type != LIBFPLIST_VALUE_TYPE_ARRAY )
+	 && ( parent_value_type != LIBFPLIST_VALUE_TYPE_DICTIONARY ) )
+	{
+		return( 0 );
+	}
+	if( ( key_tag == NULL )
+	 || ( parent_value_type == LIBFPLIST_VALUE_TYPE_ARRAY ) )
+	{
+		if( libfplist_xml_tag_get_number_of_elements(
+		     parent_tag,
+		     &number_of_elements,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of elements.",
+			 function );
 
 			return( -1 );
 		}
-		/* Ignore text nodes
-		 */
-		result = libfplist_xml_tag_compare_name(
-		          value_tag,
-		          (uint8_t *) "text",
-		          4,
-		          error );
+		for( element_index = 0;
+		     element_index < number_of_elements;
+		     element_index++ )
+		{
+			if( libfplist_xml_tag_get_element(
+			     parent_tag,
+			     element_index,
+			     &element_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve element: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+			if( element_tag == value_tag )
+			{
+				break;
+			}
+			result = libfplist_xml_tag_compare_name(
+			          element_tag,
+			          (uint8_t *) "key",
+			          3,
+			          error );
 
-		if( result == -1 )
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to compare name of element tag: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				key_tag = element_tag;
+
+				continue;
+			}
+			if( libfplist_xml_tag_get_value_type(
+			     element_tag,
+			     &value_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value type of element tag: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+			/* Ignore text nodes
+			 */
+			if( value_type != LIBFPLIST_VALUE_TYPE_UNKNOWN )
+			{
+				array_index++;
+			}
+		}
+		if( element_index >= number_of_elements )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to compare name of value tag.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing value tag in parent tag.",
 			 function );
 
 			return( -1 );
 		}
-		else if( result == 0 )
+	}
+	if( parent_value_type == LIBFPLIST_VALUE_TYPE_DICTIONARY )
+	{
+		if( key_tag == NULL )
 		{
-			break;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing key tag.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( key_tag->value != NULL )
+		 && ( key_tag->value_size > 0 ) )
+		{
+			segment_length = key_tag->value_size - 1;
 		}
-		element_index++;
 	}
-	if( element_index >= number_of_elements )
+	else
 	{
-		return( 0 );
+		segment_length = 1;
+
+		for( divider = 10;
+		     divider <= array_index;
+		     divider *= 10 )
+		{
+			segment_length++;
+
+			if( divider > ( INT_MAX / 10 ) )
+			{
+				break;
+			}
+		}
 	}
-	if( libfplist_property_initialize(
-	     sub_property,
-	     key_tag,
-	     value_tag,
-	     error ) != 1 )
+	result = libfplist_property_copy_tag_path_to_utf8_string(
+	          NULL,
+	          parent_tag,
+	          utf8_string,
+	          utf8_string_size,
+	          utf8_string_index,
+	          recursion_depth + 1,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create sub property.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy path of parent tag.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		/* Add the path segment separator
+		 */
+		segment_length += 1;
+	}
+	if( segment_length > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - *utf8_string_index ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string != NULL )
+	{
+		if( segment_length > ( utf8_string_size - *utf8_string_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		string_index = *utf8_string_index;
+
+		if( result != 0 )
+		{
+			utf8_string[ string_index++ ] = (uint8_t) '/';
+
+			segment_length -= 1;
+		}
+		if( parent_value_type == LIBFPLIST_VALUE_TYPE_DICTIONARY )
+		{
+			if( segment_length > 0 )
+			{
+				if( memory_copy(
+				     &( utf8_string[ string_index ] ),
+				     key_tag->value,
+				     segment_length ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy key to UTF-8 string.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+		else
+		{
+			string_index += segment_length;
+
+			do
+			{
+				string_index--;
+
+				utf8_string[ string_index ] = (uint8_t) '0' + (uint8_t) ( array_index % 10 );
+
+				array_index /= 10;
+			}
+			while( array_index > 0 );
+		}
+		if( result != 0 )
+		{
+			segment_length += 1;
+		}
+	}
+	*utf8_string_index += segment_length;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded path of the property
+ * The size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_get_utf8_path_size(
+     libfplist_property_t *property,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	static char *function                            = "libfplist_property_get_utf8_path_size";
+	size_t utf8_string_index                         = 0;
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_property_copy_tag_path_to_utf8_string(
+	     internal_property->key_tag,
+	     internal_property->value_tag,
+	     NULL,
+	     0,
+	     &utf8_string_index,
+	     0,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of path.",
 		 function );
 
 		return( -1 );
 	}
+	*utf8_string_size = utf8_string_index + 1;
+
 	return( 1 );
 }
 
+/* Retrieves the UTF-8 encoded path of the property
+ * The path consists of the keys of the dictionaries and the indexes of the arrays
+ * from the root property separated by '/'
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_get_utf8_path(
+     libfplist_property_t *property,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_t *internal_property = NULL;
+	static char *function                            = "libfplist_property_get_utf8_path";
+	size_t utf8_string_index                         = 0;
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property = (libfplist_internal_property_t *) property;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_property_copy_tag_path_to_utf8_string(
+	     internal_property->key_tag,
+	     internal_property->value_tag,
+	     utf8_string,
+	     utf8_string_size - 1,
+	     &utf8_string_index,
+	     0,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy path to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	utf8_string[ utf8_string_index ] = 0;
+
+	return( 1 );
+}
@@ -68,6 +68,18 @@ int libfplist_property_get_value_type(
      int *value_type,
      libcerror_error_t **error );
 
+LIBFPLIST_EXTERN \
+int libfplist_property_get_value(
+     libfplist_property_t *property,
+     libfplist_value_t *value,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_get_value_boolean(
+     libfplist_property_t *property,
+     uint8_t *value_boolean,
+     libcerror_error_t **error );
+
 LIBFPLIST_EXTERN \
 int libfplist_property_get_value_data_size(
      libfplist_property_t *property,
@@ -81,12 +93,58 @@ int libfplist_property_get_value_data(
      size_t data_size,
      libcerror_error_t **error );
 
+LIBFPLIST_EXTERN \
+int libfplist_property_get_value_data_allocated(
+     libfplist_property_t *property,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+ssize_t libfplist_property_read_value_data_at_offset(
+         libfplist_property_t *property,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_get_value_as_property_list(
+     libfplist_property_t *property,
+     libfplist_property_list_t **property_list,
+     libcerror_error_t **error );
+
 LIBFPLIST_EXTERN \
 int libfplist_property_get_value_integer(
      libfplist_property_t *property,
      uint64_t *value_64bit,
      libcerror_error_t **error );
 
+LIBFPLIST_EXTERN \
+int libfplist_property_get_value_uid(
+     libfplist_property_t *property,
+     uint64_t *uid_value,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_get_value_signed_integer(
+     libfplist_property_t *property,
+     int64_t *value_64bit,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_get_value_128bit_integer(
+     libfplist_property_t *property,
+     uint64_t *value_upper_64bit,
+     uint64_t *value_lower_64bit,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_get_value_floating_point(
+     libfplist_property_t *property,
+     double *value_floating_point,
+     libcerror_error_t **error );
+
 LIBFPLIST_EXTERN \
 int libfplist_property_get_value_string(
      libfplist_property_t *property,
@@ -101,6 +159,78 @@ int libfplist_property_value_uuid_string_copy_to_byte_stream(
      size_t byte_stream_size,
      libcerror_error_t **error );
 
+LIBFPLIST_EXTERN \
+int libfplist_property_get_value_date_time(
+     libfplist_property_t *property,
+     int64_t *posix_time_in_nanoseconds,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_get_value_filetime(
+     libfplist_property_t *property,
+     uint64_t *filetime,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_copy_array_to_date_time(
+     libfplist_property_t *property,
+     int64_t *date_time_values,
+     int number_of_date_time_values,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_copy_array_to_int64(
+     libfplist_property_t *property,
+     int64_t *integer_values,
+     int number_of_integer_values,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_copy_array_to_double(
+     libfplist_property_t *property,
+     double *floating_point_values,
+     int number_of_floating_point_values,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_copy_array_to_bool(
+     libfplist_property_t *property,
+     uint8_t *boolean_values,
+     int number_of_boolean_values,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_get_array_utf8_strings_size(
+     libfplist_property_t *property,
+     const uint8_t *utf8_key_path,
+     size_t utf8_key_path_length,
+     size_t *utf8_strings_size,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_copy_array_to_utf8_strings(
+     libfplist_property_t *property,
+     const uint8_t *utf8_key_path,
+     size_t utf8_key_path_length,
+     uint8_t *utf8_strings,
+     size_t utf8_strings_size,
+     size_t *utf8_string_offsets,
+     int number_of_utf8_string_offsets,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_copy_array_to_uuid_byte_stream(
+     libfplist_property_t *property,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_get_number_of_entries(
+     libfplist_property_t *property,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
 LIBFPLIST_EXTERN \
 int libfplist_property_get_array_number_of_entries(
      libfplist_property_t *property,
@@ -122,6 +252,75 @@ int libfplist_property_get_sub_property_by_utf8_name(
      libfplist_property_t **sub_property,
      libcerror_error_t **error );
 
+LIBFPLIST_EXTERN \
+int libfplist_property_get_sub_property_by_key_token(
+     libfplist_property_t *property,
+     libfplist_key_token_t *key_token,
+     libfplist_property_t **sub_property,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_get_sub_properties_by_utf8_names(
+     libfplist_property_t *property,
+     const uint8_t **utf8_strings,
+     const size_t *utf8_string_lengths,
+     int number_of_names,
+     libfplist_property_t **sub_properties,
+     libcerror_error_t **error );
+
+int libfplist_property_get_field_value(
+     libfplist_xml_tag_t *key_tag,
+     libfplist_xml_tag_t *value_tag,
+     const libfplist_field_descriptor_t *field_descriptor,
+     uint8_t *fields,
+     int *field_status,
+     libcerror_error_t **error );
+
+int libfplist_property_get_fields_from_dictionary_tag(
+     libfplist_xml_tag_t *dictionary_tag,
+     const libfplist_field_descriptor_t *field_descriptors,
+     int *field_descriptor_indexes,
+     int number_of_field_descriptor_indexes,
+     size_t *key_path_offsets,
+     size_t *key_path_segment_lengths,
+     uint32_t *key_path_segment_hashes,
+     uint8_t *fields,
+     int *field_statuses,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_get_fields(
+     libfplist_property_t *property,
+     const libfplist_field_descriptor_t *field_descriptors,
+     int number_of_field_descriptors,
+     uint8_t *fields,
+     size_t fields_size,
+     int *field_statuses,
+     libcerror_error_t **error );
+
+int libfplist_property_copy_tag_path_to_utf8_string(
+     libfplist_xml_tag_t *key_tag,
+     libfplist_xml_tag_t *value_tag,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_get_utf8_path_size(
+     libfplist_property_t *property,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_get_utf8_path(
+     libfplist_property_t *property,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -23,6 +23,11 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfplist_binary_parser.h"
+#include "libfplist_binary_writer.h"
+#include "libfplist_definitions.h"
+#include "libfplist_hash.h"
+#include "libfplist_key_index.h"
 #include "libfplist_libcerror.h"
 #include "libfplist_libcnotify.h"
 #include "libfplist_property.h"
@@ -156,6 +161,41 @@ int libfplist_property_list_free(
 
 			result = -1;
 		}
+		/* The binary parser state is freed after the XML tags since
+		 * the tags can reference its buffer
+		 */
+		if( internal_property_list->binary_parser_state != NULL )
+		{
+			if( libfplist_binary_parser_state_free(
+			     &( internal_property_list->binary_parser_state ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free binary parser state.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_property_list->key_index != NULL )
+		{
+			if( libfplist_key_index_free(
+			     &( internal_property_list->key_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free key index.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_property_list );
 	}
@@ -163,6 +203,7 @@ int libfplist_property_list_free(
 }
 
 /* Copies the property list from the byte stream
+ * The byte stream can contain a XML or a binary (bplist00, bplist15, bplist16 or bplist17) property list
  * Returns 1 if successful, 0 if not a valid property list or -1 on error
  */
 int libfplist_property_list_copy_from_byte_stream(
@@ -238,102 +279,129 @@ int libfplist_property_list_copy_from_byte_stream(
 
 		return( -1 );
 	}
-	/* Lex wants 2 zero bytes at the end of the buffer
-	 */
-	buffer_size = byte_stream_size;
-
-	if( byte_stream[ byte_stream_size - 1 ] != 0 )
-	{
-		buffer_size += 2;
-	}
-	else if( byte_stream[ byte_stream_size - 2 ] != 0 )
+	if( ( byte_stream_size >= 8 )
+	 && ( memory_compare(
+	       byte_stream,
+	       "bplist",
+	       6 ) == 0 ) )
 	{
-		buffer_size += 1;
-	}
-	/* Lex wants a buffer it can write to
-	 */
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * buffer_size );
+		result = libfplist_property_list_read_binary(
+		          internal_property_list,
+		          byte_stream,
+		          byte_stream_size,
+		          LIBFPLIST_BINARY_PARSER_FLAG_MANAGED_BUFFER,
+		          error );
 
-	if( buffer == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create buffer.",
-		 function );
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read binary plist.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	if( memory_copy(
-	     buffer,
-	     byte_stream,
-	     byte_stream_size ) == NULL )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy byte stream.",
-		 function );
+		/* Lex wants 2 zero bytes at the end of the buffer
+		 */
+		buffer_size = byte_stream_size;
 
-		goto on_error;
-	}
-	buffer[ buffer_size - 2 ] = 0;
-	buffer[ buffer_size - 1 ] = 0;
+		if( byte_stream[ byte_stream_size - 1 ] != 0 )
+		{
+			buffer_size += 2;
+		}
+		else if( byte_stream[ byte_stream_size - 2 ] != 0 )
+		{
+			buffer_size += 1;
+		}
+		/* Lex wants a buffer it can write to
+		 */
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * buffer_size );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		if( ( buffer_size >= 6 )
-		 && ( buffer[ 0 ] == '<' )
-		 && ( buffer[ 1 ] == '?' )
-		 && ( buffer[ 2 ] == 'x' )
-		 && ( buffer[ 3 ] == 'm' )
-		 && ( buffer[ 4 ] == 'l' )
-		 && ( buffer[ buffer_size - 1 ] == 0 ) )
+		if( buffer == NULL )
 		{
-			libcnotify_printf(
-			 "%s: XML plist:\n%s\n",
-			 function,
-			 buffer );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+
+			goto on_error;
 		}
-		else
+		if( memory_copy(
+		     buffer,
+		     byte_stream,
+		     byte_stream_size ) == NULL )
 		{
-			libcnotify_printf(
-			 "%s: XML plist data:\n",
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy byte stream.",
 			 function );
-			libcnotify_print_data(
-			 buffer,
-			 buffer_size,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+			goto on_error;
 		}
-	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+		buffer[ buffer_size - 2 ] = 0;
+		buffer[ buffer_size - 1 ] = 0;
 
-	result = libfplist_xml_parser_parse_buffer(
-	          property_list,
-	          buffer,
-	          buffer_size,
-	          error );
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( ( buffer_size >= 6 )
+			 && ( buffer[ 0 ] == '<' )
+			 && ( buffer[ 1 ] == '?' )
+			 && ( buffer[ 2 ] == 'x' )
+			 && ( buffer[ 3 ] == 'm' )
+			 && ( buffer[ 4 ] == 'l' )
+			 && ( buffer[ buffer_size - 1 ] == 0 ) )
+			{
+				libcnotify_printf(
+				 "%s: XML plist:\n%s\n",
+				 function,
+				 buffer );
+			}
+			else
+			{
+				libcnotify_printf(
+				 "%s: XML plist data:\n",
+				 function );
+				libcnotify_print_data(
+				 buffer,
+				 buffer_size,
+				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+			}
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	if( result != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to parse XML.",
-		 function );
+		result = libfplist_xml_parser_parse_buffer(
+		          property_list,
+		          buffer,
+		          buffer_size,
+		          error );
 
-		goto on_error;
-	}
-	memory_free(
-	 buffer );
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to parse XML.",
+			 function );
 
-	buffer = NULL;
+			goto on_error;
+		}
+		memory_free(
+		 buffer );
 
+		buffer = NULL;
+	}
 	if( internal_property_list->root_tag == NULL )
 	{
 		libcerror_error_set(
@@ -493,20 +561,33 @@ on_error:
 		 &( internal_property_list->root_tag ),
 		 NULL );
 	}
+	if( internal_property_list->binary_parser_state != NULL )
+	{
+		libfplist_binary_parser_state_free(
+		 &( internal_property_list->binary_parser_state ),
+		 NULL );
+	}
+	internal_property_list->plist_tag = NULL;
+	internal_property_list->dict_tag  = NULL;
+
 	return( -1 );
 }
 
-/* Determines if the property list is XML with a plist root element
- * Returns 1 if true, 0 if not or -1 on error
+/* Reads the root object of a binary (bplist00 or bplist1x) property list
+ * The binary parser state of the property list must be set
+ * The elements of the array and dict objects are read on demand
+ * Returns 1 if successful or -1 on error
  */
-int libfplist_property_list_has_plist_root_element(
-     libfplist_property_list_t *property_list,
+int libfplist_property_list_read_binary_root_object(
+     libfplist_internal_property_list_t *internal_property_list,
      libcerror_error_t **error )
 {
-	libfplist_internal_property_list_t *internal_property_list = NULL;
-	static char *function                                      = "libfplist_property_list_has_plist_root_element";
+	libfplist_xml_tag_t *root_tag       = NULL;
+	static char *function               = "libfplist_property_list_read_binary_root_object";
+	uint64_t number_of_expanded_objects = 0;
+	int result                          = 0;
 
-	if( property_list == NULL )
+	if( internal_property_list == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -517,27 +598,116 @@ int libfplist_property_list_has_plist_root_element(
 
 		return( -1 );
 	}
-	internal_property_list = (libfplist_internal_property_list_t *) property_list;
+	if( internal_property_list->binary_parser_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property list - missing binary parser state.",
+		 function );
 
-	if( internal_property_list->plist_tag == NULL )
+		return( -1 );
+	}
+	/* The object graph is validated upfront so that the elements that are read
+	 * on demand cannot contain reference cycles or expand excessively. Validation
+	 * is skipped when the data is read on demand using a read function since
+	 * it would read every object. A bplist1x property list has no object
+	 * references, its elements are stored inline and read sequentially
+	 */
+	if( ( internal_property_list->binary_parser_state->buffer != NULL )
+	 && ( internal_property_list->binary_parser_state->format_version == 0 ) )
 	{
-		return( 0 );
+		if( libfplist_binary_parser_validate(
+		     internal_property_list->binary_parser_state,
+		     &number_of_expanded_objects,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: invalid binary property list.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfplist_binary_parser_read_root_object(
+	     internal_property_list->binary_parser_state,
+	     &root_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read root object.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfplist_xml_tag_compare_name(
+	          root_tag,
+	          (uint8_t *) "dict",
+	          4,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to compare name of root tag.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_list_set_root_tag(
+	     (libfplist_property_list_t *) internal_property_list,
+	     root_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set root tag.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == 1 )
+	{
+		internal_property_list->dict_tag = root_tag;
 	}
 	return( 1 );
+
+on_error:
+	if( root_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &root_tag,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the root property
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Reads a binary (bplist00, bplist15, bplist16 or bplist17) property list
+ * The elements of bplist00 array and dict objects are read on demand
+ * Returns 1 if successful or -1 on error
  */
-int libfplist_property_list_get_root_property(
-     libfplist_property_list_t *property_list,
-     libfplist_property_t **property,
+int libfplist_property_list_read_binary(
+     libfplist_internal_property_list_t *internal_property_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint8_t flags,
      libcerror_error_t **error )
 {
-	libfplist_internal_property_list_t *internal_property_list = NULL;
-	static char *function                                      = "libfplist_property_list_get_root_property";
+	static char *function = "libfplist_property_list_read_binary";
 
-	if( property_list == NULL )
+	if( internal_property_list == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -548,50 +718,1077 @@ int libfplist_property_list_get_root_property(
 
 		return( -1 );
 	}
-	internal_property_list = (libfplist_internal_property_list_t *) property_list;
-
-	if( property == NULL )
+	if( internal_property_list->binary_parser_state != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid property.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid property list - binary parser state already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( *property != NULL )
+	if( libfplist_binary_parser_state_initialize(
+	     &( internal_property_list->binary_parser_state ),
+	     byte_stream,
+	     byte_stream_size,
+	     flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid property value already set.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create binary parser state.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_property_list->dict_tag == NULL )
+	if( libfplist_property_list_read_binary_root_object(
+	     internal_property_list,
+	     error ) != 1 )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read root object.",
+		 function );
+
+		goto on_error;
 	}
-	if( libfplist_property_initialize(
-	     property,
-	     NULL,
-	     internal_property_list->dict_tag,
-	     error ) != 1 )
+	return( 1 );
+
+on_error:
+	if( internal_property_list->binary_parser_state != NULL )
+	{
+		libfplist_binary_parser_state_free(
+		 &( internal_property_list->binary_parser_state ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the property list from the byte stream
+ * The byte stream can contain a XML or a binary (bplist00, bplist15, bplist16 or bplist17) property list
+ * A binary property list is not copied, the byte stream is referenced and must remain
+ * available and unchanged until the property list is freed
+ * A XML property list is parsed and copied as by libfplist_property_list_copy_from_byte_stream
+ * Returns 1 if successful, 0 if not a valid property list or -1 on error
+ */
+int libfplist_property_list_set_byte_stream(
+     libfplist_property_list_t *property_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_list_t *internal_property_list = NULL;
+	static char *function                                      = "libfplist_property_list_set_byte_stream";
+
+	if( property_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property_list = (libfplist_internal_property_list_t *) property_list;
+
+	if( internal_property_list->root_tag != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create property.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid property list - root XML tag already set.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream_size < 8 )
+	 || ( memory_compare(
+	       byte_stream,
+	       "bplist",
+	       6 ) != 0 ) )
+	{
+		return( libfplist_property_list_copy_from_byte_stream(
+		         property_list,
+		         byte_stream,
+		         byte_stream_size,
+		         error ) );
+	}
+	if( libfplist_property_list_read_binary(
+	     internal_property_list,
+	     byte_stream,
+	     byte_stream_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read binary plist.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the property list from a binary (bplist00, bplist15, bplist16 or bplist17) property list that is read on demand
+ * The read function is called with the IO handle to read size bytes at an offset relative
+ * to the start of the binary property list, and returns the number of bytes read or -1 on error.
+ * A libbfio handle can be used with libbfio_handle_read_buffer_at_offset
+ * Only the header, the trailer, the offset table entries and the objects that are accessed are read,
+ * the IO handle must remain available until the property list is freed
+ * Since the object graph is not validated upfront, callers that traverse the whole
+ * property list are bounded by the maximum recursion depth only
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_list_set_io_handle(
+     libfplist_property_list_t *property_list,
+     intptr_t *io_handle,
+     ssize_t (*read_buffer_at_offset)(
+                intptr_t *io_handle,
+                uint8_t *buffer,
+                size_t size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_list_t *internal_property_list = NULL;
+	static char *function                                      = "libfplist_property_list_set_io_handle";
+
+	if( property_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property_list = (libfplist_internal_property_list_t *) property_list;
+
+	if( internal_property_list->root_tag != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid property list - root XML tag already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property_list->binary_parser_state != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid property list - binary parser state already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_binary_parser_state_initialize_with_read_function(
+	     &( internal_property_list->binary_parser_state ),
+	     io_handle,
+	     read_buffer_at_offset,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create binary parser state.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_list_read_binary_root_object(
+	     internal_property_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read root object.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_property_list->binary_parser_state != NULL )
+	{
+		libfplist_binary_parser_state_free(
+		 &( internal_property_list->binary_parser_state ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the property list as a binary (bplist00) property list
+ * Identical strings and other non-container values are stored once as a shared object
+ * The byte stream is newly allocated and the caller is responsible for freeing it
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_list_write_binary(
+     libfplist_property_list_t *property_list,
+     uint8_t **byte_stream,
+     size_t *byte_stream_size,
+     libcerror_error_t **error )
+{
+	libfplist_binary_writer_t *binary_writer                   = NULL;
+	libfplist_internal_property_list_t *internal_property_list = NULL;
+	libfplist_xml_tag_t *element_tag                           = NULL;
+	libfplist_xml_tag_t *root_value_tag                        = NULL;
+	static char *function                                      = "libfplist_property_list_write_binary";
+	int element_index                                          = 0;
+	int number_of_elements                                     = 0;
+	int root_object_index                                      = 0;
+	int value_type                                             = 0;
+
+	if( property_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property_list = (libfplist_internal_property_list_t *) property_list;
+
+	if( internal_property_list->root_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property list - missing root XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	/* Ignore the plist XML node
+	 * <plist version="1.0">
+	 */
+	if( internal_property_list->plist_tag == NULL )
+	{
+		root_value_tag = internal_property_list->root_tag;
+	}
+	else
+	{
+		if( libfplist_xml_tag_get_number_of_elements(
+		     internal_property_list->plist_tag,
+		     &number_of_elements,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of elements.",
+			 function );
+
+			return( -1 );
+		}
+		for( element_index = 0;
+		     element_index < number_of_elements;
+		     element_index++ )
+		{
+			if( libfplist_xml_tag_get_element(
+			     internal_property_list->plist_tag,
+			     element_index,
+			     &element_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve element: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+			if( libfplist_xml_tag_get_value_type(
+			     element_tag,
+			     &value_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value type of element: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+			/* Ignore text nodes
+			 */
+			if( value_type != LIBFPLIST_VALUE_TYPE_UNKNOWN )
+			{
+				root_value_tag = element_tag;
+
+				break;
+			}
+		}
+	}
+	if( root_value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property list - missing root value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_binary_writer_initialize(
+	     &binary_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create binary writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_binary_writer_add_tag(
+	     binary_writer,
+	     root_value_tag,
+	     0,
+	     &root_object_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add root value XML tag.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_binary_writer_copy_to_byte_stream(
+	     binary_writer,
+	     root_object_index,
+	     byte_stream,
+	     byte_stream_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy binary property list to byte stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_binary_writer_free(
+	     &binary_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free binary writer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( binary_writer != NULL )
+	{
+		libfplist_binary_writer_free(
+		 &binary_writer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines if the property list is XML with a plist root element
+ * Returns 1 if true, 0 if not or -1 on error
+ */
+int libfplist_property_list_has_plist_root_element(
+     libfplist_property_list_t *property_list,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_list_t *internal_property_list = NULL;
+	static char *function                                      = "libfplist_property_list_has_plist_root_element";
+
+	if( property_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property_list = (libfplist_internal_property_list_t *) property_list;
+
+	if( internal_property_list->plist_tag == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the root property
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfplist_property_list_get_root_property(
+     libfplist_property_list_t *property_list,
+     libfplist_property_t **property,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_list_t *internal_property_list = NULL;
+	static char *function                                      = "libfplist_property_list_get_root_property";
+
+	if( property_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property_list = (libfplist_internal_property_list_t *) property_list;
+
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	if( *property != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid property value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_property_list->dict_tag == NULL )
+	{
+		return( 0 );
+	}
+	if( libfplist_property_initialize(
+	     property,
+	     NULL,
+	     internal_property_list->dict_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create property.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a found property to the properties
+ * The property is only created if the properties can contain it, otherwise only
+ * the number of properties is incremented
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_list_append_found_property(
+     libfplist_xml_tag_t *key_tag,
+     libfplist_xml_tag_t *value_tag,
+     libfplist_property_t **properties,
+     int maximum_number_of_properties,
+     int *number_of_properties,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_property_list_append_found_property";
+
+	if( number_of_properties == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of properties.",
+		 function );
+
+		return( -1 );
+	}
+	if( *number_of_properties == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of properties value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( *number_of_properties < maximum_number_of_properties )
+	{
+		if( libfplist_property_initialize(
+		     &( properties[ *number_of_properties ] ),
+		     key_tag,
+		     value_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create property: %d.",
+			 function,
+			 *number_of_properties );
+
+			return( -1 );
+		}
+	}
+	*number_of_properties += 1;
+
+	return( 1 );
+}
+
+/* Finds all the properties with a specific UTF-8 encoded key in a dictionary
+ * or array tag and its sub elements
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_property_list_find_all_by_utf8_key_in_tag(
+     libfplist_xml_tag_t *tag,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t hash_value,
+     libfplist_property_t **properties,
+     int maximum_number_of_properties,
+     int *number_of_properties,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfplist_xml_tag_t *element_tag = NULL;
+	libfplist_xml_tag_t *key_tag     = NULL;
+	static char *function            = "libfplist_property_list_find_all_by_utf8_key_in_tag";
+	uint32_t key_hash_value          = 0;
+	int element_index                = 0;
+	int number_of_elements           = 0;
+	int result                       = 0;
+	int value_type                   = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFPLIST_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfplist_xml_tag_get_element(
+		     tag,
+		     element_index,
+		     &element_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		result = libfplist_xml_tag_compare_name(
+		          element_tag,
+		          (uint8_t *) "key",
+		          3,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of element tag: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			key_tag = NULL;
+
+			if( element_tag->value_size == ( utf8_string_length + 1 ) )
+			{
+				if( libfplist_xml_tag_get_value_hash(
+				     element_tag,
+				     &key_hash_value,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve hash of element tag: %d.",
+					 function,
+					 element_index );
+
+					return( -1 );
+				}
+				if( ( key_hash_value == hash_value )
+				 && ( memory_compare(
+				       element_tag->value,
+				       utf8_string,
+				       utf8_string_length ) == 0 ) )
+				{
+					key_tag = element_tag;
+				}
+			}
+			continue;
+		}
+		if( libfplist_xml_tag_get_value_type(
+		     element_tag,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type of element tag: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		/* Ignore text nodes
+		 */
+		if( value_type == LIBFPLIST_VALUE_TYPE_UNKNOWN )
+		{
+			continue;
+		}
+		if( key_tag != NULL )
+		{
+			if( libfplist_property_list_append_found_property(
+			     key_tag,
+			     element_tag,
+			     properties,
+			     maximum_number_of_properties,
+			     number_of_properties,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append found property.",
+				 function );
+
+				return( -1 );
+			}
+			key_tag = NULL;
+		}
+		if( ( value_type == LIBFPLIST_VALUE_TYPE_ARRAY )
+		 || ( value_type == LIBFPLIST_VALUE_TYPE_DICTIONARY ) )
+		{
+			if( libfplist_property_list_find_all_by_utf8_key_in_tag(
+			     element_tag,
+			     utf8_string,
+			     utf8_string_length,
+			     hash_value,
+			     properties,
+			     maximum_number_of_properties,
+			     number_of_properties,
+			     recursion_depth + 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to find properties in element tag: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Finds all the properties with a specific UTF-8 encoded key in the property list
+ * The properties are found in document order with a single walk of the document,
+ * or when LIBFPLIST_FIND_FLAG_USE_KEY_INDEX is set, by using a key index that is
+ * built on first use
+ * The properties array must contain maximum_number_of_properties entries that are set to NULL,
+ * the number of properties is set to the total number of matches, which can exceed
+ * the maximum number of properties, so that the call can be repeated with a larger array
+ * Returns 1 if successful, 0 if no such properties or -1 on error
+ */
+int libfplist_property_list_find_all_by_utf8_key(
+     libfplist_property_list_t *property_list,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t flags,
+     libfplist_property_t **properties,
+     int maximum_number_of_properties,
+     int *number_of_properties,
+     libcerror_error_t **error )
+{
+	libfplist_internal_property_list_t *internal_property_list = NULL;
+	libfplist_key_index_entry_t *entry                         = NULL;
+	static char *function                                      = "libfplist_property_list_find_all_by_utf8_key";
+	uint32_t hash_value                                        = 0;
+	int entry_index                                            = 0;
+	int property_index                                         = 0;
+	int result                                                 = 0;
+
+	if( property_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_property_list = (libfplist_internal_property_list_t *) property_list;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBFPLIST_FIND_FLAG_USE_KEY_INDEX ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	if( maximum_number_of_properties < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of properties value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( properties == NULL )
+	 && ( maximum_number_of_properties > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid properties.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_properties == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of properties.",
+		 function );
+
+		return( -1 );
+	}
+	for( property_index = 0;
+	     property_index < maximum_number_of_properties;
+	     property_index++ )
+	{
+		if( properties[ property_index ] != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid property: %d value already set.",
+			 function,
+			 property_index );
+
+			return( -1 );
+		}
+	}
+	*number_of_properties = 0;
+
+	if( internal_property_list->dict_tag == NULL )
+	{
+		return( 0 );
+	}
+	if( libfplist_hash_calculate_utf8_string(
+	     &hash_value,
+	     utf8_string,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate hash of UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( flags & LIBFPLIST_FIND_FLAG_USE_KEY_INDEX ) == 0 )
+	{
+		if( libfplist_property_list_find_all_by_utf8_key_in_tag(
+		     internal_property_list->dict_tag,
+		     utf8_string,
+		     utf8_string_length,
+		     hash_value,
+		     properties,
+		     maximum_number_of_properties,
+		     number_of_properties,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to find properties in dict tag.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( internal_property_list->key_index == NULL )
+		{
+			if( libfplist_key_index_initialize(
+			     &( internal_property_list->key_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create key index.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfplist_key_index_build(
+			     internal_property_list->key_index,
+			     internal_property_list->dict_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to build key index.",
+				 function );
+
+				libfplist_key_index_free(
+				 &( internal_property_list->key_index ),
+				 NULL );
+
+				goto on_error;
+			}
+		}
+		result = libfplist_key_index_get_first_entry_index_by_hash(
+		          internal_property_list->key_index,
+		          hash_value,
+		          &entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first key index entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			while( entry_index < internal_property_list->key_index->number_of_entries )
+			{
+				entry = &( internal_property_list->key_index->entries[ entry_index ] );
+
+				if( entry->hash_value != hash_value )
+				{
+					break;
+				}
+				if( ( entry->key_tag->value_size == ( utf8_string_length + 1 ) )
+				 && ( memory_compare(
+				       entry->key_tag->value,
+				       utf8_string,
+				       utf8_string_length ) == 0 ) )
+				{
+					if( libfplist_property_list_append_found_property(
+					     entry->key_tag,
+					     entry->value_tag,
+					     properties,
+					     maximum_number_of_properties,
+					     number_of_properties,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append found property.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				entry_index++;
+			}
+		}
+	}
+	if( *number_of_properties == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	for( property_index = 0;
+	     property_index < maximum_number_of_properties;
+	     property_index++ )
+	{
+		if( properties[ property_index ] != NULL )
+		{
+			libfplist_property_free(
+			 &( properties[ property_index ] ),
+			 NULL );
+		}
+	}
+	*number_of_properties = 0;
+
+	return( -1 );
 }
 
 /* Sets the root tag
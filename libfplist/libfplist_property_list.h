@@ -26,6 +26,8 @@
 #include <types.h>
 
 #include "libfplist_extern.h"
+#include "libfplist_key_index.h"
+#include "libfplist_binary_parser.h"
 #include "libfplist_libcerror.h"
 #include "libfplist_types.h"
 #include "libfplist_xml_tag.h"
@@ -49,6 +51,14 @@ struct libfplist_internal_property_list
 	/* The (main) dict XML tag
 	 */
 	libfplist_xml_tag_t *dict_tag;
+
+	/* The key index
+	 */
+	libfplist_key_index_t *key_index;
+
+	/* The binary parser state, set for a binary property list
+	 */
+	libfplist_binary_parser_state_t *binary_parser_state;
 };
 
 LIBFPLIST_EXTERN \
@@ -68,6 +78,44 @@ int libfplist_property_list_copy_from_byte_stream(
      size_t byte_stream_size,
      libcerror_error_t **error );
 
+int libfplist_property_list_read_binary_root_object(
+     libfplist_internal_property_list_t *internal_property_list,
+     libcerror_error_t **error );
+
+int libfplist_property_list_read_binary(
+     libfplist_internal_property_list_t *internal_property_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_list_set_byte_stream(
+     libfplist_property_list_t *property_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_list_set_io_handle(
+     libfplist_property_list_t *property_list,
+     intptr_t *io_handle,
+     ssize_t (*read_buffer_at_offset)(
+                intptr_t *io_handle,
+                uint8_t *buffer,
+                size_t size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     size64_t data_size,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_list_write_binary(
+     libfplist_property_list_t *property_list,
+     uint8_t **byte_stream,
+     size_t *byte_stream_size,
+     libcerror_error_t **error );
+
 LIBFPLIST_EXTERN \
 int libfplist_property_list_has_plist_root_element(
      libfplist_property_list_t *property_list,
@@ -79,6 +127,36 @@ int libfplist_property_list_get_root_property(
      libfplist_property_t **property,
      libcerror_error_t **error );
 
+int libfplist_property_list_append_found_property(
+     libfplist_xml_tag_t *key_tag,
+     libfplist_xml_tag_t *value_tag,
+     libfplist_property_t **properties,
+     int maximum_number_of_properties,
+     int *number_of_properties,
+     libcerror_error_t **error );
+
+int libfplist_property_list_find_all_by_utf8_key_in_tag(
+     libfplist_xml_tag_t *tag,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t hash_value,
+     libfplist_property_t **properties,
+     int maximum_number_of_properties,
+     int *number_of_properties,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_property_list_find_all_by_utf8_key(
+     libfplist_property_list_t *property_list,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t flags,
+     libfplist_property_t **properties,
+     int maximum_number_of_properties,
+     int *number_of_properties,
+     libcerror_error_t **error );
+
 int libfplist_property_list_set_root_tag(
      libfplist_property_list_t *property_list,
      libfplist_xml_tag_t *tag,
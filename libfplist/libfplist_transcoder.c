@@ -0,0 +1,1491 @@
+/*
+ * Property list transcoder functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libfplist_binary_parser.h"
+#include "libfplist_binary_writer.h"
+#include "libfplist_definitions.h"
+#include "libfplist_libcerror.h"
+#include "libfplist_transcoder.h"
+#include "libfplist_xml_tag.h"
+#include "libfplist_xml_writer.h"
+
+int libfplist_xml_parser_transcode_buffer(
+     libfplist_transcoder_t *transcoder,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+/* Creates a transcoder
+ * Make sure the value transcoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_transcoder_initialize(
+     libfplist_transcoder_t **transcoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_transcoder_initialize";
+
+	if( transcoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transcoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *transcoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid transcoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*transcoder = memory_allocate_structure(
+	               libfplist_transcoder_t );
+
+	if( *transcoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create transcoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *transcoder,
+	     0,
+	     sizeof( libfplist_transcoder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear transcoder.",
+		 function );
+
+		memory_free(
+		 *transcoder );
+
+		*transcoder = NULL;
+
+		return( -1 );
+	}
+	if( libfplist_binary_writer_initialize(
+	     &( ( *transcoder )->binary_writer ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create binary writer.",
+		 function );
+
+		goto on_error;
+	}
+	( *transcoder )->root_object_index = -1;
+
+	return( 1 );
+
+on_error:
+	if( *transcoder != NULL )
+	{
+		memory_free(
+		 *transcoder );
+
+		*transcoder = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a transcoder
+ * The tags that are still open are freed as well
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_transcoder_free(
+     libfplist_transcoder_t **transcoder,
+     libcerror_error_t **error )
+{
+	libfplist_transcoder_open_tag_t *open_tag = NULL;
+	static char *function                     = "libfplist_transcoder_free";
+	int open_tag_index                        = 0;
+	int result                                = 1;
+
+	if( transcoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transcoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *transcoder != NULL )
+	{
+		for( open_tag_index = 0;
+		     open_tag_index < ( *transcoder )->number_of_open_tags;
+		     open_tag_index++ )
+		{
+			open_tag = &( ( *transcoder )->open_tags[ open_tag_index ] );
+
+			if( open_tag->tag != NULL )
+			{
+				libfplist_xml_tag_free(
+				 &( open_tag->tag ),
+				 NULL );
+			}
+			if( open_tag->key_tag != NULL )
+			{
+				libfplist_xml_tag_free(
+				 &( open_tag->key_tag ),
+				 NULL );
+			}
+			if( open_tag->uid_key_tag != NULL )
+			{
+				libfplist_xml_tag_free(
+				 &( open_tag->uid_key_tag ),
+				 NULL );
+			}
+			if( open_tag->uid_value_tag != NULL )
+			{
+				libfplist_xml_tag_free(
+				 &( open_tag->uid_value_tag ),
+				 NULL );
+			}
+		}
+		if( ( *transcoder )->element_object_indexes != NULL )
+		{
+			memory_free(
+			 ( *transcoder )->element_object_indexes );
+		}
+		if( libfplist_binary_writer_free(
+		     &( ( *transcoder )->binary_writer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free binary writer.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *transcoder );
+
+		*transcoder = NULL;
+	}
+	return( result );
+}
+
+/* Appends an element object index of an open array or dict tag
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_transcoder_append_element_object_index(
+     libfplist_transcoder_t *transcoder,
+     int object_index,
+     libcerror_error_t **error )
+{
+	int *element_object_indexes                       = NULL;
+	static char *function                             = "libfplist_transcoder_append_element_object_index";
+	size_t maximum_number_of_element_object_indexes   = 0;
+	size_t number_of_allocated_element_object_indexes = 0;
+
+	if( transcoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transcoder.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_number_of_element_object_indexes = MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int );
+
+	if( transcoder->number_of_element_object_indexes >= transcoder->number_of_allocated_element_object_indexes )
+	{
+		number_of_allocated_element_object_indexes = transcoder->number_of_allocated_element_object_indexes;
+
+		if( number_of_allocated_element_object_indexes == 0 )
+		{
+			number_of_allocated_element_object_indexes = 1024;
+		}
+		else if( number_of_allocated_element_object_indexes <= ( maximum_number_of_element_object_indexes / 2 ) )
+		{
+			number_of_allocated_element_object_indexes *= 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of element object indexes value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		element_object_indexes = (int *) memory_reallocate(
+		                                  transcoder->element_object_indexes,
+		                                  sizeof( int ) * number_of_allocated_element_object_indexes );
+
+		if( element_object_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize element object indexes.",
+			 function );
+
+			return( -1 );
+		}
+		transcoder->element_object_indexes                     = element_object_indexes;
+		transcoder->number_of_allocated_element_object_indexes = number_of_allocated_element_object_indexes;
+	}
+	transcoder->element_object_indexes[ transcoder->number_of_element_object_indexes ] = object_index;
+
+	transcoder->number_of_element_object_indexes += 1;
+
+	return( 1 );
+}
+
+/* Opens a tag
+ * The transcoder takes over the ownership of the tag, which is freed when
+ * it is closed or when the transcoder is freed, also on error
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_transcoder_open_tag(
+     libfplist_transcoder_t *transcoder,
+     libfplist_xml_tag_t *tag,
+     libcerror_error_t **error )
+{
+	libfplist_transcoder_open_tag_t *open_tag        = NULL;
+	libfplist_transcoder_open_tag_t *parent_open_tag = NULL;
+	static char *function                            = "libfplist_transcoder_open_tag";
+	int result                                       = 0;
+
+	if( transcoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transcoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( transcoder->number_of_open_tags < 0 )
+	 || ( transcoder->number_of_open_tags >= LIBFPLIST_TRANSCODER_MAXIMUM_NUMBER_OF_OPEN_TAGS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid transcoder - number of open tags value out of bounds.",
+		 function );
+
+		libfplist_xml_tag_free(
+		 &tag,
+		 NULL );
+
+		return( -1 );
+	}
+	if( transcoder->number_of_open_tags > 0 )
+	{
+		parent_open_tag = &( transcoder->open_tags[ transcoder->number_of_open_tags - 1 ] );
+	}
+	open_tag = &( transcoder->open_tags[ transcoder->number_of_open_tags ] );
+
+	if( memory_set(
+	     open_tag,
+	     0,
+	     sizeof( libfplist_transcoder_open_tag_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear open tag.",
+		 function );
+
+		libfplist_xml_tag_free(
+		 &tag,
+		 NULL );
+
+		return( -1 );
+	}
+	open_tag->tag                           = tag;
+	open_tag->element_object_indexes_offset = transcoder->number_of_element_object_indexes;
+
+	transcoder->number_of_open_tags += 1;
+
+	if( libfplist_xml_tag_get_value_type(
+	     tag,
+	     &( open_tag->value_type ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only the elements of array and dict tags and the first value of the plist tag
+	 * are part of the property list
+	 */
+	if( parent_open_tag == NULL )
+	{
+		open_tag->is_ignored = 0;
+	}
+	else if( parent_open_tag->is_ignored != 0 )
+	{
+		open_tag->is_ignored = 1;
+	}
+	else if( parent_open_tag->value_type == LIBFPLIST_VALUE_TYPE_ARRAY )
+	{
+		open_tag->is_ignored = 0;
+	}
+	else if( parent_open_tag->value_type == LIBFPLIST_VALUE_TYPE_DICTIONARY )
+	{
+		result = libfplist_xml_tag_compare_name(
+		          tag,
+		          (uint8_t *) "key",
+		          3,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of tag.",
+			 function );
+
+			return( -1 );
+		}
+		/* A value without a key is ignored
+		 */
+		open_tag->is_ignored = (uint8_t) ( ( result == 0 ) && ( parent_open_tag->key_tag == NULL ) );
+	}
+	else if( ( transcoder->number_of_open_tags == 2 )
+	      && ( transcoder->root_object_index == -1 ) )
+	{
+		result = libfplist_xml_tag_compare_name(
+		          parent_open_tag->tag,
+		          (uint8_t *) "plist",
+		          5,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of parent tag.",
+			 function );
+
+			return( -1 );
+		}
+		open_tag->is_ignored = (uint8_t) ( result == 0 );
+	}
+	else
+	{
+		open_tag->is_ignored = 1;
+	}
+	return( 1 );
+}
+
+/* Adds a dict entry of which the value object was added before
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_transcoder_add_dict_entry(
+     libfplist_transcoder_t *transcoder,
+     libfplist_transcoder_open_tag_t *dict_open_tag,
+     libfplist_xml_tag_t *key_tag,
+     int value_object_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_transcoder_add_dict_entry";
+	int key_object_index  = 0;
+
+	if( transcoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transcoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( dict_open_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dict open tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_binary_writer_add_string_tag(
+	     transcoder->binary_writer,
+	     key_tag,
+	     &key_object_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add key tag.",
+		 function );
+
+		return( -1 );
+	}
+	/* The key and value object indexes are stored interleaved
+	 */
+	if( libfplist_transcoder_append_element_object_index(
+	     transcoder,
+	     key_object_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append key object index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_transcoder_append_element_object_index(
+	     transcoder,
+	     value_object_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value object index.",
+		 function );
+
+		return( -1 );
+	}
+	dict_open_tag->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Adds the CF$UID entry of a dict that was held back as a regular entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_transcoder_add_uid_entry(
+     libfplist_transcoder_t *transcoder,
+     libfplist_transcoder_open_tag_t *dict_open_tag,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfplist_transcoder_add_uid_entry";
+	int value_object_index = 0;
+
+	if( transcoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transcoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( dict_open_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dict open tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_binary_writer_add_tag(
+	     transcoder->binary_writer,
+	     dict_open_tag->uid_value_tag,
+	     0,
+	     &value_object_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add UID value tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_transcoder_add_dict_entry(
+	     transcoder,
+	     dict_open_tag,
+	     dict_open_tag->uid_key_tag,
+	     value_object_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add UID dict entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_free(
+	     &( dict_open_tag->uid_key_tag ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free UID key tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_free(
+	     &( dict_open_tag->uid_value_tag ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free UID value tag.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if a dict entry represents a UID, which is held back until the dict is closed
+ * A UID is represented as a dict with a single CF$UID key and a non-negative integer value:
+ * <dict><key>CF$UID</key><integer>#</integer></dict>
+ * Returns 1 if the entry represents a UID, 0 if not or -1 on error
+ */
+int libfplist_transcoder_is_uid_entry(
+     libfplist_transcoder_open_tag_t *dict_open_tag,
+     libfplist_xml_tag_t *value_tag,
+     int value_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_transcoder_is_uid_entry";
+	uint64_t lower_64bit  = 0;
+	uint64_t upper_64bit  = 0;
+	uint8_t is_negative   = 0;
+
+	if( dict_open_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dict open tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_type != LIBFPLIST_VALUE_TYPE_INTEGER )
+	 || ( dict_open_tag->number_of_entries != 0 )
+	 || ( dict_open_tag->uid_value_tag != NULL )
+	 || ( dict_open_tag->key_tag == NULL )
+	 || ( dict_open_tag->key_tag->value_size != 7 )
+	 || ( narrow_string_compare(
+	       dict_open_tag->key_tag->value,
+	       "CF$UID",
+	       6 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( libfplist_xml_tag_get_integer_value(
+	     value_tag,
+	     &upper_64bit,
+	     &lower_64bit,
+	     &is_negative,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve integer value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( is_negative != 0 )
+	 || ( upper_64bit != 0 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Closes the last open tag
+ * The tag is added to the binary writer as an object and referenced by its parent
+ * array or dict tag, the elements of an array or dict tag were added when they were closed
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_transcoder_close_tag(
+     libfplist_transcoder_t *transcoder,
+     libfplist_xml_tag_t *tag,
+     libcerror_error_t **error )
+{
+	libfplist_transcoder_open_tag_t *open_tag        = NULL;
+	libfplist_transcoder_open_tag_t *parent_open_tag = NULL;
+	static char *function                            = "libfplist_transcoder_close_tag";
+	uint64_t lower_64bit                             = 0;
+	uint64_t upper_64bit                             = 0;
+	uint8_t is_negative                              = 0;
+	int object_index                                 = 0;
+	int result                                       = 0;
+
+	if( transcoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transcoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( transcoder->number_of_open_tags <= 0 )
+	 || ( transcoder->number_of_open_tags > LIBFPLIST_TRANSCODER_MAXIMUM_NUMBER_OF_OPEN_TAGS )
+	 || ( tag == NULL )
+	 || ( tag != transcoder->open_tags[ transcoder->number_of_open_tags - 1 ].tag ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tag - not the last open tag.",
+		 function );
+
+		return( -1 );
+	}
+	open_tag = &( transcoder->open_tags[ transcoder->number_of_open_tags - 1 ] );
+
+	if( transcoder->number_of_open_tags > 1 )
+	{
+		parent_open_tag = &( transcoder->open_tags[ transcoder->number_of_open_tags - 2 ] );
+	}
+	if( open_tag->is_ignored != 0 )
+	{
+		goto close_tag;
+	}
+	switch( open_tag->value_type )
+	{
+		case LIBFPLIST_VALUE_TYPE_ARRAY:
+			if( libfplist_binary_writer_add_container_object(
+			     transcoder->binary_writer,
+			     0xa0,
+			     &( transcoder->element_object_indexes[ open_tag->element_object_indexes_offset ] ),
+			     open_tag->number_of_entries,
+			     &object_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add array object.",
+				 function );
+
+				return( -1 );
+			}
+			transcoder->number_of_element_object_indexes = open_tag->element_object_indexes_offset;
+
+			break;
+
+		case LIBFPLIST_VALUE_TYPE_DICTIONARY:
+			if( ( open_tag->uid_value_tag != NULL )
+			 && ( open_tag->number_of_entries == 0 ) )
+			{
+				if( libfplist_xml_tag_get_integer_value(
+				     open_tag->uid_value_tag,
+				     &upper_64bit,
+				     &lower_64bit,
+				     &is_negative,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve UID value.",
+					 function );
+
+					return( -1 );
+				}
+				if( libfplist_binary_writer_add_uid_value(
+				     transcoder->binary_writer,
+				     lower_64bit,
+				     &object_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to add UID value.",
+					 function );
+
+					return( -1 );
+				}
+				break;
+			}
+			if( open_tag->uid_value_tag != NULL )
+			{
+				if( libfplist_transcoder_add_uid_entry(
+				     transcoder,
+				     open_tag,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to add UID entry.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( libfplist_binary_writer_add_container_object(
+			     transcoder->binary_writer,
+			     0xd0,
+			     &( transcoder->element_object_indexes[ open_tag->element_object_indexes_offset ] ),
+			     open_tag->number_of_entries,
+			     &object_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add dict object.",
+				 function );
+
+				return( -1 );
+			}
+			transcoder->number_of_element_object_indexes = open_tag->element_object_indexes_offset;
+
+			break;
+
+		case LIBFPLIST_VALUE_TYPE_UNKNOWN:
+			if( ( parent_open_tag == NULL )
+			 || ( parent_open_tag->value_type != LIBFPLIST_VALUE_TYPE_DICTIONARY ) )
+			{
+				goto close_tag;
+			}
+			result = libfplist_xml_tag_compare_name(
+			          tag,
+			          (uint8_t *) "key",
+			          3,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to compare name of tag.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				goto close_tag;
+			}
+			/* A key that follows a held back CF$UID entry means the dict does not represent a UID
+			 */
+			if( parent_open_tag->uid_value_tag != NULL )
+			{
+				if( libfplist_transcoder_add_uid_entry(
+				     transcoder,
+				     parent_open_tag,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to add UID entry.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			/* A key that is not followed by a value is replaced by the next key
+			 */
+			if( parent_open_tag->key_tag != NULL )
+			{
+				if( libfplist_xml_tag_free(
+				     &( parent_open_tag->key_tag ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free key tag.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			parent_open_tag->key_tag = tag;
+			open_tag->tag            = NULL;
+
+			goto close_tag;
+
+		default:
+			if( ( parent_open_tag != NULL )
+			 && ( parent_open_tag->value_type == LIBFPLIST_VALUE_TYPE_DICTIONARY ) )
+			{
+				result = libfplist_transcoder_is_uid_entry(
+				          parent_open_tag,
+				          tag,
+				          open_tag->value_type,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine if dict entry represents a UID.",
+					 function );
+
+					return( -1 );
+				}
+				else if( result != 0 )
+				{
+					parent_open_tag->uid_key_tag   = parent_open_tag->key_tag;
+					parent_open_tag->uid_value_tag = tag;
+					parent_open_tag->key_tag       = NULL;
+					open_tag->tag                  = NULL;
+
+					goto close_tag;
+				}
+			}
+			if( libfplist_binary_writer_add_tag(
+			     transcoder->binary_writer,
+			     tag,
+			     0,
+			     &object_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add tag.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+	}
+	if( ( parent_open_tag != NULL )
+	 && ( parent_open_tag->value_type == LIBFPLIST_VALUE_TYPE_ARRAY ) )
+	{
+		if( libfplist_transcoder_append_element_object_index(
+		     transcoder,
+		     object_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append element object index.",
+			 function );
+
+			return( -1 );
+		}
+		parent_open_tag->number_of_entries += 1;
+	}
+	else if( ( parent_open_tag != NULL )
+	      && ( parent_open_tag->value_type == LIBFPLIST_VALUE_TYPE_DICTIONARY ) )
+	{
+		if( libfplist_transcoder_add_dict_entry(
+		     transcoder,
+		     parent_open_tag,
+		     parent_open_tag->key_tag,
+		     object_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to add dict entry.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfplist_xml_tag_free(
+		     &( parent_open_tag->key_tag ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free key tag.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		/* The root value is the root tag or the first value of the plist tag
+		 */
+		transcoder->root_object_index = object_index;
+	}
+close_tag:
+	if( open_tag->key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &( open_tag->key_tag ),
+		 NULL );
+	}
+	if( open_tag->uid_key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &( open_tag->uid_key_tag ),
+		 NULL );
+	}
+	if( open_tag->uid_value_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &( open_tag->uid_value_tag ),
+		 NULL );
+	}
+	if( open_tag->tag != NULL )
+	{
+		if( libfplist_xml_tag_free(
+		     &( open_tag->tag ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free tag.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	transcoder->number_of_open_tags -= 1;
+
+	return( 1 );
+}
+
+/* Copies a XML property list to a binary property list (bplist00)
+ * The XML tags are converted into binary objects as soon as they are closed
+ * so that no XML tag tree is built for the property list
+ * The byte stream is newly allocated and the caller is responsible for freeing it
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_transcoder_copy_xml_to_binary(
+     const uint8_t *xml_byte_stream,
+     size_t xml_byte_stream_size,
+     uint8_t **binary_byte_stream,
+     size_t *binary_byte_stream_size,
+     libcerror_error_t **error )
+{
+	libfplist_transcoder_t *transcoder = NULL;
+	uint8_t *buffer                    = NULL;
+	static char *function              = "libfplist_transcoder_copy_xml_to_binary";
+	size_t buffer_size                 = 0;
+
+	if( xml_byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( xml_byte_stream_size < 2 )
+	 || ( xml_byte_stream_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid XML byte stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_byte_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary byte stream size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Lex wants 2 zero bytes at the end of the buffer
+	 */
+	buffer_size = xml_byte_stream_size;
+
+	if( xml_byte_stream[ xml_byte_stream_size - 1 ] != 0 )
+	{
+		buffer_size += 2;
+	}
+	else if( xml_byte_stream[ xml_byte_stream_size - 2 ] != 0 )
+	{
+		buffer_size += 1;
+	}
+	/* Lex wants a buffer it can write to
+	 */
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     buffer,
+	     xml_byte_stream,
+	     xml_byte_stream_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy XML byte stream.",
+		 function );
+
+		goto on_error;
+	}
+	buffer[ buffer_size - 2 ] = 0;
+	buffer[ buffer_size - 1 ] = 0;
+
+	if( libfplist_transcoder_initialize(
+	     &transcoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create transcoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_xml_parser_transcode_buffer(
+	     transcoder,
+	     buffer,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to parse XML.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	if( transcoder->root_object_index == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid property list - missing root value.",
+		 function );
+
+		goto on_error;
+	}
+	/* The objects are added as their XML tags are closed, which is after
+	 * the objects they reference, hence they are reordered to match the order
+	 * of libfplist_property_list_write_binary
+	 */
+	if( libfplist_binary_writer_reorder_objects(
+	     transcoder->binary_writer,
+	     &( transcoder->root_object_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reorder objects.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_binary_writer_copy_to_byte_stream(
+	     transcoder->binary_writer,
+	     transcoder->root_object_index,
+	     &buffer,
+	     &buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy binary property list to byte stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_transcoder_free(
+	     &transcoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free transcoder.",
+		 function );
+
+		goto on_error;
+	}
+	/* The byte stream is only returned when all the other resources were freed
+	 */
+	*binary_byte_stream      = buffer;
+	*binary_byte_stream_size = buffer_size;
+
+	return( 1 );
+
+on_error:
+	if( transcoder != NULL )
+	{
+		libfplist_transcoder_free(
+		 &transcoder,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+/* Copies a binary property list (bplist00) to a XML property list
+ * The binary objects are written as XML as they are read so that no XML tag
+ * tree is built for the property list
+ * The byte stream is newly allocated and the caller is responsible for freeing it
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_transcoder_copy_binary_to_xml(
+     const uint8_t *binary_byte_stream,
+     size_t binary_byte_stream_size,
+     uint8_t **xml_byte_stream,
+     size_t *xml_byte_stream_size,
+     libcerror_error_t **error )
+{
+	libfplist_binary_parser_state_t *parser_state = NULL;
+	libfplist_xml_writer_t *xml_writer            = NULL;
+	uint8_t *safe_xml_byte_stream                 = NULL;
+	static char *function                         = "libfplist_transcoder_copy_binary_to_xml";
+	size_t safe_xml_byte_stream_size              = 0;
+	uint64_t number_of_expanded_objects           = 0;
+
+	if( binary_byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_byte_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML byte stream size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_binary_parser_state_initialize(
+	     &parser_state,
+	     binary_byte_stream,
+	     binary_byte_stream_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create binary parser state.",
+		 function );
+
+		goto on_error;
+	}
+	/* Validate the object graph before writing so that cyclic or excessively
+	 * expanding object references are rejected
+	 */
+	if( libfplist_binary_parser_validate(
+	     parser_state,
+	     &number_of_expanded_objects,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to validate binary plist.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_xml_writer_initialize(
+	     &xml_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create XML writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_xml_writer_append_data(
+	     xml_writer,
+	     (uint8_t *) "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+	     "<!DOCTYPE plist PUBLIC \"-//Apple//DTD PLIST 1.0//EN\" \"http://www.apple.com/DTDs/PropertyList-1.0.dtd\">\n"
+	     "<plist version=\"1.0\">\n",
+	     39 + 103 + 22,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append XML header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_xml_writer_append_binary_object(
+	     xml_writer,
+	     parser_state,
+	     parser_state->root_object,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append root object.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_xml_writer_append_data(
+	     xml_writer,
+	     (uint8_t *) "</plist>\n",
+	     9,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append XML footer.",
+		 function );
+
+		goto on_error;
+	}
+	safe_xml_byte_stream      = xml_writer->buffer;
+	safe_xml_byte_stream_size = xml_writer->buffer_size;
+
+	xml_writer->buffer = NULL;
+
+	if( libfplist_xml_writer_free(
+	     &xml_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free XML writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_binary_parser_state_free(
+	     &parser_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free binary parser state.",
+		 function );
+
+		goto on_error;
+	}
+	/* The byte stream is only returned when all the other resources were freed
+	 */
+	*xml_byte_stream      = safe_xml_byte_stream;
+	*xml_byte_stream_size = safe_xml_byte_stream_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_xml_byte_stream != NULL )
+	{
+		memory_free(
+		 safe_xml_byte_stream );
+	}
+	if( xml_writer != NULL )
+	{
+		libfplist_xml_writer_free(
+		 &xml_writer,
+		 NULL );
+	}
+	if( parser_state != NULL )
+	{
+		libfplist_binary_parser_state_free(
+		 &parser_state,
+		 NULL );
+	}
+	return( -1 );
+}
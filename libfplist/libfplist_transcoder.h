@@ -0,0 +1,178 @@
+/*
+ * Property list transcoder functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFPLIST_TRANSCODER_H )
+#define _LIBFPLIST_TRANSCODER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfplist_binary_writer.h"
+#include "libfplist_definitions.h"
+#include "libfplist_extern.h"
+#include "libfplist_libcerror.h"
+#include "libfplist_xml_tag.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of open tags, which are the plist tag, the nested
+ * array and dict tags and the tag of the innermost value
+ */
+#define LIBFPLIST_TRANSCODER_MAXIMUM_NUMBER_OF_OPEN_TAGS	( LIBFPLIST_MAXIMUM_RECURSION_DEPTH + 2 )
+
+typedef struct libfplist_transcoder_open_tag libfplist_transcoder_open_tag_t;
+
+struct libfplist_transcoder_open_tag
+{
+	/* The tag
+	 */
+	libfplist_xml_tag_t *tag;
+
+	/* The value type
+	 */
+	int value_type;
+
+	/* Value to indicate the tag and its elements are not part of the property list
+	 * such as a value without a key in a dict
+	 */
+	uint8_t is_ignored;
+
+	/* The offset of the first element object index of an array or dict tag
+	 * in the element object indexes
+	 */
+	size_t element_object_indexes_offset;
+
+	/* The number of entries of an array or dict tag
+	 */
+	size_t number_of_entries;
+
+	/* The key tag of a dict tag of which the value was not closed
+	 */
+	libfplist_xml_tag_t *key_tag;
+
+	/* The CF$UID key tag of a dict tag, which is held back while the dict
+	 * can represent a UID
+	 */
+	libfplist_xml_tag_t *uid_key_tag;
+
+	/* The integer value tag of the CF$UID key tag
+	 */
+	libfplist_xml_tag_t *uid_value_tag;
+};
+
+typedef struct libfplist_transcoder libfplist_transcoder_t;
+
+struct libfplist_transcoder
+{
+	/* The binary writer
+	 */
+	libfplist_binary_writer_t *binary_writer;
+
+	/* The open tags
+	 */
+	libfplist_transcoder_open_tag_t open_tags[ LIBFPLIST_TRANSCODER_MAXIMUM_NUMBER_OF_OPEN_TAGS ];
+
+	/* The number of open tags
+	 */
+	int number_of_open_tags;
+
+	/* The object indexes of the elements of the open array and dict tags
+	 */
+	int *element_object_indexes;
+
+	/* The number of element object indexes
+	 */
+	size_t number_of_element_object_indexes;
+
+	/* The number of allocated element object indexes
+	 */
+	size_t number_of_allocated_element_object_indexes;
+
+	/* The root object index or -1 if not set
+	 */
+	int root_object_index;
+};
+
+int libfplist_transcoder_initialize(
+     libfplist_transcoder_t **transcoder,
+     libcerror_error_t **error );
+
+int libfplist_transcoder_free(
+     libfplist_transcoder_t **transcoder,
+     libcerror_error_t **error );
+
+int libfplist_transcoder_append_element_object_index(
+     libfplist_transcoder_t *transcoder,
+     int object_index,
+     libcerror_error_t **error );
+
+int libfplist_transcoder_open_tag(
+     libfplist_transcoder_t *transcoder,
+     libfplist_xml_tag_t *tag,
+     libcerror_error_t **error );
+
+int libfplist_transcoder_add_dict_entry(
+     libfplist_transcoder_t *transcoder,
+     libfplist_transcoder_open_tag_t *dict_open_tag,
+     libfplist_xml_tag_t *key_tag,
+     int value_object_index,
+     libcerror_error_t **error );
+
+int libfplist_transcoder_add_uid_entry(
+     libfplist_transcoder_t *transcoder,
+     libfplist_transcoder_open_tag_t *dict_open_tag,
+     libcerror_error_t **error );
+
+int libfplist_transcoder_is_uid_entry(
+     libfplist_transcoder_open_tag_t *dict_open_tag,
+     libfplist_xml_tag_t *value_tag,
+     int value_type,
+     libcerror_error_t **error );
+
+int libfplist_transcoder_close_tag(
+     libfplist_transcoder_t *transcoder,
+     libfplist_xml_tag_t *tag,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_transcoder_copy_xml_to_binary(
+     const uint8_t *xml_byte_stream,
+     size_t xml_byte_stream_size,
+     uint8_t **binary_byte_stream,
+     size_t *binary_byte_stream_size,
+     libcerror_error_t **error );
+
+LIBFPLIST_EXTERN \
+int libfplist_transcoder_copy_binary_to_xml(
+     const uint8_t *binary_byte_stream,
+     size_t binary_byte_stream_size,
+     uint8_t **xml_byte_stream,
+     size_t *xml_byte_stream_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFPLIST_TRANSCODER_H ) */
+
@@ -34,15 +34,48 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libfplist_archive {}		libfplist_archive_t;
+typedef struct libfplist_key_token {}		libfplist_key_token_t;
 typedef struct libfplist_property {}		libfplist_property_t;
 typedef struct libfplist_property_list {}	libfplist_property_list_t;
 
 #else
+typedef intptr_t libfplist_archive_t;
+typedef intptr_t libfplist_key_token_t;
 typedef intptr_t libfplist_property_t;
 typedef intptr_t libfplist_property_list_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* The field descriptor, used to retrieve values into fields of a structure
+ */
+typedef struct libfplist_field_descriptor libfplist_field_descriptor_t;
+
+struct libfplist_field_descriptor
+{
+	/* The key path
+	 * Contains the keys of the nested dictionaries separated by '/'
+	 */
+	const char *key_path;
+
+	/* The field type
+	 */
+	int field_type;
+
+	/* The offset of the field in the structure
+	 */
+	size_t field_offset;
+
+	/* The size of the field in the structure
+	 * Only used by the binary data and UTF-8 string field types
+	 */
+	size_t field_size;
+
+	/* The flags
+	 */
+	uint8_t flags;
+};
+
 #endif /* defined( HAVE_LOCAL_LIBFPLIST ) */
 
 #endif /* !defined( _LIBFPLIST_INTERNAL_TYPES_H ) */
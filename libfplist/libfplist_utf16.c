@@ -0,0 +1,520 @@
+/*
+ * UTF-16 stream functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+#endif
+
+#include "libfplist_libcerror.h"
+#include "libfplist_utf16.h"
+
+/* The Unicode replacement character that is used for unpaired surrogates
+ */
+#define LIBFPLIST_UTF16_REPLACEMENT_CHARACTER	0x0000fffdUL
+
+/* Determines the size of the UTF-8 string of a big-endian UTF-16 stream
+ * The size includes the end of string character
+ * A leading byte order mark is ignored, the string ends at the first end of string
+ * character and unpaired surrogates are replaced by U+FFFD
+ * Uses SSE2 to determine the size of consecutive runs of 8 characters that do not
+ * contain a surrogate or an end of string character when available at compile time,
+ * otherwise consecutive runs of 4 ASCII characters are counted at once
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_utf16_stream_get_utf8_string_size(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+#if defined( __SSE2__ )
+	__m128i characters_128bit      = _mm_setzero_si128();
+	__m128i input_128bit           = _mm_setzero_si128();
+	__m128i number_of_bytes_128bit = _mm_setzero_si128();
+
+	const __m128i mask_f800_128bit = _mm_set1_epi16( (short) 0xf800 );
+	const __m128i mask_ff80_128bit = _mm_set1_epi16( (short) 0xff80 );
+	const __m128i one_128bit       = _mm_set1_epi16( 1 );
+	const __m128i surrogate_128bit = _mm_set1_epi16( (short) 0xd800 );
+	const __m128i zero_128bit      = _mm_setzero_si128();
+#endif
+	static char *function          = "libfplist_utf16_stream_get_utf8_string_size";
+	size_t safe_utf8_string_size   = 1;
+	size_t utf16_stream_index      = 0;
+	uint64_t value_64bit           = 0;
+	uint32_t unicode_character     = 0;
+	uint16_t low_surrogate         = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size % 2 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size >= 2 )
+	 && ( utf16_stream[ 0 ] == 0xfe )
+	 && ( utf16_stream[ 1 ] == 0xff ) )
+	{
+		utf16_stream_index = 2;
+	}
+	while( utf16_stream_index < utf16_stream_size )
+	{
+#if defined( __SSE2__ )
+		if( ( utf16_stream_size - utf16_stream_index ) >= 16 )
+		{
+			input_128bit = _mm_loadu_si128(
+			                (__m128i *) &( utf16_stream[ utf16_stream_index ] ) );
+
+			/* Swap the bytes of the big-endian characters
+			 */
+			characters_128bit = _mm_or_si128(
+			                     _mm_slli_epi16(
+			                      input_128bit,
+			                      8 ),
+			                     _mm_srli_epi16(
+			                      input_128bit,
+			                      8 ) );
+
+			if( _mm_movemask_epi8(
+			     _mm_or_si128(
+			      _mm_cmpeq_epi16(
+			       _mm_and_si128(
+			        characters_128bit,
+			        mask_f800_128bit ),
+			       surrogate_128bit ),
+			      _mm_cmpeq_epi16(
+			       characters_128bit,
+			       zero_128bit ) ) ) == 0 )
+			{
+				/* Every character takes 1 byte, a character of U+0080 and above
+				 * an additional byte and a character of U+0800 and above another
+				 */
+				number_of_bytes_128bit = _mm_add_epi16(
+				                          _mm_andnot_si128(
+				                           _mm_cmpeq_epi16(
+				                            _mm_and_si128(
+				                             characters_128bit,
+				                             mask_ff80_128bit ),
+				                            zero_128bit ),
+				                           one_128bit ),
+				                          _mm_andnot_si128(
+				                           _mm_cmpeq_epi16(
+				                            _mm_and_si128(
+				                             characters_128bit,
+				                             mask_f800_128bit ),
+				                            zero_128bit ),
+				                           one_128bit ) );
+
+				number_of_bytes_128bit = _mm_sad_epu8(
+				                          number_of_bytes_128bit,
+				                          zero_128bit );
+
+				safe_utf8_string_size += 8
+				                       + (size_t) _mm_cvtsi128_si32( number_of_bytes_128bit )
+				                       + (size_t) _mm_extract_epi16( number_of_bytes_128bit, 4 );
+
+				utf16_stream_index += 16;
+
+				continue;
+			}
+		}
+#endif /* defined( __SSE2__ ) */
+
+		/* Count 4 characters at once if they are ASCII and not an end of string character
+		 */
+		if( ( utf16_stream_size - utf16_stream_index ) >= 8 )
+		{
+			byte_stream_copy_to_uint64_big_endian(
+			 &( utf16_stream[ utf16_stream_index ] ),
+			 value_64bit );
+
+			if( ( ( value_64bit & 0xff80ff80ff80ff80ULL ) == 0 )
+			 && ( ( ( value_64bit - 0x0001000100010001ULL ) & 0x8000800080008000ULL ) == 0 ) )
+			{
+				safe_utf8_string_size += 4;
+				utf16_stream_index    += 8;
+
+				continue;
+			}
+		}
+		byte_stream_copy_to_uint16_big_endian(
+		 &( utf16_stream[ utf16_stream_index ] ),
+		 unicode_character );
+
+		utf16_stream_index += 2;
+
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		if( unicode_character < 0x00000080UL )
+		{
+			safe_utf8_string_size += 1;
+		}
+		else if( unicode_character < 0x00000800UL )
+		{
+			safe_utf8_string_size += 2;
+		}
+		else if( ( unicode_character & 0x0000fc00UL ) == 0x0000d800UL )
+		{
+			/* A high surrogate followed by a low surrogate takes 4 bytes,
+			 * an unpaired surrogate is replaced by U+FFFD which takes 3 bytes
+			 */
+			low_surrogate = 0;
+
+			if( utf16_stream_index < utf16_stream_size )
+			{
+				byte_stream_copy_to_uint16_big_endian(
+				 &( utf16_stream[ utf16_stream_index ] ),
+				 low_surrogate );
+			}
+			if( ( low_surrogate & 0xfc00 ) == 0xdc00 )
+			{
+				safe_utf8_string_size += 4;
+				utf16_stream_index    += 2;
+			}
+			else
+			{
+				safe_utf8_string_size += 3;
+			}
+		}
+		else
+		{
+			safe_utf8_string_size += 3;
+		}
+	}
+	*utf8_string_size = safe_utf8_string_size;
+
+	return( 1 );
+}
+
+/* Copies a big-endian UTF-16 stream to an UTF-8 string
+ * The string is terminated by an end of string character
+ * A leading byte order mark is ignored, the string ends at the first end of string
+ * character and unpaired surrogates are replaced by U+FFFD
+ * Uses SSE2 to copy consecutive runs of 16 ASCII characters when available at
+ * compile time, otherwise consecutive runs of 4 ASCII characters are copied at once
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_utf16_stream_copy_to_utf8_string(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+#if defined( __SSE2__ )
+	__m128i input1_128bit          = _mm_setzero_si128();
+	__m128i input2_128bit          = _mm_setzero_si128();
+
+	const __m128i mask_80ff_128bit = _mm_set1_epi16( (short) 0x80ff );
+	const __m128i zero_128bit      = _mm_setzero_si128();
+#endif
+	static char *function          = "libfplist_utf16_stream_copy_to_utf8_string";
+	size_t utf16_stream_index      = 0;
+	size_t utf8_string_index       = 0;
+	uint64_t value_64bit           = 0;
+	uint32_t unicode_character     = 0;
+	uint16_t low_surrogate         = 0;
+	uint8_t number_of_bytes        = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size % 2 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size >= 2 )
+	 && ( utf16_stream[ 0 ] == 0xfe )
+	 && ( utf16_stream[ 1 ] == 0xff ) )
+	{
+		utf16_stream_index = 2;
+	}
+	while( utf16_stream_index < utf16_stream_size )
+	{
+#if defined( __SSE2__ )
+		if( ( ( utf16_stream_size - utf16_stream_index ) >= 32 )
+		 && ( ( utf8_string_size - utf8_string_index ) >= 16 ) )
+		{
+			input1_128bit = _mm_loadu_si128(
+			                 (__m128i *) &( utf16_stream[ utf16_stream_index ] ) );
+
+			input2_128bit = _mm_loadu_si128(
+			                 (__m128i *) &( utf16_stream[ utf16_stream_index + 16 ] ) );
+
+			/* Since the characters are big-endian, the 16-bit values are ASCII
+			 * if the bits of mask 0x80ff are not set
+			 */
+			if( ( _mm_movemask_epi8(
+			       _mm_cmpeq_epi16(
+			        _mm_and_si128(
+			         _mm_or_si128(
+			          input1_128bit,
+			          input2_128bit ),
+			         mask_80ff_128bit ),
+			        zero_128bit ) ) == 0xffff )
+			 && ( _mm_movemask_epi8(
+			       _mm_or_si128(
+			        _mm_cmpeq_epi16(
+			         input1_128bit,
+			         zero_128bit ),
+			        _mm_cmpeq_epi16(
+			         input2_128bit,
+			         zero_128bit ) ) ) == 0 ) )
+			{
+				_mm_storeu_si128(
+				 (__m128i *) &( utf8_string[ utf8_string_index ] ),
+				 _mm_packus_epi16(
+				  _mm_srli_epi16(
+				   input1_128bit,
+				   8 ),
+				  _mm_srli_epi16(
+				   input2_128bit,
+				   8 ) ) );
+
+				utf16_stream_index += 32;
+				utf8_string_index  += 16;
+
+				continue;
+			}
+		}
+#endif /* defined( __SSE2__ ) */
+
+		/* Copy 4 characters at once if they are ASCII and not an end of string character
+		 */
+		if( ( ( utf16_stream_size - utf16_stream_index ) >= 8 )
+		 && ( ( utf8_string_size - utf8_string_index ) >= 4 ) )
+		{
+			byte_stream_copy_to_uint64_big_endian(
+			 &( utf16_stream[ utf16_stream_index ] ),
+			 value_64bit );
+
+			if( ( ( value_64bit & 0xff80ff80ff80ff80ULL ) == 0 )
+			 && ( ( ( value_64bit - 0x0001000100010001ULL ) & 0x8000800080008000ULL ) == 0 ) )
+			{
+				utf8_string[ utf8_string_index ]     = utf16_stream[ utf16_stream_index + 1 ];
+				utf8_string[ utf8_string_index + 1 ] = utf16_stream[ utf16_stream_index + 3 ];
+				utf8_string[ utf8_string_index + 2 ] = utf16_stream[ utf16_stream_index + 5 ];
+				utf8_string[ utf8_string_index + 3 ] = utf16_stream[ utf16_stream_index + 7 ];
+
+				utf16_stream_index += 8;
+				utf8_string_index  += 4;
+
+				continue;
+			}
+		}
+		byte_stream_copy_to_uint16_big_endian(
+		 &( utf16_stream[ utf16_stream_index ] ),
+		 unicode_character );
+
+		utf16_stream_index += 2;
+
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		if( ( unicode_character & 0x0000fc00UL ) == 0x0000d800UL )
+		{
+			low_surrogate = 0;
+
+			if( utf16_stream_index < utf16_stream_size )
+			{
+				byte_stream_copy_to_uint16_big_endian(
+				 &( utf16_stream[ utf16_stream_index ] ),
+				 low_surrogate );
+			}
+			if( ( low_surrogate & 0xfc00 ) == 0xdc00 )
+			{
+				unicode_character = 0x00010000UL
+				                  + ( ( unicode_character - 0x0000d800UL ) << 10 )
+				                  + ( (uint32_t) low_surrogate - 0x0000dc00UL );
+
+				utf16_stream_index += 2;
+			}
+			else
+			{
+				unicode_character = LIBFPLIST_UTF16_REPLACEMENT_CHARACTER;
+			}
+		}
+		else if( ( unicode_character & 0x0000fc00UL ) == 0x0000dc00UL )
+		{
+			unicode_character = LIBFPLIST_UTF16_REPLACEMENT_CHARACTER;
+		}
+		if( unicode_character < 0x00000080UL )
+		{
+			number_of_bytes = 1;
+		}
+		else if( unicode_character < 0x00000800UL )
+		{
+			number_of_bytes = 2;
+		}
+		else if( unicode_character < 0x00010000UL )
+		{
+			number_of_bytes = 3;
+		}
+		else
+		{
+			number_of_bytes = 4;
+		}
+		if( (size_t) number_of_bytes > ( utf8_string_size - utf8_string_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		switch( number_of_bytes )
+		{
+			case 1:
+				utf8_string[ utf8_string_index++ ] = (uint8_t) unicode_character;
+				break;
+
+			case 2:
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xc0 | ( unicode_character >> 6 ) );
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+				break;
+
+			case 3:
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xe0 | ( unicode_character >> 12 ) );
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+				break;
+
+			default:
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xf0 | ( unicode_character >> 18 ) );
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 12 ) & 0x3f ) );
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+				break;
+		}
+	}
+	if( utf8_string_index >= utf8_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string too small.",
+		 function );
+
+		return( -1 );
+	}
+	utf8_string[ utf8_string_index ] = 0;
+
+	return( 1 );
+}
+
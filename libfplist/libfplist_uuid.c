@@ -0,0 +1,299 @@
+/*
+ * UUID functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfplist_libcerror.h"
+#include "libfplist_uuid.h"
+
+/* Copies an UUID from an UTF-8 string to a big-endian byte stream
+ * The string is expected to be formatted as: xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx
+ * where x is a hexadecimal digit in either upper or lower case, optionally followed
+ * by an end of string character
+ * Returns 1 if successful, 0 if the string is not a supported UUID value or -1 on error
+ */
+int libfplist_uuid_copy_from_utf8_string(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	uint8_t safe_byte_stream[ 16 ];
+
+	static char *function    = "libfplist_uuid_copy_from_utf8_string";
+	size_t byte_stream_index = 0;
+	size_t utf8_string_index = 0;
+	uint8_t byte_value       = 0;
+	uint8_t character_value  = 0;
+	uint8_t nibble_index     = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length == 37 )
+	 && ( utf8_string[ 36 ] == 0 ) )
+	{
+		utf8_string_length = 36;
+	}
+	if( utf8_string_length != 36 )
+	{
+		return( 0 );
+	}
+	for( utf8_string_index = 0;
+	     utf8_string_index < 36;
+	     utf8_string_index++ )
+	{
+		character_value = utf8_string[ utf8_string_index ];
+
+		/* The groups of hexadecimal digits are separated by '-' at offsets 8, 13, 18 and 23
+		 */
+		if( ( utf8_string_index == 8 )
+		 || ( utf8_string_index == 13 )
+		 || ( utf8_string_index == 18 )
+		 || ( utf8_string_index == 23 ) )
+		{
+			if( character_value != (uint8_t) '-' )
+			{
+				return( 0 );
+			}
+			continue;
+		}
+		if( ( character_value >= (uint8_t) '0' )
+		 && ( character_value <= (uint8_t) '9' ) )
+		{
+			character_value -= (uint8_t) '0';
+		}
+		else if( ( character_value >= (uint8_t) 'a' )
+		      && ( character_value <= (uint8_t) 'f' ) )
+		{
+			character_value -= (uint8_t) 'a' - 10;
+		}
+		else if( ( character_value >= (uint8_t) 'A' )
+		      && ( character_value <= (uint8_t) 'F' ) )
+		{
+			character_value -= (uint8_t) 'A' - 10;
+		}
+		else
+		{
+			return( 0 );
+		}
+		byte_value = (uint8_t) ( ( byte_value << 4 ) | character_value );
+
+		nibble_index ^= 1;
+
+		if( nibble_index == 0 )
+		{
+			safe_byte_stream[ byte_stream_index++ ] = byte_value;
+		}
+	}
+	if( memory_copy(
+	     byte_stream,
+	     safe_byte_stream,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy UUID to byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+
+/* Copies an UUID from a big-endian byte stream to an UTF-8 string
+ * The string is formatted as: XXXXXXXX-XXXX-XXXX-XXXX-XXXXXXXXXXXX
+ * where X is an upper case hexadecimal digit, followed by an end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_uuid_copy_to_utf8_string(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfplist_uuid_copy_to_utf8_string";
+	size_t byte_stream_index = 0;
+	size_t utf8_string_index = 0;
+	uint8_t nibble_value     = 0;
+	uint8_t nibble_index     = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size < 37 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf8_string_index < 36 )
+	{
+		/* The groups of hexadecimal digits are separated by '-' at offsets 8, 13, 18 and 23
+		 */
+		if( ( utf8_string_index == 8 )
+		 || ( utf8_string_index == 13 )
+		 || ( utf8_string_index == 18 )
+		 || ( utf8_string_index == 23 ) )
+		{
+			utf8_string[ utf8_string_index++ ] = (uint8_t) '-';
+
+			continue;
+		}
+		if( nibble_index == 0 )
+		{
+			nibble_value = byte_stream[ byte_stream_index ] >> 4;
+		}
+		else
+		{
+			nibble_value = byte_stream[ byte_stream_index++ ] & 0x0f;
+		}
+		nibble_index ^= 1;
+
+		if( nibble_value < 10 )
+		{
+			utf8_string[ utf8_string_index++ ] = (uint8_t) '0' + nibble_value;
+		}
+		else
+		{
+			utf8_string[ utf8_string_index++ ] = (uint8_t) 'A' + nibble_value - 10;
+		}
+	}
+	utf8_string[ 36 ] = 0;
+
+	return( 1 );
+}
@@ -32,6 +32,7 @@
 #include "libfplist_libcerror.h"
 #include "libfplist_libcnotify.h"
 #include "libfplist_property_list.h"
+#include "libfplist_transcoder.h"
 #include "libfplist_types.h"
 #include "libfplist_xml_tag.h"
 
@@ -105,6 +106,10 @@ struct libfplist_xml_parser_state
 	/* The parent XML tag
 	 */
 	libfplist_xml_tag_t *parent_tag;
+
+	/* The transcoder, which takes over the XML tags instead of the root XML tag
+	 */
+	libfplist_transcoder_t *transcoder;
 };
 
 typedef size_t yy_size_t;
@@ -159,6 +164,12 @@ int libfplist_xml_parser_parse_buffer(
      size_t buffer_size,
      libcerror_error_t **error );
 
+int libfplist_xml_parser_transcode_buffer(
+     libfplist_transcoder_t *transcoder,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
 %}
 
 /* Associativity rules
@@ -201,7 +212,7 @@ xml_doctype
 
 xml_tags
 	: /* empty */
-	| xml_tag xml_tags
+	| xml_tags xml_tag
 	;
 
 xml_tag
@@ -244,7 +255,28 @@ xml_tag_open_start
 
 			YYABORT;
 		}
-		if( ( (libfplist_xml_parser_state_t *) parser_state )->root_tag == NULL )
+		if( ( (libfplist_xml_parser_state_t *) parser_state )->transcoder != NULL )
+		{
+			( (libfplist_xml_parser_state_t *) parser_state )->current_tag->parent_tag = ( (libfplist_xml_parser_state_t *) parser_state )->parent_tag;
+
+			if( libfplist_transcoder_open_tag(
+			     ( (libfplist_xml_parser_state_t *) parser_state )->transcoder,
+			     ( (libfplist_xml_parser_state_t *) parser_state )->current_tag,
+			     ( (libfplist_xml_parser_state_t *) parser_state )->error ) != 1 )
+			{
+				libcerror_error_set(
+				 ( (libfplist_xml_parser_state_t *) parser_state )->error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to open tag in transcoder.",
+				 libfplist_xml_parser_function );
+
+				( (libfplist_xml_parser_state_t *) parser_state )->current_tag = NULL;
+
+				YYABORT;
+			}
+		}
+		else if( ( (libfplist_xml_parser_state_t *) parser_state )->root_tag == NULL )
 		{
 			( (libfplist_xml_parser_state_t *) parser_state )->root_tag = ( (libfplist_xml_parser_state_t *) parser_state )->current_tag;
 		}
@@ -276,6 +308,8 @@ xml_tag_open
 xml_tag_single
 	: xml_tag_open_start xml_attributes XML_TAG_END_SINGLE
 	{
+		libfplist_xml_tag_t *closed_tag = NULL;
+
 		libfplist_xml_parser_rule_print(
 		 "xml_tag_single" );
 
@@ -290,14 +324,36 @@ xml_tag_single
 
 			YYABORT;
 		}
+		closed_tag = ( (libfplist_xml_parser_state_t *) parser_state )->current_tag;
+
 		( (libfplist_xml_parser_state_t *) parser_state )->parent_tag  = ( (libfplist_xml_parser_state_t *) parser_state )->current_tag->parent_tag;
 		( (libfplist_xml_parser_state_t *) parser_state )->current_tag = ( (libfplist_xml_parser_state_t *) parser_state )->parent_tag;
+
+		if( ( (libfplist_xml_parser_state_t *) parser_state )->transcoder != NULL )
+		{
+			if( libfplist_transcoder_close_tag(
+			     ( (libfplist_xml_parser_state_t *) parser_state )->transcoder,
+			     closed_tag,
+			     ( (libfplist_xml_parser_state_t *) parser_state )->error ) != 1 )
+			{
+				libcerror_error_set(
+				 ( (libfplist_xml_parser_state_t *) parser_state )->error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to close tag in transcoder.",
+				 libfplist_xml_parser_function );
+
+				YYABORT;
+			}
+		}
 	}
 	;
 
 xml_tag_close
 	: XML_TAG_CLOSE
 	{
+		libfplist_xml_tag_t *closed_tag = NULL;
+
 		libfplist_xml_parser_rule_print(
 		 "xml_tag_close" );
 
@@ -340,8 +396,28 @@ xml_tag_close
 
 			YYABORT;
 		}
+		closed_tag = ( (libfplist_xml_parser_state_t *) parser_state )->current_tag;
+
 		( (libfplist_xml_parser_state_t *) parser_state )->parent_tag  = ( (libfplist_xml_parser_state_t *) parser_state )->current_tag->parent_tag;
 		( (libfplist_xml_parser_state_t *) parser_state )->current_tag = ( (libfplist_xml_parser_state_t *) parser_state )->parent_tag;
+
+		if( ( (libfplist_xml_parser_state_t *) parser_state )->transcoder != NULL )
+		{
+			if( libfplist_transcoder_close_tag(
+			     ( (libfplist_xml_parser_state_t *) parser_state )->transcoder,
+			     closed_tag,
+			     ( (libfplist_xml_parser_state_t *) parser_state )->error ) != 1 )
+			{
+				libcerror_error_set(
+				 ( (libfplist_xml_parser_state_t *) parser_state )->error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to close tag in transcoder.",
+				 libfplist_xml_parser_function );
+
+				YYABORT;
+			}
+		}
 	}
 	;
 
@@ -377,6 +453,19 @@ xml_tag_content
 
 			YYABORT;
 		}
+		if( libfplist_xml_tag_decode_value_entity_references(
+		     ( (libfplist_xml_parser_state_t *) parser_state )->current_tag,
+		     ( (libfplist_xml_parser_state_t *) parser_state )->error ) != 1 )
+		{
+			libcerror_error_set(
+			 ( (libfplist_xml_parser_state_t *) parser_state )->error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to decode entity references in value.",
+			 libfplist_xml_parser_function );
+
+			YYABORT;
+		}
 	}
 	;
 
@@ -471,6 +560,7 @@ int libfplist_xml_parser_parse_buffer(
 		parser_state.root_tag      = NULL;
 		parser_state.current_tag   = NULL;
 		parser_state.parent_tag    = NULL;
+		parser_state.transcoder    = NULL;
 
 		if( libfplist_xml_scanner_parse(
 		     &parser_state ) == 0 )
@@ -510,3 +600,68 @@ int libfplist_xml_parser_parse_buffer(
 	return( result );
 }
 
+/* Parses the buffer and passes the XML tags to the transcoder
+ * The XML tags are freed by the transcoder once they are closed
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_xml_parser_transcode_buffer(
+     libfplist_transcoder_t *transcoder,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	libfplist_xml_parser_state_t parser_state;
+	
+	YY_BUFFER_STATE buffer_state = NULL;
+	static char *function        = "libfplist_xml_parser_transcode_buffer";
+	int result                   = -1;
+
+	if( transcoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transcoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	buffer_state = libfplist_xml_scanner__scan_buffer(
+	                (char *) buffer,
+	                buffer_size );
+
+	libfplist_xml_scanner_buffer_offset = 0;
+
+	if( buffer_state != NULL )
+	{
+		parser_state.property_list = NULL;
+		parser_state.error         = error;
+		parser_state.root_tag      = NULL;
+		parser_state.current_tag   = NULL;
+		parser_state.parent_tag    = NULL;
+		parser_state.transcoder    = transcoder;
+
+		if( libfplist_xml_scanner_parse(
+		     &parser_state ) == 0 )
+		{
+			result = 1;
+		}
+		libfplist_xml_scanner__delete_buffer(
+		 buffer_state );
+	}
+	libfplist_xml_scanner_lex_destroy();
+
+	return( result );
+}
@@ -24,9 +24,15 @@
 #include <narrow_string.h>
 #include <types.h>
 
+#include "libfplist_base64.h"
+#include "libfplist_binary_parser.h"
+#include "libfplist_date_time.h"
 #include "libfplist_definitions.h"
+#include "libfplist_hash.h"
+#include "libfplist_integer.h"
 #include "libfplist_libcdata.h"
 #include "libfplist_libcerror.h"
+#include "libfplist_property_list.h"
 #include "libfplist_xml_attribute.h"
 #include "libfplist_xml_tag.h"
 
@@ -258,6 +264,34 @@ int libfplist_xml_tag_free(
 
 			result = -1;
 		}
+		/* The embedded property list references the managed value data
+		 */
+		if( ( *tag )->embedded_property_list != NULL )
+		{
+			if( libfplist_property_list_free(
+			     &( ( *tag )->embedded_property_list ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free embedded property list.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *tag )->value_data_checkpoints != NULL )
+		{
+			memory_free(
+			 ( *tag )->value_data_checkpoints );
+		}
+		if( ( *tag )->managed_value_data != NULL )
+		{
+			memory_free(
+			 ( *tag )->managed_value_data );
+		}
 		if( ( *tag )->value != NULL )
 		{
 			memory_free(
@@ -500,12 +534,52 @@ int libfplist_xml_tag_set_value(
 	}
 	if( tag->value != NULL )
 	{
+		/* The value data decoded from the previous value and its embedded property list
+		 * are no longer valid
+		 */
+		if( tag->embedded_property_list != NULL )
+		{
+			if( libfplist_property_list_free(
+			     &( tag->embedded_property_list ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free embedded property list.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( tag->managed_value_data != NULL )
+		{
+			memory_free(
+			 tag->managed_value_data );
+
+			tag->managed_value_data   = NULL;
+			tag->value_data_reference = NULL;
+		}
+		tag->embedded_property_list_is_set = 0;
+
 		memory_free(
 		 tag->value );
 
 		tag->value = NULL;
 	}
-	tag->value_size = value_length + 1;
+	if( tag->value_data_checkpoints != NULL )
+	{
+		memory_free(
+		 tag->value_data_checkpoints );
+
+		tag->value_data_checkpoints = NULL;
+	}
+	tag->value_size                       = value_length + 1;
+	tag->value_hash_is_set                = 0;
+	tag->value_data_size_is_set           = 0;
+	tag->number_of_value_data_checkpoints = 0;
+	tag->integer_value_is_set             = 0;
 
 	tag->value = (uint8_t *) memory_allocate(
 	                          sizeof( uint8_t ) * tag->value_size );
@@ -552,20 +626,26 @@ on_error:
 	return( -1 );
 }
 
-/* Appends an attribute
+/* Decodes the entity and character references in the value
+ * The predefined entity references &amp; &lt; &gt; &quot; and &apos; and
+ * the character references &#N; and &#xN; are replaced by the corresponding
+ * UTF-8 encoded character, other references are left unchanged
  * Returns 1 if successful or -1 on error
  */
-int libfplist_xml_tag_append_attribute(
+int libfplist_xml_tag_decode_value_entity_references(
      libfplist_xml_tag_t *tag,
-     const uint8_t *name,
-     size_t name_length,
-     const uint8_t *value,
-     size_t value_length,
      libcerror_error_t **error )
 {
-	libfplist_xml_attribute_t *attribute = NULL;
-	static char *function                = "libfplist_xml_tag_append_attribute";
-	int entry_index                      = 0;
+	static char *function      = "libfplist_xml_tag_decode_value_entity_references";
+	size_t reference_index     = 0;
+	size_t reference_length    = 0;
+	size_t value_index         = 0;
+	size_t value_length        = 0;
+	size_t write_index         = 0;
+	uint32_t unicode_character = 0;
+	uint8_t base               = 0;
+	uint8_t byte_value         = 0;
+	uint8_t digit              = 0;
 
 	if( tag == NULL )
 	{
@@ -578,57 +658,248 @@ int libfplist_xml_tag_append_attribute(
 
 		return( -1 );
 	}
-	if( libfplist_xml_attribute_initialize(
-	     &attribute,
-	     name,
-	     name_length,
-	     value,
-	     value_length,
-	     error ) != 1 )
+	if( ( tag->value == NULL )
+	 || ( tag->value_size == 0 ) )
+	{
+		return( 1 );
+	}
+	value_length = tag->value_size - 1;
+
+	/* A reference is never shorter than the UTF-8 encoded character it represents
+	 * hence the value can be decoded in place
+	 */
+	while( value_index < value_length )
+	{
+		byte_value = tag->value[ value_index ];
+
+		if( byte_value != (uint8_t) '&' )
+		{
+			tag->value[ write_index++ ] = byte_value;
+
+			value_index++;
+
+			continue;
+		}
+		unicode_character = 0;
+		reference_length  = 0;
+
+		if( ( ( value_length - value_index ) >= 5 )
+		 && ( memory_compare(
+		       &( tag->value[ value_index ] ),
+		       "&amp;",
+		       5 ) == 0 ) )
+		{
+			unicode_character = (uint32_t) '&';
+			reference_length  = 5;
+		}
+		else if( ( ( value_length - value_index ) >= 4 )
+		      && ( memory_compare(
+		            &( tag->value[ value_index ] ),
+		            "&lt;",
+		            4 ) == 0 ) )
+		{
+			unicode_character = (uint32_t) '<';
+			reference_length  = 4;
+		}
+		else if( ( ( value_length - value_index ) >= 4 )
+		      && ( memory_compare(
+		            &( tag->value[ value_index ] ),
+		            "&gt;",
+		            4 ) == 0 ) )
+		{
+			unicode_character = (uint32_t) '>';
+			reference_length  = 4;
+		}
+		else if( ( ( value_length - value_index ) >= 6 )
+		      && ( memory_compare(
+		            &( tag->value[ value_index ] ),
+		            "&quot;",
+		            6 ) == 0 ) )
+		{
+			unicode_character = (uint32_t) '"';
+			reference_length  = 6;
+		}
+		else if( ( ( value_length - value_index ) >= 6 )
+		      && ( memory_compare(
+		            &( tag->value[ value_index ] ),
+		            "&apos;",
+		            6 ) == 0 ) )
+		{
+			unicode_character = (uint32_t) '\'';
+			reference_length  = 6;
+		}
+		else if( ( ( value_length - value_index ) >= 4 )
+		      && ( tag->value[ value_index + 1 ] == (uint8_t) '#' ) )
+		{
+			reference_index = value_index + 2;
+			base            = 10;
+
+			if( tag->value[ reference_index ] == (uint8_t) 'x' )
+			{
+				reference_index++;
+
+				base = 16;
+			}
+			while( reference_index < value_length )
+			{
+				byte_value = tag->value[ reference_index ];
+
+				if( ( byte_value >= (uint8_t) '0' )
+				 && ( byte_value <= (uint8_t) '9' ) )
+				{
+					digit = byte_value - (uint8_t) '0';
+				}
+				else if( ( base == 16 )
+				      && ( byte_value >= (uint8_t) 'a' )
+				      && ( byte_value <= (uint8_t) 'f' ) )
+				{
+					digit = byte_value - (uint8_t) 'a' + 10;
+				}
+				else if( ( base == 16 )
+				      && ( byte_value >= (uint8_t) 'A' )
+				      && ( byte_value <= (uint8_t) 'F' ) )
+				{
+					digit = byte_value - (uint8_t) 'A' + 10;
+				}
+				else
+				{
+					break;
+				}
+				unicode_character = ( unicode_character * base ) + digit;
+
+				if( unicode_character > 0x0010ffffUL )
+				{
+					break;
+				}
+				reference_index++;
+			}
+			/* The reference must contain at least 1 digit, be terminated by ;
+			 * and refer to a valid Unicode character
+			 */
+			if( ( reference_index < value_length )
+			 && ( tag->value[ reference_index ] == (uint8_t) ';' )
+			 && ( tag->value[ reference_index - 1 ] != (uint8_t) '#' )
+			 && ( tag->value[ reference_index - 1 ] != (uint8_t) 'x' )
+			 && ( unicode_character > 0 )
+			 && ( unicode_character <= 0x0010ffffUL )
+			 && ( ( unicode_character < 0x0000d800UL )
+			  ||  ( unicode_character > 0x0000dfffUL ) ) )
+			{
+				reference_length = reference_index + 1 - value_index;
+			}
+		}
+		if( reference_length == 0 )
+		{
+			tag->value[ write_index++ ] = (uint8_t) '&';
+
+			value_index++;
+
+			continue;
+		}
+		if( unicode_character < 0x00000080UL )
+		{
+			tag->value[ write_index++ ] = (uint8_t) unicode_character;
+		}
+		else if( unicode_character < 0x00000800UL )
+		{
+			tag->value[ write_index++ ] = (uint8_t) ( 0xc0 | ( unicode_character >> 6 ) );
+			tag->value[ write_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+		}
+		else if( unicode_character < 0x00010000UL )
+		{
+			tag->value[ write_index++ ] = (uint8_t) ( 0xe0 | ( unicode_character >> 12 ) );
+			tag->value[ write_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+			tag->value[ write_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+		}
+		else
+		{
+			tag->value[ write_index++ ] = (uint8_t) ( 0xf0 | ( unicode_character >> 18 ) );
+			tag->value[ write_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 12 ) & 0x3f ) );
+			tag->value[ write_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+			tag->value[ write_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+		}
+		value_index += reference_length;
+	}
+	tag->value[ write_index ] = 0;
+
+	tag->value_size = write_index + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the value hash
+ * The hash is calculated on first use and cached
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_xml_tag_get_value_hash(
+     libfplist_xml_tag_t *tag,
+     uint32_t *value_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_xml_tag_get_value_hash";
+	size_t value_length   = 0;
+
+	if( tag == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create attribute.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML plist tag.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdata_array_append_entry(
-	     tag->attributes_array,
-	     &entry_index,
-	     (intptr_t *) attribute,
-	     error ) != 1 )
+	if( value_hash == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append attribute to array.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value hash.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( 1 );
-
-on_error:
-	if( attribute != NULL )
+	if( tag->value_hash_is_set == 0 )
 	{
-		libfplist_xml_attribute_free(
-		 &attribute,
-		 NULL );
+		if( ( tag->value != NULL )
+		 && ( tag->value_size > 0 ) )
+		{
+			value_length = tag->value_size - 1;
+		}
+		if( libfplist_hash_calculate_utf8_string(
+		     &( tag->value_hash ),
+		     tag->value,
+		     value_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate value hash.",
+			 function );
+
+			return( -1 );
+		}
+		tag->value_hash_is_set = 1;
 	}
-	return( -1 );
+	*value_hash = tag->value_hash;
+
+	return( 1 );
 }
 
-int libfplist_xml_tag_append_element(
+/* Retrieves the size of the base64 decoded value data
+ * The size is determined on first use and cached
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_xml_tag_get_value_data_size(
      libfplist_xml_tag_t *tag,
-     libfplist_xml_tag_t *element_tag,
+     size_t *value_data_size,
      libcerror_error_t **error )
 {
-	static char *function = "libfplist_xml_tag_append_element";
-	int entry_index       = 0;
+	static char *function = "libfplist_xml_tag_get_value_data_size";
 
 	if( tag == NULL )
 	{
@@ -641,46 +912,67 @@ int libfplist_xml_tag_append_element(
 
 		return( -1 );
 	}
-	if( element_tag == NULL )
+	if( ( tag->value_data_reference == NULL )
+	 && ( ( tag->value == NULL )
+	  || ( tag->value_size == 0 ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid XML plist element tag.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid XML plist tag - missing value.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_append_entry(
-	     tag->elements_array,
-	     &entry_index,
-	     (intptr_t *) element_tag,
-	     error ) != 1 )
+	if( value_data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append element tag to array.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
 		 function );
 
 		return( -1 );
 	}
-	element_tag->parent_tag = tag;
+	if( tag->value_data_size_is_set == 0 )
+	{
+		if( libfplist_base64_stream_size_to_byte_stream(
+		     tag->value,
+		     tag->value_size - 1,
+		     &( tag->value_data_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of base64 encoded value data.",
+			 function );
+
+			return( -1 );
+		}
+		tag->value_data_size_is_set = 1;
+	}
+	*value_data_size = tag->value_data_size;
 
 	return( 1 );
 }
 
-/* Retrieves the number of elements
+/* Copies the base64 decoded value data
+ * The size of the decoded value data is cached, as a side effect, so that
+ * a subsequent size retrieval does not need to decode the value again
  * Returns 1 if successful or -1 on error
  */
-int libfplist_xml_tag_get_number_of_elements(
+int libfplist_xml_tag_copy_value_data(
      libfplist_xml_tag_t *tag,
-     int *number_of_elements,
+     uint8_t *value_data,
+     size_t value_data_size,
+     size_t *value_data_index,
      libcerror_error_t **error )
 {
-	static char *function = "libfplist_xml_tag_get_number_of_elements";
+	static char *function = "libfplist_xml_tag_copy_value_data";
 
 	if( tag == NULL )
 	{
@@ -693,33 +985,114 @@ int libfplist_xml_tag_get_number_of_elements(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     tag->elements_array,
-	     number_of_elements,
+	if( ( tag->value_data_reference == NULL )
+	 && ( ( tag->value == NULL )
+	  || ( tag->value_size == 0 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid XML plist tag - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( tag->value_data_size_is_set != 0 )
+	 && ( value_data_size < tag->value_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid value data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag->value_data_reference != NULL )
+	{
+		if( memory_copy(
+		     value_data,
+		     tag->value_data_reference,
+		     tag->value_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data.",
+			 function );
+
+			return( -1 );
+		}
+		*value_data_index = tag->value_data_size;
+
+		return( 1 );
+	}
+	if( libfplist_base64_stream_decode(
+	     tag->value,
+	     tag->value_size - 1,
+	     value_data,
+	     value_data_size,
+	     value_data_index,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to retrieve number of entries.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy base64 encoded value data.",
 		 function );
 
 		return( -1 );
 	}
+	tag->value_data_size        = *value_data_index;
+	tag->value_data_size_is_set = 1;
+
 	return( 1 );
 }
 
-/* Retrieves a specific element
- * Returns 1 if successful or -1 on error
+/* Retrieves the property list embedded in the value data
+ * The value data is checked and the embedded property list is parsed on first use
+ * and cached, the embedded property list is freed when the tag is freed
+ * Base64 encoded value data is decoded once into managed value data that is
+ * referenced by the embedded property list
+ * Returns 1 if successful, 0 if the value data does not contain a property list or -1 on error
  */
-int libfplist_xml_tag_get_element(
+int libfplist_xml_tag_get_embedded_property_list(
      libfplist_xml_tag_t *tag,
-     int element_index,
-     libfplist_xml_tag_t **element_tag,
+     libfplist_property_list_t **property_list,
      libcerror_error_t **error )
 {
-	static char *function = "libfplist_xml_tag_get_element";
+	uint8_t *value_data      = NULL;
+	static char *function    = "libfplist_xml_tag_get_embedded_property_list";
+	size_t value_data_index  = 0;
+	size_t value_data_offset = 0;
+	size_t value_data_size   = 0;
+	int result               = 0;
 
 	if( tag == NULL )
 	{
@@ -732,6 +1105,1295 @@ int libfplist_xml_tag_get_element(
 
 		return( -1 );
 	}
+	if( property_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property list.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag->embedded_property_list_is_set == 0 )
+	{
+		if( libfplist_xml_tag_get_value_data_size(
+		     tag,
+		     &value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value data size.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( tag->value_data_reference == NULL )
+		 && ( value_data_size > 0 ) )
+		{
+			if( value_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid value data size value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			value_data = (uint8_t *) memory_allocate(
+			                          sizeof( uint8_t ) * value_data_size );
+
+			if( value_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create value data.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfplist_xml_tag_copy_value_data(
+			     tag,
+			     value_data,
+			     value_data_size,
+			     &value_data_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy value data.",
+				 function );
+
+				goto on_error;
+			}
+			/* The decoded value data is kept so that subsequent reads of the value data
+			 * and the embedded property list reference it
+			 */
+			tag->managed_value_data   = value_data;
+			tag->value_data_reference = value_data;
+
+			value_data = NULL;
+		}
+		/* Only value data that starts with a binary plist signature or, after optional
+		 * white space, with a XML declaration or plist element is parsed
+		 */
+		if( value_data_size >= 8 )
+		{
+			if( memory_compare(
+			     tag->value_data_reference,
+			     "bplist",
+			     6 ) == 0 )
+			{
+				result = 1;
+			}
+			else
+			{
+				if( ( tag->value_data_reference[ 0 ] == 0xef )
+				 && ( tag->value_data_reference[ 1 ] == 0xbb )
+				 && ( tag->value_data_reference[ 2 ] == 0xbf ) )
+				{
+					value_data_offset = 3;
+				}
+				while( ( value_data_offset < value_data_size )
+				    && ( ( tag->value_data_reference[ value_data_offset ] == (uint8_t) ' ' )
+				     ||  ( tag->value_data_reference[ value_data_offset ] == (uint8_t) '\t' )
+				     ||  ( tag->value_data_reference[ value_data_offset ] == (uint8_t) '\n' )
+				     ||  ( tag->value_data_reference[ value_data_offset ] == (uint8_t) '\r' ) ) )
+				{
+					value_data_offset++;
+				}
+				if( ( ( value_data_size - value_data_offset ) >= 6 )
+				 && ( ( memory_compare(
+				         &( tag->value_data_reference[ value_data_offset ] ),
+				         "<?xml",
+				         5 ) == 0 )
+				  ||  ( memory_compare(
+				         &( tag->value_data_reference[ value_data_offset ] ),
+				         "<plist",
+				         6 ) == 0 ) ) )
+				{
+					result = 1;
+				}
+			}
+		}
+		if( result != 0 )
+		{
+			if( libfplist_property_list_initialize(
+			     &( tag->embedded_property_list ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create embedded property list.",
+				 function );
+
+				goto on_error;
+			}
+			/* A binary property list is not copied but references the value data
+			 */
+			if( libfplist_property_list_set_byte_stream(
+			     tag->embedded_property_list,
+			     tag->value_data_reference,
+			     value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read embedded property list.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		tag->embedded_property_list_is_set = 1;
+	}
+	if( tag->embedded_property_list == NULL )
+	{
+		return( 0 );
+	}
+	*property_list = tag->embedded_property_list;
+
+	return( 1 );
+
+on_error:
+	if( tag->embedded_property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &( tag->embedded_property_list ),
+		 NULL );
+	}
+	if( value_data != NULL )
+	{
+		memory_free(
+		 value_data );
+	}
+	return( -1 );
+}
+
+/* Reads base64 decoded value data at a specific offset of the decoded data
+ * A sparse index of checkpoints is built on first use so that only the part
+ * of the base64 encoded value that contains the requested range is decoded
+ * Returns the number of bytes read, 0 if the offset is at or beyond the end of the data or -1 on error
+ */
+ssize_t libfplist_xml_tag_read_value_data_at_offset(
+         libfplist_xml_tag_t *tag,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	uint8_t checkpoint_data[ LIBFPLIST_BASE64_CHECKPOINT_DATA_SIZE ];
+
+	uint8_t *checkpoint_data_buffer = NULL;
+	static char *function           = "libfplist_xml_tag_read_value_data_at_offset";
+	size_t base64_stream_end_index  = 0;
+	size_t buffer_offset            = 0;
+	size_t checkpoint_data_offset   = 0;
+	size_t checkpoint_data_size     = 0;
+	size_t read_size                = 0;
+	size_t value_length             = 0;
+	int checkpoint_index            = 0;
+
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML plist tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( tag->value_data_reference == NULL )
+	 && ( ( tag->value == NULL )
+	  || ( tag->value_size == 0 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid XML plist tag - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag->value_data_reference != NULL )
+	{
+		if( (size64_t) offset >= (size64_t) tag->value_data_size )
+		{
+			return( 0 );
+		}
+		if( buffer_size > ( tag->value_data_size - (size_t) offset ) )
+		{
+			buffer_size = tag->value_data_size - (size_t) offset;
+		}
+		if( memory_copy(
+		     buffer,
+		     &( tag->value_data_reference[ (size_t) offset ] ),
+		     buffer_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data.",
+			 function );
+
+			return( -1 );
+		}
+		return( (ssize_t) buffer_size );
+	}
+	value_length = tag->value_size - 1;
+
+	if( tag->value_data_checkpoints == NULL )
+	{
+		if( libfplist_base64_stream_get_checkpoints(
+		     tag->value,
+		     value_length,
+		     &( tag->value_data_checkpoints ),
+		     &( tag->number_of_value_data_checkpoints ),
+		     &( tag->value_data_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine checkpoints of base64 encoded value data.",
+			 function );
+
+			return( -1 );
+		}
+		tag->value_data_size_is_set = 1;
+	}
+	if( (size64_t) offset >= (size64_t) tag->value_data_size )
+	{
+		return( 0 );
+	}
+	if( buffer_size > ( tag->value_data_size - (size_t) offset ) )
+	{
+		buffer_size = tag->value_data_size - (size_t) offset;
+	}
+	checkpoint_index       = (int) ( (size_t) offset / LIBFPLIST_BASE64_CHECKPOINT_DATA_SIZE );
+	checkpoint_data_offset = (size_t) offset % LIBFPLIST_BASE64_CHECKPOINT_DATA_SIZE;
+
+	while( buffer_offset < buffer_size )
+	{
+		if( checkpoint_index >= tag->number_of_value_data_checkpoints )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid checkpoint index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( checkpoint_index + 1 ) < tag->number_of_value_data_checkpoints )
+		{
+			base64_stream_end_index = tag->value_data_checkpoints[ checkpoint_index + 1 ];
+		}
+		else
+		{
+			base64_stream_end_index = value_length;
+		}
+		read_size = buffer_size - buffer_offset;
+
+		/* Decode directly into the buffer if the data of the checkpoint is read in full
+		 */
+		if( ( checkpoint_data_offset == 0 )
+		 && ( read_size >= LIBFPLIST_BASE64_CHECKPOINT_DATA_SIZE ) )
+		{
+			checkpoint_data_buffer = &( buffer[ buffer_offset ] );
+		}
+		else
+		{
+			checkpoint_data_buffer = checkpoint_data;
+		}
+		if( libfplist_base64_stream_decode(
+		     &( tag->value[ tag->value_data_checkpoints[ checkpoint_index ] ] ),
+		     base64_stream_end_index - tag->value_data_checkpoints[ checkpoint_index ],
+		     checkpoint_data_buffer,
+		     LIBFPLIST_BASE64_CHECKPOINT_DATA_SIZE,
+		     &checkpoint_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to decode base64 encoded value data of checkpoint: %d.",
+			 function,
+			 checkpoint_index );
+
+			return( -1 );
+		}
+		if( checkpoint_data_offset >= checkpoint_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid checkpoint data offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		checkpoint_data_size -= checkpoint_data_offset;
+
+		if( read_size > checkpoint_data_size )
+		{
+			read_size = checkpoint_data_size;
+		}
+		if( checkpoint_data_buffer == checkpoint_data )
+		{
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( checkpoint_data[ checkpoint_data_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy checkpoint data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		buffer_offset         += read_size;
+		checkpoint_data_offset = 0;
+
+		checkpoint_index++;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Retrieves the date and time value
+ * The value is expected to be formatted as: YYYY-MM-DDThh:mm:ss[.fraction][Z]
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_xml_tag_get_date_time_value(
+     libfplist_xml_tag_t *tag,
+     int64_t *posix_time,
+     uint32_t *nanoseconds,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_xml_tag_get_date_time_value";
+	int result            = 0;
+
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML plist tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( tag->value == NULL )
+	 || ( tag->value_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid XML plist tag - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfplist_date_time_copy_from_utf8_string(
+	          tag->value,
+	          tag->value_size - 1,
+	          posix_time,
+	          nanoseconds,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy date and time from value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported date and time value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the integer size
+ * The size is defined by the size attribute in bits, for example size="128"
+ * The size is 64 if the tag has no size attribute
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_xml_tag_get_integer_size(
+     libfplist_xml_tag_t *tag,
+     uint8_t *integer_size,
+     libcerror_error_t **error )
+{
+	libfplist_xml_attribute_t *attribute = NULL;
+	static char *function                = "libfplist_xml_tag_get_integer_size";
+	uint64_t size_lower_64bit            = 0;
+	uint64_t size_upper_64bit            = 0;
+	uint8_t size_is_negative             = 0;
+	int attribute_index                  = 0;
+	int number_of_attributes             = 0;
+	int result                           = 0;
+
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML plist tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( integer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integer size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     tag->attributes_array,
+	     &number_of_attributes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of attributes.",
+		 function );
+
+		return( -1 );
+	}
+	*integer_size = 64;
+
+	for( attribute_index = 0;
+	     attribute_index < number_of_attributes;
+	     attribute_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     tag->attributes_array,
+		     attribute_index,
+		     (intptr_t **) &attribute,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute: %d.",
+			 function,
+			 attribute_index );
+
+			return( -1 );
+		}
+		if( attribute == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing attribute: %d.",
+			 function,
+			 attribute_index );
+
+			return( -1 );
+		}
+		if( ( attribute->name_size != 5 )
+		 || ( memory_compare(
+		       attribute->name,
+		       "size",
+		       4 ) != 0 ) )
+		{
+			continue;
+		}
+		result = libfplist_integer_copy_from_utf8_string(
+		          attribute->value,
+		          attribute->value_size - 1,
+		          &size_upper_64bit,
+		          &size_lower_64bit,
+		          &size_is_negative,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy size attribute value to integer.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( result == 0 )
+		 || ( size_is_negative != 0 )
+		 || ( size_upper_64bit != 0 )
+		 || ( ( size_lower_64bit != 8 )
+		  &&  ( size_lower_64bit != 16 )
+		  &&  ( size_lower_64bit != 32 )
+		  &&  ( size_lower_64bit != 64 )
+		  &&  ( size_lower_64bit != 128 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported size attribute value.",
+			 function );
+
+			return( -1 );
+		}
+		*integer_size = (uint8_t) size_lower_64bit;
+
+		break;
+	}
+	return( 1 );
+}
+
+/* Retrieves the integer value
+ * The value is parsed on first use and cached
+ * The value is returned as a 128-bit magnitude and a sign and must fit in the integer size
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_xml_tag_get_integer_value(
+     libfplist_xml_tag_t *tag,
+     uint64_t *upper_64bit,
+     uint64_t *lower_64bit,
+     uint8_t *is_negative,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_xml_tag_get_integer_value";
+	uint8_t integer_size  = 0;
+	int result            = 0;
+
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML plist tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( upper_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid upper 64-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	if( lower_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lower 64-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_negative == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid is negative.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag->integer_value_is_set == 0 )
+	{
+		if( ( tag->value == NULL )
+		 || ( tag->value_size == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid XML plist tag - missing value.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfplist_xml_tag_get_integer_size(
+		     tag,
+		     &integer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve integer size.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfplist_integer_copy_from_utf8_string(
+		          tag->value,
+		          tag->value_size - 1,
+		          &( tag->integer_value_upper_64bit ),
+		          &( tag->integer_value_lower_64bit ),
+		          &( tag->integer_value_is_negative ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value to integer.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported integer value.",
+			 function );
+
+			return( -1 );
+		}
+		/* A value of size N must fit in either a signed or an unsigned N-bit integer
+		 */
+		if( integer_size < 128 )
+		{
+			if( tag->integer_value_upper_64bit != 0 )
+			{
+				result = 0;
+			}
+			else if( tag->integer_value_is_negative != 0 )
+			{
+				result = (int) ( tag->integer_value_lower_64bit <= ( (uint64_t) 1 << ( integer_size - 1 ) ) );
+			}
+			else if( integer_size < 64 )
+			{
+				result = (int) ( ( tag->integer_value_lower_64bit >> integer_size ) == 0 );
+			}
+		}
+		if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid integer value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		tag->integer_value_is_set = 1;
+	}
+	*upper_64bit = tag->integer_value_upper_64bit;
+	*lower_64bit = tag->integer_value_lower_64bit;
+	*is_negative = tag->integer_value_is_negative;
+
+	return( 1 );
+}
+
+/* Retrieves the value tag of a specific key path
+ * The key path consists of dictionary keys separated by '/', where an empty
+ * key path refers to the tag itself
+ * Returns 1 if successful, 0 if no such value tag or -1 on error
+ */
+int libfplist_xml_tag_get_value_tag_by_utf8_key_path(
+     libfplist_xml_tag_t *tag,
+     const uint8_t *utf8_key_path,
+     size_t utf8_key_path_length,
+     libfplist_xml_tag_t **value_tag,
+     libcerror_error_t **error )
+{
+	libfplist_xml_tag_t *dictionary_tag = NULL;
+	libfplist_xml_tag_t *element_tag    = NULL;
+	static char *function               = "libfplist_xml_tag_get_value_tag_by_utf8_key_path";
+	size_t key_length                   = 0;
+	size_t key_path_index               = 0;
+	size_t key_start_index              = 0;
+	int element_index                   = 0;
+	int key_found                       = 0;
+	int number_of_elements              = 0;
+	int result                          = 0;
+
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML plist tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_key_path == NULL )
+	 && ( utf8_key_path_length != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 key path.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_key_path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 key path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value tag.",
+		 function );
+
+		return( -1 );
+	}
+	dictionary_tag = tag;
+
+	while( key_path_index < utf8_key_path_length )
+	{
+		key_start_index = key_path_index;
+
+		while( ( key_path_index < utf8_key_path_length )
+		    && ( utf8_key_path[ key_path_index ] != (uint8_t) '/' ) )
+		{
+			key_path_index++;
+		}
+		key_length = key_path_index - key_start_index;
+
+		/* Skip the key separator
+		 */
+		key_path_index++;
+
+		result = libfplist_xml_tag_compare_name(
+		          dictionary_tag,
+		          (uint8_t *) "dict",
+		          4,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare name of dictionary tag.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( libfplist_xml_tag_get_number_of_elements(
+		     dictionary_tag,
+		     &number_of_elements,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of elements.",
+			 function );
+
+			return( -1 );
+		}
+		key_found = 0;
+
+		for( element_index = 0;
+		     element_index < number_of_elements;
+		     element_index++ )
+		{
+			if( libfplist_xml_tag_get_element(
+			     dictionary_tag,
+			     element_index,
+			     &element_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve element: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+			result = libfplist_xml_tag_compare_name(
+			          element_tag,
+			          (uint8_t *) "text",
+			          4,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to compare name of element: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				continue;
+			}
+			/* The first element that is not a text node after the key is its value
+			 */
+			if( key_found != 0 )
+			{
+				break;
+			}
+			result = libfplist_xml_tag_compare_name(
+			          element_tag,
+			          (uint8_t *) "key",
+			          3,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to compare name of element: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				if( key_length == 0 )
+				{
+					key_found = (int) ( ( element_tag->value == NULL )
+					                 || ( element_tag->value_size <= 1 ) );
+				}
+				else if( ( element_tag->value != NULL )
+				      && ( element_tag->value_size == ( key_length + 1 ) )
+				      && ( memory_compare(
+				            element_tag->value,
+				            &( utf8_key_path[ key_start_index ] ),
+				            key_length ) == 0 ) )
+				{
+					key_found = 1;
+				}
+			}
+		}
+		if( element_index >= number_of_elements )
+		{
+			return( 0 );
+		}
+		dictionary_tag = element_tag;
+	}
+	*value_tag = dictionary_tag;
+
+	return( 1 );
+}
+
+/* Appends an attribute
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_xml_tag_append_attribute(
+     libfplist_xml_tag_t *tag,
+     const uint8_t *name,
+     size_t name_length,
+     const uint8_t *value,
+     size_t value_length,
+     libcerror_error_t **error )
+{
+	libfplist_xml_attribute_t *attribute = NULL;
+	static char *function                = "libfplist_xml_tag_append_attribute";
+	int entry_index                      = 0;
+
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML plist tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_attribute_initialize(
+	     &attribute,
+	     name,
+	     name_length,
+	     value,
+	     value_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create attribute.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     tag->attributes_array,
+	     &entry_index,
+	     (intptr_t *) attribute,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append attribute to array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( attribute != NULL )
+	{
+		libfplist_xml_attribute_free(
+		 &attribute,
+		 NULL );
+	}
+	return( -1 );
+}
+
+int libfplist_xml_tag_append_element(
+     libfplist_xml_tag_t *tag,
+     libfplist_xml_tag_t *element_tag,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_xml_tag_append_element";
+	int entry_index       = 0;
+
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML plist tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( element_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML plist element tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_append_entry(
+	     tag->elements_array,
+	     &entry_index,
+	     (intptr_t *) element_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append element tag to array.",
+		 function );
+
+		return( -1 );
+	}
+	element_tag->parent_tag = tag;
+
+	/* Key and text elements are not counted as entries
+	 */
+	if( element_tag->name != NULL )
+	{
+		if( ( element_tag->name_size == 4 )
+		 && ( narrow_string_compare(
+		       element_tag->name,
+		       "key",
+		       3 ) == 0 ) )
+		{
+			return( 1 );
+		}
+		if( ( element_tag->name_size == 5 )
+		 && ( narrow_string_compare(
+		       element_tag->name,
+		       "text",
+		       4 ) == 0 ) )
+		{
+			return( 1 );
+		}
+	}
+	tag->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of elements
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_xml_tag_get_number_of_elements(
+     libfplist_xml_tag_t *tag,
+     int *number_of_elements,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_xml_tag_get_number_of_elements";
+
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML plist tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag->binary_parser_state != NULL )
+	{
+		if( libfplist_binary_parser_read_elements(
+		     tag->binary_parser_state,
+		     tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read binary plist elements.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     tag->elements_array,
+	     number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * The number of entries is maintained when elements are appended
+ * The elements of a binary plist array or dict are read first since
+ * null elements and dict entries with a null value are omitted
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_xml_tag_get_number_of_entries(
+     libfplist_xml_tag_t *tag,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_xml_tag_get_number_of_entries";
+
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML plist tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag->binary_parser_state != NULL )
+	{
+		if( libfplist_binary_parser_read_elements(
+		     tag->binary_parser_state,
+		     tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read binary plist elements.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*number_of_entries = tag->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific element
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_xml_tag_get_element(
+     libfplist_xml_tag_t *tag,
+     int element_index,
+     libfplist_xml_tag_t **element_tag,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_xml_tag_get_element";
+
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML plist tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag->binary_parser_state != NULL )
+	{
+		if( libfplist_binary_parser_read_elements(
+		     tag->binary_parser_state,
+		     tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read binary plist elements.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( libcdata_array_get_entry_by_index(
 	     tag->elements_array,
 	     element_index,
@@ -27,6 +27,7 @@
 
 #include "libfplist_libcdata.h"
 #include "libfplist_libcerror.h"
+#include "libfplist_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -56,6 +57,46 @@ struct libfplist_xml_tag
 	 */
 	size_t value_size;
 
+	/* The value hash
+	 */
+	uint32_t value_hash;
+
+	/* Value to indicate the value hash was calculated
+	 */
+	uint8_t value_hash_is_set;
+
+	/* The size of the base64 decoded value data
+	 */
+	size_t value_data_size;
+
+	/* Value to indicate the value data size was determined
+	 */
+	uint8_t value_data_size_is_set;
+
+	/* The base64 value data checkpoints, which are built on first ranged read
+	 */
+	size_t *value_data_checkpoints;
+
+	/* The number of base64 value data checkpoints
+	 */
+	int number_of_value_data_checkpoints;
+
+	/* The upper 64-bit of the magnitude of the integer value
+	 */
+	uint64_t integer_value_upper_64bit;
+
+	/* The lower 64-bit of the magnitude of the integer value
+	 */
+	uint64_t integer_value_lower_64bit;
+
+	/* Value to indicate the integer value is negative
+	 */
+	uint8_t integer_value_is_negative;
+
+	/* Value to indicate the integer value was parsed
+	 */
+	uint8_t integer_value_is_set;
+
 	/* The attributes array
 	 */
 	libcdata_array_t *attributes_array;
@@ -63,6 +104,37 @@ struct libfplist_xml_tag
 	/* The elements array
 	 */
 	libcdata_array_t *elements_array;
+
+	/* The number of entries, which are the value elements of a dict or array tag
+	 */
+	int number_of_entries;
+
+	/* The binary property list parser state, which is set while the elements
+	 * of a binary property list array or dict have not been read
+	 */
+	struct libfplist_binary_parser_state *binary_parser_state;
+
+	/* The binary property list object index
+	 */
+	uint64_t binary_object_index;
+
+	/* The value data reference, which points into the binary property list buffer
+	 * or to the managed value data
+	 */
+	const uint8_t *value_data_reference;
+
+	/* The managed value data, which is a copy of the binary property list data owned by the tag
+	 * or the base64 decoded value data of an embedded property list
+	 */
+	uint8_t *managed_value_data;
+
+	/* The embedded property list, which is parsed from the value data on first use
+	 */
+	libfplist_property_list_t *embedded_property_list;
+
+	/* Value to indicate the value data was checked for an embedded property list
+	 */
+	uint8_t embedded_property_list_is_set;
 };
 
 int libfplist_xml_tag_initialize(
@@ -92,6 +164,64 @@ int libfplist_xml_tag_set_value(
      size_t value_length,
      libcerror_error_t **error );
 
+int libfplist_xml_tag_decode_value_entity_references(
+     libfplist_xml_tag_t *tag,
+     libcerror_error_t **error );
+
+int libfplist_xml_tag_get_value_hash(
+     libfplist_xml_tag_t *tag,
+     uint32_t *value_hash,
+     libcerror_error_t **error );
+
+int libfplist_xml_tag_get_value_data_size(
+     libfplist_xml_tag_t *tag,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
+int libfplist_xml_tag_copy_value_data(
+     libfplist_xml_tag_t *tag,
+     uint8_t *value_data,
+     size_t value_data_size,
+     size_t *value_data_index,
+     libcerror_error_t **error );
+
+int libfplist_xml_tag_get_embedded_property_list(
+     libfplist_xml_tag_t *tag,
+     libfplist_property_list_t **property_list,
+     libcerror_error_t **error );
+
+ssize_t libfplist_xml_tag_read_value_data_at_offset(
+         libfplist_xml_tag_t *tag,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libfplist_xml_tag_get_date_time_value(
+     libfplist_xml_tag_t *tag,
+     int64_t *posix_time,
+     uint32_t *nanoseconds,
+     libcerror_error_t **error );
+
+int libfplist_xml_tag_get_integer_size(
+     libfplist_xml_tag_t *tag,
+     uint8_t *integer_size,
+     libcerror_error_t **error );
+
+int libfplist_xml_tag_get_integer_value(
+     libfplist_xml_tag_t *tag,
+     uint64_t *upper_64bit,
+     uint64_t *lower_64bit,
+     uint8_t *is_negative,
+     libcerror_error_t **error );
+
+int libfplist_xml_tag_get_value_tag_by_utf8_key_path(
+     libfplist_xml_tag_t *tag,
+     const uint8_t *utf8_key_path,
+     size_t utf8_key_path_length,
+     libfplist_xml_tag_t **value_tag,
+     libcerror_error_t **error );
+
 int libfplist_xml_tag_append_attribute(
      libfplist_xml_tag_t *tag,
      const uint8_t *name,
@@ -110,6 +240,11 @@ int libfplist_xml_tag_get_number_of_elements(
      int *number_of_elements,
      libcerror_error_t **error );
 
+int libfplist_xml_tag_get_number_of_entries(
+     libfplist_xml_tag_t *tag,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
 int libfplist_xml_tag_get_element(
      libfplist_xml_tag_t *tag,
      int element_index,
@@ -0,0 +1,1112 @@
+/*
+ * XML writer functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libfplist_base64.h"
+#include "libfplist_binary_parser.h"
+#include "libfplist_definitions.h"
+#include "libfplist_libcerror.h"
+#include "libfplist_xml_tag.h"
+#include "libfplist_xml_writer.h"
+
+/* Creates a XML writer
+ * Make sure the value xml_writer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_xml_writer_initialize(
+     libfplist_xml_writer_t **xml_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_xml_writer_initialize";
+
+	if( xml_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *xml_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid XML writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*xml_writer = memory_allocate_structure(
+	               libfplist_xml_writer_t );
+
+	if( *xml_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create XML writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *xml_writer,
+	     0,
+	     sizeof( libfplist_xml_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear XML writer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *xml_writer != NULL )
+	{
+		memory_free(
+		 *xml_writer );
+
+		*xml_writer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a XML writer
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_xml_writer_free(
+     libfplist_xml_writer_t **xml_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "libfplist_xml_writer_free";
+
+	if( xml_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *xml_writer != NULL )
+	{
+		if( ( *xml_writer )->buffer != NULL )
+		{
+			memory_free(
+			 ( *xml_writer )->buffer );
+		}
+		memory_free(
+		 *xml_writer );
+
+		*xml_writer = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends space for data to the buffer
+ * The data remains valid until the next append
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_xml_writer_append_space(
+     libfplist_xml_writer_t *xml_writer,
+     size_t size,
+     uint8_t **data,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer              = NULL;
+	static char *function        = "libfplist_xml_writer_append_space";
+	size_t allocated_buffer_size = 0;
+
+	if( xml_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE - xml_writer->buffer_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( xml_writer->buffer_size + size ) > xml_writer->allocated_buffer_size )
+	{
+		allocated_buffer_size = xml_writer->allocated_buffer_size;
+
+		if( allocated_buffer_size == 0 )
+		{
+			allocated_buffer_size = 4096;
+		}
+		while( allocated_buffer_size < ( xml_writer->buffer_size + size ) )
+		{
+			if( allocated_buffer_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				allocated_buffer_size = MEMORY_MAXIMUM_ALLOCATION_SIZE;
+
+				break;
+			}
+			allocated_buffer_size *= 2;
+		}
+		buffer = (uint8_t *) memory_reallocate(
+		                      xml_writer->buffer,
+		                      sizeof( uint8_t ) * allocated_buffer_size );
+
+		if( buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize buffer.",
+			 function );
+
+			return( -1 );
+		}
+		xml_writer->buffer                = buffer;
+		xml_writer->allocated_buffer_size = allocated_buffer_size;
+	}
+	*data = &( xml_writer->buffer[ xml_writer->buffer_size ] );
+
+	xml_writer->buffer_size += size;
+
+	return( 1 );
+}
+
+/* Appends data to the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_xml_writer_append_data(
+     libfplist_xml_writer_t *xml_writer,
+     const uint8_t *data,
+     size_t size,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer_data  = NULL;
+	static char *function = "libfplist_xml_writer_append_data";
+
+	if( ( data == NULL )
+	 && ( size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_writer_append_space(
+	     xml_writer,
+	     size,
+	     &buffer_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append space.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > 0 )
+	{
+		if( memory_copy(
+		     buffer_data,
+		     data,
+		     size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends the indentation of a tag, which is a tab per level
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_xml_writer_append_indentation(
+     libfplist_xml_writer_t *xml_writer,
+     int indentation_level,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer_data  = NULL;
+	static char *function = "libfplist_xml_writer_append_indentation";
+
+	if( ( indentation_level < 0 )
+	 || ( indentation_level > ( LIBFPLIST_MAXIMUM_RECURSION_DEPTH + 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid indentation level value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_writer_append_space(
+	     xml_writer,
+	     (size_t) indentation_level,
+	     &buffer_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append space.",
+		 function );
+
+		return( -1 );
+	}
+	if( indentation_level > 0 )
+	{
+		if( memory_set(
+		     buffer_data,
+		     (int) '\t',
+		     (size_t) indentation_level ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to set indentation.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends a string of which the &, < and > characters are replaced by entity references
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_xml_writer_append_escaped_string(
+     libfplist_xml_writer_t *xml_writer,
+     const uint8_t *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	const char *entity_reference = NULL;
+	static char *function        = "libfplist_xml_writer_append_escaped_string";
+	size_t run_start_index       = 0;
+	size_t string_index          = 0;
+
+	if( ( string == NULL )
+	 && ( string_length > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		switch( string[ string_index ] )
+		{
+			case (uint8_t) '&':
+				entity_reference = "&amp;";
+				break;
+
+			case (uint8_t) '<':
+				entity_reference = "&lt;";
+				break;
+
+			case (uint8_t) '>':
+				entity_reference = "&gt;";
+				break;
+
+			default:
+				continue;
+		}
+		/* Characters that do not need to be replaced are appended as a run
+		 */
+		if( libfplist_xml_writer_append_data(
+		     xml_writer,
+		     &( string[ run_start_index ] ),
+		     string_index - run_start_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append string.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfplist_xml_writer_append_data(
+		     xml_writer,
+		     (uint8_t *) entity_reference,
+		     narrow_string_length(
+		      entity_reference ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entity reference.",
+			 function );
+
+			return( -1 );
+		}
+		run_start_index = string_index + 1;
+	}
+	if( libfplist_xml_writer_append_data(
+	     xml_writer,
+	     &( string[ run_start_index ] ),
+	     string_length - run_start_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a tag and its elements
+ * The elements of a binary property list array or dict tag that were not read are not appended
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_xml_writer_append_tag(
+     libfplist_xml_writer_t *xml_writer,
+     libfplist_xml_tag_t *tag,
+     int indentation_level,
+     libcerror_error_t **error )
+{
+	libfplist_xml_tag_t *element_tag = NULL;
+	uint8_t *buffer_data             = NULL;
+	static char *function            = "libfplist_xml_writer_append_tag";
+	size_t base64_stream_size        = 0;
+	uint8_t integer_size             = 0;
+	int element_index                = 0;
+	int number_of_elements           = 0;
+
+	if( tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( tag->name == NULL )
+	 || ( tag->name_size < 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid tag - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_tag_get_number_of_elements(
+	     tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_xml_writer_append_indentation(
+	     xml_writer,
+	     indentation_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append indentation.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( tag->name_size == 5 )
+	  && ( narrow_string_compare(
+	        tag->name,
+	        "true",
+	        4 ) == 0 ) )
+	 || ( ( tag->name_size == 6 )
+	  && ( narrow_string_compare(
+	        tag->name,
+	        "false",
+	        5 ) == 0 ) ) )
+	{
+		if( ( libfplist_xml_writer_append_data(
+		       xml_writer,
+		       (uint8_t *) "<",
+		       1,
+		       error ) != 1 )
+		 || ( libfplist_xml_writer_append_data(
+		       xml_writer,
+		       tag->name,
+		       tag->name_size - 1,
+		       error ) != 1 )
+		 || ( libfplist_xml_writer_append_data(
+		       xml_writer,
+		       (uint8_t *) "/>\n",
+		       3,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append tag.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( ( libfplist_xml_writer_append_data(
+	       xml_writer,
+	       (uint8_t *) "<",
+	       1,
+	       error ) != 1 )
+	 || ( libfplist_xml_writer_append_data(
+	       xml_writer,
+	       tag->name,
+	       tag->name_size - 1,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append open tag.",
+		 function );
+
+		return( -1 );
+	}
+	/* A 128-bit integer requires the size attribute to be read back
+	 */
+	if( ( tag->name_size == 8 )
+	 && ( narrow_string_compare(
+	       tag->name,
+	       "integer",
+	       7 ) == 0 ) )
+	{
+		if( libfplist_xml_tag_get_integer_size(
+		     tag,
+		     &integer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve integer size.",
+			 function );
+
+			return( -1 );
+		}
+		if( integer_size == 128 )
+		{
+			if( libfplist_xml_writer_append_data(
+			     xml_writer,
+			     (uint8_t *) " size=\"128\"",
+			     11,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append size attribute.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( libfplist_xml_writer_append_data(
+	     xml_writer,
+	     (uint8_t *) ">",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append open tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag->value_data_reference != NULL )
+	{
+		/* The data of a binary property list data object is base64 encoded
+		 */
+		if( libfplist_base64_stream_size_from_byte_stream(
+		     tag->value_data_size,
+		     &base64_stream_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine base64 stream size.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfplist_xml_writer_append_space(
+		     xml_writer,
+		     base64_stream_size,
+		     &buffer_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append space.",
+			 function );
+
+			return( -1 );
+		}
+		if( base64_stream_size > 0 )
+		{
+			if( libfplist_base64_stream_copy_from_byte_stream(
+			     buffer_data,
+			     base64_stream_size,
+			     tag->value_data_reference,
+			     tag->value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy data to base64 stream.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	else if( number_of_elements > 0 )
+	{
+		if( libfplist_xml_writer_append_data(
+		     xml_writer,
+		     (uint8_t *) "\n",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append end of line.",
+			 function );
+
+			return( -1 );
+		}
+		for( element_index = 0;
+		     element_index < number_of_elements;
+		     element_index++ )
+		{
+			if( libfplist_xml_tag_get_element(
+			     tag,
+			     element_index,
+			     &element_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve element: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+			if( libfplist_xml_writer_append_tag(
+			     xml_writer,
+			     element_tag,
+			     indentation_level + 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append element: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+		}
+		if( libfplist_xml_writer_append_indentation(
+		     xml_writer,
+		     indentation_level,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append indentation.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( ( tag->value != NULL )
+	      && ( tag->value_size > 1 ) )
+	{
+		if( libfplist_xml_writer_append_escaped_string(
+		     xml_writer,
+		     tag->value,
+		     tag->value_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( libfplist_xml_writer_append_data(
+	       xml_writer,
+	       (uint8_t *) "</",
+	       2,
+	       error ) != 1 )
+	 || ( libfplist_xml_writer_append_data(
+	       xml_writer,
+	       tag->name,
+	       tag->name_size - 1,
+	       error ) != 1 )
+	 || ( libfplist_xml_writer_append_data(
+	       xml_writer,
+	       (uint8_t *) ">\n",
+	       2,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append close tag.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a binary property list object and the objects it references
+ * The objects are read and appended one at a time without building a tree of tags
+ * If is_key is set the object must be a string
+ * Returns 1 if successful or -1 on error
+ */
+int libfplist_xml_writer_append_binary_object(
+     libfplist_xml_writer_t *xml_writer,
+     libfplist_binary_parser_state_t *parser_state,
+     uint64_t object_index,
+     uint8_t is_key,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfplist_xml_tag_t *tag      = NULL;
+	static char *function         = "libfplist_xml_writer_append_binary_object";
+	size_t references_offset      = 0;
+	uint64_t element_object_index = 0;
+	uint64_t entry_index          = 0;
+	uint64_t key_object_index     = 0;
+	uint64_t number_of_entries    = 0;
+	uint8_t object_marker         = 0;
+	int result                    = 0;
+
+	if( parser_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFPLIST_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfplist_binary_parser_read_object(
+	     parser_state,
+	     object_index,
+	     is_key,
+	     &tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read object: %" PRIu64 ".",
+		 function,
+		 object_index );
+
+		goto on_error;
+	}
+	/* The elements of array and dict objects are not read into the tag
+	 * but appended as they are read
+	 */
+	if( ( tag->binary_parser_state == NULL )
+	 || ( tag->number_of_entries == 0 ) )
+	{
+		if( libfplist_xml_writer_append_tag(
+		     xml_writer,
+		     tag,
+		     recursion_depth,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append tag.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libfplist_binary_parser_get_container_references(
+		     parser_state,
+		     object_index,
+		     &object_marker,
+		     &references_offset,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve object: %" PRIu64 " references.",
+			 function,
+			 object_index );
+
+			goto on_error;
+		}
+		if( ( libfplist_xml_writer_append_indentation(
+		       xml_writer,
+		       recursion_depth,
+		       error ) != 1 )
+		 || ( libfplist_xml_writer_append_data(
+		       xml_writer,
+		       (uint8_t *) "<",
+		       1,
+		       error ) != 1 )
+		 || ( libfplist_xml_writer_append_data(
+		       xml_writer,
+		       tag->name,
+		       tag->name_size - 1,
+		       error ) != 1 )
+		 || ( libfplist_xml_writer_append_data(
+		       xml_writer,
+		       (uint8_t *) ">\n",
+		       2,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append open tag.",
+			 function );
+
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			/* A dict stores the key references followed by the value references
+			 */
+			if( object_marker == 0xd0 )
+			{
+				if( libfplist_binary_parser_get_object_reference(
+				     parser_state,
+				     references_offset + (size_t) ( entry_index * parser_state->object_reference_size ),
+				     &key_object_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve key object reference: %" PRIu64 ".",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				if( libfplist_binary_parser_get_object_reference(
+				     parser_state,
+				     references_offset + (size_t) ( ( number_of_entries + entry_index ) * parser_state->object_reference_size ),
+				     &element_object_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve value object reference: %" PRIu64 ".",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+			}
+			else
+			{
+				if( libfplist_binary_parser_get_object_reference(
+				     parser_state,
+				     references_offset + (size_t) ( entry_index * parser_state->object_reference_size ),
+				     &element_object_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve object reference: %" PRIu64 ".",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+			}
+			/* Null elements and dict entries with a null value are omitted
+			 */
+			result = libfplist_binary_parser_object_is_null(
+			          parser_state,
+			          element_object_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if object: %" PRIu64 " is null.",
+				 function,
+				 element_object_index );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				continue;
+			}
+			if( object_marker == 0xd0 )
+			{
+				if( libfplist_xml_writer_append_binary_object(
+				     xml_writer,
+				     parser_state,
+				     key_object_index,
+				     1,
+				     recursion_depth + 1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append key object: %" PRIu64 ".",
+					 function,
+					 key_object_index );
+
+					goto on_error;
+				}
+			}
+			if( libfplist_xml_writer_append_binary_object(
+			     xml_writer,
+			     parser_state,
+			     element_object_index,
+			     0,
+			     recursion_depth + 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append object: %" PRIu64 ".",
+				 function,
+				 element_object_index );
+
+				goto on_error;
+			}
+		}
+		if( ( libfplist_xml_writer_append_indentation(
+		       xml_writer,
+		       recursion_depth,
+		       error ) != 1 )
+		 || ( libfplist_xml_writer_append_data(
+		       xml_writer,
+		       (uint8_t *) "</",
+		       2,
+		       error ) != 1 )
+		 || ( libfplist_xml_writer_append_data(
+		       xml_writer,
+		       tag->name,
+		       tag->name_size - 1,
+		       error ) != 1 )
+		 || ( libfplist_xml_writer_append_data(
+		       xml_writer,
+		       (uint8_t *) ">\n",
+		       2,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append close tag.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfplist_xml_tag_free(
+	     &tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free tag.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &tag,
+		 NULL );
+	}
+	return( -1 );
+}
+
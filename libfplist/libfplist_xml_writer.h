@@ -0,0 +1,103 @@
+/*
+ * XML writer functions
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFPLIST_XML_WRITER_H )
+#define _LIBFPLIST_XML_WRITER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfplist_binary_parser.h"
+#include "libfplist_libcerror.h"
+#include "libfplist_xml_tag.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfplist_xml_writer libfplist_xml_writer_t;
+
+struct libfplist_xml_writer
+{
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The allocated buffer size
+	 */
+	size_t allocated_buffer_size;
+};
+
+int libfplist_xml_writer_initialize(
+     libfplist_xml_writer_t **xml_writer,
+     libcerror_error_t **error );
+
+int libfplist_xml_writer_free(
+     libfplist_xml_writer_t **xml_writer,
+     libcerror_error_t **error );
+
+int libfplist_xml_writer_append_space(
+     libfplist_xml_writer_t *xml_writer,
+     size_t size,
+     uint8_t **data,
+     libcerror_error_t **error );
+
+int libfplist_xml_writer_append_data(
+     libfplist_xml_writer_t *xml_writer,
+     const uint8_t *data,
+     size_t size,
+     libcerror_error_t **error );
+
+int libfplist_xml_writer_append_indentation(
+     libfplist_xml_writer_t *xml_writer,
+     int indentation_level,
+     libcerror_error_t **error );
+
+int libfplist_xml_writer_append_escaped_string(
+     libfplist_xml_writer_t *xml_writer,
+     const uint8_t *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int libfplist_xml_writer_append_tag(
+     libfplist_xml_writer_t *xml_writer,
+     libfplist_xml_tag_t *tag,
+     int indentation_level,
+     libcerror_error_t **error );
+
+int libfplist_xml_writer_append_binary_object(
+     libfplist_xml_writer_t *xml_writer,
+     libfplist_binary_parser_state_t *parser_state,
+     uint64_t object_index,
+     uint8_t is_key,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFPLIST_XML_WRITER_H ) */
+
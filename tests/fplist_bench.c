@@ -0,0 +1,1322 @@
+/*
+ * Library benchmarks
+ *
+ * The benchmarks are not run by make check, build and run them with:
+ * make -C tests fplist_bench && tests/fplist_bench
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "fplist_test_libcerror.h"
+#include "fplist_test_libfplist.h"
+#include "fplist_test_unused.h"
+
+#include "../libfplist/libfplist_base64.h"
+#include "../libfplist/libfplist_floating_point.h"
+#include "../libfplist/libfplist_libuna.h"
+#include "../libfplist/libfplist_utf16.h"
+
+/* The minimum duration of a benchmark in clock ticks
+ */
+#define FPLIST_BENCH_MINIMUM_DURATION	( CLOCKS_PER_SEC / 2 )
+
+/* The number of dict entries in the generated property list
+ */
+#define FPLIST_BENCH_NUMBER_OF_DICTS	20000
+
+typedef int (*fplist_bench_function_t)(
+             void *context,
+             libcerror_error_t **error );
+
+typedef struct fplist_bench_buffer fplist_bench_buffer_t;
+
+struct fplist_bench_buffer
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+/* Runs a benchmark function repeatedly for at least the minimum duration
+ * Prints the throughput relative to the size of the benchmark input
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_run(
+     const char *name,
+     fplist_bench_function_t function,
+     void *context,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	clock_t start_time       = 0;
+	clock_t elapsed_time     = 0;
+	double throughput        = 0.0;
+	int number_of_iterations = 0;
+
+	start_time = clock();
+
+	do
+	{
+		if( function(
+		     context,
+		     error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run benchmark: %s\n",
+			 name );
+
+			return( -1 );
+		}
+		number_of_iterations++;
+
+		elapsed_time = clock() - start_time;
+	}
+	while( elapsed_time < FPLIST_BENCH_MINIMUM_DURATION );
+
+	throughput = ( (double) data_size * number_of_iterations )
+	           / ( ( (double) elapsed_time / CLOCKS_PER_SEC ) * 1024.0 * 1024.0 );
+
+	fprintf(
+	 stdout,
+	 "%-48s %9.1f MiB/s (%d iterations)\n",
+	 name,
+	 throughput,
+	 number_of_iterations );
+
+	return( 1 );
+}
+
+/* Appends a string to a buffer
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_buffer_append_string(
+     fplist_bench_buffer_t *buffer,
+     size_t *buffer_allocated_size,
+     const char *string )
+{
+	uint8_t *reallocation = NULL;
+	size_t string_length  = 0;
+
+	string_length = narrow_string_length(
+	                 string );
+
+	if( ( buffer->data_size + string_length + 2 ) > *buffer_allocated_size )
+	{
+		*buffer_allocated_size = ( *buffer_allocated_size * 2 ) + string_length + 2;
+
+		reallocation = (uint8_t *) memory_reallocate(
+		                            buffer->data,
+		                            sizeof( uint8_t ) * *buffer_allocated_size );
+
+		if( reallocation == NULL )
+		{
+			return( -1 );
+		}
+		buffer->data = reallocation;
+	}
+	if( memory_copy(
+	     &( buffer->data[ buffer->data_size ] ),
+	     string,
+	     string_length ) == NULL )
+	{
+		return( -1 );
+	}
+	buffer->data_size += string_length;
+
+	return( 1 );
+}
+
+/* Generates a XML property list with an array of dicts, that contain strings,
+ * integers, reals, booleans and data, comparable to a preferences dump
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_generate_xml_property_list(
+     fplist_bench_buffer_t *buffer )
+{
+	char string[ 512 ];
+
+	size_t buffer_allocated_size = 0;
+	int dict_index               = 0;
+	int print_count              = 0;
+
+	buffer->data      = NULL;
+	buffer->data_size = 0;
+
+	if( fplist_bench_buffer_append_string(
+	     buffer,
+	     &buffer_allocated_size,
+	     "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+	     "<!DOCTYPE plist PUBLIC \"-//Apple//DTD PLIST 1.0//EN\" \"http://www.apple.com/DTDs/PropertyList-1.0.dtd\">\n"
+	     "<plist version=\"1.0\">\n<dict>\n\t<key>Items</key>\n\t<array>\n" ) != 1 )
+	{
+		return( -1 );
+	}
+	for( dict_index = 0;
+	     dict_index < FPLIST_BENCH_NUMBER_OF_DICTS;
+	     dict_index++ )
+	{
+		print_count = narrow_string_snprintf(
+		               string,
+		               512,
+		               "\t\t<dict>\n"
+		               "\t\t\t<key>Name</key>\n\t\t\t<string>Item %d &amp; T\xc3\xa9st</string>\n"
+		               "\t\t\t<key>Identifier</key>\n\t\t\t<integer>%d</integer>\n"
+		               "\t\t\t<key>Offset</key>\n\t\t\t<integer>-%d</integer>\n"
+		               "\t\t\t<key>Ratio</key>\n\t\t\t<real>%d.%06d</real>\n"
+		               "\t\t\t<key>Enabled</key>\n\t\t\t<%s/>\n"
+		               "\t\t\t<key>Data</key>\n\t\t\t<data>\n\t\t\tVGhpcyBpcyBzb21lIGRhdGEgdGhhdCBpcyBzdG9yZWQgaW4g\n\t\t\tYmFzZTY0IGZvcm1hdCAlMDZk\n\t\t\t</data>\n"
+		               "\t\t</dict>\n",
+		               dict_index,
+		               dict_index,
+		               dict_index * 7,
+		               dict_index % 1000,
+		               ( ( dict_index % 7 ) * 142857 ) % 1000000,
+		               ( ( dict_index % 2 ) == 0 ) ? "true" : "false" );
+
+		if( ( print_count < 0 )
+		 || ( print_count >= 512 ) )
+		{
+			return( -1 );
+		}
+		if( fplist_bench_buffer_append_string(
+		     buffer,
+		     &buffer_allocated_size,
+		     string ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	if( fplist_bench_buffer_append_string(
+	     buffer,
+	     &buffer_allocated_size,
+	     "\t</array>\n</dict>\n</plist>\n" ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Transcodes the XML property list into a binary property list
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_transcoder_copy_xml_to_binary(
+     void *context,
+     libcerror_error_t **error )
+{
+	fplist_bench_buffer_t *xml_buffer = NULL;
+	uint8_t *byte_stream              = NULL;
+	size_t byte_stream_size           = 0;
+
+	xml_buffer = (fplist_bench_buffer_t *) context;
+
+	if( libfplist_transcoder_copy_xml_to_binary(
+	     xml_buffer->data,
+	     xml_buffer->data_size,
+	     &byte_stream,
+	     &byte_stream_size,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	memory_free(
+	 byte_stream );
+
+	return( 1 );
+}
+
+/* Transcodes the binary property list into a XML property list
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_transcoder_copy_binary_to_xml(
+     void *context,
+     libcerror_error_t **error )
+{
+	fplist_bench_buffer_t *binary_buffer = NULL;
+	uint8_t *byte_stream                 = NULL;
+	size_t byte_stream_size              = 0;
+
+	binary_buffer = (fplist_bench_buffer_t *) context;
+
+	if( libfplist_transcoder_copy_binary_to_xml(
+	     binary_buffer->data,
+	     binary_buffer->data_size,
+	     &byte_stream,
+	     &byte_stream_size,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	memory_free(
+	 byte_stream );
+
+	return( 1 );
+}
+
+/* Parses the XML property list into a tree and writes it as a binary property list
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_property_list_write_binary(
+     void *context,
+     libcerror_error_t **error )
+{
+	fplist_bench_buffer_t *xml_buffer        = NULL;
+	libfplist_property_list_t *property_list = NULL;
+	uint8_t *byte_stream                     = NULL;
+	size_t byte_stream_size                  = 0;
+
+	xml_buffer = (fplist_bench_buffer_t *) context;
+
+	if( libfplist_property_list_initialize(
+	     &property_list,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfplist_property_list_copy_from_byte_stream(
+	     property_list,
+	     xml_buffer->data,
+	     xml_buffer->data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfplist_property_list_write_binary(
+	     property_list,
+	     &byte_stream,
+	     &byte_stream_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	memory_free(
+	 byte_stream );
+
+	if( libfplist_property_list_free(
+	     &property_list,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Benchmarks the transcoders
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_transcoder(
+     fplist_bench_buffer_t *xml_buffer,
+     libcerror_error_t **error )
+{
+	fplist_bench_buffer_t binary_buffer;
+
+	binary_buffer.data      = NULL;
+	binary_buffer.data_size = 0;
+
+	if( libfplist_transcoder_copy_xml_to_binary(
+	     xml_buffer->data,
+	     xml_buffer->data_size,
+	     &( binary_buffer.data ),
+	     &( binary_buffer.data_size ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Transcoder: XML: %" PRIzd " bytes, binary: %" PRIzd " bytes\n",
+	 xml_buffer->data_size,
+	 binary_buffer.data_size );
+
+	if( fplist_bench_run(
+	     "XML to binary, transcoder",
+	     &fplist_bench_transcoder_copy_xml_to_binary,
+	     (void *) xml_buffer,
+	     xml_buffer->data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( fplist_bench_run(
+	     "XML to binary, property list tree",
+	     &fplist_bench_property_list_write_binary,
+	     (void *) xml_buffer,
+	     xml_buffer->data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( fplist_bench_run(
+	     "Binary to XML, transcoder",
+	     &fplist_bench_transcoder_copy_binary_to_xml,
+	     (void *) &binary_buffer,
+	     binary_buffer.data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	memory_free(
+	 binary_buffer.data );
+
+	return( 1 );
+
+on_error:
+	if( binary_buffer.data != NULL )
+	{
+		memory_free(
+		 binary_buffer.data );
+	}
+	return( -1 );
+}
+
+/* Parses the XML property list into a property list
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_property_list_copy_from_byte_stream(
+     void *context,
+     libcerror_error_t **error )
+{
+	fplist_bench_buffer_t *xml_buffer        = NULL;
+	libfplist_property_list_t *property_list = NULL;
+
+	xml_buffer = (fplist_bench_buffer_t *) context;
+
+	if( libfplist_property_list_initialize(
+	     &property_list,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfplist_property_list_copy_from_byte_stream(
+	     property_list,
+	     xml_buffer->data,
+	     xml_buffer->data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfplist_property_list_free(
+	     &property_list,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the property list as a binary property list
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_property_list_write_binary_only(
+     void *context,
+     libcerror_error_t **error )
+{
+	libfplist_property_list_t *property_list = NULL;
+	uint8_t *byte_stream                     = NULL;
+	size_t byte_stream_size                  = 0;
+
+	property_list = (libfplist_property_list_t *) context;
+
+	if( libfplist_property_list_write_binary(
+	     property_list,
+	     &byte_stream,
+	     &byte_stream_size,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	memory_free(
+	 byte_stream );
+
+	return( 1 );
+}
+
+/* Benchmarks the binary property list writer
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_binary_writer(
+     fplist_bench_buffer_t *xml_buffer,
+     libcerror_error_t **error )
+{
+	libfplist_property_list_t *property_list = NULL;
+	uint8_t *byte_stream                     = NULL;
+	size_t byte_stream_size                  = 0;
+
+	if( libfplist_property_list_initialize(
+	     &property_list,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfplist_property_list_copy_from_byte_stream(
+	     property_list,
+	     xml_buffer->data,
+	     xml_buffer->data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfplist_property_list_write_binary(
+	     property_list,
+	     &byte_stream,
+	     &byte_stream_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	memory_free(
+	 byte_stream );
+
+	fprintf(
+	 stdout,
+	 "Binary writer: XML: %" PRIzd " bytes, binary: %" PRIzd " bytes (%.1f%%)\n",
+	 xml_buffer->data_size,
+	 byte_stream_size,
+	 ( 100.0 * byte_stream_size ) / xml_buffer->data_size );
+
+	if( fplist_bench_run(
+	     "Property list copy from XML",
+	     &fplist_bench_property_list_copy_from_byte_stream,
+	     (void *) xml_buffer,
+	     xml_buffer->data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( fplist_bench_run(
+	     "Property list write binary (per XML byte)",
+	     &fplist_bench_property_list_write_binary_only,
+	     (void *) property_list,
+	     xml_buffer->data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfplist_property_list_free(
+	     &property_list,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+/* Generates a base64 stream, formatted as the data value of a XML property list
+ * with line breaks and indentation
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_generate_base64_stream(
+     fplist_bench_buffer_t *buffer,
+     size_t data_size )
+{
+	static char *alphabet   = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	size_t base64_index     = 0;
+	size_t group_index      = 0;
+	size_t number_of_groups = 0;
+	uint32_t random_value   = 1;
+	int character_index     = 0;
+
+	/* Every 48 bytes of data are encoded as a line of 64 characters,
+	 * indented by 3 tabs and terminated by a line break
+	 */
+	number_of_groups = data_size / 3;
+
+	buffer->data_size = ( number_of_groups * 4 ) + ( ( number_of_groups / 16 ) + 1 ) * 4;
+
+	buffer->data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * buffer->data_size );
+
+	if( buffer->data == NULL )
+	{
+		return( -1 );
+	}
+	for( group_index = 0;
+	     group_index < number_of_groups;
+	     group_index++ )
+	{
+		if( ( group_index % 16 ) == 0 )
+		{
+			buffer->data[ base64_index++ ] = '\n';
+			buffer->data[ base64_index++ ] = '\t';
+			buffer->data[ base64_index++ ] = '\t';
+			buffer->data[ base64_index++ ] = '\t';
+		}
+		for( character_index = 0;
+		     character_index < 4;
+		     character_index++ )
+		{
+			random_value = ( random_value * 1103515245UL ) + 12345;
+
+			buffer->data[ base64_index++ ] = (uint8_t) alphabet[ ( random_value >> 16 ) & 0x3f ];
+		}
+	}
+	buffer->data_size = base64_index;
+
+	return( 1 );
+}
+
+/* Decodes the base64 stream using libfplist
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_base64_stream_decode_libfplist(
+     void *context,
+     libcerror_error_t **error )
+{
+	fplist_bench_buffer_t *base64_buffer = NULL;
+	uint8_t *byte_stream                 = NULL;
+	size_t byte_stream_size              = 0;
+
+	base64_buffer = (fplist_bench_buffer_t *) context;
+
+	if( libfplist_base64_stream_size_to_byte_stream(
+	     base64_buffer->data,
+	     base64_buffer->data_size,
+	     &byte_stream_size,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	byte_stream = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * byte_stream_size );
+
+	if( byte_stream == NULL )
+	{
+		return( -1 );
+	}
+	if( libfplist_base64_stream_copy_to_byte_stream(
+	     base64_buffer->data,
+	     base64_buffer->data_size,
+	     byte_stream,
+	     byte_stream_size,
+	     error ) != 1 )
+	{
+		memory_free(
+		 byte_stream );
+
+		return( -1 );
+	}
+	memory_free(
+	 byte_stream );
+
+	return( 1 );
+}
+
+/* Decodes the base64 stream using libuna
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_base64_stream_decode_libuna(
+     void *context,
+     libcerror_error_t **error )
+{
+	fplist_bench_buffer_t *base64_buffer = NULL;
+	uint8_t *byte_stream                 = NULL;
+	size_t byte_stream_size              = 0;
+
+	base64_buffer = (fplist_bench_buffer_t *) context;
+
+	if( libuna_base64_stream_size_to_byte_stream(
+	     base64_buffer->data,
+	     base64_buffer->data_size,
+	     &byte_stream_size,
+	     LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED,
+	     LIBUNA_BASE64_FLAG_STRIP_WHITESPACE,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	byte_stream = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * byte_stream_size );
+
+	if( byte_stream == NULL )
+	{
+		return( -1 );
+	}
+	if( libuna_base64_stream_copy_to_byte_stream(
+	     base64_buffer->data,
+	     base64_buffer->data_size,
+	     byte_stream,
+	     byte_stream_size,
+	     LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED,
+	     LIBUNA_BASE64_FLAG_STRIP_WHITESPACE,
+	     error ) != 1 )
+	{
+		memory_free(
+		 byte_stream );
+
+		return( -1 );
+	}
+	memory_free(
+	 byte_stream );
+
+	return( 1 );
+}
+
+/* Benchmarks the base64 decoders
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_base64(
+     libcerror_error_t **error )
+{
+	fplist_bench_buffer_t base64_buffer;
+
+	if( fplist_bench_generate_base64_stream(
+	     &base64_buffer,
+	     8 * 1024 * 1024 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to generate base64 stream.\n" );
+
+		return( -1 );
+	}
+	fprintf(
+	 stdout,
+	 "Base64: %" PRIzd " bytes with line breaks and indentation\n",
+	 base64_buffer.data_size );
+
+	if( fplist_bench_run(
+	     "Base64 decode, libfplist",
+	     &fplist_bench_base64_stream_decode_libfplist,
+	     (void *) &base64_buffer,
+	     base64_buffer.data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( fplist_bench_run(
+	     "Base64 decode, libuna",
+	     &fplist_bench_base64_stream_decode_libuna,
+	     (void *) &base64_buffer,
+	     base64_buffer.data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	memory_free(
+	 base64_buffer.data );
+
+	return( 1 );
+
+on_error:
+	memory_free(
+	 base64_buffer.data );
+
+	return( -1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+/* Generates floating point value strings, each stored as a length byte
+ * followed by the string and an end of string character
+ * Alternates short values, such as found in preferences, with values
+ * formatted with 17 significant digits and exponents, such as found in telemetry
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_generate_floating_point_strings(
+     fplist_bench_buffer_t *buffer,
+     int number_of_values )
+{
+	uint64_t random_value = 1;
+	size_t buffer_index   = 0;
+	double value          = 0.0;
+	int print_count       = 0;
+	int value_index       = 0;
+
+	buffer->data_size = (size_t) number_of_values * 32;
+
+	buffer->data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * buffer->data_size );
+
+	if( buffer->data == NULL )
+	{
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		random_value = ( random_value * 6364136223846793005ULL ) + 1442695040888963407ULL;
+
+		switch( value_index % 4 )
+		{
+			case 0:
+				print_count = narrow_string_snprintf(
+				               (char *) &( buffer->data[ buffer_index + 1 ] ),
+				               30,
+				               "%d.%d",
+				               (int) ( random_value >> 54 ),
+				               (int) ( ( random_value >> 40 ) % 100 ) );
+				break;
+
+			case 1:
+				value = (double) ( random_value >> 11 ) / (double) ( 1ULL << 53 );
+
+				print_count = narrow_string_snprintf(
+				               (char *) &( buffer->data[ buffer_index + 1 ] ),
+				               30,
+				               "%.17g",
+				               value * 1000.0 );
+				break;
+
+			case 2:
+				value = (double) ( random_value >> 11 ) / (double) ( 1ULL << 53 );
+
+				print_count = narrow_string_snprintf(
+				               (char *) &( buffer->data[ buffer_index + 1 ] ),
+				               30,
+				               "%.17g",
+				               value * 1e-7 );
+				break;
+
+			default:
+				print_count = narrow_string_snprintf(
+				               (char *) &( buffer->data[ buffer_index + 1 ] ),
+				               30,
+				               "-%d.%06de%d",
+				               (int) ( random_value >> 60 ),
+				               (int) ( ( random_value >> 20 ) % 1000000 ),
+				               (int) ( random_value >> 58 ) );
+				break;
+		}
+		if( ( print_count < 0 )
+		 || ( print_count >= 30 ) )
+		{
+			return( -1 );
+		}
+		buffer->data[ buffer_index ] = (uint8_t) print_count;
+
+		buffer_index += (size_t) print_count + 2;
+	}
+	buffer->data_size = buffer_index;
+
+	return( 1 );
+}
+
+/* Converts the floating point value strings using libfplist
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_floating_point_copy_from_utf8_string(
+     void *context,
+     libcerror_error_t **error )
+{
+	fplist_bench_buffer_t *strings_buffer = NULL;
+	volatile double sum                   = 0.0;
+	size_t buffer_index                   = 0;
+	size_t string_length                  = 0;
+	double value                          = 0.0;
+
+	strings_buffer = (fplist_bench_buffer_t *) context;
+
+	while( buffer_index < strings_buffer->data_size )
+	{
+		string_length = strings_buffer->data[ buffer_index ];
+
+		if( libfplist_floating_point_copy_from_utf8_string(
+		     &( strings_buffer->data[ buffer_index + 1 ] ),
+		     string_length,
+		     &value,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		sum += value;
+
+		buffer_index += string_length + 2;
+	}
+	return( 1 );
+}
+
+/* Converts the floating point value strings using strtod
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_floating_point_strtod(
+     void *context,
+     libcerror_error_t **error FPLIST_TEST_ATTRIBUTE_UNUSED )
+{
+	fplist_bench_buffer_t *strings_buffer = NULL;
+	volatile double sum                   = 0.0;
+	size_t buffer_index                   = 0;
+	size_t string_length                  = 0;
+
+	FPLIST_TEST_UNREFERENCED_PARAMETER( error )
+
+	strings_buffer = (fplist_bench_buffer_t *) context;
+
+	while( buffer_index < strings_buffer->data_size )
+	{
+		string_length = strings_buffer->data[ buffer_index ];
+
+		sum += strtod(
+		        (char *) &( strings_buffer->data[ buffer_index + 1 ] ),
+		        NULL );
+
+		buffer_index += string_length + 2;
+	}
+	return( 1 );
+}
+
+/* Benchmarks the floating point value conversion
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_floating_point(
+     libcerror_error_t **error )
+{
+	fplist_bench_buffer_t strings_buffer;
+
+	size_t buffer_index      = 0;
+	size_t string_length     = 0;
+	double value             = 0.0;
+	int number_of_mismatches = 0;
+
+	if( fplist_bench_generate_floating_point_strings(
+	     &strings_buffer,
+	     1000000 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to generate floating point value strings.\n" );
+
+		goto on_error;
+	}
+	while( buffer_index < strings_buffer.data_size )
+	{
+		string_length = strings_buffer.data[ buffer_index ];
+
+		if( libfplist_floating_point_copy_from_utf8_string(
+		     &( strings_buffer.data[ buffer_index + 1 ] ),
+		     string_length,
+		     &value,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( value != strtod(
+		              (char *) &( strings_buffer.data[ buffer_index + 1 ] ),
+		              NULL ) )
+		{
+			number_of_mismatches++;
+		}
+		buffer_index += string_length + 2;
+	}
+	fprintf(
+	 stdout,
+	 "Floating point: 1000000 values of %" PRIzd " bytes, %d differ from strtod\n",
+	 strings_buffer.data_size,
+	 number_of_mismatches );
+
+	if( fplist_bench_run(
+	     "Floating point from string, libfplist",
+	     &fplist_bench_floating_point_copy_from_utf8_string,
+	     (void *) &strings_buffer,
+	     strings_buffer.data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( fplist_bench_run(
+	     "Floating point from string, strtod",
+	     &fplist_bench_floating_point_strtod,
+	     (void *) &strings_buffer,
+	     strings_buffer.data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	memory_free(
+	 strings_buffer.data );
+
+	return( 1 );
+
+on_error:
+	if( strings_buffer.data != NULL )
+	{
+		memory_free(
+		 strings_buffer.data );
+	}
+	return( -1 );
+}
+
+/* Generates big-endian UTF-16 strings, comparable to the values of a localization table,
+ * each stored as a 16-bit big-endian size followed by the string
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_generate_utf16_strings(
+     fplist_bench_buffer_t *buffer,
+     int number_of_strings )
+{
+	/* "Open the selected document in a new window"
+	 */
+	uint16_t english_string[ 43 ] = {
+		'O', 'p', 'e', 'n', ' ', 't', 'h', 'e', ' ', 's', 'e', 'l', 'e', 'c', 't', 'e',
+		'd', ' ', 'd', 'o', 'c', 'u', 'm', 'e', 'n', 't', ' ', 'i', 'n', ' ', 'a', ' ',
+		'n', 'e', 'w', ' ', 'w', 'i', 'n', 'd', 'o', 'w', 0 };
+
+	/* The German translation of the English string, with 2 non-ASCII characters
+	 */
+	uint16_t german_string[ 55 ] = {
+		0x00d6, 'f', 'f', 'n', 'e', 't', ' ', 'd', 'a', 's', ' ', 'a', 'u', 's', 'g', 'e',
+		'w', 0x00e4, 'h', 'l', 't', 'e', ' ', 'D', 'o', 'k', 'u', 'm', 'e', 'n', 't', ' ',
+		'i', 'n', ' ', 'e', 'i', 'n', 'e', 'm', ' ', 'n', 'e', 'u', 'e', 'n', ' ', 'F',
+		'e', 'n', 's', 't', 'e', 'r', 0 };
+
+	/* The Japanese translation of the English string
+	 */
+	uint16_t japanese_string[ 19 ] = {
+		0x9078, 0x629e, 0x3057, 0x305f, 0x66f8, 0x985e, 0x3092, 0x65b0, 0x3057, 0x3044,
+		0x30a6, 0x30a4, 0x30f3, 0x30c9, 0x30a6, 0x3067, 0x958b, 0x304f, 0 };
+
+	/* "Done " followed by an emoji, which is stored as a surrogate pair
+	 */
+	uint16_t emoji_string[ 8 ] = {
+		'D', 'o', 'n', 'e', ' ', 0xd83d, 0xde00, 0 };
+
+	uint16_t *string    = NULL;
+	size_t buffer_index = 0;
+	size_t string_size  = 0;
+	int character_index = 0;
+	int string_index    = 0;
+
+	buffer->data_size = (size_t) number_of_strings * ( 2 + ( 55 * 2 ) );
+
+	buffer->data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * buffer->data_size );
+
+	if( buffer->data == NULL )
+	{
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < number_of_strings;
+	     string_index++ )
+	{
+		/* Localization tables mostly contain ASCII and Latin strings
+		 */
+		switch( string_index % 10 )
+		{
+			case 0:
+			case 1:
+			case 2:
+			case 3:
+			case 4:
+				string = english_string;
+				break;
+
+			case 5:
+			case 6:
+			case 7:
+				string = german_string;
+				break;
+
+			case 8:
+				string = japanese_string;
+				break;
+
+			default:
+				string = emoji_string;
+				break;
+		}
+		string_size = 0;
+
+		for( character_index = 0;
+		     string[ character_index ] != 0;
+		     character_index++ )
+		{
+			buffer->data[ buffer_index + 2 + string_size++ ] = (uint8_t) ( string[ character_index ] >> 8 );
+			buffer->data[ buffer_index + 2 + string_size++ ] = (uint8_t) ( string[ character_index ] & 0xff );
+		}
+		buffer->data[ buffer_index ]     = (uint8_t) ( string_size >> 8 );
+		buffer->data[ buffer_index + 1 ] = (uint8_t) ( string_size & 0xff );
+
+		buffer_index += 2 + string_size;
+	}
+	buffer->data_size = buffer_index;
+
+	return( 1 );
+}
+
+/* Converts the UTF-16 strings into UTF-8 strings using libfplist
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_utf16_stream_copy_to_utf8_string_libfplist(
+     void *context,
+     libcerror_error_t **error )
+{
+	uint8_t utf8_string[ 256 ];
+
+	fplist_bench_buffer_t *strings_buffer = NULL;
+	size_t buffer_index                   = 0;
+	size_t string_size                    = 0;
+	size_t utf8_string_size               = 0;
+
+	strings_buffer = (fplist_bench_buffer_t *) context;
+
+	while( buffer_index < strings_buffer->data_size )
+	{
+		string_size = ( (size_t) strings_buffer->data[ buffer_index ] << 8 )
+		            | strings_buffer->data[ buffer_index + 1 ];
+
+		if( libfplist_utf16_stream_get_utf8_string_size(
+		     &( strings_buffer->data[ buffer_index + 2 ] ),
+		     string_size,
+		     &utf8_string_size,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( libfplist_utf16_stream_copy_to_utf8_string(
+		     &( strings_buffer->data[ buffer_index + 2 ] ),
+		     string_size,
+		     utf8_string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		buffer_index += 2 + string_size;
+	}
+	return( 1 );
+}
+
+/* Converts the UTF-16 strings into UTF-8 strings using libuna
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_utf16_stream_copy_to_utf8_string_libuna(
+     void *context,
+     libcerror_error_t **error )
+{
+	uint8_t utf8_string[ 256 ];
+
+	fplist_bench_buffer_t *strings_buffer = NULL;
+	size_t buffer_index                   = 0;
+	size_t string_size                    = 0;
+	size_t utf8_string_size               = 0;
+
+	strings_buffer = (fplist_bench_buffer_t *) context;
+
+	while( buffer_index < strings_buffer->data_size )
+	{
+		string_size = ( (size_t) strings_buffer->data[ buffer_index ] << 8 )
+		            | strings_buffer->data[ buffer_index + 1 ];
+
+		if( libuna_utf8_string_size_from_utf16_stream(
+		     &( strings_buffer->data[ buffer_index + 2 ] ),
+		     string_size,
+		     LIBUNA_ENDIAN_BIG,
+		     &utf8_string_size,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( libuna_utf8_string_copy_from_utf16_stream(
+		     utf8_string,
+		     utf8_string_size,
+		     &( strings_buffer->data[ buffer_index + 2 ] ),
+		     string_size,
+		     LIBUNA_ENDIAN_BIG,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		buffer_index += 2 + string_size;
+	}
+	return( 1 );
+}
+
+/* Benchmarks the UTF-16 string conversion
+ * Returns 1 if successful or -1 on error
+ */
+int fplist_bench_utf16(
+     libcerror_error_t **error )
+{
+	fplist_bench_buffer_t strings_buffer;
+
+	if( fplist_bench_generate_utf16_strings(
+	     &strings_buffer,
+	     200000 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to generate UTF-16 strings.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "UTF-16: 200000 strings of %" PRIzd " bytes\n",
+	 strings_buffer.data_size );
+
+	if( fplist_bench_run(
+	     "UTF-16 to UTF-8, libfplist",
+	     &fplist_bench_utf16_stream_copy_to_utf8_string_libfplist,
+	     (void *) &strings_buffer,
+	     strings_buffer.data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( fplist_bench_run(
+	     "UTF-16 to UTF-8, libuna",
+	     &fplist_bench_utf16_stream_copy_to_utf8_string_libuna,
+	     (void *) &strings_buffer,
+	     strings_buffer.data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	memory_free(
+	 strings_buffer.data );
+
+	return( 1 );
+
+on_error:
+	if( strings_buffer.data != NULL )
+	{
+		memory_free(
+		 strings_buffer.data );
+	}
+	return( -1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	fplist_bench_buffer_t xml_buffer;
+
+	libcerror_error_t *error = NULL;
+
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argc )
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argv )
+
+	if( fplist_bench_generate_xml_property_list(
+	     &xml_buffer ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to generate XML property list.\n" );
+
+		goto on_error;
+	}
+	if( fplist_bench_transcoder(
+	     &xml_buffer,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( fplist_bench_binary_writer(
+	     &xml_buffer,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+	if( fplist_bench_base64(
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( fplist_bench_floating_point(
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( fplist_bench_utf16(
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+#endif
+	memory_free(
+	 xml_buffer.data );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_buffer.data != NULL )
+	{
+		memory_free(
+		 xml_buffer.data );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1975 @@
+/*
+ * Library archive type test program
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fplist_test_libcerror.h"
+#include "fplist_test_libfplist.h"
+#include "fplist_test_macros.h"
+#include "fplist_test_memory.h"
+#include "fplist_test_unused.h"
+
+uint8_t fplist_test_archive_data1[ 2977 ] = {
+	0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31,
+	0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54,
+	0x46, 0x2d, 0x38, 0x22, 0x3f, 0x3e, 0x0a, 0x3c, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x76, 0x65,
+	0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69,
+	0x63, 0x74, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x24, 0x61, 0x72, 0x63, 0x68, 0x69,
+	0x76, 0x65, 0x72, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69,
+	0x6e, 0x67, 0x3e, 0x4e, 0x53, 0x4b, 0x65, 0x79, 0x65, 0x64, 0x41, 0x72, 0x63, 0x68, 0x69, 0x76,
+	0x65, 0x72, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65,
+	0x79, 0x3e, 0x24, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e,
+	0x0a, 0x09, 0x3c, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72,
+	0x69, 0x6e, 0x67, 0x3e, 0x24, 0x6e, 0x75, 0x6c, 0x6c, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e,
+	0x67, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c,
+	0x6b, 0x65, 0x79, 0x3e, 0x24, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e,
+	0x0a, 0x09, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c,
+	0x6b, 0x65, 0x79, 0x3e, 0x43, 0x46, 0x24, 0x55, 0x49, 0x44, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e,
+	0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x37, 0x3c,
+	0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x64,
+	0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x4e, 0x53, 0x2e,
+	0x6b, 0x65, 0x79, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e,
+	0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x43, 0x46, 0x24, 0x55, 0x49,
+	0x44, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x69, 0x6e,
+	0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x32, 0x3c, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72,
+	0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09,
+	0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x6b,
+	0x65, 0x79, 0x3e, 0x43, 0x46, 0x24, 0x55, 0x49, 0x44, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a,
+	0x09, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x33, 0x3c,
+	0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x2f,
+	0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x4e, 0x53, 0x2e, 0x6f, 0x62, 0x6a,
+	0x65, 0x63, 0x74, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e,
+	0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x43, 0x46, 0x24, 0x55, 0x49,
+	0x44, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x69, 0x6e,
+	0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x34, 0x3c, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72,
+	0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09,
+	0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x6b,
+	0x65, 0x79, 0x3e, 0x43, 0x46, 0x24, 0x55, 0x49, 0x44, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a,
+	0x09, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x35, 0x3c,
+	0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x2f,
+	0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x4e, 0x61, 0x6d, 0x65, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69,
+	0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x49, 0x74,
+	0x65, 0x6d, 0x73, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x3c,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x54, 0x65, 0x73, 0x74, 0x3c, 0x2f, 0x73, 0x74, 0x72,
+	0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09,
+	0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x24, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3c, 0x2f, 0x6b, 0x65,
+	0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09,
+	0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x43, 0x46, 0x24, 0x55, 0x49, 0x44, 0x3c, 0x2f, 0x6b, 0x65,
+	0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e,
+	0x38, 0x3c, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c,
+	0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x4e,
+	0x53, 0x2e, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a,
+	0x09, 0x09, 0x09, 0x3c, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c,
+	0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e,
+	0x43, 0x46, 0x24, 0x55, 0x49, 0x44, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09,
+	0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x34, 0x3c, 0x2f, 0x69, 0x6e,
+	0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63,
+	0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09,
+	0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x43, 0x46, 0x24, 0x55, 0x49, 0x44, 0x3c, 0x2f,
+	0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67,
+	0x65, 0x72, 0x3e, 0x36, 0x3c, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09,
+	0x09, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c,
+	0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e,
+	0x43, 0x46, 0x24, 0x55, 0x49, 0x44, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09,
+	0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x39, 0x3c, 0x2f, 0x69, 0x6e,
+	0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63,
+	0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09,
+	0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x43, 0x46, 0x24, 0x55, 0x49, 0x44, 0x3c, 0x2f,
+	0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67,
+	0x65, 0x72, 0x3e, 0x30, 0x3c, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09,
+	0x09, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c,
+	0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e,
+	0x43, 0x46, 0x24, 0x55, 0x49, 0x44, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09,
+	0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x35, 0x3c, 0x2f, 0x69, 0x6e,
+	0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63,
+	0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09,
+	0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x43, 0x46, 0x24, 0x55, 0x49, 0x44, 0x3c, 0x2f,
+	0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67,
+	0x65, 0x72, 0x3e, 0x31, 0x32, 0x3c, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a,
+	0x09, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c,
+	0x2f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74,
+	0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b,
+	0x65, 0x79, 0x3e, 0x24, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a,
+	0x09, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x6b,
+	0x65, 0x79, 0x3e, 0x43, 0x46, 0x24, 0x55, 0x49, 0x44, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a,
+	0x09, 0x09, 0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x31, 0x30, 0x3c,
+	0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x64,
+	0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x4e, 0x53, 0x2e,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09,
+	0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x4d, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3c,
+	0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63,
+	0x74, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c,
+	0x6b, 0x65, 0x79, 0x3e, 0x24, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x6e, 0x61, 0x6d, 0x65, 0x3c, 0x2f,
+	0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e,
+	0x4e, 0x53, 0x44, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72, 0x79, 0x3c, 0x2f, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x24, 0x63,
+	0x6c, 0x61, 0x73, 0x73, 0x65, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09,
+	0x3c, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72,
+	0x69, 0x6e, 0x67, 0x3e, 0x4e, 0x53, 0x44, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72, 0x79,
+	0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x4e, 0x53, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x3c, 0x2f,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09,
+	0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x24,
+	0x63, 0x6c, 0x61, 0x73, 0x73, 0x6e, 0x61, 0x6d, 0x65, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a,
+	0x09, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x4e, 0x53, 0x41, 0x72, 0x72,
+	0x61, 0x79, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c,
+	0x6b, 0x65, 0x79, 0x3e, 0x24, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x65, 0x73, 0x3c, 0x2f, 0x6b, 0x65,
+	0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3e, 0x0a, 0x09, 0x09,
+	0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x4e, 0x53, 0x41, 0x72, 0x72, 0x61,
+	0x79, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x4e, 0x53, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x3c,
+	0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x61, 0x72,
+	0x72, 0x61, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09,
+	0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e,
+	0x24, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09,
+	0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e,
+	0x43, 0x46, 0x24, 0x55, 0x49, 0x44, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09,
+	0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x31, 0x31, 0x3c, 0x2f, 0x69, 0x6e,
+	0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74,
+	0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x4e, 0x53, 0x2e, 0x74, 0x69, 0x6d,
+	0x65, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x72, 0x65, 0x61, 0x6c,
+	0x3e, 0x30, 0x3c, 0x2f, 0x72, 0x65, 0x61, 0x6c, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69,
+	0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09,
+	0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x24, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x6e, 0x61, 0x6d, 0x65, 0x3c,
+	0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x3e, 0x4e, 0x53, 0x4d, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65,
+	0x79, 0x3e, 0x24, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x65, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e,
+	0x0a, 0x09, 0x09, 0x09, 0x3c, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09,
+	0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x4e, 0x53, 0x4d, 0x75, 0x74, 0x61, 0x62, 0x6c,
+	0x65, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e,
+	0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x4e, 0x53, 0x4f,
+	0x62, 0x6a, 0x65, 0x63, 0x74, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09,
+	0x09, 0x09, 0x3c, 0x2f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x2f, 0x64,
+	0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09,
+	0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x24, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x6e, 0x61, 0x6d, 0x65,
+	0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e,
+	0x67, 0x3e, 0x4e, 0x53, 0x44, 0x61, 0x74, 0x65, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x24, 0x63, 0x6c, 0x61, 0x73, 0x73,
+	0x65, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e,
+	0x4e, 0x53, 0x44, 0x61, 0x74, 0x65, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a,
+	0x09, 0x09, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x4e, 0x53, 0x4f, 0x62,
+	0x6a, 0x65, 0x63, 0x74, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09,
+	0x09, 0x3c, 0x2f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69,
+	0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09,
+	0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x24, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79,
+	0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09,
+	0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x43, 0x46, 0x24, 0x55, 0x49, 0x44, 0x3c, 0x2f, 0x6b, 0x65, 0x79,
+	0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x31,
+	0x33, 0x3c, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c,
+	0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x6e,
+	0x61, 0x6d, 0x65, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x64, 0x69,
+	0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x43, 0x46, 0x24,
+	0x55, 0x49, 0x44, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x69,
+	0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x34, 0x3c, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65,
+	0x72, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09,
+	0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x61, 0x67, 0x65, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a,
+	0x09, 0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x34, 0x32, 0x3c, 0x2f,
+	0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63,
+	0x74, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c,
+	0x6b, 0x65, 0x79, 0x3e, 0x24, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x6e, 0x61, 0x6d, 0x65, 0x3c, 0x2f,
+	0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e,
+	0x50, 0x65, 0x72, 0x73, 0x6f, 0x6e, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a,
+	0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x24, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x65, 0x73,
+	0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x50, 0x65,
+	0x72, 0x73, 0x6f, 0x6e, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09,
+	0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x4e, 0x53, 0x4f, 0x62, 0x6a, 0x65,
+	0x63, 0x74, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c,
+	0x2f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74,
+	0x3e, 0x0a, 0x09, 0x3c, 0x2f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65,
+	0x79, 0x3e, 0x24, 0x74, 0x6f, 0x70, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x64,
+	0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x72, 0x6f, 0x6f, 0x74,
+	0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a,
+	0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x43, 0x46, 0x24, 0x55, 0x49, 0x44, 0x3c, 0x2f,
+	0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72,
+	0x3e, 0x31, 0x3c, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09, 0x3c,
+	0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a,
+	0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x24, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3c, 0x2f,
+	0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x31,
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a,
+	0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x3c, 0x2f, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x3e,
+	0x0a };
+
+uint8_t fplist_test_archive_data2[ 125 ] = {
+	0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31,
+	0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54,
+	0x46, 0x2d, 0x38, 0x22, 0x3f, 0x3e, 0x0a, 0x3c, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x76, 0x65,
+	0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69,
+	0x63, 0x74, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x4e, 0x61, 0x6d, 0x65, 0x3c, 0x2f,
+	0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x54, 0x65,
+	0x73, 0x74, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69,
+	0x63, 0x74, 0x3e, 0x0a, 0x3c, 0x2f, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x3e, 0x0a };
+
+/* Tests the libfplist_archive_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_archive_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfplist_archive_t *archive             = NULL;
+	libfplist_property_list_t *property_list = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
+
+	result = libfplist_property_list_copy_from_byte_stream(
+	          property_list,
+	          fplist_test_archive_data1,
+	          2977,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_archive_initialize(
+	          &archive,
+	          property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "archive",
+	 archive );
+
+	result = libfplist_archive_free(
+	          &archive,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "archive",
+	 archive );
+
+	/* Test error cases
+	 */
+	result = libfplist_archive_initialize(
+	          NULL,
+	          property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	archive = (libfplist_archive_t *) 0x12345678UL;
+
+	result = libfplist_archive_initialize(
+	          &archive,
+	          property_list,
+	          &error );
+
+	archive = NULL;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_archive_initialize(
+	          &archive,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test property list without $objects and $top
+	 */
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_copy_from_byte_stream(
+	          property_list,
+	          fplist_test_archive_data2,
+	          125,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_archive_initialize(
+	          &archive,
+	          property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "archive",
+	 archive );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property_list",
+	 property_list );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( archive != NULL )
+	{
+		libfplist_archive_free(
+		 &archive,
+		 NULL );
+	}
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_archive_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_archive_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfplist_archive_free(
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_archive_get_number_of_objects function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_archive_get_number_of_objects(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfplist_archive_t *archive             = NULL;
+	libfplist_property_list_t *property_list = NULL;
+	int number_of_objects                    = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
+
+	result = libfplist_property_list_copy_from_byte_stream(
+	          property_list,
+	          fplist_test_archive_data1,
+	          2977,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_archive_initialize(
+	          &archive,
+	          property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "archive",
+	 archive );
+
+	/* Test regular cases
+	 */
+	result = libfplist_archive_get_number_of_objects(
+	          archive,
+	          &number_of_objects,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "number_of_objects",
+	 number_of_objects,
+	 14 );
+
+	/* Test error cases
+	 */
+	result = libfplist_archive_get_number_of_objects(
+	          NULL,
+	          &number_of_objects,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_archive_get_number_of_objects(
+	          archive,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_archive_free(
+	          &archive,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "archive",
+	 archive );
+
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property_list",
+	 property_list );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( archive != NULL )
+	{
+		libfplist_archive_free(
+		 &archive,
+		 NULL );
+	}
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_archive_get_object_by_uid function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_archive_get_object_by_uid(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfplist_archive_t *archive             = NULL;
+	libfplist_property_t *property           = NULL;
+	libfplist_property_list_t *property_list = NULL;
+	libfplist_property_t *sub_property       = NULL;
+	uint64_t uid_value                       = 0;
+	int number_of_entries                    = 0;
+	int result                               = 0;
+	int value_type                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
+
+	result = libfplist_property_list_copy_from_byte_stream(
+	          property_list,
+	          fplist_test_archive_data1,
+	          2977,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_archive_initialize(
+	          &archive,
+	          property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "archive",
+	 archive );
+
+	/* Test regular cases
+	 */
+	result = libfplist_archive_get_object_by_uid(
+	          archive,
+	          5,
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	result = libfplist_property_get_value_type(
+	          property,
+	          &value_type,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "value_type",
+	 value_type,
+	 LIBFPLIST_VALUE_TYPE_ARRAY );
+
+	result = libfplist_property_get_array_number_of_entries(
+	          property,
+	          &number_of_entries,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 6 );
+
+	/* Test if a reference to the object that is being decoded remains an UID
+	 */
+	result = libfplist_property_get_array_entry_by_index(
+	          property,
+	          4,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	result = libfplist_property_get_value_uid(
+	          sub_property,
+	          &uid_value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "uid_value",
+	 uid_value,
+	 (uint64_t) 5 );
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if a reference to $null remains an UID
+	 */
+	result = libfplist_property_get_array_entry_by_index(
+	          property,
+	          3,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	result = libfplist_property_get_value_uid(
+	          sub_property,
+	          &uid_value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "uid_value",
+	 uid_value,
+	 (uint64_t) 0 );
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if a decoded object is memoized
+	 */
+	result = libfplist_archive_get_object_by_uid(
+	          archive,
+	          5,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test $null
+	 */
+	result = libfplist_archive_get_object_by_uid(
+	          archive,
+	          0,
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	/* Test error cases
+	 */
+	result = libfplist_archive_get_object_by_uid(
+	          NULL,
+	          5,
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_archive_get_object_by_uid(
+	          archive,
+	          14,
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_archive_get_object_by_uid(
+	          archive,
+	          5,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_archive_free(
+	          &archive,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "archive",
+	 archive );
+
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property_list",
+	 property_list );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sub_property != NULL )
+	{
+		libfplist_property_free(
+		 &sub_property,
+		 NULL );
+	}
+	if( property != NULL )
+	{
+		libfplist_property_free(
+		 &property,
+		 NULL );
+	}
+	if( archive != NULL )
+	{
+		libfplist_archive_free(
+		 &archive,
+		 NULL );
+	}
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_archive_get_top_object_by_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_archive_get_top_object_by_utf8_name(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfplist_archive_t *archive             = NULL;
+	libfplist_property_t *array_property     = NULL;
+	libfplist_property_t *property           = NULL;
+	libfplist_property_list_t *property_list = NULL;
+	libfplist_property_t *sub_property       = NULL;
+	libfplist_property_t *value_property     = NULL;
+	uint8_t *string                          = NULL;
+	int64_t posix_time                       = 0;
+	size_t string_size                       = 0;
+	uint64_t value_64bit                     = 0;
+	int number_of_entries                    = 0;
+	int result                               = 0;
+	int value_type                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
+
+	result = libfplist_property_list_copy_from_byte_stream(
+	          property_list,
+	          fplist_test_archive_data1,
+	          2977,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_archive_initialize(
+	          &archive,
+	          property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "archive",
+	 archive );
+
+	/* Test regular cases
+	 */
+	result = libfplist_archive_get_top_object_by_utf8_name(
+	          archive,
+	          (uint8_t *) "root",
+	          4,
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	result = libfplist_property_get_value_type(
+	          property,
+	          &value_type,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "value_type",
+	 value_type,
+	 LIBFPLIST_VALUE_TYPE_DICTIONARY );
+
+	result = libfplist_property_get_number_of_entries(
+	          property,
+	          &number_of_entries,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          property,
+	          (uint8_t *) "Name",
+	          4,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	result = libfplist_property_get_value_string(
+	          sub_property,
+	          &string,
+	          &string_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 5 );
+
+	result = memory_compare(
+	          string,
+	          "Test",
+	          5 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 string );
+
+	string = NULL;
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          property,
+	          (uint8_t *) "Items",
+	          5,
+	          &array_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "array_property",
+	 array_property );
+
+	result = libfplist_property_get_value_type(
+	          array_property,
+	          &value_type,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "value_type",
+	 value_type,
+	 LIBFPLIST_VALUE_TYPE_ARRAY );
+
+	/* Test NSString object that was archived as a plain string
+	 */
+	result = libfplist_property_get_array_entry_by_index(
+	          array_property,
+	          0,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	result = libfplist_property_get_value_string(
+	          sub_property,
+	          &string,
+	          &string_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 5 );
+
+	result = memory_compare(
+	          string,
+	          "Test",
+	          5 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 string );
+
+	string = NULL;
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test NSMutableString object
+	 */
+	result = libfplist_property_get_array_entry_by_index(
+	          array_property,
+	          1,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	result = libfplist_property_get_value_string(
+	          sub_property,
+	          &string,
+	          &string_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 8 );
+
+	result = memory_compare(
+	          string,
+	          "Mutable",
+	          8 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 string );
+
+	string = NULL;
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test NSDate object
+	 */
+	result = libfplist_property_get_array_entry_by_index(
+	          array_property,
+	          2,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	result = libfplist_property_get_value_date_time(
+	          sub_property,
+	          &posix_time,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 978307200000000000LL );
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test object of a custom class
+	 */
+	result = libfplist_property_get_array_entry_by_index(
+	          array_property,
+	          5,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	result = libfplist_property_get_value_type(
+	          sub_property,
+	          &value_type,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "value_type",
+	 value_type,
+	 LIBFPLIST_VALUE_TYPE_DICTIONARY );
+
+	result = libfplist_property_get_number_of_entries(
+	          sub_property,
+	          &number_of_entries,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          sub_property,
+	          (uint8_t *) "name",
+	          4,
+	          &value_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_property",
+	 value_property );
+
+	result = libfplist_property_get_value_string(
+	          value_property,
+	          &string,
+	          &string_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 5 );
+
+	result = memory_compare(
+	          string,
+	          "Test",
+	          5 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 string );
+
+	string = NULL;
+
+	result = libfplist_property_free(
+	          &value_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          sub_property,
+	          (uint8_t *) "age",
+	          3,
+	          &value_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_property",
+	 value_property );
+
+	result = libfplist_property_get_value_integer(
+	          value_property,
+	          &value_64bit,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 42 );
+
+	result = libfplist_property_free(
+	          &value_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &array_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_archive_get_top_object_by_utf8_name(
+	          archive,
+	          (uint8_t *) "bogus",
+	          5,
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	/* Test error cases
+	 */
+	result = libfplist_archive_get_top_object_by_utf8_name(
+	          NULL,
+	          (uint8_t *) "root",
+	          4,
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_archive_get_top_object_by_utf8_name(
+	          archive,
+	          (uint8_t *) "root",
+	          4,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_archive_free(
+	          &archive,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "archive",
+	 archive );
+
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property_list",
+	 property_list );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value_property != NULL )
+	{
+		libfplist_property_free(
+		 &value_property,
+		 NULL );
+	}
+	if( sub_property != NULL )
+	{
+		libfplist_property_free(
+		 &sub_property,
+		 NULL );
+	}
+	if( array_property != NULL )
+	{
+		libfplist_property_free(
+		 &array_property,
+		 NULL );
+	}
+	if( property != NULL )
+	{
+		libfplist_property_free(
+		 &property,
+		 NULL );
+	}
+	if( archive != NULL )
+	{
+		libfplist_archive_free(
+		 &archive,
+		 NULL );
+	}
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argc )
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FPLIST_TEST_RUN(
+	 "libfplist_archive_initialize",
+	 fplist_test_archive_initialize );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_archive_free",
+	 fplist_test_archive_free );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_archive_get_number_of_objects",
+	 fplist_test_archive_get_number_of_objects );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_archive_get_object_by_uid",
+	 fplist_test_archive_get_object_by_uid );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_archive_get_top_object_by_utf8_name",
+	 fplist_test_archive_get_top_object_by_utf8_name );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,956 @@
+/*
+ * Library base64 functions test program
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fplist_test_libcerror.h"
+#include "fplist_test_libfplist.h"
+#include "fplist_test_macros.h"
+#include "fplist_test_unused.h"
+
+#include "../libfplist/libfplist_base64.h"
+
+/* Base64 encoded bytes 0x00 - 0xff formatted as in a XML plist
+ */
+uint8_t fplist_test_base64_data1[ 358 ] =
+	"\n"
+	"\tAAECAwQFBgcICQoLDA0ODxAREhMUFRYXGBkaGxwdHh8gISIjJCUmJygpKissLS4v\n"
+	"\tMDEyMzQ1Njc4OTo7PD0+P0BBQkNERUZHSElKS0xNTk9QUVJTVFVWV1hZWltcXV5f\n"
+	"\tYGFiY2RlZmdoaWprbG1ub3BxcnN0dXZ3eHl6e3x9fn+AgYKDhIWGh4iJiouMjY6P\n"
+	"\tkJGSk5SVlpeYmZqbnJ2en6ChoqOkpaanqKmqq6ytrq+wsbKztLW2t7i5uru8vb6/\n"
+	"\twMHCw8TFxsfIycrLzM3Oz9DR0tPU1dbX2Nna29zd3t/g4eLj5OXm5+jp6uvs7e7v\n"
+	"\t8PHy8/T19vf4+fr7/P3+/w==\n";
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+/* Tests the libfplist_base64_stream_decode function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_base64_stream_decode(
+     void )
+{
+	uint8_t byte_stream[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	size_t byte_stream_index = 0;
+	int byte_value           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_base64_stream_decode(
+	          (uint8_t *) "SGVsbG8sIHdvcmxkIQ==",
+	          20,
+	          byte_stream,
+	          256,
+	          &byte_stream_index,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_index",
+	 byte_stream_index,
+	 (size_t) 13 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          "Hello, world!",
+	          13 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfplist_base64_stream_decode(
+	          (uint8_t *) "\n\tSGVs\n\tbG8s IHdv\r\ncmxkIQ=\t=\n",
+	          29,
+	          byte_stream,
+	          256,
+	          &byte_stream_index,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_index",
+	 byte_stream_index,
+	 (size_t) 13 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          "Hello, world!",
+	          13 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfplist_base64_stream_decode(
+	          (uint8_t *) "SGVsbG8=",
+	          8,
+	          byte_stream,
+	          256,
+	          &byte_stream_index,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_index",
+	 byte_stream_index,
+	 (size_t) 5 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_base64_stream_decode(
+	          fplist_test_base64_data1,
+	          357,
+	          byte_stream,
+	          256,
+	          &byte_stream_index,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_index",
+	 byte_stream_index,
+	 (size_t) 256 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		FPLIST_TEST_ASSERT_EQUAL_UINT8(
+		 "byte_stream[ byte_value ]",
+		 byte_stream[ byte_value ],
+		 (uint8_t) byte_value );
+	}
+	/* Test determining the size only
+	 */
+	result = libfplist_base64_stream_decode(
+	          fplist_test_base64_data1,
+	          357,
+	          NULL,
+	          0,
+	          &byte_stream_index,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_index",
+	 byte_stream_index,
+	 (size_t) 256 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_base64_stream_decode(
+	          NULL,
+	          20,
+	          byte_stream,
+	          256,
+	          &byte_stream_index,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_base64_stream_decode(
+	          (uint8_t *) "SGVsbG8sIHdvcmxkIQ==",
+	          (size_t) SSIZE_MAX + 1,
+	          byte_stream,
+	          256,
+	          &byte_stream_index,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_base64_stream_decode(
+	          (uint8_t *) "SGVsbG8sIHdvcmxkIQ==",
+	          20,
+	          byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          &byte_stream_index,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_base64_stream_decode(
+	          (uint8_t *) "SGVsbG8sIHdvcmxkIQ==",
+	          20,
+	          byte_stream,
+	          256,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decoding with a byte stream that is too small
+	 */
+	result = libfplist_base64_stream_decode(
+	          (uint8_t *) "SGVsbG8sIHdvcmxkIQ==",
+	          20,
+	          byte_stream,
+	          12,
+	          &byte_stream_index,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_base64_stream_decode(
+	          fplist_test_base64_data1,
+	          357,
+	          byte_stream,
+	          255,
+	          &byte_stream_index,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decoding with an invalid character
+	 */
+	result = libfplist_base64_stream_decode(
+	          (uint8_t *) "SGVs*G8sIHdvcmxkIQ==",
+	          20,
+	          byte_stream,
+	          256,
+	          &byte_stream_index,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decoding with missing padding
+	 */
+	result = libfplist_base64_stream_decode(
+	          (uint8_t *) "SGVsbG8",
+	          7,
+	          byte_stream,
+	          256,
+	          &byte_stream_index,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decoding with invalid padding
+	 */
+	result = libfplist_base64_stream_decode(
+	          (uint8_t *) "SGVsb===",
+	          8,
+	          byte_stream,
+	          256,
+	          &byte_stream_index,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_base64_stream_decode(
+	          (uint8_t *) "SGVsbG=v",
+	          8,
+	          byte_stream,
+	          256,
+	          &byte_stream_index,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decoding with data after the padding
+	 */
+	result = libfplist_base64_stream_decode(
+	          (uint8_t *) "SGVsbG8=SGVs",
+	          12,
+	          byte_stream,
+	          256,
+	          &byte_stream_index,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_base64_stream_size_to_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_base64_stream_size_to_byte_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t byte_stream_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_base64_stream_size_to_byte_stream(
+	          fplist_test_base64_data1,
+	          357,
+	          &byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 256 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_base64_stream_size_to_byte_stream(
+	          NULL,
+	          0,
+	          &byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_base64_stream_size_to_byte_stream(
+	          fplist_test_base64_data1,
+	          357,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_base64_stream_copy_to_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_base64_stream_copy_to_byte_stream(
+     void )
+{
+	uint8_t byte_stream[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_base64_stream_copy_to_byte_stream(
+	          fplist_test_base64_data1,
+	          357,
+	          byte_stream,
+	          256,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "byte_stream[ 255 ]",
+	 byte_stream[ 255 ],
+	 (uint8_t) 0xff );
+
+	/* Test error cases
+	 */
+	result = libfplist_base64_stream_copy_to_byte_stream(
+	          fplist_test_base64_data1,
+	          357,
+	          NULL,
+	          256,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_base64_stream_copy_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_base64_stream_copy_from_byte_stream(
+     void )
+{
+	uint8_t base64_stream[ 32 ];
+
+	libcerror_error_t *error  = NULL;
+	size_t base64_stream_size = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_base64_stream_size_from_byte_stream(
+	          13,
+	          &base64_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "base64_stream_size",
+	 base64_stream_size,
+	 (size_t) 20 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_base64_stream_copy_from_byte_stream(
+	          base64_stream,
+	          32,
+	          (uint8_t *) "Hello, world!",
+	          13,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          base64_stream,
+	          "SGVsbG8sIHdvcmxkIQ==",
+	          20 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfplist_base64_stream_size_from_byte_stream(
+	          13,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_base64_stream_copy_from_byte_stream(
+	          NULL,
+	          32,
+	          (uint8_t *) "Hello, world!",
+	          13,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_base64_stream_copy_from_byte_stream(
+	          base64_stream,
+	          32,
+	          NULL,
+	          13,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test encoding with a base64 stream that is too small
+	 */
+	result = libfplist_base64_stream_copy_from_byte_stream(
+	          base64_stream,
+	          19,
+	          (uint8_t *) "Hello, world!",
+	          13,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_base64_stream_get_checkpoints function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_base64_stream_get_checkpoints(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	size_t *checkpoints       = NULL;
+	size_t byte_stream_size   = 0;
+	int number_of_checkpoints = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_base64_stream_get_checkpoints(
+	          fplist_test_base64_data1,
+	          357,
+	          &checkpoints,
+	          &number_of_checkpoints,
+	          &byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "checkpoints",
+	 checkpoints );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "number_of_checkpoints",
+	 number_of_checkpoints,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "checkpoints[ 0 ]",
+	 checkpoints[ 0 ],
+	 (size_t) 2 );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 256 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 checkpoints );
+
+	checkpoints = NULL;
+
+	/* Test error cases
+	 */
+	result = libfplist_base64_stream_get_checkpoints(
+	          fplist_test_base64_data1,
+	          357,
+	          NULL,
+	          &number_of_checkpoints,
+	          &byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_base64_stream_get_checkpoints(
+	          fplist_test_base64_data1,
+	          357,
+	          &checkpoints,
+	          NULL,
+	          &byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_base64_stream_get_checkpoints(
+	          fplist_test_base64_data1,
+	          357,
+	          &checkpoints,
+	          &number_of_checkpoints,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with data after the padding
+	 */
+	result = libfplist_base64_stream_get_checkpoints(
+	          (uint8_t *) "SGVsbG8=SGVs",
+	          12,
+	          &checkpoints,
+	          &number_of_checkpoints,
+	          &byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "checkpoints",
+	 checkpoints );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( checkpoints != NULL )
+	{
+		memory_free(
+		 checkpoints );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argc )
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+	FPLIST_TEST_RUN(
+	 "libfplist_base64_stream_decode",
+	 fplist_test_base64_stream_decode );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_base64_stream_size_to_byte_stream",
+	 fplist_test_base64_stream_size_to_byte_stream );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_base64_stream_copy_to_byte_stream",
+	 fplist_test_base64_stream_copy_to_byte_stream );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_base64_stream_copy_from_byte_stream",
+	 fplist_test_base64_stream_copy_from_byte_stream );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_base64_stream_get_checkpoints",
+	 fplist_test_base64_stream_get_checkpoints );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+}
+
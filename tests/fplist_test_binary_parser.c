@@ -0,0 +1,4320 @@
+/*
+ * Library binary parser functions test program
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include <locale.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fplist_test_libcerror.h"
+#include "fplist_test_libfplist.h"
+#include "fplist_test_macros.h"
+#include "fplist_test_unused.h"
+
+#include "../libfplist/libfplist_binary_parser.h"
+#include "../libfplist/libfplist_definitions.h"
+#include "../libfplist/libfplist_property.h"
+#include "../libfplist/libfplist_property_list.h"
+#include "../libfplist/libfplist_xml_tag.h"
+
+uint8_t fplist_test_binary_parser_data1[ 214 ] = {
+	0x62, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x30, 0x30, 0xd5, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0x0a, 0x5f, 0x10, 0x1b, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x2d, 0x62, 0x61, 0x63,
+	0x6b, 0x69, 0x6e, 0x67, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x2d, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+	0x6e, 0x5f, 0x10, 0x15, 0x64, 0x69, 0x73, 0x6b, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x2d, 0x62, 0x75,
+	0x6e, 0x64, 0x6c, 0x65, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x54, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x10,
+	0x1d, 0x43, 0x46, 0x42, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x49, 0x6e, 0x66, 0x6f, 0x44, 0x69, 0x63,
+	0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72, 0x79, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x59, 0x62,
+	0x61, 0x6e, 0x64, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x10, 0x01, 0x5f, 0x10, 0x20, 0x63, 0x6f, 0x6d,
+	0x2e, 0x61, 0x70, 0x70, 0x6c, 0x65, 0x2e, 0x64, 0x69, 0x73, 0x6b, 0x69, 0x6d, 0x61, 0x67, 0x65,
+	0x2e, 0x73, 0x70, 0x61, 0x72, 0x73, 0x65, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x12, 0x06, 0x1a,
+	0x80, 0x00, 0x53, 0x36, 0x2e, 0x30, 0x12, 0x00, 0x80, 0x00, 0x00, 0x08, 0x13, 0x31, 0x49, 0x4e,
+	0x6e, 0x78, 0x7a, 0x9d, 0xa2, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xab };
+
+uint8_t fplist_test_binary_parser_data2[ 203 ] = {
+	0x62, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x30, 0x30, 0xd9, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x12, 0x13, 0x14, 0x15, 0x53, 0x42, 0x69, 0x67, 0x54,
+	0x44, 0x61, 0x74, 0x61, 0x54, 0x44, 0x61, 0x74, 0x65, 0x57, 0x45, 0x6e, 0x61, 0x62, 0x6c, 0x65,
+	0x64, 0x55, 0x49, 0x74, 0x65, 0x6d, 0x73, 0x54, 0x4e, 0x61, 0x6d, 0x65, 0x58, 0x4e, 0x65, 0x67,
+	0x61, 0x74, 0x69, 0x76, 0x65, 0x54, 0x52, 0x65, 0x61, 0x6c, 0x53, 0x52, 0x65, 0x66, 0x14, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44,
+	0x74, 0x65, 0x73, 0x74, 0x33, 0x41, 0xbd, 0xb4, 0xc6, 0x5d, 0x80, 0x00, 0x00, 0x09, 0xa3, 0x0f,
+	0x10, 0x11, 0x10, 0x01, 0x10, 0x02, 0x10, 0x03, 0x64, 0x00, 0x54, 0x00, 0xe9, 0x00, 0x73, 0x00,
+	0x74, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x23, 0x3f, 0xf8, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0x07, 0x08, 0x1b, 0x1f, 0x24, 0x29, 0x31, 0x37, 0x3c, 0x45, 0x4a, 0x4e,
+	0x5f, 0x64, 0x6d, 0x6e, 0x72, 0x74, 0x76, 0x78, 0x81, 0x8a, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95 };
+
+/* Binary property list with an array that references itself
+ */
+uint8_t fplist_test_binary_parser_data3[ 43 ] = {
+	0x62, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x30, 0x30, 0xa1, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a };
+
+/* Binary property list with 3 levels of arrays that reference the previous level twice
+ */
+uint8_t fplist_test_binary_parser_data4[ 54 ] = {
+	0x62, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x30, 0x30, 0x08, 0xa2, 0x00, 0x00, 0xa2, 0x01, 0x01, 0xa2,
+	0x02, 0x02, 0x08, 0x09, 0x0c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x12 };
+
+/* Binary property list with 24 levels of arrays that reference the previous level twice
+ */
+uint8_t fplist_test_binary_parser_data5[ 138 ] = {
+	0x62, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x30, 0x30, 0x08, 0xa2, 0x00, 0x00, 0xa2, 0x01, 0x01, 0xa2,
+	0x02, 0x02, 0xa2, 0x03, 0x03, 0xa2, 0x04, 0x04, 0xa2, 0x05, 0x05, 0xa2, 0x06, 0x06, 0xa2, 0x07,
+	0x07, 0xa2, 0x08, 0x08, 0xa2, 0x09, 0x09, 0xa2, 0x0a, 0x0a, 0xa2, 0x0b, 0x0b, 0xa2, 0x0c, 0x0c,
+	0xa2, 0x0d, 0x0d, 0xa2, 0x0e, 0x0e, 0xa2, 0x0f, 0x0f, 0xa2, 0x10, 0x10, 0xa2, 0x11, 0x11, 0xa2,
+	0x12, 0x12, 0xa2, 0x13, 0x13, 0xa2, 0x14, 0x14, 0xa2, 0x15, 0x15, 0xa2, 0x16, 0x16, 0xa2, 0x17,
+	0x17, 0x08, 0x09, 0x0c, 0x0f, 0x12, 0x15, 0x18, 0x1b, 0x1e, 0x21, 0x24, 0x27, 0x2a, 0x2d, 0x30,
+	0x33, 0x36, 0x39, 0x3c, 0x3f, 0x42, 0x45, 0x48, 0x4b, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51 };
+
+/* Binary property list (bplist17) with a dict that contains an UTF-8 string, an UUID,
+ * an ordered set with a fill byte and a null element, a null value, a negative 128-bit integer and an URL
+ */
+uint8_t fplist_test_binary_parser_data6[ 101 ] = {
+	0x62, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x31, 0x37, 0x11, 0x00, 0x65, 0x12, 0x00, 0x00, 0x00, 0x00,
+	0xd6, 0x54, 0x4e, 0x61, 0x6d, 0x65, 0x54, 0x55, 0x55, 0x49, 0x44, 0x53, 0x53, 0x65, 0x74, 0x54,
+	0x4e, 0x75, 0x6c, 0x6c, 0x53, 0x42, 0x69, 0x67, 0x53, 0x55, 0x52, 0x4c, 0x75, 0x54, 0xc3, 0xa9,
+	0x73, 0x74, 0x0e, 0xc3, 0x1c, 0x54, 0x34, 0x7b, 0xa4, 0x4f, 0xfa, 0xbd, 0x67, 0x99, 0xd9, 0x7a,
+	0x0a, 0xda, 0x0e, 0xb3, 0x10, 0x01, 0x0f, 0x00, 0x09, 0x00, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0c, 0x58, 0x68, 0x74, 0x74,
+	0x70, 0x3a, 0x2f, 0x2f, 0x78 };
+
+/* Binary property list with 20 levels of arrays that reference the previous level twice
+ */
+uint8_t fplist_test_binary_parser_data7[ 122 ] = {
+	0x62, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x30, 0x30, 0x08, 0xa2, 0x00, 0x00, 0xa2, 0x01, 0x01, 0xa2,
+	0x02, 0x02, 0xa2, 0x03, 0x03, 0xa2, 0x04, 0x04, 0xa2, 0x05, 0x05, 0xa2, 0x06, 0x06, 0xa2, 0x07,
+	0x07, 0xa2, 0x08, 0x08, 0xa2, 0x09, 0x09, 0xa2, 0x0a, 0x0a, 0xa2, 0x0b, 0x0b, 0xa2, 0x0c, 0x0c,
+	0xa2, 0x0d, 0x0d, 0xa2, 0x0e, 0x0e, 0xa2, 0x0f, 0x0f, 0xa2, 0x10, 0x10, 0xa2, 0x11, 0x11, 0xa2,
+	0x12, 0x12, 0xa2, 0x13, 0x13, 0x08, 0x09, 0x0c, 0x0f, 0x12, 0x15, 0x18, 0x1b, 0x1e, 0x21, 0x24,
+	0x27, 0x2a, 0x2d, 0x30, 0x33, 0x36, 0x39, 0x3c, 0x3f, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45 };
+
+/* Binary property list with a dict that contains an entry with a null value
+ * and an array that contains a null element
+ */
+uint8_t fplist_test_binary_parser_data8[ 60 ] = {
+	0x62, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x30, 0x30, 0xd2, 0x01, 0x02, 0x03, 0x04, 0x51, 0x61, 0x51,
+	0x62, 0x00, 0xa2, 0x03, 0x05, 0x09, 0x08, 0x0d, 0x0f, 0x11, 0x12, 0x15, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16 };
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+/* The IO handle used to test reading data on demand
+ */
+typedef struct fplist_test_binary_parser_io_handle fplist_test_binary_parser_io_handle_t;
+
+struct fplist_test_binary_parser_io_handle
+{
+	/* The data
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The number of reads
+	 */
+	int number_of_reads;
+};
+
+/* Reads data from the test IO handle
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t fplist_test_binary_parser_read_buffer_at_offset(
+         intptr_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error FPLIST_TEST_ATTRIBUTE_UNUSED )
+{
+	fplist_test_binary_parser_io_handle_t *test_io_handle = NULL;
+
+	FPLIST_TEST_UNREFERENCED_PARAMETER( error )
+
+	test_io_handle = (fplist_test_binary_parser_io_handle_t *) io_handle;
+
+	if( ( test_io_handle == NULL )
+	 || ( buffer == NULL )
+	 || ( offset < 0 )
+	 || ( (size_t) offset > test_io_handle->data_size )
+	 || ( size > ( test_io_handle->data_size - (size_t) offset ) ) )
+	{
+		return( -1 );
+	}
+	memory_copy(
+	 buffer,
+	 &( test_io_handle->data[ offset ] ),
+	 size );
+
+	test_io_handle->number_of_reads += 1;
+
+	return( (ssize_t) size );
+}
+
+/* Tests the libfplist_binary_parser_state_initialize_with_read_function function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_binary_parser_state_initialize_with_read_function(
+     void )
+{
+	fplist_test_binary_parser_io_handle_t io_handle;
+
+	libcerror_error_t *error                       = NULL;
+	libfplist_binary_parser_state_t *parser_state = NULL;
+	libfplist_xml_tag_t *element_tag               = NULL;
+	libfplist_xml_tag_t *root_tag                  = NULL;
+	int number_of_elements                         = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	io_handle.data            = fplist_test_binary_parser_data2;
+	io_handle.data_size       = 203;
+	io_handle.number_of_reads = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_binary_parser_state_initialize_with_read_function(
+	          &parser_state,
+	          (intptr_t *) &io_handle,
+	          &fplist_test_binary_parser_read_buffer_at_offset,
+	          203,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "parser_state->buffer",
+	 parser_state->buffer );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "parser_state->number_of_objects",
+	 parser_state->number_of_objects,
+	 (uint64_t) 22 );
+
+	result = libfplist_binary_parser_read_object(
+	          parser_state,
+	          parser_state->root_object,
+	          0,
+	          &root_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "root_tag",
+	 root_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_parser_read_elements(
+	          parser_state,
+	          root_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_get_number_of_elements(
+	          root_tag,
+	          &number_of_elements,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 18 );
+
+	/* The data of a data object is copied since the data read is not retained
+	 */
+	result = libfplist_xml_tag_get_element(
+	          root_tag,
+	          3,
+	          &element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "element_tag",
+	 element_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "element_tag->managed_value_data",
+	 element_tag->managed_value_data );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "element_tag->value_data_size",
+	 element_tag->value_data_size,
+	 (size_t) 4 );
+
+	result = memory_compare(
+	          element_tag->value_data_reference,
+	          "test",
+	          4 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The binary property list fits in a single cache block
+	 */
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "io_handle.number_of_reads",
+	 io_handle.number_of_reads,
+	 1 );
+
+	result = libfplist_xml_tag_free(
+	          &root_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "root_tag",
+	 root_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_parser_state_free(
+	          &parser_state,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_binary_parser_state_initialize_with_read_function(
+	          NULL,
+	          (intptr_t *) &io_handle,
+	          &fplist_test_binary_parser_read_buffer_at_offset,
+	          203,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_binary_parser_state_initialize_with_read_function(
+	          &parser_state,
+	          (intptr_t *) &io_handle,
+	          NULL,
+	          203,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a data size that exceeds the data of the IO handle
+	 */
+	result = libfplist_binary_parser_state_initialize_with_read_function(
+	          &parser_state,
+	          (intptr_t *) &io_handle,
+	          &fplist_test_binary_parser_read_buffer_at_offset,
+	          204,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data that is not a binary property list
+	 */
+	io_handle.data = &( fplist_test_binary_parser_data2[ 1 ] );
+
+	result = libfplist_binary_parser_state_initialize_with_read_function(
+	          &parser_state,
+	          (intptr_t *) &io_handle,
+	          &fplist_test_binary_parser_read_buffer_at_offset,
+	          202,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "parser_state",
+	 parser_state );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( root_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &root_tag,
+		 NULL );
+	}
+	if( parser_state != NULL )
+	{
+		libfplist_binary_parser_state_free(
+		 &parser_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_binary_parser_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_binary_parser_read_data(
+     void )
+{
+	libfplist_binary_parser_cache_block_t cache_blocks[ LIBFPLIST_BINARY_PARSER_CACHE_NUMBER_OF_BLOCKS ];
+	fplist_test_binary_parser_io_handle_t io_handle;
+	libfplist_binary_parser_state_t parser_state;
+
+	libcerror_error_t *error = NULL;
+	const uint8_t *data      = NULL;
+	uint8_t *test_data       = NULL;
+	size_t data_index        = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	test_data = (uint8_t *) memory_allocate(
+	                         3 * LIBFPLIST_BINARY_PARSER_CACHE_BLOCK_SIZE );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "test_data",
+	 test_data );
+
+	for( data_index = 0;
+	     data_index < ( 3 * LIBFPLIST_BINARY_PARSER_CACHE_BLOCK_SIZE );
+	     data_index++ )
+	{
+		test_data[ data_index ] = (uint8_t) ( data_index % 251 );
+	}
+	io_handle.data            = test_data;
+	io_handle.data_size       = 3 * LIBFPLIST_BINARY_PARSER_CACHE_BLOCK_SIZE;
+	io_handle.number_of_reads = 0;
+
+	memory_set(
+	 cache_blocks,
+	 0,
+	 sizeof( libfplist_binary_parser_cache_block_t ) * LIBFPLIST_BINARY_PARSER_CACHE_NUMBER_OF_BLOCKS );
+
+	memory_set(
+	 &parser_state,
+	 0,
+	 sizeof( libfplist_binary_parser_state_t ) );
+
+	parser_state.io_handle             = (intptr_t *) &io_handle;
+	parser_state.read_buffer_at_offset = &fplist_test_binary_parser_read_buffer_at_offset;
+	parser_state.cache_blocks          = cache_blocks;
+	parser_state.data_size             = 3 * LIBFPLIST_BINARY_PARSER_CACHE_BLOCK_SIZE;
+
+	/* Test regular cases
+	 */
+	result = libfplist_binary_parser_read_data(
+	          &parser_state,
+	          10,
+	          8,
+	          &data,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 0 ]",
+	 data[ 0 ],
+	 10 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "io_handle.number_of_reads",
+	 io_handle.number_of_reads,
+	 1 );
+
+	/* Test data that is stored in a cached block
+	 */
+	result = libfplist_binary_parser_read_data(
+	          &parser_state,
+	          20,
+	          8,
+	          &data,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 0 ]",
+	 data[ 0 ],
+	 20 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "io_handle.number_of_reads",
+	 io_handle.number_of_reads,
+	 1 );
+
+	/* Test data that spans multiple blocks
+	 */
+	result = libfplist_binary_parser_read_data(
+	          &parser_state,
+	          4090,
+	          12,
+	          &data,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 0 ]",
+	 data[ 0 ],
+	 74 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "io_handle.number_of_reads",
+	 io_handle.number_of_reads,
+	 2 );
+
+	result = libfplist_binary_parser_read_data(
+	          &parser_state,
+	          ( 2 * LIBFPLIST_BINARY_PARSER_CACHE_BLOCK_SIZE ) + 5,
+	          4,
+	          &data,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 0 ]",
+	 data[ 0 ],
+	 165 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "io_handle.number_of_reads",
+	 io_handle.number_of_reads,
+	 3 );
+
+	result = libfplist_binary_parser_read_data(
+	          &parser_state,
+	          5,
+	          4,
+	          &data,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 0 ]",
+	 data[ 0 ],
+	 5 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "io_handle.number_of_reads",
+	 io_handle.number_of_reads,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libfplist_binary_parser_read_data(
+	          NULL,
+	          0,
+	          8,
+	          &data,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_binary_parser_read_data(
+	          &parser_state,
+	          ( 3 * LIBFPLIST_BINARY_PARSER_CACHE_BLOCK_SIZE ) + 1,
+	          0,
+	          &data,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_binary_parser_read_data(
+	          &parser_state,
+	          ( 3 * LIBFPLIST_BINARY_PARSER_CACHE_BLOCK_SIZE ) - 4,
+	          8,
+	          &data,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_binary_parser_read_data(
+	          &parser_state,
+	          0,
+	          8,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a read function that fails
+	 */
+	io_handle.data_size = 0;
+
+	result = libfplist_binary_parser_read_data(
+	          &parser_state,
+	          LIBFPLIST_BINARY_PARSER_CACHE_BLOCK_SIZE,
+	          8,
+	          &data,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	if( parser_state.read_buffer != NULL )
+	{
+		memory_free(
+		 parser_state.read_buffer );
+	}
+	memory_free(
+	 test_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parser_state.read_buffer != NULL )
+	{
+		memory_free(
+		 parser_state.read_buffer );
+	}
+	if( test_data != NULL )
+	{
+		memory_free(
+		 test_data );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_binary_parser_read_trailer function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_binary_parser_read_trailer(
+     void )
+{
+	libfplist_binary_parser_state_t parser_state;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &parser_state,
+	 0,
+	 sizeof( libfplist_binary_parser_state_t ) );
+
+	parser_state.buffer    = fplist_test_binary_parser_data1;
+	parser_state.data_size = 214;
+
+	/* Test regular cases
+	 */
+	result = libfplist_binary_parser_read_trailer(
+	          &parser_state,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "parser_state.offset_size",
+	 parser_state.offset_size,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "parser_state.object_reference_size",
+	 parser_state.object_reference_size,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "parser_state.number_of_objects",
+	 parser_state.number_of_objects,
+	 (uint64_t) 11 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "parser_state.root_object",
+	 parser_state.root_object,
+	 (uint64_t) 0 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "parser_state.offset_table_offset",
+	 parser_state.offset_table_offset,
+	 (uint64_t) 171 );
+
+	/* Test error cases
+	 */
+	result = libfplist_binary_parser_read_trailer(
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	parser_state.data_size = 32;
+
+	result = libfplist_binary_parser_read_trailer(
+	          &parser_state,
+	          &error );
+
+	parser_state.data_size = 214;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_binary_parser_read_header function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_binary_parser_read_header(
+     void )
+{
+	uint8_t data[ 101 ];
+
+	libfplist_binary_parser_state_t parser_state;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &parser_state,
+	 0,
+	 sizeof( libfplist_binary_parser_state_t ) );
+
+	parser_state.buffer    = fplist_test_binary_parser_data1;
+	parser_state.data_size = 214;
+
+	/* Test regular cases
+	 */
+	result = libfplist_binary_parser_read_header(
+	          &parser_state,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "parser_state.format_version",
+	 parser_state.format_version,
+	 0 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "parser_state.offset_table_offset",
+	 parser_state.offset_table_offset,
+	 (uint64_t) 171 );
+
+	memory_set(
+	 &parser_state,
+	 0,
+	 sizeof( libfplist_binary_parser_state_t ) );
+
+	parser_state.buffer    = fplist_test_binary_parser_data6;
+	parser_state.data_size = 101;
+
+	result = libfplist_binary_parser_read_header(
+	          &parser_state,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "parser_state.format_version",
+	 parser_state.format_version,
+	 17 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "parser_state.offset_table_offset",
+	 parser_state.offset_table_offset,
+	 (uint64_t) 101 );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "parser_state.root_object_offset",
+	 parser_state.root_object_offset,
+	 (size_t) 16 );
+
+	/* Test error cases
+	 */
+	result = libfplist_binary_parser_read_header(
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	parser_state.data_size = 100;
+
+	result = libfplist_binary_parser_read_header(
+	          &parser_state,
+	          &error );
+
+	parser_state.data_size = 101;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = memory_copy(
+	          data,
+	          fplist_test_binary_parser_data6,
+	          101 ) != NULL;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	parser_state.buffer = data;
+
+	/* Test an unsupported format version
+	 */
+	data[ 7 ] = (uint8_t) '8';
+
+	result = libfplist_binary_parser_read_header(
+	          &parser_state,
+	          &error );
+
+	data[ 7 ] = (uint8_t) '7';
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an unsupported CRC-32 integer marker
+	 */
+	data[ 11 ] = 0x13;
+
+	result = libfplist_binary_parser_read_header(
+	          &parser_state,
+	          &error );
+
+	data[ 11 ] = 0x12;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_binary_parser_state_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_binary_parser_state_initialize(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfplist_binary_parser_state_t *parser_state = NULL;
+	int result                                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_binary_parser_state_initialize(
+	          &parser_state,
+	          fplist_test_binary_parser_data1,
+	          214,
+	          0,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "parser_state->number_of_objects",
+	 parser_state->number_of_objects,
+	 (uint64_t) 11 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "parser_state->managed_buffer",
+	 parser_state->managed_buffer );
+
+	result = libfplist_binary_parser_state_free(
+	          &parser_state,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_parser_state_initialize(
+	          &parser_state,
+	          fplist_test_binary_parser_data1,
+	          214,
+	          LIBFPLIST_BINARY_PARSER_FLAG_MANAGED_BUFFER,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "parser_state->managed_buffer",
+	 parser_state->managed_buffer );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "parser_state->buffer",
+	 (void *) ( parser_state->buffer == parser_state->managed_buffer ? parser_state->buffer : NULL ) );
+
+	result = libfplist_binary_parser_state_free(
+	          &parser_state,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_binary_parser_state_initialize(
+	          NULL,
+	          fplist_test_binary_parser_data1,
+	          214,
+	          0,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	parser_state = (libfplist_binary_parser_state_t *) 0x12345678UL;
+
+	result = libfplist_binary_parser_state_initialize(
+	          &parser_state,
+	          fplist_test_binary_parser_data1,
+	          214,
+	          0,
+	          &error );
+
+	parser_state = NULL;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_binary_parser_state_initialize(
+	          &parser_state,
+	          NULL,
+	          214,
+	          0,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_binary_parser_state_initialize(
+	          &parser_state,
+	          fplist_test_binary_parser_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_binary_parser_state_initialize(
+	          &parser_state,
+	          &( fplist_test_binary_parser_data1[ 1 ] ),
+	          213,
+	          0,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_binary_parser_state_initialize(
+	          &parser_state,
+	          fplist_test_binary_parser_data1,
+	          40,
+	          0,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "parser_state",
+	 parser_state );
+
+	result = libfplist_binary_parser_state_free(
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parser_state != NULL )
+	{
+		libfplist_binary_parser_state_free(
+		 &parser_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_binary_parser_read_elements function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_binary_parser_read_elements(
+     void )
+{
+	fplist_test_binary_parser_io_handle_t io_handle;
+
+	libcerror_error_t *error                       = NULL;
+	libfplist_binary_parser_state_t *parser_state = NULL;
+	libfplist_xml_tag_t *element_tag               = NULL;
+	libfplist_xml_tag_t *root_tag                  = NULL;
+	libfplist_xml_tag_t *tag                       = NULL;
+	uint64_t number_of_expanded_objects            = 0;
+	int depth                                      = 0;
+	int number_of_elements                         = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_binary_parser_state_initialize(
+	          &parser_state,
+	          fplist_test_binary_parser_data1,
+	          214,
+	          0,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_parser_read_object(
+	          parser_state,
+	          parser_state->root_object,
+	          0,
+	          &root_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "root_tag",
+	 root_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The elements of the root dict are not read until accessed
+	 */
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "root_tag->binary_parser_state",
+	 root_tag->binary_parser_state );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "root_tag->number_of_entries",
+	 root_tag->number_of_entries,
+	 5 );
+
+	/* Test regular cases
+	 */
+	result = libfplist_binary_parser_read_elements(
+	          parser_state,
+	          root_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "root_tag->binary_parser_state",
+	 root_tag->binary_parser_state );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "root_tag->number_of_entries",
+	 root_tag->number_of_entries,
+	 5 );
+
+	result = libfplist_xml_tag_get_number_of_elements(
+	          root_tag,
+	          &number_of_elements,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A dict contains key and value elements
+	 */
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 10 );
+
+	/* Test error cases
+	 */
+	result = libfplist_binary_parser_read_elements(
+	          NULL,
+	          root_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_binary_parser_read_elements(
+	          parser_state,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test reading an element that is not an array or dict
+	 */
+	result = libfplist_xml_tag_get_element(
+	          root_tag,
+	          0,
+	          &element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "element_tag",
+	 element_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_parser_read_elements(
+	          parser_state,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	element_tag = NULL;
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &root_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "root_tag",
+	 root_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_parser_state_free(
+	          &parser_state,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an array that references itself, which is read one level at a time
+	 */
+	result = libfplist_binary_parser_state_initialize(
+	          &parser_state,
+	          fplist_test_binary_parser_data3,
+	          43,
+	          0,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_parser_read_object(
+	          parser_state,
+	          parser_state->root_object,
+	          0,
+	          &root_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "root_tag",
+	 root_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	tag = root_tag;
+
+	for( depth = 0;
+	     depth < 8;
+	     depth++ )
+	{
+		result = libfplist_xml_tag_get_element(
+		          tag,
+		          0,
+		          &element_tag,
+		          &error );
+
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FPLIST_TEST_ASSERT_IS_NOT_NULL(
+		 "element_tag",
+		 element_tag );
+
+		FPLIST_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FPLIST_TEST_ASSERT_IS_NOT_NULL(
+		 "element_tag->binary_parser_state",
+		 element_tag->binary_parser_state );
+
+		tag = element_tag;
+	}
+	element_tag = NULL;
+	tag         = NULL;
+
+	result = libfplist_xml_tag_free(
+	          &root_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "root_tag",
+	 root_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_parser_state_free(
+	          &parser_state,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test null elements and dict entries with a null value, which are omitted
+	 */
+	result = libfplist_binary_parser_state_initialize(
+	          &parser_state,
+	          fplist_test_binary_parser_data8,
+	          60,
+	          0,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_parser_validate(
+	          parser_state,
+	          &number_of_expanded_objects,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_parser_read_root_object(
+	          parser_state,
+	          &root_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "root_tag",
+	 root_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_get_number_of_entries(
+	          root_tag,
+	          &number_of_elements,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_get_element(
+	          root_tag,
+	          1,
+	          &element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "element_tag",
+	 element_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_get_number_of_elements(
+	          element_tag,
+	          &number_of_elements,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_xml_tag_free(
+	          &root_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "root_tag",
+	 root_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_parser_state_free(
+	          &parser_state,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test shared objects read using a read function, which are not validated upfront
+	 * but of which the number of objects read is bounded
+	 */
+	io_handle.data            = fplist_test_binary_parser_data7;
+	io_handle.data_size       = 122;
+	io_handle.number_of_reads = 0;
+
+	result = libfplist_binary_parser_state_initialize_with_read_function(
+	          &parser_state,
+	          (intptr_t *) &io_handle,
+	          &fplist_test_binary_parser_read_buffer_at_offset,
+	          122,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "parser_state->maximum_number_of_expanded_objects",
+	 parser_state->maximum_number_of_expanded_objects,
+	 (uint64_t) 328 );
+
+	result = libfplist_binary_parser_read_root_object(
+	          parser_state,
+	          &root_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "root_tag",
+	 root_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_get_element(
+	          root_tag,
+	          0,
+	          &element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "element_tag",
+	 element_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "parser_state->number_of_read_objects",
+	 parser_state->number_of_read_objects,
+	 (uint64_t) 3 );
+
+	/* Test if a failing read does not count the elements as read
+	 */
+	parser_state->cache_blocks[ 0 ].data_size = 0;
+	io_handle.data_size                       = 0;
+
+	result = libfplist_binary_parser_read_elements(
+	          parser_state,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "parser_state->number_of_read_objects",
+	 parser_state->number_of_read_objects,
+	 (uint64_t) 3 );
+
+	io_handle.data_size = 122;
+
+	result = libfplist_xml_tag_get_element(
+	          element_tag,
+	          0,
+	          &tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "tag",
+	 tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "parser_state->number_of_read_objects",
+	 parser_state->number_of_read_objects,
+	 (uint64_t) 5 );
+
+	element_tag = tag;
+	tag         = NULL;
+
+	/* Test if reading more objects than the maximum number of expanded objects fails
+	 */
+	parser_state->number_of_read_objects = parser_state->maximum_number_of_expanded_objects - 1;
+
+	result = libfplist_binary_parser_read_elements(
+	          parser_state,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	element_tag = NULL;
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &root_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "root_tag",
+	 root_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_parser_state_free(
+	          &parser_state,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( root_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &root_tag,
+		 NULL );
+	}
+	if( parser_state != NULL )
+	{
+		libfplist_binary_parser_state_free(
+		 &parser_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_binary_parser_read_root_object function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_binary_parser_read_root_object(
+     void )
+{
+	uint8_t data[ 101 ];
+
+	fplist_test_binary_parser_io_handle_t io_handle;
+
+	libcerror_error_t *error                       = NULL;
+	libfplist_binary_parser_state_t *parser_state = NULL;
+	libfplist_xml_tag_t *root_tag                  = NULL;
+	uint64_t number_of_expanded_objects            = 0;
+	int number_of_elements                         = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_binary_parser_state_initialize(
+	          &parser_state,
+	          fplist_test_binary_parser_data6,
+	          101,
+	          0,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_binary_parser_read_root_object(
+	          parser_state,
+	          &root_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "root_tag",
+	 root_tag );
+
+	/* The elements of a bplist17 dict are stored inline and read directly,
+	 * the entry with a null value is omitted
+	 */
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "root_tag->binary_parser_state",
+	 root_tag->binary_parser_state );
+
+	result = libfplist_xml_tag_get_number_of_elements(
+	          root_tag,
+	          &number_of_elements,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 10 );
+
+	/* Test error cases
+	 */
+	result = libfplist_binary_parser_read_root_object(
+	          NULL,
+	          &root_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_binary_parser_read_root_object(
+	          parser_state,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libfplist_binary_parser_read_root_object with tag value already set
+	 */
+	result = libfplist_binary_parser_read_root_object(
+	          parser_state,
+	          &root_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_xml_tag_free(
+	          &root_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_parser_state_free(
+	          &parser_state,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading data on demand
+	 */
+	io_handle.data            = fplist_test_binary_parser_data6;
+	io_handle.data_size       = 101;
+	io_handle.number_of_reads = 0;
+
+	result = libfplist_binary_parser_state_initialize_with_read_function(
+	          &parser_state,
+	          (intptr_t *) &io_handle,
+	          &fplist_test_binary_parser_read_buffer_at_offset,
+	          101,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_parser_read_root_object(
+	          parser_state,
+	          &root_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "root_tag",
+	 root_tag );
+
+	result = libfplist_xml_tag_get_number_of_elements(
+	          root_tag,
+	          &number_of_elements,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 10 );
+
+	result = libfplist_xml_tag_free(
+	          &root_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_parser_state_free(
+	          &parser_state,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a null root object
+	 */
+	result = memory_copy(
+	          data,
+	          fplist_test_binary_parser_data6,
+	          101 ) != NULL;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	data[ 16 ] = 0x00;
+
+	result = libfplist_binary_parser_state_initialize(
+	          &parser_state,
+	          data,
+	          101,
+	          0,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_parser_read_root_object(
+	          parser_state,
+	          &root_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "root_tag",
+	 root_tag );
+
+	/* Test an element that extends beyond the end of the objects
+	 */
+	data[ 16 ] = 0xd6;
+	data[ 92 ] = 0x59;
+
+	result = libfplist_binary_parser_read_root_object(
+	          parser_state,
+	          &root_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "root_tag",
+	 root_tag );
+
+	/* Test that a bplist17 property list is not validated
+	 */
+	result = libfplist_binary_parser_validate(
+	          parser_state,
+	          &number_of_expanded_objects,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_binary_parser_state_free(
+	          &parser_state,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( root_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &root_tag,
+		 NULL );
+	}
+	if( parser_state != NULL )
+	{
+		libfplist_binary_parser_state_free(
+		 &parser_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_binary_parser_validate function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_binary_parser_validate(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfplist_binary_parser_state_t *parser_state = NULL;
+	uint64_t number_of_expanded_objects            = 0;
+	int result                                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_binary_parser_state_initialize(
+	          &parser_state,
+	          fplist_test_binary_parser_data2,
+	          203,
+	          0,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_parser_validate(
+	          parser_state,
+	          &number_of_expanded_objects,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_expanded_objects",
+	 number_of_expanded_objects,
+	 (uint64_t) 22 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "parser_state->visited_objects_bitmap",
+	 parser_state->visited_objects_bitmap );
+
+	/* Test error cases
+	 */
+	result = libfplist_binary_parser_validate(
+	          NULL,
+	          &number_of_expanded_objects,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_binary_parser_validate(
+	          parser_state,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_binary_parser_state_free(
+	          &parser_state,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an array that references itself
+	 */
+	result = libfplist_binary_parser_state_initialize(
+	          &parser_state,
+	          fplist_test_binary_parser_data3,
+	          43,
+	          0,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_parser_validate(
+	          parser_state,
+	          &number_of_expanded_objects,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_binary_parser_state_free(
+	          &parser_state,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test shared objects, which are validated once
+	 */
+	result = libfplist_binary_parser_state_initialize(
+	          &parser_state,
+	          fplist_test_binary_parser_data4,
+	          54,
+	          0,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_parser_validate(
+	          parser_state,
+	          &number_of_expanded_objects,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_expanded_objects",
+	 number_of_expanded_objects,
+	 (uint64_t) 15 );
+
+	result = libfplist_binary_parser_state_free(
+	          &parser_state,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test shared objects that expand into too many objects
+	 */
+	result = libfplist_binary_parser_state_initialize(
+	          &parser_state,
+	          fplist_test_binary_parser_data5,
+	          138,
+	          0,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_parser_validate(
+	          parser_state,
+	          &number_of_expanded_objects,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_binary_parser_state_free(
+	          &parser_state,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test shared objects that expand into more objects than a small multiple
+	 * of the size of the binary property list
+	 */
+	result = libfplist_binary_parser_state_initialize(
+	          &parser_state,
+	          fplist_test_binary_parser_data7,
+	          122,
+	          0,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_parser_validate(
+	          parser_state,
+	          &number_of_expanded_objects,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_binary_parser_state_free(
+	          &parser_state,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "parser_state",
+	 parser_state );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parser_state != NULL )
+	{
+		libfplist_binary_parser_state_free(
+		 &parser_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests reading the values of a binary property list through the property functions
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_binary_parser_read_values(
+     void )
+{
+	uint8_t data[ 4 ];
+
+	libcerror_error_t *error                 = NULL;
+	libfplist_property_list_t *property_list = NULL;
+	libfplist_property_t *root_property      = NULL;
+	libfplist_property_t *sub_property       = NULL;
+	libfplist_property_t *uid_property       = NULL;
+	uint8_t *string                          = NULL;
+	double floating_point_value              = 0.0;
+	size_t string_size                       = 0;
+	uint64_t lower_64bit                     = 0;
+	uint64_t upper_64bit                     = 0;
+	int64_t posix_time                       = 0;
+	int64_t signed_64bit                     = 0;
+	uint8_t boolean_value                    = 0;
+	int number_of_entries                    = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_copy_from_byte_stream(
+	          property_list,
+	          fplist_test_binary_parser_data2,
+	          203,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_get_root_property(
+	          property_list,
+	          &root_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "root_property",
+	 root_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an UTF-16 string value
+	 */
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "Name",
+	          4,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_string(
+	          sub_property,
+	          &string,
+	          &string_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 6 );
+
+	result = memory_compare(
+	          string,
+	          "T\xc3\xa9st",
+	          6 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 string );
+
+	string = NULL;
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a data value
+	 */
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "Data",
+	          4,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_data(
+	          sub_property,
+	          data,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "test",
+	          4 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a date and time value
+	 */
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "Date",
+	          4,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_date_time(
+	          sub_property,
+	          &posix_time,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1476693725500000000LL );
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a floating point value
+	 */
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "Real",
+	          4,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_floating_point(
+	          sub_property,
+	          &floating_point_value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_FLOAT(
+	 "floating_point_value",
+	 floating_point_value,
+	 1.5 );
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a negative integer value
+	 */
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "Negative",
+	          8,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_signed_integer(
+	          sub_property,
+	          &signed_64bit,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT64(
+	 "signed_64bit",
+	 signed_64bit,
+	 (int64_t) -5 );
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a 128-bit integer value
+	 */
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "Big",
+	          3,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_128bit_integer(
+	          sub_property,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "upper_64bit",
+	 upper_64bit,
+	 (uint64_t) 0 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "lower_64bit",
+	 lower_64bit,
+	 (uint64_t) 0xffffffffffffffffULL );
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a boolean value
+	 */
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "Enabled",
+	          7,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_boolean(
+	          sub_property,
+	          &boolean_value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "boolean_value",
+	 boolean_value,
+	 1 );
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an array value
+	 */
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "Items",
+	          5,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_array_number_of_entries(
+	          sub_property,
+	          &number_of_entries,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 3 );
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an UID value
+	 */
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "Ref",
+	          3,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          sub_property,
+	          (uint8_t *) "CF$UID",
+	          6,
+	          &uid_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "uid_property",
+	 uid_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_signed_integer(
+	          uid_property,
+	          &signed_64bit,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT64(
+	 "signed_64bit",
+	 signed_64bit,
+	 (int64_t) 7 );
+
+	result = libfplist_property_free(
+	          &uid_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_free(
+	          &root_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string != NULL )
+	{
+		memory_free(
+		 string );
+	}
+	if( uid_property != NULL )
+	{
+		libfplist_property_free(
+		 &uid_property,
+		 NULL );
+	}
+	if( sub_property != NULL )
+	{
+		libfplist_property_free(
+		 &sub_property,
+		 NULL );
+	}
+	if( root_property != NULL )
+	{
+		libfplist_property_free(
+		 &root_property,
+		 NULL );
+	}
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Sets LC_NUMERIC to a locale that uses a decimal comma
+ * Returns 1 if successful or 0 if no such locale is available
+ */
+int fplist_test_binary_parser_set_decimal_comma_locale(
+     void )
+{
+	const char *locale_names[ 8 ] = {
+		"de_DE.UTF-8", "de_DE.utf8", "de_DE", "fr_FR.UTF-8",
+		"fr_FR.utf8", "fr_FR", "nl_NL.UTF-8", "nl_NL.utf8" };
+
+	struct lconv *locale_conventions = NULL;
+	int locale_index                 = 0;
+
+	for( locale_index = 0;
+	     locale_index < 8;
+	     locale_index++ )
+	{
+		if( setlocale(
+		     LC_NUMERIC,
+		     locale_names[ locale_index ] ) == NULL )
+		{
+			continue;
+		}
+		locale_conventions = localeconv();
+
+		if( ( locale_conventions != NULL )
+		 && ( locale_conventions->decimal_point != NULL )
+		 && ( locale_conventions->decimal_point[ 0 ] == ',' ) )
+		{
+			return( 1 );
+		}
+	}
+	setlocale(
+	 LC_NUMERIC,
+	 "C" );
+
+	return( 0 );
+}
+
+/* Tests reading a floating point value of a bplist00 property list when LC_NUMERIC uses a decimal comma
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_binary_parser_read_values_with_locale(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfplist_property_list_t *property_list = NULL;
+	libfplist_property_t *root_property      = NULL;
+	libfplist_property_t *sub_property       = NULL;
+	double floating_point_value              = 0.0;
+	int result                               = 0;
+
+	if( fplist_test_binary_parser_set_decimal_comma_locale() == 0 )
+	{
+		fprintf(
+		 stdout,
+		 "(no decimal comma locale available, skipping) " );
+
+		return( 1 );
+	}
+	/* Initialize test
+	 */
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_copy_from_byte_stream(
+	          property_list,
+	          fplist_test_binary_parser_data2,
+	          203,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_get_root_property(
+	          property_list,
+	          &root_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "root_property",
+	 root_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a floating point value
+	 */
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "Real",
+	          4,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_floating_point(
+	          sub_property,
+	          &floating_point_value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_FLOAT(
+	 "floating_point_value",
+	 floating_point_value,
+	 1.5 );
+
+	/* Clean up
+	 */
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &root_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	setlocale(
+	 LC_NUMERIC,
+	 "C" );
+
+	return( 1 );
+
+on_error:
+	setlocale(
+	 LC_NUMERIC,
+	 "C" );
+
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sub_property != NULL )
+	{
+		libfplist_property_free(
+		 &sub_property,
+		 NULL );
+	}
+	if( root_property != NULL )
+	{
+		libfplist_property_free(
+		 &root_property,
+		 NULL );
+	}
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests reading the values of a bplist17 property list
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_binary_parser_read_inline_values(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfplist_property_list_t *property_list = NULL;
+	libfplist_property_t *root_property      = NULL;
+	libfplist_property_t *sub_property       = NULL;
+	uint8_t *string                          = NULL;
+	size_t string_size                       = 0;
+	uint64_t lower_64bit                     = 0;
+	uint64_t upper_64bit                     = 0;
+	int number_of_entries                    = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_copy_from_byte_stream(
+	          property_list,
+	          fplist_test_binary_parser_data6,
+	          101,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_get_root_property(
+	          property_list,
+	          &root_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "root_property",
+	 root_property );
+
+	/* Test an UTF-8 string value
+	 */
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "Name",
+	          4,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	result = libfplist_property_get_value_string(
+	          sub_property,
+	          &string,
+	          &string_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 6 );
+
+	result = memory_compare(
+	          string,
+	          "T\xc3\xa9st",
+	          6 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 string );
+
+	string = NULL;
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an UUID value
+	 */
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "UUID",
+	          4,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	result = libfplist_property_get_value_string(
+	          sub_property,
+	          &string,
+	          &string_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 37 );
+
+	result = memory_compare(
+	          string,
+	          "C31C5434-7BA4-4FFA-BD67-99D97A0ADA0E",
+	          37 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 string );
+
+	string = NULL;
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an ordered set value, where the fill byte and the null element are omitted
+	 */
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "Set",
+	          3,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	result = libfplist_property_get_array_number_of_entries(
+	          sub_property,
+	          &number_of_entries,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an entry with a null value is omitted
+	 */
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "Null",
+	          4,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "sub_property",
+	 sub_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a 128-bit integer value
+	 */
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "Big",
+	          3,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	result = libfplist_property_get_value_128bit_integer(
+	          sub_property,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "upper_64bit",
+	 upper_64bit,
+	 (uint64_t) 0xffffffffffffffffULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "lower_64bit",
+	 lower_64bit,
+	 (uint64_t) 0xfffffffffffffffeULL );
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an URL value
+	 */
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "URL",
+	          3,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	result = libfplist_property_get_value_string(
+	          sub_property,
+	          &string,
+	          &string_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 9 );
+
+	result = memory_compare(
+	          string,
+	          "http://x",
+	          9 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 string );
+
+	string = NULL;
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_free(
+	          &root_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string != NULL )
+	{
+		memory_free(
+		 string );
+	}
+	if( sub_property != NULL )
+	{
+		libfplist_property_free(
+		 &sub_property,
+		 NULL );
+	}
+	if( root_property != NULL )
+	{
+		libfplist_property_free(
+		 &root_property,
+		 NULL );
+	}
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argc )
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+	FPLIST_TEST_RUN(
+	 "libfplist_binary_parser_state_initialize",
+	 fplist_test_binary_parser_state_initialize );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_binary_parser_state_initialize_with_read_function",
+	 fplist_test_binary_parser_state_initialize_with_read_function );
+
+	/* TODO: add tests for libfplist_binary_parser_state_free */
+
+	FPLIST_TEST_RUN(
+	 "libfplist_binary_parser_read_data",
+	 fplist_test_binary_parser_read_data );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_binary_parser_read_header",
+	 fplist_test_binary_parser_read_header );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_binary_parser_read_trailer",
+	 fplist_test_binary_parser_read_trailer );
+
+	/* TODO: add tests for libfplist_binary_parser_get_object_offset */
+
+	/* TODO: add tests for libfplist_binary_parser_get_object_reference */
+
+	/* TODO: add tests for libfplist_binary_parser_get_object_size */
+
+	/* TODO: add tests for libfplist_binary_parser_read_object_at_offset */
+
+	/* TODO: add tests for libfplist_binary_parser_read_object */
+
+	/* TODO: add tests for libfplist_binary_parser_read_inline_object */
+
+	/* TODO: add tests for libfplist_binary_parser_read_inline_elements */
+
+	/* TODO: add tests for libfplist_binary_parser_append_dict_entry */
+
+	FPLIST_TEST_RUN(
+	 "libfplist_binary_parser_read_root_object",
+	 fplist_test_binary_parser_read_root_object );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_binary_parser_read_elements",
+	 fplist_test_binary_parser_read_elements );
+
+	/* TODO: add tests for libfplist_binary_parser_validate_object */
+
+	FPLIST_TEST_RUN(
+	 "libfplist_binary_parser_validate",
+	 fplist_test_binary_parser_validate );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_binary_parser_read_values",
+	 fplist_test_binary_parser_read_values );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_binary_parser_read_values_with_locale",
+	 fplist_test_binary_parser_read_values_with_locale );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_binary_parser_read_inline_values",
+	 fplist_test_binary_parser_read_inline_values );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+}
+
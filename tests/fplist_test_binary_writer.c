@@ -0,0 +1,951 @@
+/*
+ * Library binary writer functions test program
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fplist_test_libcerror.h"
+#include "fplist_test_libfplist.h"
+#include "fplist_test_macros.h"
+#include "fplist_test_memory.h"
+#include "fplist_test_unused.h"
+
+#include "../libfplist/libfplist_binary_writer.h"
+#include "../libfplist/libfplist_property_list.h"
+
+uint8_t fplist_test_binary_writer_data1[ 700 ] = {
+	0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31,
+	0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54,
+	0x46, 0x2d, 0x38, 0x22, 0x3f, 0x3e, 0x0a, 0x3c, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x76, 0x65,
+	0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69,
+	0x63, 0x74, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x4e, 0x61, 0x6d, 0x65, 0x3c, 0x2f,
+	0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x4e, 0x61,
+	0x6d, 0x65, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65,
+	0x79, 0x3e, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09,
+	0x3c, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e,
+	0x67, 0x3e, 0x61, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x3c,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x62, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x61, 0x3c, 0x2f, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+	0x3e, 0x62, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x61, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e,
+	0x0a, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x62, 0x3c, 0x2f, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e,
+	0x61, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x3e, 0x62, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a,
+	0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x31, 0x3c, 0x2f, 0x69, 0x6e,
+	0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65,
+	0x72, 0x3e, 0x31, 0x3c, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09,
+	0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x2d, 0x31, 0x3c, 0x2f, 0x69, 0x6e, 0x74,
+	0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72,
+	0x3e, 0x32, 0x35, 0x36, 0x3c, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09,
+	0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x37, 0x30, 0x30, 0x30, 0x30, 0x3c,
+	0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74,
+	0x65, 0x67, 0x65, 0x72, 0x3e, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c,
+	0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x74, 0x72, 0x75,
+	0x65, 0x2f, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x74, 0x72, 0x75, 0x65, 0x2f, 0x3e, 0x0a, 0x09, 0x3c,
+	0x2f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x44, 0x61,
+	0x74, 0x61, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x3e,
+	0x64, 0x47, 0x56, 0x7a, 0x64, 0x41, 0x3d, 0x3d, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x3e, 0x0a,
+	0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x43, 0x6f, 0x70, 0x79, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e,
+	0x0a, 0x09, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x3e, 0x64, 0x47, 0x56, 0x7a, 0x64, 0x41, 0x3d, 0x3d,
+	0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x44, 0x61,
+	0x74, 0x65, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x64, 0x61, 0x74, 0x65, 0x3e,
+	0x32, 0x30, 0x31, 0x36, 0x2d, 0x31, 0x30, 0x2d, 0x31, 0x37, 0x54, 0x30, 0x38, 0x3a, 0x34, 0x32,
+	0x3a, 0x30, 0x35, 0x5a, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65,
+	0x79, 0x3e, 0x52, 0x65, 0x61, 0x6c, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x72,
+	0x65, 0x61, 0x6c, 0x3e, 0x30, 0x2e, 0x35, 0x3c, 0x2f, 0x72, 0x65, 0x61, 0x6c, 0x3e, 0x0a, 0x09,
+	0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x46, 0x6c, 0x61, 0x67, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a,
+	0x09, 0x3c, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x2f, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74,
+	0x3e, 0x0a, 0x3c, 0x2f, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x3e, 0x0a, 0x00 };
+
+/* Binary property list of data1 as written by other implementations
+ */
+uint8_t fplist_test_binary_writer_data1_binary[ 189 ] = {
+	0x62, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x30, 0x30, 0xd7, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x01, 0x08, 0x11, 0x11, 0x12, 0x13, 0x14, 0x54, 0x4e, 0x61, 0x6d, 0x65, 0x56, 0x56, 0x61, 0x6c,
+	0x75, 0x65, 0x73, 0x54, 0x44, 0x61, 0x74, 0x61, 0x54, 0x43, 0x6f, 0x70, 0x79, 0x54, 0x44, 0x61,
+	0x74, 0x65, 0x54, 0x52, 0x65, 0x61, 0x6c, 0x54, 0x46, 0x6c, 0x61, 0x67, 0xaf, 0x10, 0x10, 0x09,
+	0x0a, 0x09, 0x0a, 0x09, 0x0a, 0x09, 0x0a, 0x0b, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x10, 0x51,
+	0x61, 0x51, 0x62, 0x10, 0x01, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x01,
+	0x00, 0x12, 0x00, 0x01, 0x11, 0x70, 0x13, 0x00, 0x00, 0x00, 0x01, 0x2a, 0x05, 0xf2, 0x00, 0x09,
+	0x44, 0x74, 0x65, 0x73, 0x74, 0x33, 0x41, 0xbd, 0xb4, 0xc6, 0x5d, 0x00, 0x00, 0x00, 0x23, 0x3f,
+	0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x17, 0x1c, 0x23, 0x28, 0x2d, 0x32, 0x37,
+	0x3c, 0x4f, 0x51, 0x53, 0x55, 0x5e, 0x61, 0x66, 0x6f, 0x70, 0x75, 0x7e, 0x87, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88 };
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+/* Tests the libfplist_binary_writer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_binary_writer_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfplist_binary_writer_t *binary_writer = NULL;
+	int result                               = 0;
+
+#if defined( HAVE_FPLIST_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 1;
+	int number_of_memset_fail_tests          = 1;
+	int test_number                          = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfplist_binary_writer_initialize(
+	          &binary_writer,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "binary_writer",
+	 binary_writer );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_writer_free(
+	          &binary_writer,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "binary_writer",
+	 binary_writer );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_binary_writer_initialize(
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	binary_writer = (libfplist_binary_writer_t *) 0x12345678UL;
+
+	result = libfplist_binary_writer_initialize(
+	          &binary_writer,
+	          &error );
+
+	binary_writer = NULL;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FPLIST_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfplist_binary_writer_initialize with malloc failing
+		 */
+		fplist_test_malloc_attempts_before_fail = test_number;
+
+		result = libfplist_binary_writer_initialize(
+		          &binary_writer,
+		          &error );
+
+		if( fplist_test_malloc_attempts_before_fail != -1 )
+		{
+			fplist_test_malloc_attempts_before_fail = -1;
+
+			if( binary_writer != NULL )
+			{
+				libfplist_binary_writer_free(
+				 &binary_writer,
+				 NULL );
+			}
+		}
+		else
+		{
+			FPLIST_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FPLIST_TEST_ASSERT_IS_NULL(
+			 "binary_writer",
+			 binary_writer );
+
+			FPLIST_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfplist_binary_writer_initialize with memset failing
+		 */
+		fplist_test_memset_attempts_before_fail = test_number;
+
+		result = libfplist_binary_writer_initialize(
+		          &binary_writer,
+		          &error );
+
+		if( fplist_test_memset_attempts_before_fail != -1 )
+		{
+			fplist_test_memset_attempts_before_fail = -1;
+
+			if( binary_writer != NULL )
+			{
+				libfplist_binary_writer_free(
+				 &binary_writer,
+				 NULL );
+			}
+		}
+		else
+		{
+			FPLIST_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FPLIST_TEST_ASSERT_IS_NULL(
+			 "binary_writer",
+			 binary_writer );
+
+			FPLIST_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FPLIST_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( binary_writer != NULL )
+	{
+		libfplist_binary_writer_free(
+		 &binary_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_binary_writer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_binary_writer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfplist_binary_writer_free(
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_binary_writer_copy_object_marker function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_binary_writer_copy_object_marker(
+     void )
+{
+	uint8_t data[ 16 ];
+
+	libcerror_error_t *error  = NULL;
+	size_t object_marker_size = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_binary_writer_copy_object_marker(
+	          data,
+	          16,
+	          0xa0,
+	          14,
+	          &object_marker_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "object_marker_size",
+	 object_marker_size,
+	 (size_t) 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 0 ]",
+	 data[ 0 ],
+	 0xae );
+
+	result = libfplist_binary_writer_copy_object_marker(
+	          data,
+	          16,
+	          0xa0,
+	          15,
+	          &object_marker_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "object_marker_size",
+	 object_marker_size,
+	 (size_t) 3 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 0 ]",
+	 data[ 0 ],
+	 0xaf );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 1 ]",
+	 data[ 1 ],
+	 0x10 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 2 ]",
+	 data[ 2 ],
+	 0x0f );
+
+	result = libfplist_binary_writer_copy_object_marker(
+	          data,
+	          16,
+	          0xa0,
+	          300,
+	          &object_marker_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "object_marker_size",
+	 object_marker_size,
+	 (size_t) 4 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 0 ]",
+	 data[ 0 ],
+	 0xaf );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 1 ]",
+	 data[ 1 ],
+	 0x11 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 2 ]",
+	 data[ 2 ],
+	 0x01 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 3 ]",
+	 data[ 3 ],
+	 0x2c );
+
+	result = libfplist_binary_writer_copy_object_marker(
+	          NULL,
+	          0,
+	          0xa0,
+	          70000,
+	          &object_marker_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "object_marker_size",
+	 object_marker_size,
+	 (size_t) 6 );
+
+	/* Test error cases
+	 */
+	result = libfplist_binary_writer_copy_object_marker(
+	          data,
+	          16,
+	          0xa0,
+	          14,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_binary_writer_copy_object_marker(
+	          data,
+	          2,
+	          0xa0,
+	          15,
+	          &object_marker_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_binary_writer_copy_to_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_binary_writer_copy_to_byte_stream(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfplist_binary_writer_t *binary_writer = NULL;
+	libfplist_property_list_t *property_list = NULL;
+	uint8_t *byte_stream                     = NULL;
+	uint8_t *rewritten_byte_stream           = NULL;
+	size_t byte_stream_size                  = 0;
+	size_t rewritten_byte_stream_size        = 0;
+	int root_object_index                    = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_copy_from_byte_stream(
+	          property_list,
+	          fplist_test_binary_writer_data1,
+	          700,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_writer_initialize(
+	          &binary_writer,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "binary_writer",
+	 binary_writer );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_binary_writer_add_tag(
+	          binary_writer,
+	          ( (libfplist_internal_property_list_t *) property_list )->dict_tag,
+	          0,
+	          &root_object_index,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "root_object_index",
+	 root_object_index,
+	 0 );
+
+	/* Test regular cases
+	 */
+	result = libfplist_binary_writer_copy_to_byte_stream(
+	          binary_writer,
+	          root_object_index,
+	          &byte_stream,
+	          &byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "byte_stream",
+	 byte_stream );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 189 );
+
+	result = memory_compare(
+	          byte_stream,
+	          fplist_test_binary_writer_data1_binary,
+	          189 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfplist_binary_writer_copy_to_byte_stream(
+	          NULL,
+	          root_object_index,
+	          &rewritten_byte_stream,
+	          &rewritten_byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_binary_writer_copy_to_byte_stream(
+	          binary_writer,
+	          -1,
+	          &rewritten_byte_stream,
+	          &rewritten_byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_binary_writer_copy_to_byte_stream(
+	          binary_writer,
+	          root_object_index,
+	          NULL,
+	          &rewritten_byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_binary_writer_copy_to_byte_stream(
+	          binary_writer,
+	          root_object_index,
+	          &rewritten_byte_stream,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_binary_writer_free(
+	          &binary_writer,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "binary_writer",
+	 binary_writer );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the written binary property list is written identically after it has been read
+	 */
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_copy_from_byte_stream(
+	          property_list,
+	          byte_stream,
+	          byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_write_binary(
+	          property_list,
+	          &rewritten_byte_stream,
+	          &rewritten_byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "rewritten_byte_stream",
+	 rewritten_byte_stream );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "rewritten_byte_stream_size",
+	 rewritten_byte_stream_size,
+	 byte_stream_size );
+
+	result = memory_compare(
+	          rewritten_byte_stream,
+	          byte_stream,
+	          byte_stream_size );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	memory_free(
+	 rewritten_byte_stream );
+
+	rewritten_byte_stream = NULL;
+
+	memory_free(
+	 byte_stream );
+
+	byte_stream = NULL;
+
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rewritten_byte_stream != NULL )
+	{
+		memory_free(
+		 rewritten_byte_stream );
+	}
+	if( byte_stream != NULL )
+	{
+		memory_free(
+		 byte_stream );
+	}
+	if( binary_writer != NULL )
+	{
+		libfplist_binary_writer_free(
+		 &binary_writer,
+		 NULL );
+	}
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argc )
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+	FPLIST_TEST_RUN(
+	 "libfplist_binary_writer_initialize",
+	 fplist_test_binary_writer_initialize );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_binary_writer_free",
+	 fplist_test_binary_writer_free );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_binary_writer_copy_object_marker",
+	 fplist_test_binary_writer_copy_object_marker );
+
+	/* TODO: add tests for libfplist_binary_writer_append_object_data */
+
+	/* TODO: add tests for libfplist_binary_writer_add_tag */
+
+	FPLIST_TEST_RUN(
+	 "libfplist_binary_writer_copy_to_byte_stream",
+	 fplist_test_binary_writer_copy_to_byte_stream );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,776 @@
+/*
+ * Library date and time functions test program
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fplist_test_libcerror.h"
+#include "fplist_test_libfplist.h"
+#include "fplist_test_macros.h"
+#include "fplist_test_memory.h"
+#include "fplist_test_unused.h"
+
+#include "../libfplist/libfplist_date_time.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+/* Tests the libfplist_date_time_copy_from_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_date_time_copy_from_utf8_string(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int64_t posix_time       = 0;
+	uint32_t nanoseconds     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_date_time_copy_from_utf8_string(
+	          (uint8_t *) "2016-10-17T08:42:05Z",
+	          20,
+	          &posix_time,
+	          &nanoseconds,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1476693725 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT32(
+	 "nanoseconds",
+	 nanoseconds,
+	 (uint32_t) 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_date_time_copy_from_utf8_string(
+	          (uint8_t *) "2000-02-29T23:59:59.125Z",
+	          24,
+	          &posix_time,
+	          &nanoseconds,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 951868799 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT32(
+	 "nanoseconds",
+	 nanoseconds,
+	 (uint32_t) 125000000 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_date_time_copy_from_utf8_string(
+	          (uint8_t *) "1601-01-01T00:00:00",
+	          19,
+	          &posix_time,
+	          &nanoseconds,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) -11644473600LL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test unsupported strings
+	 */
+	result = libfplist_date_time_copy_from_utf8_string(
+	          (uint8_t *) "2016-10-17",
+	          10,
+	          &posix_time,
+	          &nanoseconds,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_date_time_copy_from_utf8_string(
+	          (uint8_t *) "2015-02-29T00:00:00Z",
+	          20,
+	          &posix_time,
+	          &nanoseconds,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_date_time_copy_from_utf8_string(
+	          (uint8_t *) "2016-10-17T24:00:00Z",
+	          20,
+	          &posix_time,
+	          &nanoseconds,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_date_time_copy_from_utf8_string(
+	          (uint8_t *) "2016-10-17T08:42:05.Z",
+	          21,
+	          &posix_time,
+	          &nanoseconds,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_date_time_copy_from_utf8_string(
+	          (uint8_t *) "2016-10-17T08:42:05ZZ",
+	          21,
+	          &posix_time,
+	          &nanoseconds,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_date_time_copy_from_utf8_string(
+	          NULL,
+	          20,
+	          &posix_time,
+	          &nanoseconds,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_date_time_copy_from_utf8_string(
+	          (uint8_t *) "2016-10-17T08:42:05Z",
+	          (size_t) SSIZE_MAX + 1,
+	          &posix_time,
+	          &nanoseconds,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_date_time_copy_from_utf8_string(
+	          (uint8_t *) "2016-10-17T08:42:05Z",
+	          20,
+	          NULL,
+	          &nanoseconds,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_date_time_copy_from_utf8_string(
+	          (uint8_t *) "2016-10-17T08:42:05Z",
+	          20,
+	          &posix_time,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_date_time_copy_to_posix_time_in_nanoseconds function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_date_time_copy_to_posix_time_in_nanoseconds(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	int64_t posix_time_in_nanoseconds = 0;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_date_time_copy_to_posix_time_in_nanoseconds(
+	          (int64_t) 951868799,
+	          125000000,
+	          &posix_time_in_nanoseconds,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time_in_nanoseconds",
+	 posix_time_in_nanoseconds,
+	 (int64_t) 951868799125000000LL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_date_time_copy_to_posix_time_in_nanoseconds(
+	          (int64_t) -86400,
+	          500,
+	          &posix_time_in_nanoseconds,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time_in_nanoseconds",
+	 posix_time_in_nanoseconds,
+	 (int64_t) -86399999999500LL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a date and time that cannot be represented
+	 */
+	result = libfplist_date_time_copy_to_posix_time_in_nanoseconds(
+	          (int64_t) 9223372036LL,
+	          0,
+	          &posix_time_in_nanoseconds,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_date_time_copy_to_posix_time_in_nanoseconds(
+	          (int64_t) 951868799,
+	          0,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_date_time_copy_to_posix_time_in_nanoseconds(
+	          (int64_t) 951868799,
+	          1000000000,
+	          &posix_time_in_nanoseconds,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_date_time_copy_to_filetime function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_date_time_copy_to_filetime(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t filetime        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_date_time_copy_to_filetime(
+	          (int64_t) 1476693725,
+	          0,
+	          &filetime,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "filetime",
+	 filetime,
+	 (uint64_t) 131211673250000000ULL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_date_time_copy_to_filetime(
+	          (int64_t) -11644473600LL,
+	          125000000,
+	          &filetime,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "filetime",
+	 filetime,
+	 (uint64_t) 1250000 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a date and time that cannot be represented
+	 */
+	result = libfplist_date_time_copy_to_filetime(
+	          (int64_t) -11644473601LL,
+	          0,
+	          &filetime,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_date_time_copy_to_filetime(
+	          (int64_t) 1476693725,
+	          0,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_date_time_copy_to_filetime(
+	          (int64_t) 1476693725,
+	          1000000000,
+	          &filetime,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_date_time_copy_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_date_time_copy_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_date_time_copy_to_utf8_string(
+	          (int64_t) 1476693725,
+	          0,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "2016-10-17T08:42:05Z",
+	          21 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfplist_date_time_copy_to_utf8_string(
+	          (int64_t) 1476693725,
+	          500000000,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "2016-10-17T08:42:05.5Z",
+	          23 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfplist_date_time_copy_to_utf8_string(
+	          (int64_t) -1,
+	          0,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "1969-12-31T23:59:59Z",
+	          21 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfplist_date_time_copy_to_utf8_string(
+	          (int64_t) 300000000000LL,
+	          0,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_date_time_copy_to_utf8_string(
+	          (int64_t) 1476693725,
+	          0,
+	          NULL,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_date_time_copy_to_utf8_string(
+	          (int64_t) 1476693725,
+	          0,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_date_time_copy_to_utf8_string(
+	          (int64_t) 1476693725,
+	          0,
+	          utf8_string,
+	          8,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_date_time_copy_to_utf8_string(
+	          (int64_t) 1476693725,
+	          1000000000,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argc )
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+	FPLIST_TEST_RUN(
+	 "libfplist_date_time_copy_from_utf8_string",
+	 fplist_test_date_time_copy_from_utf8_string );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_date_time_copy_to_posix_time_in_nanoseconds",
+	 fplist_test_date_time_copy_to_posix_time_in_nanoseconds );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_date_time_copy_to_filetime",
+	 fplist_test_date_time_copy_to_filetime );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_date_time_copy_to_utf8_string",
+	 fplist_test_date_time_copy_to_utf8_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+}
+
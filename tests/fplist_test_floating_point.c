@@ -0,0 +1,933 @@
+/*
+ * Library floating point functions test program
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fplist_test_libcerror.h"
+#include "fplist_test_libfplist.h"
+#include "fplist_test_macros.h"
+#include "fplist_test_memory.h"
+#include "fplist_test_unused.h"
+
+#include "../libfplist/libfplist_floating_point.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+/* Tests the libfplist_floating_point_copy_from_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_floating_point_copy_from_utf8_string(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t value_64bit     = 0;
+	double value             = 0.0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "3.14",
+	          4,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_copy(
+	 &value_64bit,
+	 &value,
+	 sizeof( double ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x40091eb851eb851fULL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "-0.5",
+	          4,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_copy(
+	 &value_64bit,
+	 &value,
+	 sizeof( double ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0xbfe0000000000000ULL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "1e10",
+	          4,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_copy(
+	 &value_64bit,
+	 &value,
+	 sizeof( double ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x4202a05f20000000ULL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) ".25",
+	          3,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_copy(
+	 &value_64bit,
+	 &value,
+	 sizeof( double ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x3fd0000000000000ULL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "0.1",
+	          3,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_copy(
+	 &value_64bit,
+	 &value,
+	 sizeof( double ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x3fb999999999999aULL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "1.7976931348623157e308",
+	          22,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_copy(
+	 &value_64bit,
+	 &value,
+	 sizeof( double ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x7fefffffffffffffULL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "4.9e-324",
+	          8,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_copy(
+	 &value_64bit,
+	 &value,
+	 sizeof( double ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x0000000000000001ULL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "2.2250738585072011e-308",
+	          23,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_copy(
+	 &value_64bit,
+	 &value,
+	 sizeof( double ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x000fffffffffffffULL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "9007199254740993",
+	          16,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_copy(
+	 &value_64bit,
+	 &value,
+	 sizeof( double ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x4340000000000000ULL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "123456789012345678901234567890e-10",
+	          34,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_copy(
+	 &value_64bit,
+	 &value,
+	 sizeof( double ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x43e56a95319d63e1ULL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test values that are out of range
+	 */
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "1e400",
+	          5,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_copy(
+	 &value_64bit,
+	 &value,
+	 sizeof( double ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x7ff0000000000000ULL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "-1e-400",
+	          7,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_copy(
+	 &value_64bit,
+	 &value,
+	 sizeof( double ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x8000000000000000ULL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test special values
+	 */
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "nan",
+	          3,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_copy(
+	 &value_64bit,
+	 &value,
+	 sizeof( double ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x7ff8000000000000ULL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "inf",
+	          3,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_copy(
+	 &value_64bit,
+	 &value,
+	 sizeof( double ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x7ff0000000000000ULL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "-inf",
+	          4,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_copy(
+	 &value_64bit,
+	 &value,
+	 sizeof( double ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0xfff0000000000000ULL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "+Infinity",
+	          9,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_copy(
+	 &value_64bit,
+	 &value,
+	 sizeof( double ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x7ff0000000000000ULL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test unsupported strings
+	 */
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "abc",
+	          3,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "1.2.3",
+	          5,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "1e",
+	          2,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "-",
+	          1,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "1,5",
+	          3,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "infinite",
+	          8,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          NULL,
+	          3,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "1.5",
+	          (size_t) SSIZE_MAX + 1,
+	          &value,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_floating_point_copy_from_utf8_string(
+	          (uint8_t *) "1.5",
+	          3,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_floating_point_copy_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_floating_point_copy_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	double value             = 0.0;
+	uint64_t value_bits      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_floating_point_copy_to_utf8_string(
+	          1.5,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "1.5",
+	          4 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfplist_floating_point_copy_to_utf8_string(
+	          -0.25,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "-0.25",
+	          6 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfplist_floating_point_copy_to_utf8_string(
+	          0.1,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "0.10000000000000001",
+	          20 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfplist_floating_point_copy_to_utf8_string(
+	          1.0e300,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "1.0000000000000001e+300",
+	          24 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	value_bits = 0x7ff0000000000000ULL;
+
+	memory_copy(
+	 &value,
+	 &value_bits,
+	 sizeof( double ) );
+
+	result = libfplist_floating_point_copy_to_utf8_string(
+	          value,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "+infinity",
+	          10 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	value_bits = 0xfff0000000000000ULL;
+
+	memory_copy(
+	 &value,
+	 &value_bits,
+	 sizeof( double ) );
+
+	result = libfplist_floating_point_copy_to_utf8_string(
+	          value,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "-infinity",
+	          10 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	value_bits = 0x7ff8000000000000ULL;
+
+	memory_copy(
+	 &value,
+	 &value_bits,
+	 sizeof( double ) );
+
+	result = libfplist_floating_point_copy_to_utf8_string(
+	          value,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "nan",
+	          4 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfplist_floating_point_copy_to_utf8_string(
+	          1.5,
+	          NULL,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_floating_point_copy_to_utf8_string(
+	          1.5,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_floating_point_copy_to_utf8_string(
+	          1.5,
+	          utf8_string,
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argc )
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+	FPLIST_TEST_RUN(
+	 "libfplist_floating_point_copy_from_utf8_string",
+	 fplist_test_floating_point_copy_from_utf8_string );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_floating_point_copy_to_utf8_string",
+	 fplist_test_floating_point_copy_to_utf8_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+}
+
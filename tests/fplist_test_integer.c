@@ -0,0 +1,865 @@
+/*
+ * Library integer functions test program
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fplist_test_libcerror.h"
+#include "fplist_test_libfplist.h"
+#include "fplist_test_macros.h"
+#include "fplist_test_memory.h"
+#include "fplist_test_unused.h"
+
+#include "../libfplist/libfplist_integer.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+/* Tests the libfplist_integer_copy_from_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_integer_copy_from_utf8_string(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t lower_64bit     = 0;
+	uint64_t upper_64bit     = 0;
+	uint8_t is_negative      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "1234567890",
+	          10,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "upper_64bit",
+	 upper_64bit,
+	 (uint64_t) 0x0000000000000000ULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "lower_64bit",
+	 lower_64bit,
+	 (uint64_t) 0x00000000499602d2ULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "is_negative",
+	 is_negative,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "-42",
+	          3,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "upper_64bit",
+	 upper_64bit,
+	 (uint64_t) 0x0000000000000000ULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "lower_64bit",
+	 lower_64bit,
+	 (uint64_t) 0x000000000000002aULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "is_negative",
+	 is_negative,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "+7",
+	          2,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "upper_64bit",
+	 upper_64bit,
+	 (uint64_t) 0x0000000000000000ULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "lower_64bit",
+	 lower_64bit,
+	 (uint64_t) 0x0000000000000007ULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "is_negative",
+	 is_negative,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "0x7fFF",
+	          6,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "upper_64bit",
+	 upper_64bit,
+	 (uint64_t) 0x0000000000000000ULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "lower_64bit",
+	 lower_64bit,
+	 (uint64_t) 0x0000000000007fffULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "is_negative",
+	 is_negative,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "-0x10",
+	          5,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "upper_64bit",
+	 upper_64bit,
+	 (uint64_t) 0x0000000000000000ULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "lower_64bit",
+	 lower_64bit,
+	 (uint64_t) 0x0000000000000010ULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "is_negative",
+	 is_negative,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "-0",
+	          2,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "upper_64bit",
+	 upper_64bit,
+	 (uint64_t) 0x0000000000000000ULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "lower_64bit",
+	 lower_64bit,
+	 (uint64_t) 0x0000000000000000ULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "is_negative",
+	 is_negative,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "18446744073709551616",
+	          20,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "upper_64bit",
+	 upper_64bit,
+	 (uint64_t) 0x0000000000000001ULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "lower_64bit",
+	 lower_64bit,
+	 (uint64_t) 0x0000000000000000ULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "is_negative",
+	 is_negative,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "340282366920938463463374607431768211455",
+	          39,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "upper_64bit",
+	 upper_64bit,
+	 (uint64_t) 0xffffffffffffffffULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "lower_64bit",
+	 lower_64bit,
+	 (uint64_t) 0xffffffffffffffffULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "is_negative",
+	 is_negative,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "-170141183460469231731687303715884105728",
+	          40,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "upper_64bit",
+	 upper_64bit,
+	 (uint64_t) 0x8000000000000000ULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "lower_64bit",
+	 lower_64bit,
+	 (uint64_t) 0x0000000000000000ULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "is_negative",
+	 is_negative,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "0xffffffffffffffffffffffffffffffff",
+	          34,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "upper_64bit",
+	 upper_64bit,
+	 (uint64_t) 0xffffffffffffffffULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "lower_64bit",
+	 lower_64bit,
+	 (uint64_t) 0xffffffffffffffffULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "is_negative",
+	 is_negative,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test unsupported strings
+	 */
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "",
+	          0,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "abc",
+	          3,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "0x",
+	          2,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "-",
+	          1,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "12a",
+	          3,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "1 2",
+	          3,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "0xg",
+	          3,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "340282366920938463463374607431768211456",
+	          39,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "-170141183460469231731687303715884105729",
+	          40,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "0x100000000000000000000000000000000",
+	          35,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_integer_copy_from_utf8_string(
+	          NULL,
+	          2,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "42",
+	          (size_t) SSIZE_MAX + 1,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "42",
+	          2,
+	          NULL,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "42",
+	          2,
+	          &upper_64bit,
+	          NULL,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_integer_copy_from_utf8_string(
+	          (uint8_t *) "42",
+	          2,
+	          &upper_64bit,
+	          &lower_64bit,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_integer_copy_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_integer_copy_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_integer_copy_to_utf8_string(
+	          0,
+	          1234,
+	          1,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "-1234",
+	          6 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfplist_integer_copy_to_utf8_string(
+	          0,
+	          0,
+	          1,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "0",
+	          2 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfplist_integer_copy_to_utf8_string(
+	          0xffffffffffffffffULL,
+	          0xffffffffffffffffULL,
+	          0,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "340282366920938463463374607431768211455",
+	          40 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfplist_integer_copy_to_utf8_string(
+	          0,
+	          1234,
+	          0,
+	          NULL,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_integer_copy_to_utf8_string(
+	          0,
+	          1234,
+	          0,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_integer_copy_to_utf8_string(
+	          0,
+	          1234,
+	          0,
+	          utf8_string,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argc )
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+	FPLIST_TEST_RUN(
+	 "libfplist_integer_copy_from_utf8_string",
+	 fplist_test_integer_copy_from_utf8_string );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_integer_copy_to_utf8_string",
+	 fplist_test_integer_copy_to_utf8_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+}
+
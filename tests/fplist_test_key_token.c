@@ -0,0 +1,345 @@
+/*
+ * Library key_token type test program
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fplist_test_libcerror.h"
+#include "fplist_test_libfplist.h"
+#include "fplist_test_macros.h"
+#include "fplist_test_memory.h"
+#include "fplist_test_unused.h"
+
+
+/* Tests the libfplist_key_token_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_key_token_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfplist_key_token_t *key_token = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_FPLIST_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 2;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfplist_key_token_initialize(
+	          &key_token,
+	          (uint8_t *) "CFBundleIdentifier",
+	          18,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_token",
+	 key_token );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_key_token_free(
+	          &key_token,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_token",
+	 key_token );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_key_token_initialize(
+	          NULL,
+	          (uint8_t *) "CFBundleIdentifier",
+	          18,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	key_token = (libfplist_key_token_t *) 0x12345678UL;
+
+	result = libfplist_key_token_initialize(
+	          &key_token,
+	          (uint8_t *) "CFBundleIdentifier",
+	          18,
+	          &error );
+
+	key_token = NULL;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_key_token_initialize(
+	          &key_token,
+	          NULL,
+	          18,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_key_token_initialize(
+	          &key_token,
+	          (uint8_t *) "CFBundleIdentifier",
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FPLIST_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfplist_key_token_initialize with malloc failing
+		 */
+		fplist_test_malloc_attempts_before_fail = test_number;
+
+		result = libfplist_key_token_initialize(
+		          &key_token,
+		          (uint8_t *) "CFBundleIdentifier",
+		          18,
+		          &error );
+
+		if( fplist_test_malloc_attempts_before_fail != -1 )
+		{
+			fplist_test_malloc_attempts_before_fail = -1;
+
+			if( key_token != NULL )
+			{
+				libfplist_key_token_free(
+				 &key_token,
+				 NULL );
+			}
+		}
+		else
+		{
+			FPLIST_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FPLIST_TEST_ASSERT_IS_NULL(
+			 "key_token",
+			 key_token );
+
+			FPLIST_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfplist_key_token_initialize with memset failing
+		 */
+		fplist_test_memset_attempts_before_fail = test_number;
+
+		result = libfplist_key_token_initialize(
+		          &key_token,
+		          (uint8_t *) "CFBundleIdentifier",
+		          18,
+		          &error );
+
+		if( fplist_test_memset_attempts_before_fail != -1 )
+		{
+			fplist_test_memset_attempts_before_fail = -1;
+
+			if( key_token != NULL )
+			{
+				libfplist_key_token_free(
+				 &key_token,
+				 NULL );
+			}
+		}
+		else
+		{
+			FPLIST_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FPLIST_TEST_ASSERT_IS_NULL(
+			 "key_token",
+			 key_token );
+
+			FPLIST_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FPLIST_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_token != NULL )
+	{
+		libfplist_key_token_free(
+		 &key_token,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_key_token_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_key_token_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfplist_key_token_free(
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argc )
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FPLIST_TEST_RUN(
+	 "libfplist_key_token_initialize",
+	 fplist_test_key_token_initialize );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_key_token_free",
+	 fplist_test_key_token_free );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
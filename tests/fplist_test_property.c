@@ -37,6 +37,65 @@
 #include "../libfplist/libfplist_property.h"
 #include "../libfplist/libfplist_xml_tag.h"
 
+uint8_t fplist_test_property_data1[ 343 ] = {
+	0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31,
+	0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54,
+	0x46, 0x2d, 0x38, 0x22, 0x3f, 0x3e, 0x0a, 0x3c, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x76, 0x65,
+	0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69,
+	0x63, 0x74, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x4e, 0x61, 0x6d, 0x65, 0x3c, 0x2f,
+	0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x54, 0x65,
+	0x73, 0x74, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65,
+	0x79, 0x3e, 0x45, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a,
+	0x09, 0x3c, 0x74, 0x72, 0x75, 0x65, 0x2f, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x44,
+	0x65, 0x74, 0x61, 0x69, 0x6c, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x64,
+	0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x53, 0x69, 0x7a, 0x65,
+	0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65,
+	0x72, 0x3e, 0x38, 0x33, 0x38, 0x38, 0x36, 0x30, 0x38, 0x3c, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67,
+	0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x43, 0x72, 0x65, 0x61, 0x74,
+	0x65, 0x64, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x64, 0x61, 0x74, 0x65,
+	0x3e, 0x32, 0x30, 0x31, 0x36, 0x2d, 0x31, 0x30, 0x2d, 0x31, 0x37, 0x54, 0x30, 0x38, 0x3a, 0x34,
+	0x32, 0x3a, 0x30, 0x35, 0x5a, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x65, 0x3e, 0x0a, 0x09, 0x09, 0x3c,
+	0x6b, 0x65, 0x79, 0x3e, 0x44, 0x61, 0x74, 0x61, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09,
+	0x09, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x3e, 0x0a, 0x09, 0x09, 0x64, 0x47, 0x56, 0x7a, 0x64, 0x41,
+	0x3d, 0x3d, 0x0a, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x3e, 0x0a, 0x09, 0x3c, 0x2f,
+	0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x3c, 0x2f,
+	0x70, 0x6c, 0x69, 0x73, 0x74, 0x3e, 0x0a };
+
+uint8_t fplist_test_property_data2[ 522 ] = {
+	0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31,
+	0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54,
+	0x46, 0x2d, 0x38, 0x22, 0x3f, 0x3e, 0x0a, 0x3c, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x76, 0x65,
+	0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69,
+	0x63, 0x74, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x45, 0x6e, 0x74, 0x72, 0x69, 0x65,
+	0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3e,
+	0x0a, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65,
+	0x79, 0x3e, 0x4e, 0x61, 0x6d, 0x65, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09,
+	0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x46, 0x69, 0x72, 0x73, 0x74, 0x3c, 0x2f, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x41,
+	0x6c, 0x69, 0x61, 0x73, 0x65, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09,
+	0x3c, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72,
+	0x69, 0x6e, 0x67, 0x3e, 0x61, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09,
+	0x09, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x62, 0x63, 0x3c, 0x2f, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x44, 0x65, 0x74, 0x61, 0x69,
+	0x6c, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63,
+	0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x4b, 0x69, 0x6e, 0x64,
+	0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69,
+	0x6e, 0x67, 0x3e, 0x66, 0x69, 0x6c, 0x65, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e,
+	0x0a, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x2f,
+	0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09,
+	0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x4e, 0x61, 0x6d, 0x65, 0x3c, 0x2f, 0x6b, 0x65, 0x79,
+	0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x3c, 0x2f, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x44,
+	0x65, 0x74, 0x61, 0x69, 0x6c, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09,
+	0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e,
+	0x4b, 0x69, 0x6e, 0x64, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79,
+	0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x64,
+	0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09,
+	0x3c, 0x2f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e,
+	0x0a, 0x3c, 0x2f, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x3e, 0x0a };
+
 #if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
 
 /* Tests the libfplist_property_initialize function
@@ -784,26 +843,25 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfplist_property_get_value_data_size function
+/* Tests the libfplist_property_get_value function
  * Returns 1 if successful or 0 if not
  */
-int fplist_test_property_get_value_data_size(
+int fplist_test_property_get_value(
      void )
 {
-	libcerror_error_t *error            = NULL;
-	libfplist_property_t *property      = NULL;
-	libfplist_xml_tag_t *key_tag        = NULL;
-	libfplist_xml_tag_t *test_value_tag = NULL;
-	libfplist_xml_tag_t *value_tag      = NULL;
-	size_t data_size                    = 0;
-	int result                          = 0;
+	libfplist_value_t value;
+
+	libcerror_error_t *error                 = NULL;
+	libfplist_property_t *details_property   = NULL;
+	libfplist_property_t *root_property      = NULL;
+	libfplist_property_t *sub_property       = NULL;
+	libfplist_property_list_t *property_list = NULL;
+	int result                               = 0;
 
 	/* Initialize test
 	 */
-	result = libfplist_xml_tag_initialize(
-	          &key_tag,
-	          (uint8_t *) "key",
-	          3,
+	result = libfplist_property_list_initialize(
+	          &property_list,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -811,18 +869,14 @@ int fplist_test_property_get_value_data_size(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "key_tag",
-	 key_tag );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_initialize(
-	          &value_tag,
-	          (uint8_t *) "data",
-	          4,
+	result = libfplist_property_list_copy_from_byte_stream(
+	          property_list,
+	          fplist_test_property_data1,
+	          343,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -830,18 +884,13 @@ int fplist_test_property_get_value_data_size(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "value_tag",
-	 value_tag );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_set_value(
-	          value_tag,
-	          (uint8_t *) "\nVEVTVA==\n",
-	          10,
+	result = libfplist_property_list_get_root_property(
+	          property_list,
+	          &root_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -853,10 +902,11 @@ int fplist_test_property_get_value_data_size(
 	 "error",
 	 error );
 
-	result = libfplist_property_initialize(
-	          &property,
-	          key_tag,
-	          value_tag,
+	/* Test regular cases
+	 */
+	result = libfplist_property_get_value(
+	          root_property,
+	          &value,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -864,19 +914,25 @@ int fplist_test_property_get_value_data_size(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "property",
-	 property );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libfplist_property_get_value_data_size(
-	          property,
-	          &data_size,
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "value.value_type",
+	 value.value_type,
+	 LIBFPLIST_VALUE_TYPE_DICTIONARY );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "value.data.number_of_entries",
+	 value.data.number_of_entries,
+	 3 );
+
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "Name",
+	          4,
+	          &sub_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -884,78 +940,62 @@ int fplist_test_property_get_value_data_size(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_EQUAL_SIZE(
-	 "data_size",
-	 data_size,
-	 (size_t) 4 );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfplist_property_get_value_data_size(
-	          NULL,
-	          &data_size,
+	result = libfplist_property_get_value(
+	          sub_property,
+	          &value,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	test_value_tag = ( (libfplist_internal_property_t *) property )->value_tag;
-
-	( (libfplist_internal_property_t *) property )->value_tag = NULL;
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "value.value_type",
+	 value.value_type,
+	 LIBFPLIST_VALUE_TYPE_STRING );
 
-	result = libfplist_property_get_value_data_size(
-	          property,
-	          &data_size,
-	          &error );
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "value.data.string.utf8_string_size",
+	 value.data.string.utf8_string_size,
+	 (size_t) 5 );
 
-	( (libfplist_internal_property_t *) property )->value_tag = test_value_tag;
+	result = memory_compare(
+	          value.data.string.utf8_string,
+	          "Test",
+	          5 );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
+	 0 );
 
-	result = libfplist_property_get_value_data_size(
-	          property,
-	          NULL,
+	result = libfplist_property_free(
+	          &sub_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Clean up
-	 */
-	result = libfplist_xml_tag_free(
-	          &value_tag,
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "Enabled",
+	          7,
+	          &sub_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -963,16 +1003,13 @@ int fplist_test_property_get_value_data_size(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "value_tag",
-	 value_tag );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_free(
-	          &key_tag,
+	result = libfplist_property_get_value(
+	          sub_property,
+	          &value,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -980,16 +1017,22 @@ int fplist_test_property_get_value_data_size(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "key_tag",
-	 key_tag );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "value.value_type",
+	 value.value_type,
+	 LIBFPLIST_VALUE_TYPE_BOOLEAN );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "value.data.boolean",
+	 value.data.boolean,
+	 (uint8_t) 1 );
+
 	result = libfplist_property_free(
-	          &property,
+	          &sub_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -997,20 +1040,15 @@ int fplist_test_property_get_value_data_size(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "property",
-	 property );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Initialize test
-	 */
-	result = libfplist_xml_tag_initialize(
-	          &key_tag,
-	          (uint8_t *) "key",
-	          3,
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "Details",
+	          7,
+	          &details_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -1018,18 +1056,15 @@ int fplist_test_property_get_value_data_size(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "key_tag",
-	 key_tag );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_initialize(
-	          &value_tag,
-	          (uint8_t *) "unknown",
-	          7,
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          details_property,
+	          (uint8_t *) "Size",
+	          4,
+	          &sub_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -1037,18 +1072,13 @@ int fplist_test_property_get_value_data_size(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "value_tag",
-	 value_tag );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_property_initialize(
-	          &property,
-	          key_tag,
-	          value_tag,
+	result = libfplist_property_get_value(
+	          sub_property,
+	          &value,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -1056,37 +1086,43 @@ int fplist_test_property_get_value_data_size(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "property",
-	 property );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test with unsupported value type
-	 */
-	result = libfplist_property_get_value_data_size(
-	          property,
-	          &data_size,
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "value.value_type",
+	 value.value_type,
+	 LIBFPLIST_VALUE_TYPE_INTEGER );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value.data.integer.upper_64bit",
+	 value.data.integer.upper_64bit,
+	 (uint64_t) 0 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value.data.integer.lower_64bit",
+	 value.data.integer.lower_64bit,
+	 (uint64_t) 8388608 );
+
+	result = libfplist_property_free(
+	          &sub_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Clean up
-	 */
-	result = libfplist_xml_tag_free(
-	          &value_tag,
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          details_property,
+	          (uint8_t *) "Created",
+	          7,
+	          &sub_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -1094,16 +1130,13 @@ int fplist_test_property_get_value_data_size(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "value_tag",
-	 value_tag );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_free(
-	          &key_tag,
+	result = libfplist_property_get_value(
+	          sub_property,
+	          &value,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -1111,16 +1144,22 @@ int fplist_test_property_get_value_data_size(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "key_tag",
-	 key_tag );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "value.value_type",
+	 value.value_type,
+	 LIBFPLIST_VALUE_TYPE_DATE );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT64(
+	 "value.data.posix_time_in_nanoseconds",
+	 value.data.posix_time_in_nanoseconds,
+	 (int64_t) 1476693725000000000LL );
+
 	result = libfplist_property_free(
-	          &property,
+	          &sub_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -1128,20 +1167,15 @@ int fplist_test_property_get_value_data_size(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "property",
-	 property );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Initialize test
-	 */
-	result = libfplist_xml_tag_initialize(
-	          &key_tag,
-	          (uint8_t *) "key",
-	          3,
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          details_property,
+	          (uint8_t *) "Data",
+	          4,
+	          &sub_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -1149,18 +1183,13 @@ int fplist_test_property_get_value_data_size(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "key_tag",
-	 key_tag );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_initialize(
-	          &value_tag,
-	          (uint8_t *) "data",
-	          4,
+	result = libfplist_property_get_value(
+	          sub_property,
+	          &value,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -1168,18 +1197,22 @@ int fplist_test_property_get_value_data_size(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "value_tag",
-	 value_tag );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_property_initialize(
-	          &property,
-	          key_tag,
-	          value_tag,
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "value.value_type",
+	 value.value_type,
+	 LIBFPLIST_VALUE_TYPE_BINARY_DATA );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "value.data.data_size",
+	 value.data.data_size,
+	 (size_t) 4 );
+
+	result = libfplist_property_free(
+	          &sub_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -1187,19 +1220,15 @@ int fplist_test_property_get_value_data_size(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "property",
-	 property );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test with missing value data
+	/* Test error cases
 	 */
-	result = libfplist_property_get_value_data_size(
-	          property,
-	          &data_size,
+	result = libfplist_property_get_value(
+	          NULL,
+	          &value,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -1214,27 +1243,118 @@ int fplist_test_property_get_value_data_size(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libfplist_xml_tag_free(
-	          &value_tag,
+	result = libfplist_property_get_value(
+	          root_property,
+	          NULL,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "value_tag",
-	 value_tag );
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_free(
+	          &details_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_free(
+	result = libfplist_property_free(
+	          &root_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sub_property != NULL )
+	{
+		libfplist_property_free(
+		 &sub_property,
+		 NULL );
+	}
+	if( details_property != NULL )
+	{
+		libfplist_property_free(
+		 &details_property,
+		 NULL );
+	}
+	if( root_property != NULL )
+	{
+		libfplist_property_free(
+		 &root_property,
+		 NULL );
+	}
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_get_value_boolean function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_get_value_boolean(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfplist_property_t *property = NULL;
+	libfplist_xml_tag_t *key_tag   = NULL;
+	libfplist_xml_tag_t *value_tag = NULL;
+	uint8_t value_boolean          = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
 	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -1243,13 +1363,98 @@ int fplist_test_property_get_value_data_size(
 	 1 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
-	 "key_tag",
-	 key_tag );
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "false",
+	          5,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_property_get_value_boolean(
+	          property,
+	          &value_boolean,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "value_boolean",
+	 value_boolean,
+	 (uint8_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_get_value_boolean(
+	          NULL,
+	          &value_boolean,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_value_boolean(
+	          property,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
 	result = libfplist_property_free(
 	          &property,
 	          &error );
@@ -1260,8 +1465,30 @@ int fplist_test_property_get_value_data_size(
 	 1 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
-	 "property",
-	 property );
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1275,6 +1502,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( property != NULL )
+	{
+		libfplist_property_free(
+		 &property,
+		 NULL );
+	}
 	if( value_tag != NULL )
 	{
 		libfplist_xml_tag_free(
@@ -1287,28 +1520,21 @@ on_error:
 		 &key_tag,
 		 NULL );
 	}
-	if( property != NULL )
-	{
-		libfplist_property_free(
-		 &property,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libfplist_property_get_value_data function
+/* Tests the libfplist_property_get_value_data_size function
  * Returns 1 if successful or 0 if not
  */
-int fplist_test_property_get_value_data(
+int fplist_test_property_get_value_data_size(
      void )
 {
-	uint8_t data[ 32 ];
-
 	libcerror_error_t *error            = NULL;
 	libfplist_property_t *property      = NULL;
 	libfplist_xml_tag_t *key_tag        = NULL;
 	libfplist_xml_tag_t *test_value_tag = NULL;
 	libfplist_xml_tag_t *value_tag      = NULL;
+	size_t data_size                    = 0;
 	int result                          = 0;
 
 	/* Initialize test
@@ -1387,10 +1613,9 @@ int fplist_test_property_get_value_data(
 
 	/* Test regular cases
 	 */
-	result = libfplist_property_get_value_data(
+	result = libfplist_property_get_value_data_size(
 	          property,
-	          data,
-	          32,
+	          &data_size,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -1398,26 +1623,20 @@ int fplist_test_property_get_value_data(
 	 result,
 	 1 );
 
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 4 );
+
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = memory_compare(
-	          data,
-	          "TEST",
-	          4 );
-
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
 	/* Test error cases
 	 */
-	result = libfplist_property_get_value_data(
+	result = libfplist_property_get_value_data_size(
 	          NULL,
-	          data,
-	          32,
+	          &data_size,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -1436,10 +1655,9 @@ int fplist_test_property_get_value_data(
 
 	( (libfplist_internal_property_t *) property )->value_tag = NULL;
 
-	result = libfplist_property_get_value_data(
+	result = libfplist_property_get_value_data_size(
 	          property,
-	          data,
-	          32,
+	          &data_size,
 	          &error );
 
 	( (libfplist_internal_property_t *) property )->value_tag = test_value_tag;
@@ -1456,28 +1674,9 @@ int fplist_test_property_get_value_data(
 	libcerror_error_free(
 	 &error );
 
-	result = libfplist_property_get_value_data(
+	result = libfplist_property_get_value_data_size(
 	          property,
 	          NULL,
-	          32,
-	          &error );
-
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libfplist_property_get_value_data(
-	          property,
-	          data,
-	          (size_t) SSIZE_MAX + 1,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -1606,10 +1805,9 @@ int fplist_test_property_get_value_data(
 
 	/* Test with unsupported value type
 	 */
-	result = libfplist_property_get_value_data(
+	result = libfplist_property_get_value_data_size(
 	          property,
-	          data,
-	          32,
+	          &data_size,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -1738,10 +1936,9 @@ int fplist_test_property_get_value_data(
 
 	/* Test with missing value data
 	 */
-	result = libfplist_property_get_value_data(
+	result = libfplist_property_get_value_data_size(
 	          property,
-	          data,
-	          32,
+	          &data_size,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -1838,18 +2035,19 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfplist_property_get_value_integer function
+/* Tests the libfplist_property_get_value_data function
  * Returns 1 if successful or 0 if not
  */
-int fplist_test_property_get_value_integer(
+int fplist_test_property_get_value_data(
      void )
 {
+	uint8_t data[ 32 ];
+
 	libcerror_error_t *error            = NULL;
 	libfplist_property_t *property      = NULL;
 	libfplist_xml_tag_t *key_tag        = NULL;
 	libfplist_xml_tag_t *test_value_tag = NULL;
 	libfplist_xml_tag_t *value_tag      = NULL;
-	uint64_t value_64bit                = 0;
 	int result                          = 0;
 
 	/* Initialize test
@@ -1875,8 +2073,8 @@ int fplist_test_property_get_value_integer(
 
 	result = libfplist_xml_tag_initialize(
 	          &value_tag,
-	          (uint8_t *) "integer",
-	          7,
+	          (uint8_t *) "data",
+	          4,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -1892,30 +2090,9 @@ int fplist_test_property_get_value_integer(
 	 "error",
 	 error );
 
-	result = libfplist_property_initialize(
-	          &property,
-	          key_tag,
-	          value_tag,
-	          &error );
-
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "property",
-	 property );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Test regular cases
-	 */
 	result = libfplist_xml_tag_set_value(
 	          value_tag,
-	          (uint8_t *) "1234567890",
+	          (uint8_t *) "\nVEVTVA==\n",
 	          10,
 	          &error );
 
@@ -1928,9 +2105,10 @@ int fplist_test_property_get_value_integer(
 	 "error",
 	 error );
 
-	result = libfplist_property_get_value_integer(
-	          property,
-	          &value_64bit,
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -1938,19 +2116,20 @@ int fplist_test_property_get_value_integer(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_EQUAL_UINT64(
-	 "value_64bit",
-	 value_64bit,
-	 (uint64_t) 1234567890 );
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_set_value(
-	          value_tag,
-	          (uint8_t *) "0xabcdef",
-	          8,
+	/* Test regular cases
+	 */
+	result = libfplist_property_get_value_data(
+	          property,
+	          data,
+	          32,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -1962,30 +2141,22 @@ int fplist_test_property_get_value_integer(
 	 "error",
 	 error );
 
-	result = libfplist_property_get_value_integer(
-	          property,
-	          &value_64bit,
-	          &error );
+	result = memory_compare(
+	          data,
+	          "TEST",
+	          4 );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FPLIST_TEST_ASSERT_EQUAL_UINT64(
-	 "value_64bit",
-	 value_64bit,
-	 (uint64_t) 0xabcdef );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	 0 );
 
 	/* Test error cases
 	 */
-	result = libfplist_property_get_value_integer(
+	result = libfplist_property_get_value_data(
 	          NULL,
-	          &value_64bit,
+	          data,
+	          32,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -2004,9 +2175,10 @@ int fplist_test_property_get_value_integer(
 
 	( (libfplist_internal_property_t *) property )->value_tag = NULL;
 
-	result = libfplist_property_get_value_integer(
+	result = libfplist_property_get_value_data(
 	          property,
-	          &value_64bit,
+	          data,
+	          32,
 	          &error );
 
 	( (libfplist_internal_property_t *) property )->value_tag = test_value_tag;
@@ -2023,9 +2195,28 @@ int fplist_test_property_get_value_integer(
 	libcerror_error_free(
 	 &error );
 
-	result = libfplist_property_get_value_integer(
+	result = libfplist_property_get_value_data(
 	          property,
 	          NULL,
+	          32,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_value_data(
+	          property,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -2154,9 +2345,10 @@ int fplist_test_property_get_value_integer(
 
 	/* Test with unsupported value type
 	 */
-	result = libfplist_property_get_value_integer(
+	result = libfplist_property_get_value_data(
 	          property,
-	          &value_64bit,
+	          data,
+	          32,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -2247,8 +2439,8 @@ int fplist_test_property_get_value_integer(
 
 	result = libfplist_xml_tag_initialize(
 	          &value_tag,
-	          (uint8_t *) "integer",
-	          7,
+	          (uint8_t *) "data",
+	          4,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -2285,9 +2477,10 @@ int fplist_test_property_get_value_integer(
 
 	/* Test with missing value data
 	 */
-	result = libfplist_property_get_value_integer(
+	result = libfplist_property_get_value_data(
 	          property,
-	          &value_64bit,
+	          data,
+	          32,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -2384,20 +2577,19 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfplist_property_get_value_string function
+/* Tests the libfplist_property_get_value_data_allocated function
  * Returns 1 if successful or 0 if not
  */
-int fplist_test_property_get_value_string(
+int fplist_test_property_get_value_data_allocated(
      void )
 {
-	libcerror_error_t *error            = NULL;
-	libfplist_property_t *property      = NULL;
-	libfplist_xml_tag_t *key_tag        = NULL;
-	libfplist_xml_tag_t *test_value_tag = NULL;
-	libfplist_xml_tag_t *value_tag      = NULL;
-	uint8_t *value_string               = NULL;
-	size_t value_string_size            = 0;
-	int result                          = 0;
+	libcerror_error_t *error       = NULL;
+	libfplist_property_t *property = NULL;
+	libfplist_xml_tag_t *key_tag   = NULL;
+	libfplist_xml_tag_t *value_tag = NULL;
+	uint8_t *data                  = NULL;
+	size_t data_size               = 0;
+	int result                     = 0;
 
 	/* Initialize test
 	 */
@@ -2422,8 +2614,8 @@ int fplist_test_property_get_value_string(
 
 	result = libfplist_xml_tag_initialize(
 	          &value_tag,
-	          (uint8_t *) "string",
-	          6,
+	          (uint8_t *) "data",
+	          4,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -2441,7 +2633,7 @@ int fplist_test_property_get_value_string(
 
 	result = libfplist_xml_tag_set_value(
 	          value_tag,
-	          (uint8_t *) "ABCDEFGHIJ",
+	          (uint8_t *) "\nVEVTVA==\n",
 	          10,
 	          &error );
 
@@ -2475,10 +2667,10 @@ int fplist_test_property_get_value_string(
 
 	/* Test regular cases
 	 */
-	result = libfplist_property_get_value_string(
+	result = libfplist_property_get_value_data_allocated(
 	          property,
-	          &value_string,
-	          &value_string_size,
+	          &data,
+	          &data_size,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -2487,118 +2679,130 @@ int fplist_test_property_get_value_string(
 	 1 );
 
 	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "value_string",
-	 value_string );
+	 "data",
+	 data );
 
 	FPLIST_TEST_ASSERT_EQUAL_SIZE(
-	 "value_string_size",
-	 value_string_size,
-	 (size_t) 11 );
+	 "data_size",
+	 data_size,
+	 (size_t) 4 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	result = memory_compare(
-	          value_string,
-	          "ABCDEFGHIJ",
-	          11 );
+	          data,
+	          "TEST",
+	          4 );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 0 );
 
-/* TODO change libfplist_property_get_value_string to be an internal function */
 	memory_free(
-	 value_string );
+	 data );
 
-	value_string = NULL;
+	data = NULL;
 
-	/* Test error cases
+	/* Test if the decoded size was cached
 	 */
-	result = libfplist_property_get_value_string(
-	          NULL,
-	          &value_string,
-	          &value_string_size,
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "value_tag->value_data_size_is_set",
+	 value_tag->value_data_size_is_set,
+	 (uint8_t) 1 );
+
+	result = libfplist_property_get_value_data_size(
+	          property,
+	          &data_size,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 4 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	test_value_tag = ( (libfplist_internal_property_t *) property )->value_tag;
-
-	( (libfplist_internal_property_t *) property )->value_tag = NULL;
-
-	result = libfplist_property_get_value_string(
-	          property,
-	          &value_string,
-	          &value_string_size,
+	/* Test with empty data
+	 */
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "\n",
+	          1,
 	          &error );
 
-	( (libfplist_internal_property_t *) property )->value_tag = test_value_tag;
-
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfplist_property_get_value_string(
+	result = libfplist_property_get_value_data_allocated(
 	          property,
-	          NULL,
-	          &value_string_size,
+	          &data,
+	          &data_size,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "data",
+	 data );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfplist_property_get_value_string(
+	result = libfplist_property_get_value_data_size(
 	          property,
-	          &value_string,
-	          NULL,
+	          &data_size,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Clean up
+	/* Test with empty data of which the decoded size was cached
 	 */
-	result = libfplist_xml_tag_free(
-	          &value_tag,
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "value_tag->value_data_size_is_set",
+	 value_tag->value_data_size_is_set,
+	 (uint8_t) 1 );
+
+	result = libfplist_property_get_value_data_allocated(
+	          property,
+	          &data,
+	          &data_size,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -2607,114 +2811,66 @@ int fplist_test_property_get_value_string(
 	 1 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
-	 "value_tag",
-	 value_tag );
+	 "data",
+	 data );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 0 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_free(
-	          &key_tag,
-	          &error );
-
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "key_tag",
-	 key_tag );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libfplist_property_free(
-	          &property,
-	          &error );
-
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "property",
-	 property );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Initialize test
+	/* Test error cases
 	 */
-	result = libfplist_xml_tag_initialize(
-	          &key_tag,
-	          (uint8_t *) "key",
-	          3,
+	result = libfplist_property_get_value_data_allocated(
+	          NULL,
+	          &data,
+	          &data_size,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "key_tag",
-	 key_tag );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_initialize(
-	          &value_tag,
-	          (uint8_t *) "unknown",
-	          7,
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_value_data_allocated(
+	          property,
+	          NULL,
+	          &data_size,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "value_tag",
-	 value_tag );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_property_initialize(
-	          &property,
-	          key_tag,
-	          value_tag,
-	          &error );
-
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "property",
-	 property );
+	libcerror_error_free(
+	 &error );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	data = (uint8_t *) 0x12345678UL;
 
-	/* Test with unsupported value type
-	 */
-	result = libfplist_property_get_value_string(
+	result = libfplist_property_get_value_data_allocated(
 	          property,
-	          &value_string,
-	          &value_string_size,
+	          &data,
+	          &data_size,
 	          &error );
 
+	data = NULL;
+
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -2727,42 +2883,26 @@ int fplist_test_property_get_value_string(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libfplist_xml_tag_free(
-	          &value_tag,
+	result = libfplist_property_get_value_data_allocated(
+	          property,
+	          &data,
+	          NULL,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "value_tag",
-	 value_tag );
+	 -1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_free(
-	          &key_tag,
-	          &error );
-
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "key_tag",
-	 key_tag );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	libcerror_error_free(
+	 &error );
 
+	/* Clean up
+	 */
 	result = libfplist_property_free(
 	          &property,
 	          &error );
@@ -2780,87 +2920,6 @@ int fplist_test_property_get_value_string(
 	 "error",
 	 error );
 
-	/* Initialize test
-	 */
-	result = libfplist_xml_tag_initialize(
-	          &key_tag,
-	          (uint8_t *) "key",
-	          3,
-	          &error );
-
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "key_tag",
-	 key_tag );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libfplist_xml_tag_initialize(
-	          &value_tag,
-	          (uint8_t *) "string",
-	          6,
-	          &error );
-
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "value_tag",
-	 value_tag );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libfplist_property_initialize(
-	          &property,
-	          key_tag,
-	          value_tag,
-	          &error );
-
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "property",
-	 property );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Test with missing value data
-	 */
-	result = libfplist_property_get_value_string(
-	          property,
-	          &value_string,
-	          &value_string_size,
-	          &error );
-
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	/* Clean up
-	 */
 	result = libfplist_xml_tag_free(
 	          &value_tag,
 	          &error );
@@ -2895,23 +2954,6 @@ int fplist_test_property_get_value_string(
 	 "error",
 	 error );
 
-	result = libfplist_property_free(
-	          &property,
-	          &error );
-
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "property",
-	 property );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	return( 1 );
 
 on_error:
@@ -2920,6 +2962,17 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( property != NULL )
+	{
+		libfplist_property_free(
+		 &property,
+		 NULL );
+	}
 	if( value_tag != NULL )
 	{
 		libfplist_xml_tag_free(
@@ -2932,32 +2985,26 @@ on_error:
 		 &key_tag,
 		 NULL );
 	}
-	if( property != NULL )
-	{
-		libfplist_property_free(
-		 &property,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libfplist_property_value_uuid_string_copy_to_byte_stream function
+/* Tests the libfplist_property_get_value_as_property_list function
  * Returns 1 if successful or 0 if not
  */
-int fplist_test_property_value_uuid_string_copy_to_byte_stream(
+int fplist_test_property_get_value_as_property_list(
      void )
 {
-	uint8_t expected_uuid_data[ 16 ] = {
-		0xc3, 0x1c, 0x54, 0x34, 0x7b, 0xa4, 0x4f, 0xfa, 0xbd, 0x67, 0x99, 0xd9, 0x7a, 0x0a, 0xda, 0x0e };
-
-	uint8_t uuid_data[ 16 ];
-
-	libcerror_error_t *error            = NULL;
-	libfplist_property_t *property      = NULL;
-	libfplist_xml_tag_t *key_tag        = NULL;
-	libfplist_xml_tag_t *test_value_tag = NULL;
-	libfplist_xml_tag_t *value_tag      = NULL;
-	int result                          = 0;
+	libcerror_error_t *error                        = NULL;
+	libfplist_property_t *property                  = NULL;
+	libfplist_property_t *root_property             = NULL;
+	libfplist_property_t *sub_property              = NULL;
+	libfplist_property_list_t *cached_property_list = NULL;
+	libfplist_property_list_t *property_list        = NULL;
+	libfplist_xml_tag_t *key_tag                    = NULL;
+	libfplist_xml_tag_t *value_tag                  = NULL;
+	uint8_t *string                                 = NULL;
+	size_t string_size                              = 0;
+	int result                                      = 0;
 
 	/* Initialize test
 	 */
@@ -2982,8 +3029,8 @@ int fplist_test_property_value_uuid_string_copy_to_byte_stream(
 
 	result = libfplist_xml_tag_initialize(
 	          &value_tag,
-	          (uint8_t *) "string",
-	          6,
+	          (uint8_t *) "data",
+	          4,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3001,8 +3048,8 @@ int fplist_test_property_value_uuid_string_copy_to_byte_stream(
 
 	result = libfplist_xml_tag_set_value(
 	          value_tag,
-	          (uint8_t *) "C31C5434-7BA4-4FFA-BD67-99D97A0ADA0E",
-	          37,
+	          (uint8_t *) "PD94bWwgdmVyc2lvbj0iMS4wIiBlbmNvZGluZz0iVVRGLTgiPz4KPHBsaXN0IHZlcnNpb249IjEuMCI+CjxkaWN0PgoJPGtleT5OYW1lPC9rZXk+Cgk8c3RyaW5nPlRlc3Q8L3N0cmluZz4KPC9kaWN0Pgo8L3BsaXN0Pgo=",
+	          168,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3035,10 +3082,9 @@ int fplist_test_property_value_uuid_string_copy_to_byte_stream(
 
 	/* Test regular cases
 	 */
-	result = libfplist_property_value_uuid_string_copy_to_byte_stream(
+	result = libfplist_property_get_value_as_property_list(
 	          property,
-	          uuid_data,
-	          16,
+	          &property_list,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3050,163 +3096,85 @@ int fplist_test_property_value_uuid_string_copy_to_byte_stream(
 	 "error",
 	 error );
 
-	result = memory_compare(
-	          uuid_data,
-	          expected_uuid_data,
-	          16 );
-
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
 
-	/* Test error cases
-	 */
-	result = libfplist_property_value_uuid_string_copy_to_byte_stream(
-	          NULL,
-	          uuid_data,
-	          16,
+	result = libfplist_property_list_get_root_property(
+	          property_list,
+	          &root_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	test_value_tag = ( (libfplist_internal_property_t *) property )->value_tag;
-
-	( (libfplist_internal_property_t *) property )->value_tag = NULL;
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "root_property",
+	 root_property );
 
-	result = libfplist_property_value_uuid_string_copy_to_byte_stream(
-	          property,
-	          uuid_data,
-	          16,
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "Name",
+	          4,
+	          &sub_property,
 	          &error );
 
-	( (libfplist_internal_property_t *) property )->value_tag = test_value_tag;
-
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
 
-	result = libfplist_property_value_uuid_string_copy_to_byte_stream(
-	          property,
-	          NULL,
-	          16,
+	result = libfplist_property_get_value_string(
+	          sub_property,
+	          &string,
+	          &string_size,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 5 );
 
-	result = libfplist_property_value_uuid_string_copy_to_byte_stream(
-	          property,
-	          uuid_data,
-	          (size_t) SSIZE_MAX + 1,
-	          &error );
+	result = memory_compare(
+	          string,
+	          "Test",
+	          5 );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-#if defined( HAVE_FPLIST_TEST_MEMORY )
-
-	/* Test libfplist_property_initialize with malloc failing in libfguid_identifier_copy_to_byte_stream
-	 */
-	fplist_test_malloc_attempts_before_fail = 2;
-
-	result = libfplist_property_value_uuid_string_copy_to_byte_stream(
-	          property,
-	          uuid_data,
-	          16,
-	          &error );
-
-	if( fplist_test_malloc_attempts_before_fail != -1 )
-	{
-		fplist_test_malloc_attempts_before_fail = -1;
-	}
-	else
-	{
-		FPLIST_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		FPLIST_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-#if defined( OPTIMIZATION_DISABLED )
-
-	/* Test libfplist_property_initialize with memcpy failing in libfguid_identifier_copy_to_byte_stream
-	 */
-	fplist_test_memcpy_attempts_before_fail = 2;
-
-	result = libfplist_property_value_uuid_string_copy_to_byte_stream(
-	          property,
-	          uuid_data,
-	          16,
-	          &error );
-
-	if( fplist_test_memcpy_attempts_before_fail != -1 )
-	{
-		fplist_test_memcpy_attempts_before_fail = -1;
-	}
-	else
-	{
-		FPLIST_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	 0 );
 
-		FPLIST_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	memory_free(
+	 string );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( OPTIMIZATION_DISABLED ) */
-#endif /* defined( HAVE_FPLIST_TEST_MEMORY ) */
+	string = NULL;
 
-	/* Clean up
-	 */
-	result = libfplist_xml_tag_free(
-	          &value_tag,
+	result = libfplist_property_free(
+	          &sub_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3214,16 +3182,12 @@ int fplist_test_property_value_uuid_string_copy_to_byte_stream(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "value_tag",
-	 value_tag );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_free(
-	          &key_tag,
+	result = libfplist_property_free(
+	          &root_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3231,16 +3195,15 @@ int fplist_test_property_value_uuid_string_copy_to_byte_stream(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "key_tag",
-	 key_tag );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_property_free(
-	          &property,
+	/* Test if the embedded property list is cached
+	 */
+	result = libfplist_property_get_value_as_property_list(
+	          property,
+	          &cached_property_list,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3248,20 +3211,21 @@ int fplist_test_property_value_uuid_string_copy_to_byte_stream(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "property",
-	 property );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Initialize test
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "cached_property_list",
+	 (int) ( cached_property_list == property_list ),
+	 1 );
+
+	/* Test embedded binary property list
 	 */
-	result = libfplist_xml_tag_initialize(
-	          &key_tag,
-	          (uint8_t *) "key",
-	          3,
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "YnBsaXN0MDDRAQJUTmFtZVRUZXN0CAsQAAAAAAAAAQEAAAAAAAAAAwAAAAAAAAAAAAAAAAAAABU=",
+	          76,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3269,18 +3233,15 @@ int fplist_test_property_value_uuid_string_copy_to_byte_stream(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "key_tag",
-	 key_tag );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_initialize(
-	          &value_tag,
-	          (uint8_t *) "unknown",
-	          7,
+	property_list = NULL;
+
+	result = libfplist_property_get_value_as_property_list(
+	          property,
+	          &property_list,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3288,18 +3249,17 @@ int fplist_test_property_value_uuid_string_copy_to_byte_stream(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "value_tag",
-	 value_tag );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_property_initialize(
-	          &property,
-	          key_tag,
-	          value_tag,
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
+
+	result = libfplist_property_list_get_root_property(
+	          property_list,
+	          &root_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3307,38 +3267,38 @@ int fplist_test_property_value_uuid_string_copy_to_byte_stream(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "property",
-	 property );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test with unsupported value type
-	 */
-	result = libfplist_property_value_uuid_string_copy_to_byte_stream(
-	          property,
-	          uuid_data,
-	          16,
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "root_property",
+	 root_property );
+
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "Name",
+	          4,
+	          &sub_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
 
-	/* Clean up
-	 */
-	result = libfplist_xml_tag_free(
-	          &value_tag,
+	result = libfplist_property_get_value_string(
+	          sub_property,
+	          &string,
+	          &string_size,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3346,33 +3306,32 @@ int fplist_test_property_value_uuid_string_copy_to_byte_stream(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "value_tag",
-	 value_tag );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_free(
-	          &key_tag,
-	          &error );
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 5 );
+
+	result = memory_compare(
+	          string,
+	          "Test",
+	          5 );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "key_tag",
-	 key_tag );
+	memory_free(
+	 string );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	string = NULL;
 
 	result = libfplist_property_free(
-	          &property,
+	          &sub_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3380,20 +3339,12 @@ int fplist_test_property_value_uuid_string_copy_to_byte_stream(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "property",
-	 property );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Initialize test
-	 */
-	result = libfplist_xml_tag_initialize(
-	          &key_tag,
-	          (uint8_t *) "key",
-	          3,
+	result = libfplist_property_free(
+	          &root_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3401,18 +3352,16 @@ int fplist_test_property_value_uuid_string_copy_to_byte_stream(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "key_tag",
-	 key_tag );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_initialize(
-	          &value_tag,
-	          (uint8_t *) "string",
-	          6,
+	/* Test data that does not contain a property list
+	 */
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "VEVTVA==",
+	          8,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3420,33 +3369,70 @@ int fplist_test_property_value_uuid_string_copy_to_byte_stream(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "value_tag",
-	 value_tag );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_set_value(
-	          value_tag,
-	          (uint8_t *) "BOGUS",
-	          5,
+	property_list = NULL;
+
+	result = libfplist_property_get_value_as_property_list(
+	          property,
+	          &property_list,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_property_initialize(
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property_list",
+	 property_list );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_get_value_as_property_list(
+	          NULL,
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_value_as_property_list(
+	          property,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_free(
 	          &property,
-	          key_tag,
-	          value_tag,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3454,7 +3440,7 @@ int fplist_test_property_value_uuid_string_copy_to_byte_stream(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	FPLIST_TEST_ASSERT_IS_NULL(
 	 "property",
 	 property );
 
@@ -3462,12 +3448,26 @@ int fplist_test_property_value_uuid_string_copy_to_byte_stream(
 	 "error",
 	 error );
 
-	/* Test with invalid value data
+	/* Test unsupported value type
 	 */
-	result = libfplist_property_value_uuid_string_copy_to_byte_stream(
+	result = libfplist_property_initialize(
+	          &property,
+	          NULL,
+	          key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_as_property_list(
 	          property,
-	          uuid_data,
-	          16,
+	          &property_list,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3484,8 +3484,8 @@ int fplist_test_property_value_uuid_string_copy_to_byte_stream(
 
 	/* Clean up
 	 */
-	result = libfplist_xml_tag_free(
-	          &value_tag,
+	result = libfplist_property_free(
+	          &property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3494,15 +3494,15 @@ int fplist_test_property_value_uuid_string_copy_to_byte_stream(
 	 1 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
-	 "value_tag",
-	 value_tag );
+	 "property",
+	 property );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	result = libfplist_xml_tag_free(
-	          &key_tag,
+	          &value_tag,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3511,15 +3511,15 @@ int fplist_test_property_value_uuid_string_copy_to_byte_stream(
 	 1 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
-	 "key_tag",
-	 key_tag );
+	 "value_tag",
+	 value_tag );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_property_free(
-	          &property,
+	result = libfplist_xml_tag_free(
+	          &key_tag,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3528,8 +3528,8 @@ int fplist_test_property_value_uuid_string_copy_to_byte_stream(
 	 1 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
-	 "property",
-	 property );
+	 "key_tag",
+	 key_tag );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -3543,16 +3543,21 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( value_tag != NULL )
+	if( string != NULL )
 	{
-		libfplist_xml_tag_free(
-		 &value_tag,
+		memory_free(
+		 string );
+	}
+	if( sub_property != NULL )
+	{
+		libfplist_property_free(
+		 &sub_property,
 		 NULL );
 	}
-	if( key_tag != NULL )
+	if( root_property != NULL )
 	{
-		libfplist_xml_tag_free(
-		 &key_tag,
+		libfplist_property_free(
+		 &root_property,
 		 NULL );
 	}
 	if( property != NULL )
@@ -3561,49 +3566,91 @@ on_error:
 		 &property,
 		 NULL );
 	}
+	if( value_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &value_tag,
+		 NULL );
+	}
+	if( key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &key_tag,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libfplist_property_get_array_number_of_entries function
+/* Tests the libfplist_property_read_value_data_at_offset function
  * Returns 1 if successful or 0 if not
  */
-int fplist_test_property_get_array_number_of_entries(
+int fplist_test_property_read_value_data_at_offset(
      void )
 {
-	libcerror_error_t *error            = NULL;
-	libfplist_property_t *property      = NULL;
-	libfplist_xml_tag_t *element_tag    = NULL;
-	libfplist_xml_tag_t *key_tag        = NULL;
-	libfplist_xml_tag_t *test_value_tag = NULL;
-	libfplist_xml_tag_t *value_tag      = NULL;
-	int number_of_entries               = 0;
-	int result                          = 0;
+	uint8_t data[ 8192 ];
+	uint8_t expected_data[ 10000 ];
+
+	const char *base64_alphabet    = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	libcerror_error_t *error       = NULL;
+	libfplist_property_t *property = NULL;
+	libfplist_xml_tag_t *key_tag   = NULL;
+	libfplist_xml_tag_t *value_tag = NULL;
+	uint8_t *base64_data           = NULL;
+	size_t base64_data_index       = 0;
+	size_t data_index              = 0;
+	ssize_t read_count             = 0;
+	uint32_t value_24bit           = 0;
+	int result                     = 0;
 
 	/* Initialize test
 	 */
-	result = libfplist_xml_tag_initialize(
-	          &key_tag,
-	          (uint8_t *) "key",
-	          3,
-	          &error );
-
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	base64_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * 16384 );
 
 	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "key_tag",
-	 key_tag );
+	 "base64_data",
+	 base64_data );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	/* Create base64 encoded data with the layout used in XML plists
+	 */
+	for( data_index = 0;
+	     data_index < 10000;
+	     data_index++ )
+	{
+		expected_data[ data_index ] = (uint8_t) ( ( data_index * 7 ) + ( data_index >> 8 ) );
+	}
+	for( data_index = 0;
+	     data_index < 9999;
+	     data_index += 3 )
+	{
+		if( ( data_index % 48 ) == 0 )
+		{
+			base64_data[ base64_data_index++ ] = (uint8_t) '\n';
+			base64_data[ base64_data_index++ ] = (uint8_t) '\t';
+		}
+		value_24bit = ( (uint32_t) expected_data[ data_index ] << 16 )
+		            | ( (uint32_t) expected_data[ data_index + 1 ] << 8 )
+		            | expected_data[ data_index + 2 ];
+
+		base64_data[ base64_data_index++ ] = (uint8_t) base64_alphabet[ ( value_24bit >> 18 ) & 0x3f ];
+		base64_data[ base64_data_index++ ] = (uint8_t) base64_alphabet[ ( value_24bit >> 12 ) & 0x3f ];
+		base64_data[ base64_data_index++ ] = (uint8_t) base64_alphabet[ ( value_24bit >> 6 ) & 0x3f ];
+		base64_data[ base64_data_index++ ] = (uint8_t) base64_alphabet[ value_24bit & 0x3f ];
+	}
+	/* The last byte is encoded with padding
+	 */
+	value_24bit = (uint32_t) expected_data[ 9999 ] << 16;
+
+	base64_data[ base64_data_index++ ] = (uint8_t) base64_alphabet[ ( value_24bit >> 18 ) & 0x3f ];
+	base64_data[ base64_data_index++ ] = (uint8_t) base64_alphabet[ ( value_24bit >> 12 ) & 0x3f ];
+	base64_data[ base64_data_index++ ] = (uint8_t) '=';
+	base64_data[ base64_data_index++ ] = (uint8_t) '=';
+	base64_data[ base64_data_index++ ] = (uint8_t) '\n';
 
 	result = libfplist_xml_tag_initialize(
-	          &value_tag,
-	          (uint8_t *) "array",
-	          5,
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3611,16 +3658,12 @@ int fplist_test_property_get_array_number_of_entries(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "value_tag",
-	 value_tag );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	result = libfplist_xml_tag_initialize(
-	          &element_tag,
+	          &value_tag,
 	          (uint8_t *) "data",
 	          4,
 	          &error );
@@ -3630,17 +3673,14 @@ int fplist_test_property_get_array_number_of_entries(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "element_tag",
-	 element_tag );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_append_element(
+	result = libfplist_xml_tag_set_value(
 	          value_tag,
-	          element_tag,
+	          base64_data,
+	          base64_data_index,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3652,7 +3692,10 @@ int fplist_test_property_get_array_number_of_entries(
 	 "error",
 	 error );
 
-	element_tag = NULL;
+	memory_free(
+	 base64_data );
+
+	base64_data = NULL;
 
 	result = libfplist_property_initialize(
 	          &property,
@@ -3665,217 +3708,213 @@ int fplist_test_property_get_array_number_of_entries(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "property",
-	 property );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	/* Test regular cases
 	 */
-	result = libfplist_property_get_array_number_of_entries(
+	read_count = libfplist_property_read_value_data_at_offset(
 	          property,
-	          &number_of_entries,
+	          data,
+	          16,
+	          0,
 	          &error );
 
+	FPLIST_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          &( expected_data[ 0 ] ),
+	          16 );
+
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "number_of_entries",
-	 number_of_entries,
-	 1 );
+	 "value_tag->number_of_value_data_checkpoints",
+	 value_tag->number_of_value_data_checkpoints,
+	 4 );
+
+	/* Test a read that crosses a checkpoint boundary
+	 */
+	read_count = libfplist_property_read_value_data_at_offset(
+	          property,
+	          data,
+	          200,
+	          3000,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 200 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfplist_property_get_array_number_of_entries(
-	          NULL,
-	          &number_of_entries,
-	          &error );
+	result = memory_compare(
+	          data,
+	          &( expected_data[ 3000 ] ),
+	          200 );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	/* Test a read of the data of multiple checkpoints
+	 */
+	read_count = libfplist_property_read_value_data_at_offset(
+	          property,
+	          data,
+	          8192,
+	          3072,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 6928 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	test_value_tag = ( (libfplist_internal_property_t *) property )->value_tag;
+	result = memory_compare(
+	          data,
+	          &( expected_data[ 3072 ] ),
+	          6928 );
 
-	( (libfplist_internal_property_t *) property )->value_tag = NULL;
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	result = libfplist_property_get_array_number_of_entries(
+	/* Test a read at the end of the data
+	 */
+	read_count = libfplist_property_read_value_data_at_offset(
 	          property,
-	          &number_of_entries,
+	          data,
+	          100,
+	          9990,
 	          &error );
 
-	( (libfplist_internal_property_t *) property )->value_tag = test_value_tag;
-
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	FPLIST_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 10 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfplist_property_get_array_number_of_entries(
-	          property,
-	          NULL,
-	          &error );
+	result = memory_compare(
+	          data,
+	          &( expected_data[ 9990 ] ),
+	          10 );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	 0 );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Clean up
-	 */
-	result = libfplist_xml_tag_free(
-	          &value_tag,
-	          &error );
-
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "value_tag",
-	 value_tag );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libfplist_xml_tag_free(
-	          &key_tag,
-	          &error );
-
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "key_tag",
-	 key_tag );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libfplist_property_free(
-	          &property,
+	read_count = libfplist_property_read_value_data_at_offset(
+	          property,
+	          data,
+	          100,
+	          10000,
 	          &error );
 
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "property",
-	 property );
+	FPLIST_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Initialize test
+	/* Test error cases
 	 */
-	result = libfplist_xml_tag_initialize(
-	          &key_tag,
-	          (uint8_t *) "key",
-	          3,
+	read_count = libfplist_property_read_value_data_at_offset(
+	          NULL,
+	          data,
+	          16,
+	          0,
 	          &error );
 
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	FPLIST_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
 
 	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "key_tag",
-	 key_tag );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_initialize(
-	          &value_tag,
-	          (uint8_t *) "unknown",
-	          7,
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfplist_property_read_value_data_at_offset(
+	          property,
+	          NULL,
+	          16,
+	          0,
 	          &error );
 
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	FPLIST_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
 
 	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "value_tag",
-	 value_tag );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_property_initialize(
-	          &property,
-	          key_tag,
-	          value_tag,
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfplist_property_read_value_data_at_offset(
+	          property,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
 	          &error );
 
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	FPLIST_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
 
 	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "property",
-	 property );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test with unsupported value type
-	 */
-	result = libfplist_property_get_array_number_of_entries(
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfplist_property_read_value_data_at_offset(
 	          property,
-	          &number_of_entries,
+	          data,
+	          16,
+	          -1,
 	          &error );
 
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	FPLIST_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
 
 	FPLIST_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -3886,8 +3925,8 @@ int fplist_test_property_get_array_number_of_entries(
 
 	/* Clean up
 	 */
-	result = libfplist_xml_tag_free(
-	          &value_tag,
+	result = libfplist_property_free(
+	          &property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3895,16 +3934,12 @@ int fplist_test_property_get_array_number_of_entries(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "value_tag",
-	 value_tag );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	result = libfplist_xml_tag_free(
-	          &key_tag,
+	          &value_tag,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3912,16 +3947,12 @@ int fplist_test_property_get_array_number_of_entries(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "key_tag",
-	 key_tag );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_property_free(
-	          &property,
+	result = libfplist_xml_tag_free(
+	          &key_tag,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -3929,10 +3960,6 @@ int fplist_test_property_get_array_number_of_entries(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "property",
-	 property );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
@@ -3945,10 +3972,10 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( element_tag != NULL )
+	if( property != NULL )
 	{
-		libfplist_xml_tag_free(
-		 &element_tag,
+		libfplist_property_free(
+		 &property,
 		 NULL );
 	}
 	if( value_tag != NULL )
@@ -3963,28 +3990,26 @@ on_error:
 		 &key_tag,
 		 NULL );
 	}
-	if( property != NULL )
+	if( base64_data != NULL )
 	{
-		libfplist_property_free(
-		 &property,
-		 NULL );
+		memory_free(
+		 base64_data );
 	}
 	return( 0 );
 }
 
-/* Tests the libfplist_property_get_array_entry_by_index function
+/* Tests the libfplist_property_get_value_integer function
  * Returns 1 if successful or 0 if not
  */
-int fplist_test_property_get_array_entry_by_index(
+int fplist_test_property_get_value_integer(
      void )
 {
 	libcerror_error_t *error            = NULL;
-	libfplist_property_t *array_entry   = NULL;
 	libfplist_property_t *property      = NULL;
-	libfplist_xml_tag_t *element_tag    = NULL;
 	libfplist_xml_tag_t *key_tag        = NULL;
 	libfplist_xml_tag_t *test_value_tag = NULL;
 	libfplist_xml_tag_t *value_tag      = NULL;
+	uint64_t value_64bit                = 0;
 	int result                          = 0;
 
 	/* Initialize test
@@ -4010,8 +4035,8 @@ int fplist_test_property_get_array_entry_by_index(
 
 	result = libfplist_xml_tag_initialize(
 	          &value_tag,
-	          (uint8_t *) "array",
-	          5,
+	          (uint8_t *) "integer",
+	          7,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4027,10 +4052,10 @@ int fplist_test_property_get_array_entry_by_index(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_initialize(
-	          &element_tag,
-	          (uint8_t *) "data",
-	          4,
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4039,16 +4064,19 @@ int fplist_test_property_get_array_entry_by_index(
 	 1 );
 
 	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "element_tag",
-	 element_tag );
+	 "property",
+	 property );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_append_element(
+	/* Test regular cases
+	 */
+	result = libfplist_xml_tag_set_value(
 	          value_tag,
-	          element_tag,
+	          (uint8_t *) "1234567890",
+	          10,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4060,12 +4088,9 @@ int fplist_test_property_get_array_entry_by_index(
 	 "error",
 	 error );
 
-	element_tag = NULL;
-
-	result = libfplist_property_initialize(
-	          &property,
-	          key_tag,
-	          value_tag,
+	result = libfplist_property_get_value_integer(
+	          property,
+	          &value_64bit,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4073,22 +4098,19 @@ int fplist_test_property_get_array_entry_by_index(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "property",
-	 property );
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 1234567890 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	array_entry = NULL;
-
-	result = libfplist_property_get_array_entry_by_index(
-	          property,
-	          0,
-	          &array_entry,
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "0xabcdef",
+	          8,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4096,18 +4118,13 @@ int fplist_test_property_get_array_entry_by_index(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "array_entry",
-	 array_entry );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Clean up
-	 */
-	result = libfplist_property_free(
-	          &array_entry,
+	result = libfplist_property_get_value_integer(
+	          property,
+	          &value_64bit,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4115,9 +4132,10 @@ int fplist_test_property_get_array_entry_by_index(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "array_entry",
-	 array_entry );
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0xabcdef );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -4125,12 +4143,9 @@ int fplist_test_property_get_array_entry_by_index(
 
 	/* Test error cases
 	 */
-	array_entry = NULL;
-
-	result = libfplist_property_get_array_entry_by_index(
+	result = libfplist_property_get_value_integer(
 	          NULL,
-	          0,
-	          &array_entry,
+	          &value_64bit,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4149,10 +4164,9 @@ int fplist_test_property_get_array_entry_by_index(
 
 	( (libfplist_internal_property_t *) property )->value_tag = NULL;
 
-	result = libfplist_property_get_array_entry_by_index(
+	result = libfplist_property_get_value_integer(
 	          property,
-	          0,
-	          &array_entry,
+	          &value_64bit,
 	          &error );
 
 	( (libfplist_internal_property_t *) property )->value_tag = test_value_tag;
@@ -4169,10 +4183,9 @@ int fplist_test_property_get_array_entry_by_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfplist_property_get_array_entry_by_index(
+	result = libfplist_property_get_value_integer(
 	          property,
-	          -1,
-	          &array_entry,
+	          NULL,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4187,33 +4200,156 @@ int fplist_test_property_get_array_entry_by_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfplist_property_get_array_entry_by_index(
-	          property,
-	          0,
-	          NULL,
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "-1",
+	          2,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
+	result = libfplist_property_get_value_integer(
+	          property,
+	          &value_64bit,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
 	 &error );
 
-	array_entry = (libfplist_property_t *) 0x12345678UL;
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
 
-	result = libfplist_property_get_array_entry_by_index(
-	          property,
-	          0,
-	          &array_entry,
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
 	          &error );
 
-	array_entry = NULL;
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "unknown",
+	          7,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with unsupported value type
+	 */
+	result = libfplist_property_get_value_integer(
+	          property,
+	          &value_64bit,
+	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -4303,7 +4439,7 @@ int fplist_test_property_get_array_entry_by_index(
 
 	result = libfplist_xml_tag_initialize(
 	          &value_tag,
-	          (uint8_t *) "unknown",
+	          (uint8_t *) "integer",
 	          7,
 	          &error );
 
@@ -4339,12 +4475,11 @@ int fplist_test_property_get_array_entry_by_index(
 	 "error",
 	 error );
 
-	/* Test with unsupported value type
+	/* Test with missing value data
 	 */
-	result = libfplist_property_get_array_entry_by_index(
+	result = libfplist_property_get_value_integer(
 	          property,
-	          0,
-	          &array_entry,
+	          &value_64bit,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4420,12 +4555,6 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( element_tag != NULL )
-	{
-		libfplist_xml_tag_free(
-		 &element_tag,
-		 NULL );
-	}
 	if( value_tag != NULL )
 	{
 		libfplist_xml_tag_free(
@@ -4447,20 +4576,18 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfplist_property_get_sub_property_by_utf8_name function
+/* Tests the libfplist_property_get_value_signed_integer function
  * Returns 1 if successful or 0 if not
  */
-int fplist_test_property_get_sub_property_by_utf8_name(
+int fplist_test_property_get_value_signed_integer(
      void )
 {
 	libcerror_error_t *error            = NULL;
 	libfplist_property_t *property      = NULL;
-	libfplist_property_t *sub_property  = NULL;
-	libfplist_xml_tag_t *element_tag1   = NULL;
-	libfplist_xml_tag_t *element_tag2   = NULL;
 	libfplist_xml_tag_t *key_tag        = NULL;
 	libfplist_xml_tag_t *test_value_tag = NULL;
 	libfplist_xml_tag_t *value_tag      = NULL;
+	int64_t value_64bit                 = 0;
 	int result                          = 0;
 
 	/* Initialize test
@@ -4486,8 +4613,8 @@ int fplist_test_property_get_sub_property_by_utf8_name(
 
 	result = libfplist_xml_tag_initialize(
 	          &value_tag,
-	          (uint8_t *) "dict",
-	          4,
+	          (uint8_t *) "integer",
+	          7,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4503,9 +4630,30 @@ int fplist_test_property_get_sub_property_by_utf8_name(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_initialize(
-	          &element_tag1,
-	          (uint8_t *) "key",
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "-42",
 	          3,
 	          &error );
 
@@ -4514,18 +4662,9221 @@ int fplist_test_property_get_sub_property_by_utf8_name(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "element_tag1",
-	 element_tag1 );
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_signed_integer(
+	          property,
+	          &value_64bit,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT64(
+	 "value_64bit",
+	 value_64bit,
+	 (int64_t) -42 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "9223372036854775807",
+	          19,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_signed_integer(
+	          property,
+	          &value_64bit,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT64(
+	 "value_64bit",
+	 value_64bit,
+	 (int64_t) INT64_MAX );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_get_value_signed_integer(
+	          NULL,
+	          &value_64bit,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	test_value_tag = ( (libfplist_internal_property_t *) property )->value_tag;
+
+	( (libfplist_internal_property_t *) property )->value_tag = NULL;
+
+	result = libfplist_property_get_value_signed_integer(
+	          property,
+	          &value_64bit,
+	          &error );
+
+	( (libfplist_internal_property_t *) property )->value_tag = test_value_tag;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_value_signed_integer(
+	          property,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "9223372036854775808",
+	          19,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_signed_integer(
+	          property,
+	          &value_64bit,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "unknown",
+	          7,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with unsupported value type
+	 */
+	result = libfplist_property_get_value_signed_integer(
+	          property,
+	          &value_64bit,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "integer",
+	          7,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with missing value data
+	 */
+	result = libfplist_property_get_value_signed_integer(
+	          property,
+	          &value_64bit,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &value_tag,
+		 NULL );
+	}
+	if( key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &key_tag,
+		 NULL );
+	}
+	if( property != NULL )
+	{
+		libfplist_property_free(
+		 &property,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_get_value_128bit_integer function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_get_value_128bit_integer(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfplist_property_t *property      = NULL;
+	libfplist_xml_tag_t *key_tag        = NULL;
+	libfplist_xml_tag_t *test_value_tag = NULL;
+	libfplist_xml_tag_t *value_tag      = NULL;
+	uint64_t value_lower_64bit          = 0;
+	uint64_t value_upper_64bit          = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "integer",
+	          7,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "-1",
+	          2,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_128bit_integer(
+	          property,
+	          &value_upper_64bit,
+	          &value_lower_64bit,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_upper_64bit",
+	 value_upper_64bit,
+	 (uint64_t) 0xffffffffffffffffULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_lower_64bit",
+	 value_lower_64bit,
+	 (uint64_t) 0xffffffffffffffffULL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "0xabcdef",
+	          8,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_128bit_integer(
+	          property,
+	          &value_upper_64bit,
+	          &value_lower_64bit,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_upper_64bit",
+	 value_upper_64bit,
+	 (uint64_t) 0 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_lower_64bit",
+	 value_lower_64bit,
+	 (uint64_t) 0xabcdef );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_get_value_128bit_integer(
+	          NULL,
+	          &value_upper_64bit,
+	          &value_lower_64bit,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	test_value_tag = ( (libfplist_internal_property_t *) property )->value_tag;
+
+	( (libfplist_internal_property_t *) property )->value_tag = NULL;
+
+	result = libfplist_property_get_value_128bit_integer(
+	          property,
+	          &value_upper_64bit,
+	          &value_lower_64bit,
+	          &error );
+
+	( (libfplist_internal_property_t *) property )->value_tag = test_value_tag;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_value_128bit_integer(
+	          property,
+	          NULL,
+	          &value_lower_64bit,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_value_128bit_integer(
+	          property,
+	          &value_upper_64bit,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "unknown",
+	          7,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with unsupported value type
+	 */
+	result = libfplist_property_get_value_128bit_integer(
+	          property,
+	          &value_upper_64bit,
+	          &value_lower_64bit,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "integer",
+	          7,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with missing value data
+	 */
+	result = libfplist_property_get_value_128bit_integer(
+	          property,
+	          &value_upper_64bit,
+	          &value_lower_64bit,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &value_tag,
+		 NULL );
+	}
+	if( key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &key_tag,
+		 NULL );
+	}
+	if( property != NULL )
+	{
+		libfplist_property_free(
+		 &property,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_get_value_floating_point function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_get_value_floating_point(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfplist_property_t *property      = NULL;
+	libfplist_xml_tag_t *key_tag        = NULL;
+	libfplist_xml_tag_t *test_value_tag = NULL;
+	libfplist_xml_tag_t *value_tag      = NULL;
+	uint64_t value_64bit                = 0;
+	double value_floating_point         = 0.0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "real",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "3.14",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_floating_point(
+	          property,
+	          &value_floating_point,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_copy(
+	 &value_64bit,
+	 &value_floating_point,
+	 sizeof( double ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x40091eb851eb851fULL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "-inf",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_floating_point(
+	          property,
+	          &value_floating_point,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_copy(
+	 &value_64bit,
+	 &value_floating_point,
+	 sizeof( double ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0xfff0000000000000ULL );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_get_value_floating_point(
+	          NULL,
+	          &value_floating_point,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	test_value_tag = ( (libfplist_internal_property_t *) property )->value_tag;
+
+	( (libfplist_internal_property_t *) property )->value_tag = NULL;
+
+	result = libfplist_property_get_value_floating_point(
+	          property,
+	          &value_floating_point,
+	          &error );
+
+	( (libfplist_internal_property_t *) property )->value_tag = test_value_tag;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_value_floating_point(
+	          property,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "3,14",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_floating_point(
+	          property,
+	          &value_floating_point,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "unknown",
+	          7,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with unsupported value type
+	 */
+	result = libfplist_property_get_value_floating_point(
+	          property,
+	          &value_floating_point,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "real",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with missing value data
+	 */
+	result = libfplist_property_get_value_floating_point(
+	          property,
+	          &value_floating_point,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &value_tag,
+		 NULL );
+	}
+	if( key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &key_tag,
+		 NULL );
+	}
+	if( property != NULL )
+	{
+		libfplist_property_free(
+		 &property,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_get_value_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_get_value_string(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfplist_property_t *property      = NULL;
+	libfplist_xml_tag_t *key_tag        = NULL;
+	libfplist_xml_tag_t *test_value_tag = NULL;
+	libfplist_xml_tag_t *value_tag      = NULL;
+	uint8_t *value_string               = NULL;
+	size_t value_string_size            = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "string",
+	          6,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "ABCDEFGHIJ",
+	          10,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_property_get_value_string(
+	          property,
+	          &value_string,
+	          &value_string_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_string",
+	 value_string );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "value_string_size",
+	 value_string_size,
+	 (size_t) 11 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          value_string,
+	          "ABCDEFGHIJ",
+	          11 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+/* TODO change libfplist_property_get_value_string to be an internal function */
+	memory_free(
+	 value_string );
+
+	value_string = NULL;
+
+	/* Test error cases
+	 */
+	result = libfplist_property_get_value_string(
+	          NULL,
+	          &value_string,
+	          &value_string_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	test_value_tag = ( (libfplist_internal_property_t *) property )->value_tag;
+
+	( (libfplist_internal_property_t *) property )->value_tag = NULL;
+
+	result = libfplist_property_get_value_string(
+	          property,
+	          &value_string,
+	          &value_string_size,
+	          &error );
+
+	( (libfplist_internal_property_t *) property )->value_tag = test_value_tag;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_value_string(
+	          property,
+	          NULL,
+	          &value_string_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_value_string(
+	          property,
+	          &value_string,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "unknown",
+	          7,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with unsupported value type
+	 */
+	result = libfplist_property_get_value_string(
+	          property,
+	          &value_string,
+	          &value_string_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "string",
+	          6,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with missing value data
+	 */
+	result = libfplist_property_get_value_string(
+	          property,
+	          &value_string,
+	          &value_string_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &value_tag,
+		 NULL );
+	}
+	if( key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &key_tag,
+		 NULL );
+	}
+	if( property != NULL )
+	{
+		libfplist_property_free(
+		 &property,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_value_uuid_string_copy_to_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_value_uuid_string_copy_to_byte_stream(
+     void )
+{
+	uint8_t expected_uuid_data[ 16 ] = {
+		0xc3, 0x1c, 0x54, 0x34, 0x7b, 0xa4, 0x4f, 0xfa, 0xbd, 0x67, 0x99, 0xd9, 0x7a, 0x0a, 0xda, 0x0e };
+
+	uint8_t uuid_data[ 16 ];
+
+	libcerror_error_t *error            = NULL;
+	libfplist_property_t *property      = NULL;
+	libfplist_xml_tag_t *key_tag        = NULL;
+	libfplist_xml_tag_t *test_value_tag = NULL;
+	libfplist_xml_tag_t *value_tag      = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "string",
+	          6,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "C31C5434-7BA4-4FFA-BD67-99D97A0ADA0E",
+	          37,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_property_value_uuid_string_copy_to_byte_stream(
+	          property,
+	          uuid_data,
+	          16,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uuid_data,
+	          expected_uuid_data,
+	          16 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_value_uuid_string_copy_to_byte_stream(
+	          NULL,
+	          uuid_data,
+	          16,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	test_value_tag = ( (libfplist_internal_property_t *) property )->value_tag;
+
+	( (libfplist_internal_property_t *) property )->value_tag = NULL;
+
+	result = libfplist_property_value_uuid_string_copy_to_byte_stream(
+	          property,
+	          uuid_data,
+	          16,
+	          &error );
+
+	( (libfplist_internal_property_t *) property )->value_tag = test_value_tag;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_value_uuid_string_copy_to_byte_stream(
+	          property,
+	          NULL,
+	          16,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_value_uuid_string_copy_to_byte_stream(
+	          property,
+	          uuid_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FPLIST_TEST_MEMORY ) && defined( OPTIMIZATION_DISABLED )
+
+	/* Test libfplist_property_value_uuid_string_copy_to_byte_stream with memcpy failing in libfplist_uuid_copy_from_utf8_string
+	 */
+	fplist_test_memcpy_attempts_before_fail = 0;
+
+	result = libfplist_property_value_uuid_string_copy_to_byte_stream(
+	          property,
+	          uuid_data,
+	          16,
+	          &error );
+
+	if( fplist_test_memcpy_attempts_before_fail != -1 )
+	{
+		fplist_test_memcpy_attempts_before_fail = -1;
+	}
+	else
+	{
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FPLIST_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FPLIST_TEST_MEMORY ) && defined( OPTIMIZATION_DISABLED ) */
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "unknown",
+	          7,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with unsupported value type
+	 */
+	result = libfplist_property_value_uuid_string_copy_to_byte_stream(
+	          property,
+	          uuid_data,
+	          16,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "string",
+	          6,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "BOGUS",
+	          5,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with invalid value data
+	 */
+	result = libfplist_property_value_uuid_string_copy_to_byte_stream(
+	          property,
+	          uuid_data,
+	          16,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &value_tag,
+		 NULL );
+	}
+	if( key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &key_tag,
+		 NULL );
+	}
+	if( property != NULL )
+	{
+		libfplist_property_free(
+		 &property,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_get_value_date_time function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_get_value_date_time(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfplist_property_t *property    = NULL;
+	libfplist_xml_tag_t *key_tag      = NULL;
+	libfplist_xml_tag_t *value_tag    = NULL;
+	int64_t posix_time_in_nanoseconds = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "date",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "2016-10-17T08:42:05.5Z",
+	          22,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_property_get_value_date_time(
+	          property,
+	          &posix_time_in_nanoseconds,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time_in_nanoseconds",
+	 posix_time_in_nanoseconds,
+	 (int64_t) 1476693725500000000LL );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_get_value_date_time(
+	          NULL,
+	          &posix_time_in_nanoseconds,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_value_date_time(
+	          property,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a value that is not a supported date and time
+	 */
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "2016-10-17",
+	          10,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_date_time(
+	          property,
+	          &posix_time_in_nanoseconds,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( property != NULL )
+	{
+		libfplist_property_free(
+		 &property,
+		 NULL );
+	}
+	if( value_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &value_tag,
+		 NULL );
+	}
+	if( key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &key_tag,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_get_value_filetime function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_get_value_filetime(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfplist_property_t *property = NULL;
+	libfplist_xml_tag_t *key_tag   = NULL;
+	libfplist_xml_tag_t *value_tag = NULL;
+	uint64_t filetime              = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "date",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "2016-10-17T08:42:05.5Z",
+	          22,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_property_get_value_filetime(
+	          property,
+	          &filetime,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "filetime",
+	 filetime,
+	 (uint64_t) 131211673255000000ULL );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_get_value_filetime(
+	          NULL,
+	          &filetime,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_value_filetime(
+	          property,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a value that is not a supported date and time
+	 */
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "2016-10-17",
+	          10,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_filetime(
+	          property,
+	          &filetime,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( property != NULL )
+	{
+		libfplist_property_free(
+		 &property,
+		 NULL );
+	}
+	if( value_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &value_tag,
+		 NULL );
+	}
+	if( key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &key_tag,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_copy_array_to_date_time function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_copy_array_to_date_time(
+     void )
+{
+	int64_t date_time_values[ 4 ];
+
+	libcerror_error_t *error         = NULL;
+	libfplist_property_t *property   = NULL;
+	libfplist_xml_tag_t *element_tag = NULL;
+	libfplist_xml_tag_t *key_tag     = NULL;
+	libfplist_xml_tag_t *value_tag   = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "array",
+	          5,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "date",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          element_tag,
+	          (uint8_t *) "2016-10-17T08:42:05Z",
+	          20,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "text",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "date",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          element_tag,
+	          (uint8_t *) "2000-02-29T23:59:59.125Z",
+	          24,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_property_copy_array_to_date_time(
+	          property,
+	          date_time_values,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT64(
+	 "date_time_values[ 0 ]",
+	 date_time_values[ 0 ],
+	 (int64_t) 1476693725000000000LL );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT64(
+	 "date_time_values[ 1 ]",
+	 date_time_values[ 1 ],
+	 (int64_t) 951868799125000000LL );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_copy_array_to_date_time(
+	          NULL,
+	          date_time_values,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_date_time(
+	          property,
+	          NULL,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_date_time(
+	          property,
+	          date_time_values,
+	          -1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_date_time(
+	          property,
+	          date_time_values,
+	          1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an array entry that is not a date and time
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "integer",
+	          7,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          element_tag,
+	          (uint8_t *) "1",
+	          1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_property_copy_array_to_date_time(
+	          property,
+	          date_time_values,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( property != NULL )
+	{
+		libfplist_property_free(
+		 &property,
+		 NULL );
+	}
+	if( element_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &element_tag,
+		 NULL );
+	}
+	if( value_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &value_tag,
+		 NULL );
+	}
+	if( key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &key_tag,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_copy_array_to_int64 function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_copy_array_to_int64(
+     void )
+{
+	int64_t integer_values[ 4 ];
+
+	libcerror_error_t *error         = NULL;
+	libfplist_property_t *property   = NULL;
+	libfplist_xml_tag_t *element_tag = NULL;
+	libfplist_xml_tag_t *key_tag     = NULL;
+	libfplist_xml_tag_t *value_tag   = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "array",
+	          5,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "integer",
+	          7,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          element_tag,
+	          (uint8_t *) "-42",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "text",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "integer",
+	          7,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          element_tag,
+	          (uint8_t *) "0x10",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_property_copy_array_to_int64(
+	          property,
+	          integer_values,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT64(
+	 "integer_values[ 0 ]",
+	 integer_values[ 0 ],
+	 (int64_t) -42 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT64(
+	 "integer_values[ 1 ]",
+	 integer_values[ 1 ],
+	 (int64_t) 16 );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_copy_array_to_int64(
+	          NULL,
+	          integer_values,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_int64(
+	          property,
+	          NULL,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_int64(
+	          property,
+	          integer_values,
+	          -1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_int64(
+	          property,
+	          integer_values,
+	          1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an array entry that is not an integer
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "string",
+	          6,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          element_tag,
+	          (uint8_t *) "1",
+	          1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_property_copy_array_to_int64(
+	          property,
+	          integer_values,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( property != NULL )
+	{
+		libfplist_property_free(
+		 &property,
+		 NULL );
+	}
+	if( element_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &element_tag,
+		 NULL );
+	}
+	if( value_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &value_tag,
+		 NULL );
+	}
+	if( key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &key_tag,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_copy_array_to_double function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_copy_array_to_double(
+     void )
+{
+	double floating_point_values[ 4 ];
+
+	libcerror_error_t *error         = NULL;
+	libfplist_property_t *property   = NULL;
+	libfplist_xml_tag_t *element_tag = NULL;
+	libfplist_xml_tag_t *key_tag     = NULL;
+	libfplist_xml_tag_t *value_tag   = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "array",
+	          5,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "real",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          element_tag,
+	          (uint8_t *) "0.5",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "text",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "real",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          element_tag,
+	          (uint8_t *) "-1.25e0",
+	          7,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_property_copy_array_to_double(
+	          property,
+	          floating_point_values,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_FLOAT(
+	 "floating_point_values[ 0 ]",
+	 floating_point_values[ 0 ],
+	 0.5 );
+
+	FPLIST_TEST_ASSERT_EQUAL_FLOAT(
+	 "floating_point_values[ 1 ]",
+	 floating_point_values[ 1 ],
+	 -1.25 );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_copy_array_to_double(
+	          NULL,
+	          floating_point_values,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_double(
+	          property,
+	          NULL,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_double(
+	          property,
+	          floating_point_values,
+	          -1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_double(
+	          property,
+	          floating_point_values,
+	          1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an array entry that is not a floating point
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "string",
+	          6,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          element_tag,
+	          (uint8_t *) "1",
+	          1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_property_copy_array_to_double(
+	          property,
+	          floating_point_values,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( property != NULL )
+	{
+		libfplist_property_free(
+		 &property,
+		 NULL );
+	}
+	if( element_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &element_tag,
+		 NULL );
+	}
+	if( value_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &value_tag,
+		 NULL );
+	}
+	if( key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &key_tag,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_copy_array_to_bool function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_copy_array_to_bool(
+     void )
+{
+	uint8_t boolean_values[ 4 ];
+
+	libcerror_error_t *error         = NULL;
+	libfplist_property_t *property   = NULL;
+	libfplist_xml_tag_t *element_tag = NULL;
+	libfplist_xml_tag_t *key_tag     = NULL;
+	libfplist_xml_tag_t *value_tag   = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "array",
+	          5,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "true",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "text",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "false",
+	          5,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_property_copy_array_to_bool(
+	          property,
+	          boolean_values,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "boolean_values[ 0 ]",
+	 boolean_values[ 0 ],
+	 (uint8_t) 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "boolean_values[ 1 ]",
+	 boolean_values[ 1 ],
+	 (uint8_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_copy_array_to_bool(
+	          NULL,
+	          boolean_values,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_bool(
+	          property,
+	          NULL,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_bool(
+	          property,
+	          boolean_values,
+	          -1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_bool(
+	          property,
+	          boolean_values,
+	          1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an array entry that is not a boolean
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "string",
+	          6,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          element_tag,
+	          (uint8_t *) "1",
+	          1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_property_copy_array_to_bool(
+	          property,
+	          boolean_values,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( property != NULL )
+	{
+		libfplist_property_free(
+		 &property,
+		 NULL );
+	}
+	if( element_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &element_tag,
+		 NULL );
+	}
+	if( value_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &value_tag,
+		 NULL );
+	}
+	if( key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &key_tag,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_get_array_utf8_strings_size and libfplist_property_copy_array_to_utf8_strings functions
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_copy_array_to_utf8_strings(
+     void )
+{
+	uint8_t utf8_strings[ 32 ];
+	size_t utf8_string_offsets[ 4 ];
+
+	libcerror_error_t *error                 = NULL;
+	libfplist_property_t *array_property     = NULL;
+	libfplist_property_t *entries_property   = NULL;
+	libfplist_property_t *entry_property     = NULL;
+	libfplist_property_t *root_property      = NULL;
+	libfplist_property_list_t *property_list = NULL;
+	size_t utf8_strings_size                 = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_copy_from_byte_stream(
+	          property_list,
+	          fplist_test_property_data2,
+	          522,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_get_root_property(
+	          property_list,
+	          &root_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "Entries",
+	          7,
+	          &entries_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_array_entry_by_index(
+	          entries_property,
+	          0,
+	          &entry_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          entry_property,
+	          (uint8_t *) "Aliases",
+	          7,
+	          &array_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_property_get_array_utf8_strings_size(
+	          array_property,
+	          NULL,
+	          0,
+	          &utf8_strings_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_strings_size",
+	 utf8_strings_size,
+	 (size_t) 3 );
+
+	result = libfplist_property_copy_array_to_utf8_strings(
+	          array_property,
+	          NULL,
+	          0,
+	          utf8_strings,
+	          32,
+	          utf8_string_offsets,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_offsets[ 0 ]",
+	 utf8_string_offsets[ 0 ],
+	 (size_t) 0 );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_offsets[ 1 ]",
+	 utf8_string_offsets[ 1 ],
+	 (size_t) 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_offsets[ 2 ]",
+	 utf8_string_offsets[ 2 ],
+	 (size_t) 3 );
+
+	result = memory_compare(
+	          &( utf8_strings[ 0 ] ),
+	          "abc",
+	          3 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfplist_property_get_array_utf8_strings_size(
+	          entries_property,
+	          (uint8_t *) "Name",
+	          4,
+	          &utf8_strings_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_strings_size",
+	 utf8_strings_size,
+	 (size_t) 5 );
+
+	result = libfplist_property_copy_array_to_utf8_strings(
+	          entries_property,
+	          (uint8_t *) "Name",
+	          4,
+	          utf8_strings,
+	          32,
+	          utf8_string_offsets,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_offsets[ 0 ]",
+	 utf8_string_offsets[ 0 ],
+	 (size_t) 0 );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_offsets[ 1 ]",
+	 utf8_string_offsets[ 1 ],
+	 (size_t) 5 );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_offsets[ 2 ]",
+	 utf8_string_offsets[ 2 ],
+	 (size_t) 5 );
+
+	result = memory_compare(
+	          &( utf8_strings[ 0 ] ),
+	          "First",
+	          5 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfplist_property_get_array_utf8_strings_size(
+	          entries_property,
+	          (uint8_t *) "Details/Kind",
+	          12,
+	          &utf8_strings_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_strings_size",
+	 utf8_strings_size,
+	 (size_t) 13 );
+
+	result = libfplist_property_copy_array_to_utf8_strings(
+	          entries_property,
+	          (uint8_t *) "Details/Kind",
+	          12,
+	          utf8_strings,
+	          32,
+	          utf8_string_offsets,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_offsets[ 0 ]",
+	 utf8_string_offsets[ 0 ],
+	 (size_t) 0 );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_offsets[ 1 ]",
+	 utf8_string_offsets[ 1 ],
+	 (size_t) 4 );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_offsets[ 2 ]",
+	 utf8_string_offsets[ 2 ],
+	 (size_t) 13 );
+
+	result = memory_compare(
+	          &( utf8_strings[ 0 ] ),
+	          "filedirectory",
+	          13 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_get_array_utf8_strings_size(
+	          NULL,
+	          (uint8_t *) "Name",
+	          4,
+	          &utf8_strings_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_array_utf8_strings_size(
+	          entries_property,
+	          NULL,
+	          4,
+	          &utf8_strings_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_array_utf8_strings_size(
+	          entries_property,
+	          (uint8_t *) "Name",
+	          (size_t) SSIZE_MAX,
+	          &utf8_strings_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_array_utf8_strings_size(
+	          entries_property,
+	          (uint8_t *) "Name",
+	          4,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_array_utf8_strings_size(
+	          root_property,
+	          (uint8_t *) "Name",
+	          4,
+	          &utf8_strings_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with array entries that are not string values
+	 */
+	result = libfplist_property_get_array_utf8_strings_size(
+	          entries_property,
+	          NULL,
+	          0,
+	          &utf8_strings_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a key path that is not present in every array entry
+	 */
+	result = libfplist_property_get_array_utf8_strings_size(
+	          entries_property,
+	          (uint8_t *) "Aliases",
+	          7,
+	          &utf8_strings_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_array_utf8_strings_size(
+	          entries_property,
+	          (uint8_t *) "Name/Sub",
+	          8,
+	          &utf8_strings_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_utf8_strings(
+	          NULL,
+	          (uint8_t *) "Name",
+	          4,
+	          utf8_strings,
+	          32,
+	          utf8_string_offsets,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_utf8_strings(
+	          entries_property,
+	          (uint8_t *) "Name",
+	          4,
+	          NULL,
+	          32,
+	          utf8_string_offsets,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_utf8_strings(
+	          entries_property,
+	          (uint8_t *) "Name",
+	          4,
+	          utf8_strings,
+	          (size_t) SSIZE_MAX + 1,
+	          utf8_string_offsets,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_utf8_strings(
+	          entries_property,
+	          (uint8_t *) "Name",
+	          4,
+	          utf8_strings,
+	          32,
+	          NULL,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_utf8_strings(
+	          entries_property,
+	          (uint8_t *) "Name",
+	          4,
+	          utf8_strings,
+	          32,
+	          utf8_string_offsets,
+	          -1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_utf8_strings(
+	          entries_property,
+	          (uint8_t *) "Name",
+	          4,
+	          utf8_strings,
+	          32,
+	          utf8_string_offsets,
+	          2,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_utf8_strings(
+	          entries_property,
+	          (uint8_t *) "Name",
+	          4,
+	          utf8_strings,
+	          4,
+	          utf8_string_offsets,
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_free(
+	          &array_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &entry_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &entries_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &root_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( array_property != NULL )
+	{
+		libfplist_property_free(
+		 &array_property,
+		 NULL );
+	}
+	if( entry_property != NULL )
+	{
+		libfplist_property_free(
+		 &entry_property,
+		 NULL );
+	}
+	if( entries_property != NULL )
+	{
+		libfplist_property_free(
+		 &entries_property,
+		 NULL );
+	}
+	if( root_property != NULL )
+	{
+		libfplist_property_free(
+		 &root_property,
+		 NULL );
+	}
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_copy_array_to_uuid_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_copy_array_to_uuid_byte_stream(
+     void )
+{
+	uint8_t expected_uuid_data[ 32 ] = {
+		0xc3, 0x1c, 0x54, 0x34, 0x7b, 0xa4, 0x4f, 0xfa, 0xbd, 0x67, 0x99, 0xd9, 0x7a, 0x0a, 0xda, 0x0e,
+		0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff };
+
+	uint8_t uuid_data[ 64 ];
+
+	libcerror_error_t *error         = NULL;
+	libfplist_property_t *property   = NULL;
+	libfplist_xml_tag_t *element_tag = NULL;
+	libfplist_xml_tag_t *key_tag     = NULL;
+	libfplist_xml_tag_t *value_tag   = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "array",
+	          5,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "string",
+	          6,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          element_tag,
+	          (uint8_t *) "C31C5434-7BA4-4FFA-BD67-99D97A0ADA0E",
+	          36,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "text",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "string",
+	          6,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          element_tag,
+	          (uint8_t *) "00112233-4455-6677-8899-aabbccddeeff",
+	          36,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_property_copy_array_to_uuid_byte_stream(
+	          property,
+	          uuid_data,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uuid_data,
+	          expected_uuid_data,
+	          32 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_copy_array_to_uuid_byte_stream(
+	          NULL,
+	          uuid_data,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_uuid_byte_stream(
+	          property,
+	          NULL,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_uuid_byte_stream(
+	          property,
+	          uuid_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_copy_array_to_uuid_byte_stream(
+	          property,
+	          uuid_data,
+	          31,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an array entry that is not an UUID string
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "string",
+	          6,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          element_tag,
+	          (uint8_t *) "C31C5434-7BA4-4FFA-BD67",
+	          23,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_property_copy_array_to_uuid_byte_stream(
+	          property,
+	          uuid_data,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( property != NULL )
+	{
+		libfplist_property_free(
+		 &property,
+		 NULL );
+	}
+	if( element_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &element_tag,
+		 NULL );
+	}
+	if( value_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &value_tag,
+		 NULL );
+	}
+	if( key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &key_tag,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_get_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_get_number_of_entries(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfplist_property_t *property      = NULL;
+	libfplist_xml_tag_t *element_tag    = NULL;
+	libfplist_xml_tag_t *key_tag        = NULL;
+	libfplist_xml_tag_t *test_value_tag = NULL;
+	libfplist_xml_tag_t *value_tag      = NULL;
+	int number_of_entries               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "dict",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "element_tag",
+	 element_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "data",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "element_tag",
+	 element_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_property_get_number_of_entries(
+	          property,
+	          &number_of_entries,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_get_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	test_value_tag = ( (libfplist_internal_property_t *) property )->value_tag;
+
+	( (libfplist_internal_property_t *) property )->value_tag = NULL;
+
+	result = libfplist_property_get_number_of_entries(
+	          property,
+	          &number_of_entries,
+	          &error );
+
+	( (libfplist_internal_property_t *) property )->value_tag = test_value_tag;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_number_of_entries(
+	          property,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "unknown",
+	          7,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with unsupported value type
+	 */
+	result = libfplist_property_get_number_of_entries(
+	          property,
+	          &number_of_entries,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( element_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &element_tag,
+		 NULL );
+	}
+	if( value_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &value_tag,
+		 NULL );
+	}
+	if( key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &key_tag,
+		 NULL );
+	}
+	if( property != NULL )
+	{
+		libfplist_property_free(
+		 &property,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_get_array_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_get_array_number_of_entries(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfplist_property_t *property      = NULL;
+	libfplist_xml_tag_t *element_tag    = NULL;
+	libfplist_xml_tag_t *key_tag        = NULL;
+	libfplist_xml_tag_t *test_value_tag = NULL;
+	libfplist_xml_tag_t *value_tag      = NULL;
+	int number_of_entries               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "array",
+	          5,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "data",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "element_tag",
+	 element_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_property_get_array_number_of_entries(
+	          property,
+	          &number_of_entries,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_get_array_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	test_value_tag = ( (libfplist_internal_property_t *) property )->value_tag;
+
+	( (libfplist_internal_property_t *) property )->value_tag = NULL;
+
+	result = libfplist_property_get_array_number_of_entries(
+	          property,
+	          &number_of_entries,
+	          &error );
+
+	( (libfplist_internal_property_t *) property )->value_tag = test_value_tag;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_array_number_of_entries(
+	          property,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "unknown",
+	          7,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with unsupported value type
+	 */
+	result = libfplist_property_get_array_number_of_entries(
+	          property,
+	          &number_of_entries,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( element_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &element_tag,
+		 NULL );
+	}
+	if( value_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &value_tag,
+		 NULL );
+	}
+	if( key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &key_tag,
+		 NULL );
+	}
+	if( property != NULL )
+	{
+		libfplist_property_free(
+		 &property,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_get_array_entry_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_get_array_entry_by_index(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfplist_property_t *array_entry   = NULL;
+	libfplist_property_t *property      = NULL;
+	libfplist_xml_tag_t *element_tag    = NULL;
+	libfplist_xml_tag_t *key_tag        = NULL;
+	libfplist_xml_tag_t *test_value_tag = NULL;
+	libfplist_xml_tag_t *value_tag      = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "array",
+	          5,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag,
+	          (uint8_t *) "data",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "element_tag",
+	 element_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag = NULL;
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	array_entry = NULL;
+
+	result = libfplist_property_get_array_entry_by_index(
+	          property,
+	          0,
+	          &array_entry,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "array_entry",
+	 array_entry );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_free(
+	          &array_entry,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "array_entry",
+	 array_entry );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	array_entry = NULL;
+
+	result = libfplist_property_get_array_entry_by_index(
+	          NULL,
+	          0,
+	          &array_entry,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	test_value_tag = ( (libfplist_internal_property_t *) property )->value_tag;
+
+	( (libfplist_internal_property_t *) property )->value_tag = NULL;
+
+	result = libfplist_property_get_array_entry_by_index(
+	          property,
+	          0,
+	          &array_entry,
+	          &error );
+
+	( (libfplist_internal_property_t *) property )->value_tag = test_value_tag;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_array_entry_by_index(
+	          property,
+	          -1,
+	          &array_entry,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_array_entry_by_index(
+	          property,
+	          0,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	array_entry = (libfplist_property_t *) 0x12345678UL;
+
+	result = libfplist_property_get_array_entry_by_index(
+	          property,
+	          0,
+	          &array_entry,
+	          &error );
+
+	array_entry = NULL;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "unknown",
+	          7,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with unsupported value type
+	 */
+	result = libfplist_property_get_array_entry_by_index(
+	          property,
+	          0,
+	          &array_entry,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( element_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &element_tag,
+		 NULL );
+	}
+	if( value_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &value_tag,
+		 NULL );
+	}
+	if( key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &key_tag,
+		 NULL );
+	}
+	if( property != NULL )
+	{
+		libfplist_property_free(
+		 &property,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_get_sub_property_by_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_get_sub_property_by_utf8_name(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfplist_property_t *property      = NULL;
+	libfplist_property_t *sub_property  = NULL;
+	libfplist_xml_tag_t *element_tag1   = NULL;
+	libfplist_xml_tag_t *element_tag2   = NULL;
+	libfplist_xml_tag_t *key_tag        = NULL;
+	libfplist_xml_tag_t *test_value_tag = NULL;
+	libfplist_xml_tag_t *value_tag      = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "dict",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag1,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "element_tag1",
+	 element_tag1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          element_tag1,
+	          (uint8_t *) "MyKey",
+	          5,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag1 = NULL;
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag2,
+	          (uint8_t *) "data",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "element_tag2",
+	 element_tag2 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag2,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag2 = NULL;
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	sub_property = NULL;
+
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          property,
+	          (uint8_t *) "MyKey",
+	          5,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "sub_property",
+	 sub_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	sub_property = NULL;
+
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          property,
+	          (uint8_t *) "Bogus",
+	          5,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "sub_property",
+	 sub_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "sub_property",
+	 sub_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	sub_property = NULL;
+
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          NULL,
+	          (uint8_t *) "MyKey",
+	          5,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	test_value_tag = ( (libfplist_internal_property_t *) property )->value_tag;
+
+	( (libfplist_internal_property_t *) property )->value_tag = NULL;
+
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          property,
+	          (uint8_t *) "MyKey",
+	          5,
+	          &sub_property,
+	          &error );
+
+	( (libfplist_internal_property_t *) property )->value_tag = test_value_tag;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          property,
+	          NULL,
+	          5,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          property,
+	          (uint8_t *) "MyKey",
+	          (size_t) SSIZE_MAX,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          property,
+	          (uint8_t *) "MyKey",
+	          5,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sub_property = (libfplist_property_t *) 0x12345678UL;
+
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          property,
+	          (uint8_t *) "MyKey",
+	          5,
+	          &sub_property,
+	          &error );
+
+	sub_property = NULL;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "unknown",
+	          7,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with unsupported value type
+	 */
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          property,
+	          (uint8_t *) "MyKey",
+	          5,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( element_tag2 != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &element_tag2,
+		 NULL );
+	}
+	if( element_tag1 != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &element_tag1,
+		 NULL );
+	}
+	if( value_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &value_tag,
+		 NULL );
+	}
+	if( key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &key_tag,
+		 NULL );
+	}
+	if( property != NULL )
+	{
+		libfplist_property_free(
+		 &property,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_get_sub_properties_by_utf8_names function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_get_sub_properties_by_utf8_names(
+     void )
+{
+	const uint8_t *utf8_strings[ 33 ];
+	size_t utf8_string_lengths[ 33 ];
+	libfplist_property_t *sub_properties[ 33 ];
+
+	libcerror_error_t *error            = NULL;
+	libfplist_property_t *property      = NULL;
+	libfplist_xml_tag_t *element_tag1   = NULL;
+	libfplist_xml_tag_t *element_tag2   = NULL;
+	libfplist_xml_tag_t *key_tag        = NULL;
+	libfplist_xml_tag_t *test_value_tag = NULL;
+	libfplist_xml_tag_t *value_tag      = NULL;
+	int name_index                      = 0;
+	int result                          = 0;
+
+	for( name_index = 0;
+	     name_index < 33;
+	     name_index++ )
+	{
+		utf8_strings[ name_index ]        = (uint8_t *) "Bogus";
+		utf8_string_lengths[ name_index ] = 5;
+		sub_properties[ name_index ]      = NULL;
+	}
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &key_tag,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &value_tag,
+	          (uint8_t *) "dict",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag1,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "element_tag1",
+	 element_tag1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          element_tag1,
+	          (uint8_t *) "MyKey",
+	          5,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag1 = NULL;
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag2,
+	          (uint8_t *) "data",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "element_tag2",
+	 element_tag2 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag2,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag2 = NULL;
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag1,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "element_tag1",
+	 element_tag1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          element_tag1,
+	          (uint8_t *) "Other",
+	          5,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag1 = NULL;
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag2,
+	          (uint8_t *) "string",
+	          6,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "element_tag2",
+	 element_tag2 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          value_tag,
+	          element_tag2,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag2 = NULL;
+
+	result = libfplist_property_initialize(
+	          &property,
+	          key_tag,
+	          value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	utf8_strings[ 0 ] = (uint8_t *) "MyKey";
+	utf8_strings[ 2 ] = (uint8_t *) "MyKey";
+
+	result = libfplist_property_get_sub_properties_by_utf8_names(
+	          property,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          3,
+	          sub_properties,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_properties[ 0 ]",
+	 sub_properties[ 0 ] );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "sub_properties[ 1 ]",
+	 sub_properties[ 1 ] );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_properties[ 2 ]",
+	 sub_properties[ 2 ] );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	for( name_index = 0;
+	     name_index < 3;
+	     name_index++ )
+	{
+		result = libfplist_property_free(
+		          &( sub_properties[ name_index ] ),
+		          &error );
+
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FPLIST_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	utf8_strings[ 0 ] = (uint8_t *) "Bogus";
+	utf8_strings[ 2 ] = (uint8_t *) "Bogus";
+
+	/* Test regular cases with more names than fit the stack based hash table
+	 */
+	utf8_strings[ 32 ] = (uint8_t *) "Other";
+
+	result = libfplist_property_get_sub_properties_by_utf8_names(
+	          property,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          33,
+	          sub_properties,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "sub_properties[ 0 ]",
+	 sub_properties[ 0 ] );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_properties[ 32 ]",
+	 sub_properties[ 32 ] );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_free(
+	          &( sub_properties[ 32 ] ),
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf8_strings[ 32 ] = (uint8_t *) "Bogus";
+
+	/* Test regular cases
+	 */
+	result = libfplist_property_get_sub_properties_by_utf8_names(
+	          property,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          1,
+	          sub_properties,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "sub_properties[ 0 ]",
+	 sub_properties[ 0 ] );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_get_sub_properties_by_utf8_names(
+	          NULL,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          1,
+	          sub_properties,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	test_value_tag = ( (libfplist_internal_property_t *) property )->value_tag;
+
+	( (libfplist_internal_property_t *) property )->value_tag = NULL;
+
+	result = libfplist_property_get_sub_properties_by_utf8_names(
+	          property,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          1,
+	          sub_properties,
+	          &error );
+
+	( (libfplist_internal_property_t *) property )->value_tag = test_value_tag;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_sub_properties_by_utf8_names(
+	          property,
+	          NULL,
+	          utf8_string_lengths,
+	          1,
+	          sub_properties,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_sub_properties_by_utf8_names(
+	          property,
+	          utf8_strings,
+	          NULL,
+	          1,
+	          sub_properties,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_sub_properties_by_utf8_names(
+	          property,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          0,
+	          sub_properties,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_sub_properties_by_utf8_names(
+	          property,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          1,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	utf8_string_lengths[ 0 ] = (size_t) SSIZE_MAX;
+
+	result = libfplist_property_get_sub_properties_by_utf8_names(
+	          property,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          1,
+	          sub_properties,
+	          &error );
+
+	utf8_string_lengths[ 0 ] = 5;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sub_properties[ 0 ] = (libfplist_property_t *) 0x12345678UL;
+
+	result = libfplist_property_get_sub_properties_by_utf8_names(
+	          property,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          1,
+	          sub_properties,
+	          &error );
+
+	sub_properties[ 0 ] = NULL;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with unsupported value type
+	 */
+	( (libfplist_internal_property_t *) property )->value_type = LIBFPLIST_VALUE_TYPE_STRING;
+
+	result = libfplist_property_get_sub_properties_by_utf8_names(
+	          property,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          1,
+	          sub_properties,
+	          &error );
+
+	( (libfplist_internal_property_t *) property )->value_type = LIBFPLIST_VALUE_TYPE_UNKNOWN;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_free(
+	          &key_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "key_tag",
+	 key_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property",
+	 property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( name_index = 0;
+	     name_index < 33;
+	     name_index++ )
+	{
+		if( sub_properties[ name_index ] != NULL )
+		{
+			libfplist_property_free(
+			 &( sub_properties[ name_index ] ),
+			 NULL );
+		}
+	}
+	if( element_tag2 != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &element_tag2,
+		 NULL );
+	}
+	if( element_tag1 != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &element_tag1,
+		 NULL );
+	}
+	if( value_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &value_tag,
+		 NULL );
+	}
+	if( key_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &key_tag,
+		 NULL );
+	}
+	if( property != NULL )
+	{
+		libfplist_property_free(
+		 &property,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_get_fields function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_get_fields(
+     void )
+{
+	libfplist_field_descriptor_t field_descriptors[ 8 ] = {
+		{ "Name", LIBFPLIST_FIELD_TYPE_UTF8_STRING, 0, 16, LIBFPLIST_FIELD_FLAG_REQUIRED },
+		{ "Enabled", LIBFPLIST_FIELD_TYPE_BOOLEAN, 16, 0, 0 },
+		{ "Details/Size", LIBFPLIST_FIELD_TYPE_INTEGER_64BIT, 24, 0, LIBFPLIST_FIELD_FLAG_REQUIRED },
+		{ "Details/Created", LIBFPLIST_FIELD_TYPE_DATE_TIME, 32, 0, 0 },
+		{ "Details/Data", LIBFPLIST_FIELD_TYPE_BINARY_DATA, 40, 8, 0 },
+		{ "Details/Size", LIBFPLIST_FIELD_TYPE_INTEGER_32BIT, 48, 0, 0 },
+		{ "Details/Missing", LIBFPLIST_FIELD_TYPE_UTF8_STRING, 52, 4, 0 },
+		{ "Name/Sub", LIBFPLIST_FIELD_TYPE_INTEGER_64BIT, 56, 0, 0 } };
+
+	uint8_t fields[ 64 ];
+	int field_statuses[ 8 ];
+
+	libcerror_error_t *error                 = NULL;
+	libfplist_property_t *root_property      = NULL;
+	libfplist_property_t *sub_property       = NULL;
+	libfplist_property_list_t *property_list = NULL;
+	uint64_t value_64bit                     = 0;
+	int64_t posix_time                       = 0;
+	uint32_t value_32bit                     = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_copy_from_byte_stream(
+	          property_list,
+	          fplist_test_property_data1,
+	          343,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_get_root_property(
+	          property_list,
+	          &root_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "root_property",
+	 root_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	memory_set(
+	 fields,
+	 0xff,
+	 64 );
+
+	result = libfplist_property_get_fields(
+	          root_property,
+	          field_descriptors,
+	          8,
+	          fields,
+	          64,
+	          field_statuses,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "field_statuses[ 0 ]",
+	 field_statuses[ 0 ],
+	 LIBFPLIST_FIELD_STATUS_SET );
+
+	result = memory_compare(
+	          &( fields[ 0 ] ),
+	          "Test",
+	          5 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "field_statuses[ 1 ]",
+	 field_statuses[ 1 ],
+	 LIBFPLIST_FIELD_STATUS_SET );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "fields[ 16 ]",
+	 fields[ 16 ],
+	 (uint8_t) 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "field_statuses[ 2 ]",
+	 field_statuses[ 2 ],
+	 LIBFPLIST_FIELD_STATUS_SET );
+
+	memory_copy(
+	 &value_64bit,
+	 &( fields[ 24 ] ),
+	 sizeof( uint64_t ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 8388608UL );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "field_statuses[ 3 ]",
+	 field_statuses[ 3 ],
+	 LIBFPLIST_FIELD_STATUS_SET );
+
+	memory_copy(
+	 &posix_time,
+	 &( fields[ 32 ] ),
+	 sizeof( int64_t ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1476693725000000000LL );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "field_statuses[ 4 ]",
+	 field_statuses[ 4 ],
+	 LIBFPLIST_FIELD_STATUS_SET );
+
+	result = memory_compare(
+	          &( fields[ 40 ] ),
+	          "test\0\0\0\0",
+	          8 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "field_statuses[ 5 ]",
+	 field_statuses[ 5 ],
+	 LIBFPLIST_FIELD_STATUS_SET );
+
+	memory_copy(
+	 &value_32bit,
+	 &( fields[ 48 ] ),
+	 sizeof( uint32_t ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 8388608UL );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "field_statuses[ 6 ]",
+	 field_statuses[ 6 ],
+	 LIBFPLIST_FIELD_STATUS_NOT_SET );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "fields[ 52 ]",
+	 fields[ 52 ],
+	 (uint8_t) 0xff );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "field_statuses[ 7 ]",
+	 field_statuses[ 7 ],
+	 LIBFPLIST_FIELD_STATUS_UNSUPPORTED_VALUE_TYPE );
+
+	/* Test with a missing required field
+	 */
+	field_descriptors[ 6 ].flags = LIBFPLIST_FIELD_FLAG_REQUIRED;
+
+	result = libfplist_property_get_fields(
+	          root_property,
+	          field_descriptors,
+	          8,
+	          fields,
+	          64,
+	          NULL,
+	          &error );
+
+	field_descriptors[ 6 ].flags = 0;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a value that does not fit the field
+	 */
+	field_descriptors[ 0 ].field_size = 4;
+
+	result = libfplist_property_get_fields(
+	          root_property,
+	          field_descriptors,
+	          1,
+	          fields,
+	          64,
+	          field_statuses,
+	          &error );
+
+	field_descriptors[ 0 ].field_size = 16;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "field_statuses[ 0 ]",
+	 field_statuses[ 0 ],
+	 LIBFPLIST_FIELD_STATUS_INVALID_VALUE );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_get_fields(
+	          NULL,
+	          field_descriptors,
+	          8,
+	          fields,
+	          64,
+	          field_statuses,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_fields(
+	          root_property,
+	          NULL,
+	          8,
+	          fields,
+	          64,
+	          field_statuses,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_fields(
+	          root_property,
+	          field_descriptors,
+	          0,
+	          fields,
+	          64,
+	          field_statuses,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_fields(
+	          root_property,
+	          field_descriptors,
+	          8,
+	          NULL,
+	          64,
+	          field_statuses,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_fields(
+	          root_property,
+	          field_descriptors,
+	          8,
+	          fields,
+	          (size_t) SSIZE_MAX + 1,
+	          field_statuses,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_fields(
+	          root_property,
+	          field_descriptors,
+	          8,
+	          fields,
+	          32,
+	          field_statuses,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	field_descriptors[ 1 ].field_type = 0;
+
+	result = libfplist_property_get_fields(
+	          root_property,
+	          field_descriptors,
+	          8,
+	          fields,
+	          64,
+	          field_statuses,
+	          &error );
+
+	field_descriptors[ 1 ].field_type = LIBFPLIST_FIELD_TYPE_BOOLEAN;
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with unsupported value type
+	 */
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "Name",
+	          4,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_fields(
+	          sub_property,
+	          field_descriptors,
+	          8,
+	          fields,
+	          64,
+	          field_statuses,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "sub_property",
+	 sub_property );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_set_value(
-	          element_tag1,
-	          (uint8_t *) "MyKey",
-	          5,
+	result = libfplist_property_free(
+	          &root_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4533,13 +13884,16 @@ int fplist_test_property_get_sub_property_by_utf8_name(
 	 result,
 	 1 );
 
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "root_property",
+	 root_property );
+
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_append_element(
-	          value_tag,
-	          element_tag1,
+	result = libfplist_property_list_free(
+	          &property_list,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4547,16 +13901,68 @@ int fplist_test_property_get_sub_property_by_utf8_name(
 	 result,
 	 1 );
 
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property_list",
+	 property_list );
+
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	element_tag1 = NULL;
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sub_property != NULL )
+	{
+		libfplist_property_free(
+		 &sub_property,
+		 NULL );
+	}
+	if( root_property != NULL )
+	{
+		libfplist_property_free(
+		 &root_property,
+		 NULL );
+	}
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	return( 0 );
+}
 
+/* Tests the libfplist_property_get_field_value function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_get_field_value(
+     void )
+{
+	libfplist_field_descriptor_t field_descriptors[ 2 ] = {
+		{ "Value", LIBFPLIST_FIELD_TYPE_INTEGER_64BIT, 0, 0, 0 },
+		{ "Value", LIBFPLIST_FIELD_TYPE_INTEGER_32BIT, 8, 0, 0 } };
+
+	uint8_t fields[ 16 ];
+
+	libcerror_error_t *error       = NULL;
+	libfplist_xml_tag_t *value_tag = NULL;
+	int64_t value_64bit            = 0;
+	int32_t value_32bit            = 0;
+	int field_status               = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
 	result = libfplist_xml_tag_initialize(
-	          &element_tag2,
-	          (uint8_t *) "data",
-	          4,
+	          &value_tag,
+	          (uint8_t *) "integer",
+	          7,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4565,16 +13971,19 @@ int fplist_test_property_get_sub_property_by_utf8_name(
 	 1 );
 
 	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "element_tag2",
-	 element_tag2 );
+	 "value_tag",
+	 value_tag );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_append_element(
+	/* Test regular cases
+	 */
+	result = libfplist_xml_tag_set_value(
 	          value_tag,
-	          element_tag2,
+	          (uint8_t *) "-2",
+	          2,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4586,12 +13995,12 @@ int fplist_test_property_get_sub_property_by_utf8_name(
 	 "error",
 	 error );
 
-	element_tag2 = NULL;
-
-	result = libfplist_property_initialize(
-	          &property,
-	          key_tag,
+	result = libfplist_property_get_field_value(
+	          NULL,
 	          value_tag,
+	          &( field_descriptors[ 0 ] ),
+	          fields,
+	          &field_status,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4599,23 +14008,31 @@ int fplist_test_property_get_sub_property_by_utf8_name(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "property",
-	 property );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	sub_property = NULL;
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "field_status",
+	 field_status,
+	 LIBFPLIST_FIELD_STATUS_SET );
 
-	result = libfplist_property_get_sub_property_by_utf8_name(
-	          property,
-	          (uint8_t *) "MyKey",
-	          5,
-	          &sub_property,
+	memory_copy(
+	 &value_64bit,
+	 &( fields[ 0 ] ),
+	 sizeof( int64_t ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT64(
+	 "value_64bit",
+	 value_64bit,
+	 (int64_t) -2 );
+
+	result = libfplist_property_get_field_value(
+	          NULL,
+	          value_tag,
+	          &( field_descriptors[ 1 ] ),
+	          fields,
+	          &field_status,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4623,18 +14040,29 @@ int fplist_test_property_get_sub_property_by_utf8_name(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "sub_property",
-	 sub_property );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Clean up
-	 */
-	result = libfplist_property_free(
-	          &sub_property,
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "field_status",
+	 field_status,
+	 LIBFPLIST_FIELD_STATUS_SET );
+
+	memory_copy(
+	 &value_32bit,
+	 &( fields[ 8 ] ),
+	 sizeof( int32_t ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT32(
+	 "value_32bit",
+	 value_32bit,
+	 (int32_t) -2 );
+
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "-9223372036854775808",
+	          20,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4642,42 +14070,50 @@ int fplist_test_property_get_sub_property_by_utf8_name(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "sub_property",
-	 sub_property );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	sub_property = NULL;
-
-	result = libfplist_property_get_sub_property_by_utf8_name(
-	          property,
-	          (uint8_t *) "Bogus",
-	          5,
-	          &sub_property,
+	result = libfplist_property_get_field_value(
+	          NULL,
+	          value_tag,
+	          &( field_descriptors[ 0 ] ),
+	          fields,
+	          &field_status,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "sub_property",
-	 sub_property );
+	 1 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Clean up
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "field_status",
+	 field_status,
+	 LIBFPLIST_FIELD_STATUS_SET );
+
+	memory_copy(
+	 &value_64bit,
+	 &( fields[ 0 ] ),
+	 sizeof( int64_t ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT64(
+	 "value_64bit",
+	 value_64bit,
+	 (int64_t) INT64_MIN );
+
+	/* Test with a negative value that does not fit the field
 	 */
-	result = libfplist_property_free(
-	          &sub_property,
+	result = libfplist_property_get_field_value(
+	          NULL,
+	          value_tag,
+	          &( field_descriptors[ 1 ] ),
+	          fields,
+	          &field_status,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4685,105 +14121,107 @@ int fplist_test_property_get_sub_property_by_utf8_name(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "sub_property",
-	 sub_property );
-
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	sub_property = NULL;
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "field_status",
+	 field_status,
+	 LIBFPLIST_FIELD_STATUS_INVALID_VALUE );
 
-	result = libfplist_property_get_sub_property_by_utf8_name(
-	          NULL,
-	          (uint8_t *) "MyKey",
-	          5,
-	          &sub_property,
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "-2147483649",
+	          11,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	test_value_tag = ( (libfplist_internal_property_t *) property )->value_tag;
-
-	( (libfplist_internal_property_t *) property )->value_tag = NULL;
-
-	result = libfplist_property_get_sub_property_by_utf8_name(
-	          property,
-	          (uint8_t *) "MyKey",
-	          5,
-	          &sub_property,
+	result = libfplist_property_get_field_value(
+	          NULL,
+	          value_tag,
+	          &( field_descriptors[ 1 ] ),
+	          fields,
+	          &field_status,
 	          &error );
 
-	( (libfplist_internal_property_t *) property )->value_tag = test_value_tag;
-
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "field_status",
+	 field_status,
+	 LIBFPLIST_FIELD_STATUS_INVALID_VALUE );
 
-	result = libfplist_property_get_sub_property_by_utf8_name(
-	          property,
-	          NULL,
-	          5,
-	          &sub_property,
+	result = libfplist_xml_tag_set_value(
+	          value_tag,
+	          (uint8_t *) "-2147483648",
+	          11,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfplist_property_get_sub_property_by_utf8_name(
-	          property,
-	          (uint8_t *) "MyKey",
-	          (size_t) SSIZE_MAX,
-	          &sub_property,
+	result = libfplist_property_get_field_value(
+	          NULL,
+	          value_tag,
+	          &( field_descriptors[ 1 ] ),
+	          fields,
+	          &field_status,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "field_status",
+	 field_status,
+	 LIBFPLIST_FIELD_STATUS_SET );
 
-	result = libfplist_property_get_sub_property_by_utf8_name(
-	          property,
-	          (uint8_t *) "MyKey",
-	          5,
+	memory_copy(
+	 &value_32bit,
+	 &( fields[ 8 ] ),
+	 sizeof( int32_t ) );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT32(
+	 "value_32bit",
+	 value_32bit,
+	 (int32_t) ( -2147483647 - 1 ) );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_get_field_value(
+	          NULL,
 	          NULL,
+	          &( field_descriptors[ 0 ] ),
+	          fields,
+	          &field_status,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4798,33 +14236,64 @@ int fplist_test_property_get_sub_property_by_utf8_name(
 	libcerror_error_free(
 	 &error );
 
-	sub_property = (libfplist_property_t *) 0x12345678UL;
-
-	result = libfplist_property_get_sub_property_by_utf8_name(
-	          property,
-	          (uint8_t *) "MyKey",
-	          5,
-	          &sub_property,
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &value_tag,
 	          &error );
 
-	sub_property = NULL;
-
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "value_tag",
+	 value_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &value_tag,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_get_sub_property_by_key_token function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_get_sub_property_by_key_token(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfplist_key_token_t *key_token         = NULL;
+	libfplist_key_token_t *missing_key_token = NULL;
+	libfplist_property_t *root_property      = NULL;
+	libfplist_property_t *sub_property       = NULL;
+	libfplist_property_list_t *property_list = NULL;
+	int iterator                             = 0;
+	int result                               = 0;
+	int value_type                           = 0;
 
-	/* Clean up
+	/* Initialize test
 	 */
-	result = libfplist_xml_tag_free(
-	          &value_tag,
+	result = libfplist_key_token_initialize(
+	          &key_token,
+	          (uint8_t *) "Name",
+	          4,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4832,16 +14301,18 @@ int fplist_test_property_get_sub_property_by_utf8_name(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "value_tag",
-	 value_tag );
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "key_token",
+	 key_token );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_free(
-	          &key_tag,
+	result = libfplist_key_token_initialize(
+	          &missing_key_token,
+	          (uint8_t *) "Nama",
+	          4,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4849,97 +14320,213 @@ int fplist_test_property_get_sub_property_by_utf8_name(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "key_tag",
-	 key_tag );
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "missing_key_token",
+	 missing_key_token );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_property_free(
-	          &property,
-	          &error );
+	/* Test regular cases, the key tokens are reused across property lists
+	 */
+	for( iterator = 0;
+	     iterator < 2;
+	     iterator++ )
+	{
+		result = libfplist_property_list_initialize(
+		          &property_list,
+		          &error );
 
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "property",
-	 property );
+		FPLIST_TEST_ASSERT_IS_NOT_NULL(
+		 "property_list",
+		 property_list );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		FPLIST_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	/* Initialize test
-	 */
-	result = libfplist_xml_tag_initialize(
-	          &key_tag,
-	          (uint8_t *) "key",
-	          3,
-	          &error );
+		result = libfplist_property_list_copy_from_byte_stream(
+		          property_list,
+		          fplist_test_property_data1,
+		          343,
+		          &error );
 
-	FPLIST_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "key_tag",
-	 key_tag );
+		FPLIST_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		result = libfplist_property_list_get_root_property(
+		          property_list,
+		          &root_property,
+		          &error );
 
-	result = libfplist_xml_tag_initialize(
-	          &value_tag,
-	          (uint8_t *) "unknown",
-	          7,
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FPLIST_TEST_ASSERT_IS_NOT_NULL(
+		 "root_property",
+		 root_property );
+
+		FPLIST_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfplist_property_get_sub_property_by_key_token(
+		          root_property,
+		          key_token,
+		          &sub_property,
+		          &error );
+
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FPLIST_TEST_ASSERT_IS_NOT_NULL(
+		 "sub_property",
+		 sub_property );
+
+		FPLIST_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfplist_property_get_value_type(
+		          sub_property,
+		          &value_type,
+		          &error );
+
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "value_type",
+		 value_type,
+		 LIBFPLIST_VALUE_TYPE_STRING );
+
+		FPLIST_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfplist_property_free(
+		          &sub_property,
+		          &error );
+
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FPLIST_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfplist_property_get_sub_property_by_key_token(
+		          root_property,
+		          missing_key_token,
+		          &sub_property,
+		          &error );
+
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FPLIST_TEST_ASSERT_IS_NULL(
+		 "sub_property",
+		 sub_property );
+
+		FPLIST_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( iterator == 1 )
+		{
+			break;
+		}
+		result = libfplist_property_free(
+		          &root_property,
+		          &error );
+
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FPLIST_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfplist_property_list_free(
+		          &property_list,
+		          &error );
+
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FPLIST_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	/* Test error cases
+	 */
+	result = libfplist_property_get_sub_property_by_key_token(
+	          NULL,
+	          key_token,
+	          &sub_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "value_tag",
-	 value_tag );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_property_initialize(
-	          &property,
-	          key_tag,
-	          value_tag,
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_sub_property_by_key_token(
+	          root_property,
+	          NULL,
+	          &sub_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "property",
-	 property );
-
-	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test with unsupported value type
-	 */
-	result = libfplist_property_get_sub_property_by_utf8_name(
-	          property,
-	          (uint8_t *) "MyKey",
-	          5,
-	          &sub_property,
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_get_sub_property_by_key_token(
+	          root_property,
+	          key_token,
+	          NULL,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4956,8 +14543,8 @@ int fplist_test_property_get_sub_property_by_utf8_name(
 
 	/* Clean up
 	 */
-	result = libfplist_xml_tag_free(
-	          &value_tag,
+	result = libfplist_property_free(
+	          &root_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4966,15 +14553,15 @@ int fplist_test_property_get_sub_property_by_utf8_name(
 	 1 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
-	 "value_tag",
-	 value_tag );
+	 "root_property",
+	 root_property );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_xml_tag_free(
-	          &key_tag,
+	result = libfplist_property_list_free(
+	          &property_list,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -4983,15 +14570,15 @@ int fplist_test_property_get_sub_property_by_utf8_name(
 	 1 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
-	 "key_tag",
-	 key_tag );
+	 "property_list",
+	 property_list );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_property_free(
-	          &property,
+	result = libfplist_key_token_free(
+	          &missing_key_token,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -5000,8 +14587,17 @@ int fplist_test_property_get_sub_property_by_utf8_name(
 	 1 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
-	 "property",
-	 property );
+	 "error",
+	 error );
+
+	result = libfplist_key_token_free(
+	          &key_token,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -5015,34 +14611,34 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( element_tag2 != NULL )
+	if( sub_property != NULL )
 	{
-		libfplist_xml_tag_free(
-		 &element_tag2,
+		libfplist_property_free(
+		 &sub_property,
 		 NULL );
 	}
-	if( element_tag1 != NULL )
+	if( root_property != NULL )
 	{
-		libfplist_xml_tag_free(
-		 &element_tag1,
+		libfplist_property_free(
+		 &root_property,
 		 NULL );
 	}
-	if( value_tag != NULL )
+	if( property_list != NULL )
 	{
-		libfplist_xml_tag_free(
-		 &value_tag,
+		libfplist_property_list_free(
+		 &property_list,
 		 NULL );
 	}
-	if( key_tag != NULL )
+	if( missing_key_token != NULL )
 	{
-		libfplist_xml_tag_free(
-		 &key_tag,
+		libfplist_key_token_free(
+		 &missing_key_token,
 		 NULL );
 	}
-	if( property != NULL )
+	if( key_token != NULL )
 	{
-		libfplist_property_free(
-		 &property,
+		libfplist_key_token_free(
+		 &key_token,
 		 NULL );
 	}
 	return( 0 );
@@ -5083,6 +14679,14 @@ int main(
 	 "libfplist_property_get_value_type",
 	 fplist_test_property_get_value_type );
 
+	FPLIST_TEST_RUN(
+	 "libfplist_property_get_value",
+	 fplist_test_property_get_value );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_property_get_value_boolean",
+	 fplist_test_property_get_value_boolean );
+
 	FPLIST_TEST_RUN(
 	 "libfplist_property_get_value_data_size",
 	 fplist_test_property_get_value_data_size );
@@ -5091,10 +14695,34 @@ int main(
 	 "libfplist_property_get_value_data",
 	 fplist_test_property_get_value_data );
 
+	FPLIST_TEST_RUN(
+	 "libfplist_property_get_value_data_allocated",
+	 fplist_test_property_get_value_data_allocated );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_property_get_value_as_property_list",
+	 fplist_test_property_get_value_as_property_list );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_property_read_value_data_at_offset",
+	 fplist_test_property_read_value_data_at_offset );
+
 	FPLIST_TEST_RUN(
 	 "libfplist_property_get_value_integer",
 	 fplist_test_property_get_value_integer );
 
+	FPLIST_TEST_RUN(
+	 "libfplist_property_get_value_signed_integer",
+	 fplist_test_property_get_value_signed_integer );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_property_get_value_128bit_integer",
+	 fplist_test_property_get_value_128bit_integer );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_property_get_value_floating_point",
+	 fplist_test_property_get_value_floating_point );
+
 	FPLIST_TEST_RUN(
 	 "libfplist_property_get_value_string",
 	 fplist_test_property_get_value_string );
@@ -5103,6 +14731,42 @@ int main(
 	 "libfplist_property_value_uuid_string_copy_to_byte_stream",
 	 fplist_test_property_value_uuid_string_copy_to_byte_stream );
 
+	FPLIST_TEST_RUN(
+	 "libfplist_property_get_value_date_time",
+	 fplist_test_property_get_value_date_time );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_property_get_value_filetime",
+	 fplist_test_property_get_value_filetime );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_property_copy_array_to_date_time",
+	 fplist_test_property_copy_array_to_date_time );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_property_copy_array_to_int64",
+	 fplist_test_property_copy_array_to_int64 );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_property_copy_array_to_double",
+	 fplist_test_property_copy_array_to_double );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_property_copy_array_to_bool",
+	 fplist_test_property_copy_array_to_bool );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_property_copy_array_to_utf8_strings",
+	 fplist_test_property_copy_array_to_utf8_strings );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_property_copy_array_to_uuid_byte_stream",
+	 fplist_test_property_copy_array_to_uuid_byte_stream );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_property_get_number_of_entries",
+	 fplist_test_property_get_number_of_entries );
+
 	FPLIST_TEST_RUN(
 	 "libfplist_property_get_array_number_of_entries",
 	 fplist_test_property_get_array_number_of_entries );
@@ -5115,6 +14779,22 @@ int main(
 	 "libfplist_property_get_sub_property_by_utf8_name",
 	 fplist_test_property_get_sub_property_by_utf8_name );
 
+	FPLIST_TEST_RUN(
+	 "libfplist_property_get_sub_properties_by_utf8_names",
+	 fplist_test_property_get_sub_properties_by_utf8_names );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_property_get_fields",
+	 fplist_test_property_get_fields );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_property_get_field_value",
+	 fplist_test_property_get_field_value );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_property_get_sub_property_by_key_token",
+	 fplist_test_property_get_sub_property_by_key_token );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -21,6 +21,8 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -72,6 +74,24 @@ uint8_t fplist_test_property_list_data1[ 556 ] = {
 	0x3c, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x63,
 	0x74, 0x3e, 0x0a, 0x3c, 0x2f, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x3e, 0x0a };
 
+/* Binary property list of data1 as written by other implementations
+ */
+uint8_t fplist_test_property_list_data1_binary[ 214 ] = {
+	0x62, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x30, 0x30, 0xd5, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0x0a, 0x5f, 0x10, 0x1d, 0x43, 0x46, 0x42, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x49, 0x6e,
+	0x66, 0x6f, 0x44, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72, 0x79, 0x56, 0x65, 0x72, 0x73,
+	0x69, 0x6f, 0x6e, 0x59, 0x62, 0x61, 0x6e, 0x64, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x10, 0x1b,
+	0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x2d, 0x62, 0x61, 0x63, 0x6b, 0x69, 0x6e, 0x67, 0x73, 0x74,
+	0x6f, 0x72, 0x65, 0x2d, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x5f, 0x10, 0x15, 0x64, 0x69,
+	0x73, 0x6b, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x2d, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x2d, 0x74,
+	0x79, 0x70, 0x65, 0x54, 0x73, 0x69, 0x7a, 0x65, 0x53, 0x36, 0x2e, 0x30, 0x12, 0x00, 0x80, 0x00,
+	0x00, 0x10, 0x01, 0x5f, 0x10, 0x20, 0x63, 0x6f, 0x6d, 0x2e, 0x61, 0x70, 0x70, 0x6c, 0x65, 0x2e,
+	0x64, 0x69, 0x73, 0x6b, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x2e, 0x73, 0x70, 0x61, 0x72, 0x73, 0x65,
+	0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x12, 0x06, 0x1a, 0x80, 0x00, 0x08, 0x13, 0x33, 0x3d, 0x5b,
+	0x73, 0x78, 0x7c, 0x81, 0x83, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xab };
+
 uint8_t fplist_test_property_list_data2[ 1019 ] = {
 	0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31,
 	0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54,
@@ -138,6 +158,110 @@ uint8_t fplist_test_property_list_data2[ 1019 ] = {
 	0x0a, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74,
 	0x3e, 0x0a, 0x3c, 0x2f, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x3e, 0x0a };
 
+uint8_t fplist_test_property_list_data3[ 371 ] = {
+	0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31,
+	0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54,
+	0x46, 0x2d, 0x38, 0x22, 0x3f, 0x3e, 0x0a, 0x3c, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x76, 0x65,
+	0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69,
+	0x63, 0x74, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x43, 0x46, 0x42, 0x75, 0x6e, 0x64,
+	0x6c, 0x65, 0x49, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x3c, 0x2f, 0x6b, 0x65,
+	0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x63, 0x6f, 0x6d, 0x2e,
+	0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2e, 0x6d, 0x61, 0x69, 0x6e, 0x3c, 0x2f, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x50, 0x6c, 0x75, 0x67,
+	0x69, 0x6e, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c,
+	0x6b, 0x65, 0x79, 0x3e, 0x43, 0x46, 0x42, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x49, 0x64, 0x65, 0x6e,
+	0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09,
+	0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x63, 0x6f, 0x6d, 0x2e, 0x65, 0x78, 0x61, 0x6d,
+	0x70, 0x6c, 0x65, 0x2e, 0x66, 0x69, 0x72, 0x73, 0x74, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e,
+	0x67, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x3c,
+	0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x43, 0x46,
+	0x42, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x49, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72,
+	0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e,
+	0x67, 0x3e, 0x63, 0x6f, 0x6d, 0x2e, 0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2e, 0x73, 0x65,
+	0x63, 0x6f, 0x6e, 0x64, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09,
+	0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x3c, 0x2f, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x3c, 0x2f, 0x70, 0x6c, 0x69, 0x73,
+	0x74, 0x3e, 0x0a };
+
+uint8_t fplist_test_property_list_data4[ 214 ] = {
+	0x62, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x30, 0x30, 0xd5, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0x0a, 0x5f, 0x10, 0x1b, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x2d, 0x62, 0x61, 0x63,
+	0x6b, 0x69, 0x6e, 0x67, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x2d, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+	0x6e, 0x5f, 0x10, 0x15, 0x64, 0x69, 0x73, 0x6b, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x2d, 0x62, 0x75,
+	0x6e, 0x64, 0x6c, 0x65, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x54, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x10,
+	0x1d, 0x43, 0x46, 0x42, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x49, 0x6e, 0x66, 0x6f, 0x44, 0x69, 0x63,
+	0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72, 0x79, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x59, 0x62,
+	0x61, 0x6e, 0x64, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x10, 0x01, 0x5f, 0x10, 0x20, 0x63, 0x6f, 0x6d,
+	0x2e, 0x61, 0x70, 0x70, 0x6c, 0x65, 0x2e, 0x64, 0x69, 0x73, 0x6b, 0x69, 0x6d, 0x61, 0x67, 0x65,
+	0x2e, 0x73, 0x70, 0x61, 0x72, 0x73, 0x65, 0x62, 0x75, 0x6e, 0x64, 0x6c, 0x65, 0x12, 0x06, 0x1a,
+	0x80, 0x00, 0x53, 0x36, 0x2e, 0x30, 0x12, 0x00, 0x80, 0x00, 0x00, 0x08, 0x13, 0x31, 0x49, 0x4e,
+	0x6e, 0x78, 0x7a, 0x9d, 0xa2, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xab };
+
+/* Binary property list of a dictionary with a 16 byte integer of value 2^64
+ */
+uint8_t fplist_test_property_list_data5[ 65 ] = {
+	0x62, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x30, 0x30, 0xd1, 0x01, 0x02, 0x51, 0x61, 0x14, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0b,
+	0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1e };
+
+/* The IO handle used to test reading a binary property list on demand
+ */
+typedef struct fplist_test_property_list_io_handle fplist_test_property_list_io_handle_t;
+
+struct fplist_test_property_list_io_handle
+{
+	/* The data
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The number of reads
+	 */
+	int number_of_reads;
+};
+
+/* Reads data from the test IO handle
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t fplist_test_property_list_read_buffer_at_offset(
+         intptr_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error FPLIST_TEST_ATTRIBUTE_UNUSED )
+{
+	fplist_test_property_list_io_handle_t *test_io_handle = NULL;
+
+	FPLIST_TEST_UNREFERENCED_PARAMETER( error )
+
+	test_io_handle = (fplist_test_property_list_io_handle_t *) io_handle;
+
+	if( ( test_io_handle == NULL )
+	 || ( buffer == NULL )
+	 || ( offset < 0 )
+	 || ( (size_t) offset > test_io_handle->data_size )
+	 || ( size > ( test_io_handle->data_size - (size_t) offset ) ) )
+	{
+		return( -1 );
+	}
+	memory_copy(
+	 buffer,
+	 &( test_io_handle->data[ offset ] ),
+	 size );
+
+	test_io_handle->number_of_reads += 1;
+
+	return( (ssize_t) size );
+}
+
 /* Tests the libfplist_property_list_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -502,6 +626,70 @@ int fplist_test_property_list_copy_from_byte_stream(
 	 "error",
 	 error );
 
+	/* Test copy from byte stream with a binary property list
+	 */
+	result = libfplist_property_list_copy_from_byte_stream(
+	          property_list,
+	          (uint8_t *) fplist_test_property_list_data4,
+	          214,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_has_plist_root_element(
+	          property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
 	result = libfplist_property_list_copy_from_byte_stream(
@@ -590,14 +778,16 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfplist_property_list_has_plist_root_element function
+/* Tests the libfplist_property_list_set_byte_stream function
  * Returns 1 if successful or 0 if not
  */
-int fplist_test_property_list_has_plist_root_element(
+int fplist_test_property_list_set_byte_stream(
      void )
 {
 	libcerror_error_t *error                 = NULL;
 	libfplist_property_list_t *property_list = NULL;
+	libfplist_property_t *root_property      = NULL;
+	int number_of_entries                    = 0;
 	int result                               = 0;
 
 	/* Initialize test
@@ -619,38 +809,72 @@ int fplist_test_property_list_has_plist_root_element(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Test set byte stream with a binary property list
 	 */
-	result = libfplist_property_list_has_plist_root_element(
+	result = libfplist_property_list_set_byte_stream(
 	          property_list,
+	          (uint8_t *) fplist_test_property_list_data4,
+	          214,
 	          &error );
 
-	FPLIST_TEST_ASSERT_NOT_EQUAL_INT(
+	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfplist_property_list_has_plist_root_element(
-	          NULL,
+	result = libfplist_property_list_get_root_property(
+	          property_list,
+	          &root_property,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "root_property",
+	 root_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libfplist_property_get_number_of_entries(
+	          root_property,
+	          &number_of_entries,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 5 );
+
+	result = libfplist_property_free(
+	          &root_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Clean up
 	 */
@@ -671,38 +895,31 @@ int fplist_test_property_list_has_plist_root_element(
 	 "error",
 	 error );
 
-	return( 1 );
+	/* Initialize test
+	 */
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( property_list != NULL )
-	{
-		libfplist_property_list_free(
-		 &property_list,
-		 NULL );
-	}
-	return( 0 );
-}
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-/* Tests the libfplist_property_list_get_root_property function
- * Returns 1 if successful or 0 if not
- */
-int fplist_test_property_list_get_root_property(
-     libfplist_property_list_t *property_list )
-{
-	libcerror_error_t *error            = NULL;
-	libfplist_property_t *root_property = NULL;
-	int result                          = 0;
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
 
-	/* Test regular cases
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test set byte stream with a XML property list
 	 */
-	result = libfplist_property_list_get_root_property(
+	result = libfplist_property_list_set_byte_stream(
 	          property_list,
-	          &root_property,
+	          (uint8_t *) fplist_test_property_list_data1,
+	          556,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -710,16 +927,47 @@ int fplist_test_property_list_get_root_property(
 	 result,
 	 1 );
 
-	FPLIST_TEST_ASSERT_IS_NOT_NULL(
-	 "root_property",
-	 root_property );
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_has_plist_root_element(
+	          property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_property_free(
-	          &root_property,
+	/* Test error cases
+	 */
+	result = libfplist_property_list_set_byte_stream(
+	          property_list,
+	          (uint8_t *) fplist_test_property_list_data4,
+	          214,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_list_free(
+	          &property_list,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -728,28 +976,42 @@ int fplist_test_property_list_get_root_property(
 	 1 );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
-	 "root_property",
-	 root_property );
+	 "property_list",
+	 property_list );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Initialize test
 	 */
-	result = libfplist_property_list_get_root_property(
-	          NULL,
-	          &root_property,
+	result = libfplist_property_list_initialize(
+	          &property_list,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
 
 	FPLIST_TEST_ASSERT_IS_NULL(
-	 "root_property",
-	 root_property );
+	 "error",
+	 error );
+
+	result = libfplist_property_list_set_byte_stream(
+	          NULL,
+	          (uint8_t *) fplist_test_property_list_data4,
+	          214,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	FPLIST_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -758,9 +1020,10 @@ int fplist_test_property_list_get_root_property(
 	libcerror_error_free(
 	 &error );
 
-	result = libfplist_property_list_get_root_property(
+	result = libfplist_property_list_set_byte_stream(
 	          property_list,
 	          NULL,
+	          214,
 	          &error );
 
 	FPLIST_TEST_ASSERT_EQUAL_INT(
@@ -768,10 +1031,6 @@ int fplist_test_property_list_get_root_property(
 	 result,
 	 -1 );
 
-	FPLIST_TEST_ASSERT_IS_NULL(
-	 "root_property",
-	 root_property );
-
 	FPLIST_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -779,10 +1038,1078 @@ int fplist_test_property_list_get_root_property(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
+	result = libfplist_property_list_set_byte_stream(
+	          property_list,
+	          (uint8_t *) fplist_test_property_list_data4,
+	          40,
+	          &error );
 
-on_error:
-	if( error != NULL )
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( root_property != NULL )
+	{
+		libfplist_property_free(
+		 &root_property,
+		 NULL );
+	}
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_list_has_plist_root_element function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_list_has_plist_root_element(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfplist_property_list_t *property_list = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_property_list_has_plist_root_element(
+	          property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_list_has_plist_root_element(
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_list_set_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_list_set_io_handle(
+     void )
+{
+	fplist_test_property_list_io_handle_t io_handle;
+
+	libcerror_error_t *error                 = NULL;
+	libfplist_property_list_t *property_list = NULL;
+	libfplist_property_t *root_property      = NULL;
+	libfplist_property_t *sub_property       = NULL;
+	uint64_t value_64bit                     = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	io_handle.data            = fplist_test_property_list_data4;
+	io_handle.data_size       = 214;
+	io_handle.number_of_reads = 0;
+
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_property_list_set_io_handle(
+	          property_list,
+	          (intptr_t *) &io_handle,
+	          &fplist_test_property_list_read_buffer_at_offset,
+	          214,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_get_root_property(
+	          property_list,
+	          &root_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "root_property",
+	 root_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "size",
+	          4,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_integer(
+	          sub_property,
+	          &value_64bit,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 102400000 );
+
+	/* The binary property list fits in a single cache block
+	 */
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "io_handle.number_of_reads",
+	 io_handle.number_of_reads,
+	 1 );
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "sub_property",
+	 sub_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &root_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "root_property",
+	 root_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_list_set_io_handle(
+	          NULL,
+	          (intptr_t *) &io_handle,
+	          &fplist_test_property_list_read_buffer_at_offset,
+	          214,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test setting the IO handle of a property list that already has a root tag
+	 */
+	result = libfplist_property_list_set_io_handle(
+	          property_list,
+	          (intptr_t *) &io_handle,
+	          &fplist_test_property_list_read_buffer_at_offset,
+	          214,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_set_io_handle(
+	          property_list,
+	          (intptr_t *) &io_handle,
+	          NULL,
+	          214,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data that is not a binary property list
+	 */
+	result = libfplist_property_list_set_io_handle(
+	          property_list,
+	          (intptr_t *) &io_handle,
+	          &fplist_test_property_list_read_buffer_at_offset,
+	          100,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sub_property != NULL )
+	{
+		libfplist_property_free(
+		 &sub_property,
+		 NULL );
+	}
+	if( root_property != NULL )
+	{
+		libfplist_property_free(
+		 &root_property,
+		 NULL );
+	}
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_list_write_binary function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_list_write_binary(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfplist_property_t *sub_property       = NULL;
+	libfplist_property_t *root_property      = NULL;
+	libfplist_property_list_t *property_list = NULL;
+	uint8_t *byte_stream                     = NULL;
+	size_t byte_stream_size                  = 0;
+	uint64_t value_lower_64bit               = 0;
+	uint64_t value_upper_64bit               = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_list_write_binary(
+	          property_list,
+	          &byte_stream,
+	          &byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_list_copy_from_byte_stream(
+	          property_list,
+	          fplist_test_property_list_data1,
+	          556,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_property_list_write_binary(
+	          property_list,
+	          &byte_stream,
+	          &byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "byte_stream",
+	 byte_stream );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 214 );
+
+	result = memory_compare(
+	          byte_stream,
+	          fplist_test_property_list_data1_binary,
+	          214 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 byte_stream );
+
+	byte_stream = NULL;
+
+	/* Test error cases
+	 */
+	result = libfplist_property_list_write_binary(
+	          NULL,
+	          &byte_stream,
+	          &byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_list_write_binary(
+	          property_list,
+	          NULL,
+	          &byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_list_write_binary(
+	          property_list,
+	          &byte_stream,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if a binary property list is written identically after it has been read
+	 */
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_copy_from_byte_stream(
+	          property_list,
+	          fplist_test_property_list_data4,
+	          214,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_write_binary(
+	          property_list,
+	          &byte_stream,
+	          &byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "byte_stream",
+	 byte_stream );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 214 );
+
+	result = memory_compare(
+	          byte_stream,
+	          fplist_test_property_list_data4,
+	          214 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	memory_free(
+	 byte_stream );
+
+	byte_stream = NULL;
+
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if a 16 byte integer that does not fit in 64-bit is read and written identically
+	 */
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_copy_from_byte_stream(
+	          property_list,
+	          fplist_test_property_list_data5,
+	          65,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_get_root_property(
+	          property_list,
+	          &root_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "root_property",
+	 root_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "a",
+	          1,
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_property",
+	 sub_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_get_value_128bit_integer(
+	          sub_property,
+	          &value_upper_64bit,
+	          &value_lower_64bit,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_upper_64bit",
+	 value_upper_64bit,
+	 (uint64_t) 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "value_lower_64bit",
+	 value_lower_64bit,
+	 (uint64_t) 0 );
+
+	result = libfplist_property_list_write_binary(
+	          property_list,
+	          &byte_stream,
+	          &byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "byte_stream",
+	 byte_stream );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 65 );
+
+	result = memory_compare(
+	          byte_stream,
+	          fplist_test_property_list_data5,
+	          61 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	memory_free(
+	 byte_stream );
+
+	byte_stream = NULL;
+
+	result = libfplist_property_free(
+	          &sub_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "sub_property",
+	 sub_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &root_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "root_property",
+	 root_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( byte_stream != NULL )
+	{
+		memory_free(
+		 byte_stream );
+	}
+	if( sub_property != NULL )
+	{
+		libfplist_property_free(
+		 &sub_property,
+		 NULL );
+	}
+	if( root_property != NULL )
+	{
+		libfplist_property_free(
+		 &root_property,
+		 NULL );
+	}
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_property_list_get_root_property function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_list_get_root_property(
+     libfplist_property_list_t *property_list )
+{
+	libcerror_error_t *error            = NULL;
+	libfplist_property_t *root_property = NULL;
+	int result                          = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_property_list_get_root_property(
+	          property_list,
+	          &root_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "root_property",
+	 root_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_free(
+	          &root_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "root_property",
+	 root_property );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_property_list_get_root_property(
+	          NULL,
+	          &root_property,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "root_property",
+	 root_property );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_list_get_root_property(
+	          property_list,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "root_property",
+	 root_property );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
 	{
 		libcerror_error_free(
 		 &error );
@@ -796,6 +2123,446 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfplist_property_list_find_all_by_utf8_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_property_list_find_all_by_utf8_key(
+     void )
+{
+	uint8_t path[ 64 ];
+
+	const char *expected_paths[ 3 ] = {
+		"CFBundleIdentifier",
+		"Plugins/0/CFBundleIdentifier",
+		"Plugins/1/CFBundleIdentifier" };
+
+	libfplist_property_t *properties[ 4 ] = {
+		NULL, NULL, NULL, NULL };
+
+	libcerror_error_t *error                 = NULL;
+	libfplist_property_list_t *property_list = NULL;
+	size_t path_size                         = 0;
+	uint8_t flags                            = 0;
+	int iterator                             = 0;
+	int number_of_properties                 = 0;
+	int property_index                       = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_copy_from_byte_stream(
+	          property_list,
+	          fplist_test_property_list_data3,
+	          371,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with a walk of the document and with the key index
+	 */
+	for( iterator = 0;
+	     iterator < 2;
+	     iterator++ )
+	{
+		flags = ( iterator == 0 ) ? 0 : LIBFPLIST_FIND_FLAG_USE_KEY_INDEX;
+
+		result = libfplist_property_list_find_all_by_utf8_key(
+		          property_list,
+		          (uint8_t *) "CFBundleIdentifier",
+		          18,
+		          flags,
+		          properties,
+		          4,
+		          &number_of_properties,
+		          &error );
+
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "number_of_properties",
+		 number_of_properties,
+		 3 );
+
+		FPLIST_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FPLIST_TEST_ASSERT_IS_NULL(
+		 "properties[ 3 ]",
+		 properties[ 3 ] );
+
+		for( property_index = 0;
+		     property_index < 3;
+		     property_index++ )
+		{
+			result = libfplist_property_get_utf8_path_size(
+			          properties[ property_index ],
+			          &path_size,
+			          &error );
+
+			FPLIST_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FPLIST_TEST_ASSERT_EQUAL_SIZE(
+			 "path_size",
+			 path_size,
+			 (size_t) ( narrow_string_length( expected_paths[ property_index ] ) + 1 ) );
+
+			FPLIST_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfplist_property_get_utf8_path(
+			          properties[ property_index ],
+			          path,
+			          64,
+			          &error );
+
+			FPLIST_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FPLIST_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = narrow_string_compare(
+			          (char *) path,
+			          expected_paths[ property_index ],
+			          path_size );
+
+			FPLIST_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			result = libfplist_property_free(
+			          &( properties[ property_index ] ),
+			          &error );
+
+			FPLIST_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FPLIST_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		/* Test with properties that cannot contain all the matches
+		 */
+		result = libfplist_property_list_find_all_by_utf8_key(
+		          property_list,
+		          (uint8_t *) "CFBundleIdentifier",
+		          18,
+		          flags,
+		          properties,
+		          1,
+		          &number_of_properties,
+		          &error );
+
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "number_of_properties",
+		 number_of_properties,
+		 3 );
+
+		FPLIST_TEST_ASSERT_IS_NOT_NULL(
+		 "properties[ 0 ]",
+		 properties[ 0 ] );
+
+		FPLIST_TEST_ASSERT_IS_NULL(
+		 "properties[ 1 ]",
+		 properties[ 1 ] );
+
+		FPLIST_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfplist_property_free(
+		          &( properties[ 0 ] ),
+		          &error );
+
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FPLIST_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test with only retrieving the number of matches
+		 */
+		result = libfplist_property_list_find_all_by_utf8_key(
+		          property_list,
+		          (uint8_t *) "Plugins",
+		          7,
+		          flags,
+		          NULL,
+		          0,
+		          &number_of_properties,
+		          &error );
+
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "number_of_properties",
+		 number_of_properties,
+		 1 );
+
+		FPLIST_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test with a key that is not in the document
+		 */
+		result = libfplist_property_list_find_all_by_utf8_key(
+		          property_list,
+		          (uint8_t *) "CFBundleIdentifieR",
+		          18,
+		          flags,
+		          properties,
+		          4,
+		          &number_of_properties,
+		          &error );
+
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "number_of_properties",
+		 number_of_properties,
+		 0 );
+
+		FPLIST_TEST_ASSERT_IS_NULL(
+		 "properties[ 0 ]",
+		 properties[ 0 ] );
+
+		FPLIST_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfplist_property_list_find_all_by_utf8_key(
+	          NULL,
+	          (uint8_t *) "CFBundleIdentifier",
+	          18,
+	          0,
+	          properties,
+	          4,
+	          &number_of_properties,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_list_find_all_by_utf8_key(
+	          property_list,
+	          NULL,
+	          18,
+	          0,
+	          properties,
+	          4,
+	          &number_of_properties,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_list_find_all_by_utf8_key(
+	          property_list,
+	          (uint8_t *) "CFBundleIdentifier",
+	          18,
+	          0xfe,
+	          properties,
+	          4,
+	          &number_of_properties,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_list_find_all_by_utf8_key(
+	          property_list,
+	          (uint8_t *) "CFBundleIdentifier",
+	          18,
+	          0,
+	          properties,
+	          -1,
+	          &number_of_properties,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_list_find_all_by_utf8_key(
+	          property_list,
+	          (uint8_t *) "CFBundleIdentifier",
+	          18,
+	          0,
+	          NULL,
+	          4,
+	          &number_of_properties,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_property_list_find_all_by_utf8_key(
+	          property_list,
+	          (uint8_t *) "CFBundleIdentifier",
+	          18,
+	          0,
+	          properties,
+	          4,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "property_list",
+	 property_list );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( property_index = 0;
+	     property_index < 4;
+	     property_index++ )
+	{
+		if( properties[ property_index ] != NULL )
+		{
+			libfplist_property_free(
+			 &( properties[ property_index ] ),
+			 NULL );
+		}
+	}
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -827,10 +2594,26 @@ int main(
 	 "libfplist_property_list_copy_from_byte_stream",
 	 fplist_test_property_list_copy_from_byte_stream );
 
+	FPLIST_TEST_RUN(
+	 "libfplist_property_list_set_byte_stream",
+	 fplist_test_property_list_set_byte_stream );
+
 	FPLIST_TEST_RUN(
 	 "libfplist_property_list_has_plist_root_element",
 	 fplist_test_property_list_has_plist_root_element );
 
+	FPLIST_TEST_RUN(
+	 "libfplist_property_list_set_io_handle",
+	 fplist_test_property_list_set_io_handle );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_property_list_write_binary",
+	 fplist_test_property_list_write_binary );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_property_list_find_all_by_utf8_key",
+	 fplist_test_property_list_find_all_by_utf8_key );
+
 #if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
 
 	/* TODO: add tests for libfplist_property_list_set_root_tag */
@@ -0,0 +1,776 @@
+/*
+ * Library transcoder functions test program
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fplist_test_libcerror.h"
+#include "fplist_test_libfplist.h"
+#include "fplist_test_macros.h"
+#include "fplist_test_memory.h"
+#include "fplist_test_unused.h"
+
+uint8_t fplist_test_transcoder_data1[ 311 ] = {
+	0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31,
+	0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54,
+	0x46, 0x2d, 0x38, 0x22, 0x3f, 0x3e, 0x0a, 0x3c, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x76, 0x65,
+	0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69,
+	0x63, 0x74, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x4e, 0x61, 0x6d, 0x65, 0x3c, 0x2f,
+	0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x61, 0x20,
+	0x3e, 0x20, 0x62, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x3c, 0x6b,
+	0x65, 0x79, 0x3e, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a,
+	0x09, 0x3c, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65,
+	0x67, 0x65, 0x72, 0x3e, 0x2d, 0x31, 0x3c, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e,
+	0x0a, 0x09, 0x09, 0x3c, 0x74, 0x72, 0x75, 0x65, 0x2f, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x64, 0x61,
+	0x74, 0x61, 0x3e, 0x64, 0x47, 0x56, 0x7a, 0x64, 0x41, 0x3d, 0x3d, 0x3c, 0x2f, 0x64, 0x61, 0x74,
+	0x61, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c,
+	0x6b, 0x65, 0x79, 0x3e, 0x43, 0x46, 0x24, 0x55, 0x49, 0x44, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e,
+	0x0a, 0x09, 0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x35, 0x3c, 0x2f,
+	0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63,
+	0x74, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x61, 0x20, 0x3e,
+	0x20, 0x62, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x3c, 0x2f, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x3c, 0x2f,
+	0x70, 0x6c, 0x69, 0x73, 0x74, 0x3e, 0x0a };
+
+uint8_t fplist_test_transcoder_data1_xml[ 420 ] = {
+	0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31,
+	0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54,
+	0x46, 0x2d, 0x38, 0x22, 0x3f, 0x3e, 0x0a, 0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45,
+	0x20, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x50, 0x55, 0x42, 0x4c, 0x49, 0x43, 0x20, 0x22, 0x2d,
+	0x2f, 0x2f, 0x41, 0x70, 0x70, 0x6c, 0x65, 0x2f, 0x2f, 0x44, 0x54, 0x44, 0x20, 0x50, 0x4c, 0x49,
+	0x53, 0x54, 0x20, 0x31, 0x2e, 0x30, 0x2f, 0x2f, 0x45, 0x4e, 0x22, 0x20, 0x22, 0x68, 0x74, 0x74,
+	0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x61, 0x70, 0x70, 0x6c, 0x65, 0x2e, 0x63, 0x6f,
+	0x6d, 0x2f, 0x44, 0x54, 0x44, 0x73, 0x2f, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x4c,
+	0x69, 0x73, 0x74, 0x2d, 0x31, 0x2e, 0x30, 0x2e, 0x64, 0x74, 0x64, 0x22, 0x3e, 0x0a, 0x3c, 0x70,
+	0x6c, 0x69, 0x73, 0x74, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e,
+	0x30, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65, 0x79,
+	0x3e, 0x4e, 0x61, 0x6d, 0x65, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x3e, 0x61, 0x20, 0x26, 0x67, 0x74, 0x3b, 0x20, 0x62, 0x3c, 0x2f, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x56, 0x61, 0x6c,
+	0x75, 0x65, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x2d, 0x31,
+	0x3c, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x74, 0x72,
+	0x75, 0x65, 0x2f, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x3e, 0x64, 0x47, 0x56,
+	0x7a, 0x64, 0x41, 0x3d, 0x3d, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x3e, 0x0a, 0x09, 0x09, 0x3c,
+	0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x43, 0x46,
+	0x24, 0x55, 0x49, 0x44, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x69,
+	0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x35, 0x3c, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65,
+	0x72, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x3c,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x61, 0x20, 0x26, 0x67, 0x74, 0x3b, 0x20, 0x62, 0x3c,
+	0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x3c, 0x2f, 0x61, 0x72, 0x72, 0x61,
+	0x79, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x3c, 0x2f, 0x70, 0x6c, 0x69,
+	0x73, 0x74, 0x3e, 0x0a };
+
+uint8_t fplist_test_transcoder_data2[ 135 ] = {
+	0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31,
+	0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54,
+	0x46, 0x2d, 0x38, 0x22, 0x3f, 0x3e, 0x0a, 0x3c, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x76, 0x65,
+	0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69,
+	0x63, 0x74, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x61, 0x3c, 0x2f, 0x6b, 0x65, 0x79,
+	0x3e, 0x0a, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x26, 0x6c, 0x74, 0x3b, 0x62,
+	0x26, 0x67, 0x74, 0x3b, 0x20, 0x26, 0x61, 0x6d, 0x70, 0x3b, 0x20, 0x63, 0x3c, 0x2f, 0x73, 0x74,
+	0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x3c, 0x2f,
+	0x70, 0x6c, 0x69, 0x73, 0x74, 0x3e, 0x0a };
+
+uint8_t fplist_test_transcoder_data2_binary[ 56 ] = {
+	0x62, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x30, 0x30, 0xd1, 0x01, 0x02, 0x51, 0x61, 0x57, 0x3c, 0x62,
+	0x3e, 0x20, 0x26, 0x20, 0x63, 0x08, 0x0b, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15 };
+
+/* Binary property list with a dict that contains an entry with a null value
+ * and an array that contains a null element
+ */
+uint8_t fplist_test_transcoder_data3[ 60 ] = {
+	0x62, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x30, 0x30, 0xd2, 0x01, 0x02, 0x03, 0x04, 0x51, 0x61, 0x51,
+	0x62, 0x00, 0xa2, 0x03, 0x05, 0x09, 0x08, 0x0d, 0x0f, 0x11, 0x12, 0x15, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16 };
+
+uint8_t fplist_test_transcoder_data3_xml[ 231 ] = {
+	0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31,
+	0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54,
+	0x46, 0x2d, 0x38, 0x22, 0x3f, 0x3e, 0x0a, 0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45,
+	0x20, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x50, 0x55, 0x42, 0x4c, 0x49, 0x43, 0x20, 0x22, 0x2d,
+	0x2f, 0x2f, 0x41, 0x70, 0x70, 0x6c, 0x65, 0x2f, 0x2f, 0x44, 0x54, 0x44, 0x20, 0x50, 0x4c, 0x49,
+	0x53, 0x54, 0x20, 0x31, 0x2e, 0x30, 0x2f, 0x2f, 0x45, 0x4e, 0x22, 0x20, 0x22, 0x68, 0x74, 0x74,
+	0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x61, 0x70, 0x70, 0x6c, 0x65, 0x2e, 0x63, 0x6f,
+	0x6d, 0x2f, 0x44, 0x54, 0x44, 0x73, 0x2f, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x4c,
+	0x69, 0x73, 0x74, 0x2d, 0x31, 0x2e, 0x30, 0x2e, 0x64, 0x74, 0x64, 0x22, 0x3e, 0x0a, 0x3c, 0x70,
+	0x6c, 0x69, 0x73, 0x74, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e,
+	0x30, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65, 0x79,
+	0x3e, 0x62, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x61, 0x72, 0x72, 0x61, 0x79,
+	0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x74, 0x72, 0x75, 0x65, 0x2f, 0x3e, 0x0a, 0x09, 0x3c, 0x2f, 0x61,
+	0x72, 0x72, 0x61, 0x79, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x3c, 0x2f,
+	0x70, 0x6c, 0x69, 0x73, 0x74, 0x3e, 0x0a };
+
+/* Tests the libfplist_transcoder_copy_xml_to_binary function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_transcoder_copy_xml_to_binary(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfplist_property_list_t *property_list = NULL;
+	uint8_t *binary_byte_stream              = NULL;
+	uint8_t *property_list_byte_stream       = NULL;
+	uint8_t *xml_byte_stream                 = NULL;
+	size_t binary_byte_stream_size           = 0;
+	size_t property_list_byte_stream_size    = 0;
+	size_t xml_byte_stream_size              = 0;
+	int result                               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_transcoder_copy_xml_to_binary(
+	          fplist_test_transcoder_data1,
+	          311,
+	          &binary_byte_stream,
+	          &binary_byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "binary_byte_stream",
+	 binary_byte_stream );
+
+	result = memory_compare(
+	          binary_byte_stream,
+	          "bplist00",
+	          8 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test if the objects are written in the same order as libfplist_property_list_write_binary
+	 */
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_copy_from_byte_stream(
+	          property_list,
+	          fplist_test_transcoder_data1,
+	          311,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_property_list_write_binary(
+	          property_list,
+	          &property_list_byte_stream,
+	          &property_list_byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "binary_byte_stream_size",
+	 binary_byte_stream_size,
+	 property_list_byte_stream_size );
+
+	result = memory_compare(
+	          binary_byte_stream,
+	          property_list_byte_stream,
+	          property_list_byte_stream_size );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 property_list_byte_stream );
+
+	property_list_byte_stream = NULL;
+
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the binary property list is transcoded back into the equivalent XML property list
+	 */
+	result = libfplist_transcoder_copy_binary_to_xml(
+	          binary_byte_stream,
+	          binary_byte_stream_size,
+	          &xml_byte_stream,
+	          &xml_byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_byte_stream",
+	 xml_byte_stream );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "xml_byte_stream_size",
+	 xml_byte_stream_size,
+	 (size_t) 420 );
+
+	result = memory_compare(
+	          xml_byte_stream,
+	          fplist_test_transcoder_data1_xml,
+	          420 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	memory_free(
+	 xml_byte_stream );
+
+	xml_byte_stream = NULL;
+
+	memory_free(
+	 binary_byte_stream );
+
+	binary_byte_stream = NULL;
+
+	/* Test if the entity references are decoded
+	 */
+	result = libfplist_transcoder_copy_xml_to_binary(
+	          fplist_test_transcoder_data2,
+	          135,
+	          &binary_byte_stream,
+	          &binary_byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "binary_byte_stream_size",
+	 binary_byte_stream_size,
+	 (size_t) 56 );
+
+	result = memory_compare(
+	          binary_byte_stream,
+	          fplist_test_transcoder_data2_binary,
+	          56 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 binary_byte_stream );
+
+	binary_byte_stream = NULL;
+
+	/* Test if a binary property list with &, < and > in a string survives a round trip
+	 */
+	result = libfplist_transcoder_copy_binary_to_xml(
+	          fplist_test_transcoder_data2_binary,
+	          56,
+	          &xml_byte_stream,
+	          &xml_byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_transcoder_copy_xml_to_binary(
+	          xml_byte_stream,
+	          xml_byte_stream_size,
+	          &binary_byte_stream,
+	          &binary_byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "binary_byte_stream_size",
+	 binary_byte_stream_size,
+	 (size_t) 56 );
+
+	result = memory_compare(
+	          binary_byte_stream,
+	          fplist_test_transcoder_data2_binary,
+	          56 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 xml_byte_stream );
+
+	xml_byte_stream = NULL;
+
+	memory_free(
+	 binary_byte_stream );
+
+	binary_byte_stream = NULL;
+
+	/* Test error cases
+	 */
+	result = libfplist_transcoder_copy_xml_to_binary(
+	          NULL,
+	          311,
+	          &binary_byte_stream,
+	          &binary_byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_transcoder_copy_xml_to_binary(
+	          fplist_test_transcoder_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &binary_byte_stream,
+	          &binary_byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_transcoder_copy_xml_to_binary(
+	          fplist_test_transcoder_data1,
+	          311,
+	          NULL,
+	          &binary_byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_transcoder_copy_xml_to_binary(
+	          fplist_test_transcoder_data1,
+	          311,
+	          &binary_byte_stream,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test transcoding a property list without a root value
+	 */
+	result = libfplist_transcoder_copy_xml_to_binary(
+	          fplist_test_transcoder_data1,
+	          39,
+	          &binary_byte_stream,
+	          &binary_byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "binary_byte_stream",
+	 binary_byte_stream );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( property_list_byte_stream != NULL )
+	{
+		memory_free(
+		 property_list_byte_stream );
+	}
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	if( xml_byte_stream != NULL )
+	{
+		memory_free(
+		 xml_byte_stream );
+	}
+	if( binary_byte_stream != NULL )
+	{
+		memory_free(
+		 binary_byte_stream );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_transcoder_copy_binary_to_xml function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_transcoder_copy_binary_to_xml(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	uint8_t *binary_byte_stream    = NULL;
+	uint8_t *xml_byte_stream       = NULL;
+	size_t binary_byte_stream_size = 0;
+	size_t xml_byte_stream_size    = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_transcoder_copy_xml_to_binary(
+	          fplist_test_transcoder_data1,
+	          311,
+	          &binary_byte_stream,
+	          &binary_byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "binary_byte_stream",
+	 binary_byte_stream );
+
+	/* Test if null elements and dict entries with a null value are omitted
+	 */
+	result = libfplist_transcoder_copy_binary_to_xml(
+	          fplist_test_transcoder_data3,
+	          60,
+	          &xml_byte_stream,
+	          &xml_byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "xml_byte_stream_size",
+	 xml_byte_stream_size,
+	 (size_t) 231 );
+
+	result = memory_compare(
+	          xml_byte_stream,
+	          fplist_test_transcoder_data3_xml,
+	          231 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 xml_byte_stream );
+
+	xml_byte_stream = NULL;
+
+	/* Test error cases
+	 */
+	result = libfplist_transcoder_copy_binary_to_xml(
+	          NULL,
+	          binary_byte_stream_size,
+	          &xml_byte_stream,
+	          &xml_byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_transcoder_copy_binary_to_xml(
+	          binary_byte_stream,
+	          binary_byte_stream_size,
+	          NULL,
+	          &xml_byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_transcoder_copy_binary_to_xml(
+	          binary_byte_stream,
+	          binary_byte_stream_size,
+	          &xml_byte_stream,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test transcoding a truncated binary property list
+	 */
+	result = libfplist_transcoder_copy_binary_to_xml(
+	          binary_byte_stream,
+	          binary_byte_stream_size - 1,
+	          &xml_byte_stream,
+	          &xml_byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "xml_byte_stream",
+	 xml_byte_stream );
+
+	/* Test transcoding a XML property list
+	 */
+	result = libfplist_transcoder_copy_binary_to_xml(
+	          fplist_test_transcoder_data1,
+	          311,
+	          &xml_byte_stream,
+	          &xml_byte_stream_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "xml_byte_stream",
+	 xml_byte_stream );
+
+	/* Clean up
+	 */
+	memory_free(
+	 binary_byte_stream );
+
+	binary_byte_stream = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_byte_stream != NULL )
+	{
+		memory_free(
+		 xml_byte_stream );
+	}
+	if( binary_byte_stream != NULL )
+	{
+		memory_free(
+		 binary_byte_stream );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argc )
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FPLIST_TEST_RUN(
+	 "libfplist_transcoder_copy_xml_to_binary",
+	 fplist_test_transcoder_copy_xml_to_binary );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_transcoder_copy_binary_to_xml",
+	 fplist_test_transcoder_copy_binary_to_xml );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
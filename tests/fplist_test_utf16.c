@@ -0,0 +1,495 @@
+/*
+ * Library UTF-16 stream functions test program
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fplist_test_libcerror.h"
+#include "fplist_test_libfplist.h"
+#include "fplist_test_macros.h"
+#include "fplist_test_unused.h"
+
+#include "../libfplist/libfplist_utf16.h"
+
+/* Big-endian UTF-16 encoded "The quick brown fox jumps over the lazy dog"
+ */
+uint8_t fplist_test_utf16_data1[ 86 ] = {
+	0x00, 0x54, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x71, 0x00, 0x75, 0x00, 0x69, 0x00, 0x63,
+	0x00, 0x6b, 0x00, 0x20, 0x00, 0x62, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x77, 0x00, 0x6e, 0x00, 0x20,
+	0x00, 0x66, 0x00, 0x6f, 0x00, 0x78, 0x00, 0x20, 0x00, 0x6a, 0x00, 0x75, 0x00, 0x6d, 0x00, 0x70,
+	0x00, 0x73, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x76, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x74,
+	0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x7a, 0x00, 0x79, 0x00, 0x20,
+	0x00, 0x64, 0x00, 0x6f, 0x00, 0x67 };
+
+/* Big-endian UTF-16 stream with a byte order mark, a surrogate pair, an unpaired
+ * surrogate and characters after an end of string character
+ */
+uint8_t fplist_test_utf16_data2[ 20 ] = {
+	0xfe, 0xff, 0x00, 0x41, 0x00, 0xe9, 0x20, 0xac, 0xd8, 0x3d, 0xde, 0x00, 0xd8, 0x00, 0x00, 0x42,
+	0x00, 0x00, 0x00, 0x43 };
+
+/* Big-endian UTF-16 encoded 2-byte and 3-byte UTF-8 characters
+ */
+uint8_t fplist_test_utf16_data3[ 16 ] = {
+	0x00, 0xe9, 0x20, 0xac, 0x00, 0x41, 0x00, 0xe9, 0x20, 0xac, 0x00, 0x41, 0x00, 0xe9, 0x20, 0xac };
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+/* Tests the libfplist_utf16_stream_get_utf8_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_utf16_stream_get_utf8_string_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_utf16_stream_get_utf8_string_size(
+	          (uint8_t *) "\x00" "H\x00" "e\x00" "l\x00" "l\x00" "o",
+	          10,
+	          &utf8_string_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 6 );
+
+	result = libfplist_utf16_stream_get_utf8_string_size(
+	          fplist_test_utf16_data1,
+	          86,
+	          &utf8_string_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 44 );
+
+	result = libfplist_utf16_stream_get_utf8_string_size(
+	          fplist_test_utf16_data2,
+	          20,
+	          &utf8_string_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 15 );
+
+	result = libfplist_utf16_stream_get_utf8_string_size(
+	          fplist_test_utf16_data3,
+	          16,
+	          &utf8_string_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 18 );
+
+	/* Test error cases
+	 */
+	result = libfplist_utf16_stream_get_utf8_string_size(
+	          NULL,
+	          86,
+	          &utf8_string_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_utf16_stream_get_utf8_string_size(
+	          fplist_test_utf16_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf8_string_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_utf16_stream_get_utf8_string_size(
+	          fplist_test_utf16_data1,
+	          85,
+	          &utf8_string_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_utf16_stream_get_utf8_string_size(
+	          fplist_test_utf16_data1,
+	          86,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_utf16_stream_copy_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_utf16_stream_copy_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_utf16_stream_copy_to_utf8_string(
+	          fplist_test_utf16_data1,
+	          86,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "The quick brown fox jumps over the lazy dog",
+	          44 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfplist_utf16_stream_copy_to_utf8_string(
+	          fplist_test_utf16_data2,
+	          20,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "A\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80\xef\xbf\xbd" "B",
+	          15 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfplist_utf16_stream_copy_to_utf8_string(
+	          fplist_test_utf16_data3,
+	          16,
+	          utf8_string,
+	          18,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "\xc3\xa9\xe2\x82\xac" "A\xc3\xa9\xe2\x82\xac" "A\xc3\xa9\xe2\x82\xac",
+	          18 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfplist_utf16_stream_copy_to_utf8_string(
+	          NULL,
+	          86,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_utf16_stream_copy_to_utf8_string(
+	          fplist_test_utf16_data1,
+	          85,
+	          utf8_string,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_utf16_stream_copy_to_utf8_string(
+	          fplist_test_utf16_data1,
+	          86,
+	          NULL,
+	          64,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_utf16_stream_copy_to_utf8_string(
+	          fplist_test_utf16_data1,
+	          86,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_utf16_stream_copy_to_utf8_string(
+	          fplist_test_utf16_data1,
+	          86,
+	          utf8_string,
+	          43,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_utf16_stream_copy_to_utf8_string(
+	          fplist_test_utf16_data3,
+	          16,
+	          utf8_string,
+	          17,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argc )
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+	FPLIST_TEST_RUN(
+	 "libfplist_utf16_stream_get_utf8_string_size",
+	 fplist_test_utf16_stream_get_utf8_string_size );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_utf16_stream_copy_to_utf8_string",
+	 fplist_test_utf16_stream_copy_to_utf8_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+}
+
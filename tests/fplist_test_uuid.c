@@ -0,0 +1,539 @@
+/*
+ * Library UUID functions test program
+ *
+ * Copyright (C) 2016-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fplist_test_libcerror.h"
+#include "fplist_test_libfplist.h"
+#include "fplist_test_macros.h"
+#include "fplist_test_memory.h"
+#include "fplist_test_unused.h"
+
+#include "../libfplist/libfplist_uuid.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+/* Tests the libfplist_uuid_copy_from_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_uuid_copy_from_utf8_string(
+     void )
+{
+	uint8_t expected_uuid_data[ 16 ] = {
+		0xc3, 0x1c, 0x54, 0x34, 0x7b, 0xa4, 0x4f, 0xfa, 0xbd, 0x67, 0x99, 0xd9, 0x7a, 0x0a, 0xda, 0x0e };
+
+	uint8_t uuid_data[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_uuid_copy_from_utf8_string(
+	          (uint8_t *) "c31c5434-7BA4-4ffa-BD67-99d97a0ada0e",
+	          36,
+	          uuid_data,
+	          16,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uuid_data,
+	          expected_uuid_data,
+	          16 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfplist_uuid_copy_from_utf8_string(
+	          (uint8_t *) "c31c5434-7BA4-4ffa-BD67-99d97a0ada0e",
+	          37,
+	          uuid_data,
+	          16,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uuid_data,
+	          expected_uuid_data,
+	          16 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test unsupported UUID strings
+	 */
+	result = libfplist_uuid_copy_from_utf8_string(
+	          (uint8_t *) "c31c5434-7BA4-4ffa-BD67-99d97a0ada0e",
+	          35,
+	          uuid_data,
+	          16,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_uuid_copy_from_utf8_string(
+	          (uint8_t *) "c31c5434-7BA4-4ffa-BD67-99d97a0ada0ef",
+	          37,
+	          uuid_data,
+	          16,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_uuid_copy_from_utf8_string(
+	          (uint8_t *) "c31c5434_7BA4-4ffa-BD67-99d97a0ada0e",
+	          36,
+	          uuid_data,
+	          16,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_uuid_copy_from_utf8_string(
+	          (uint8_t *) "c31c5434-7BA4-4ffa-BD67-99d97a0ada0g",
+	          36,
+	          uuid_data,
+	          16,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_uuid_copy_from_utf8_string(
+	          (uint8_t *) "{c31c5434-7BA4-4ffa-BD67-99d97a0ada}",
+	          36,
+	          uuid_data,
+	          16,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_uuid_copy_from_utf8_string(
+	          NULL,
+	          36,
+	          uuid_data,
+	          16,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_uuid_copy_from_utf8_string(
+	          (uint8_t *) "c31c5434-7BA4-4ffa-BD67-99d97a0ada0e",
+	          (size_t) SSIZE_MAX + 1,
+	          uuid_data,
+	          16,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_uuid_copy_from_utf8_string(
+	          (uint8_t *) "c31c5434-7BA4-4ffa-BD67-99d97a0ada0e",
+	          36,
+	          NULL,
+	          16,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_uuid_copy_from_utf8_string(
+	          (uint8_t *) "c31c5434-7BA4-4ffa-BD67-99d97a0ada0e",
+	          36,
+	          uuid_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_uuid_copy_from_utf8_string(
+	          (uint8_t *) "c31c5434-7BA4-4ffa-BD67-99d97a0ada0e",
+	          36,
+	          uuid_data,
+	          15,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FPLIST_TEST_MEMORY ) && defined( OPTIMIZATION_DISABLED )
+
+	/* Test libfplist_uuid_copy_from_utf8_string with memcpy failing
+	 */
+	fplist_test_memcpy_attempts_before_fail = 0;
+
+	result = libfplist_uuid_copy_from_utf8_string(
+	          (uint8_t *) "c31c5434-7BA4-4ffa-BD67-99d97a0ada0e",
+	          36,
+	          uuid_data,
+	          16,
+	          &error );
+
+	if( fplist_test_memcpy_attempts_before_fail != -1 )
+	{
+		fplist_test_memcpy_attempts_before_fail = -1;
+	}
+	else
+	{
+		FPLIST_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FPLIST_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FPLIST_TEST_MEMORY ) && defined( OPTIMIZATION_DISABLED ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_uuid_copy_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_uuid_copy_to_utf8_string(
+     void )
+{
+	uint8_t uuid_data[ 16 ] = {
+		0xc3, 0x1c, 0x54, 0x34, 0x7b, 0xa4, 0x4f, 0xfa, 0xbd, 0x67, 0x99, 0xd9, 0x7a, 0x0a, 0xda, 0x0e };
+
+	uint8_t utf8_string[ 37 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfplist_uuid_copy_to_utf8_string(
+	          uuid_data,
+	          16,
+	          utf8_string,
+	          37,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "C31C5434-7BA4-4FFA-BD67-99D97A0ADA0E",
+	          37 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfplist_uuid_copy_to_utf8_string(
+	          NULL,
+	          16,
+	          utf8_string,
+	          37,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_uuid_copy_to_utf8_string(
+	          uuid_data,
+	          (size_t) SSIZE_MAX + 1,
+	          utf8_string,
+	          37,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_uuid_copy_to_utf8_string(
+	          uuid_data,
+	          15,
+	          utf8_string,
+	          37,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_uuid_copy_to_utf8_string(
+	          uuid_data,
+	          16,
+	          NULL,
+	          37,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_uuid_copy_to_utf8_string(
+	          uuid_data,
+	          16,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_uuid_copy_to_utf8_string(
+	          uuid_data,
+	          16,
+	          utf8_string,
+	          36,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FPLIST_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FPLIST_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argc )
+	FPLIST_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+	FPLIST_TEST_RUN(
+	 "libfplist_uuid_copy_from_utf8_string",
+	 fplist_test_uuid_copy_from_utf8_string );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_uuid_copy_to_utf8_string",
+	 fplist_test_uuid_copy_to_utf8_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFPLIST_DLL_IMPORT ) */
+}
+
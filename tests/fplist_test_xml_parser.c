@@ -21,6 +21,8 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -89,6 +91,10 @@ int fplist_test_xml_parser_parse_buffer(
 {
 	libcerror_error_t *error                 = NULL;
 	libfplist_property_list_t *property_list = NULL;
+	uint8_t *buffer                          = NULL;
+	size_t buffer_index                      = 0;
+	size_t buffer_size                       = 0;
+	int element_index                        = 0;
 	int result                               = 0;
 
 	/* Initialize test
@@ -146,6 +152,88 @@ int fplist_test_xml_parser_parse_buffer(
 	 "error",
 	 error );
 
+	/* Test an array with more elements than the maximum depth of the parser stack
+	 */
+	buffer_size = 28 + ( 20000 * 7 ) + 18;
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * buffer_size );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	narrow_string_copy(
+	 (char *) buffer,
+	 "<plist version=\"1.0\"><array>",
+	 28 );
+
+	buffer_index = 28;
+
+	for( element_index = 0;
+	     element_index < 20000;
+	     element_index++ )
+	{
+		narrow_string_copy(
+		 (char *) &( buffer[ buffer_index ] ),
+		 "<true/>",
+		 7 );
+
+		buffer_index += 7;
+	}
+	narrow_string_copy(
+	 (char *) &( buffer[ buffer_index ] ),
+	 "</array></plist>",
+	 17 );
+
+	buffer[ buffer_size - 1 ] = 0;
+
+	result = libfplist_property_list_initialize(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_parser_parse_buffer(
+	          property_list,
+	          buffer,
+	          buffer_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	result = libfplist_property_list_free(
+	          &property_list,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Initialize test
 	 */
 	result = libfplist_property_list_initialize(
@@ -236,6 +324,11 @@ on_error:
 		 &property_list,
 		 NULL );
 	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
 	return( 0 );
 }
 
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -965,6 +966,855 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfplist_xml_tag_decode_value_entity_references function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_xml_tag_decode_value_entity_references(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libfplist_xml_tag_t *xml_tag = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &xml_tag,
+	          (uint8_t *) "string",
+	          6,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_tag",
+	 xml_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          xml_tag,
+	          (uint8_t *) "&lt;a&gt; &amp; &quot;&apos; &#65;&#x42; & &x;",
+	          46,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_xml_tag_decode_value_entity_references(
+	          xml_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "xml_tag->value_size",
+	 xml_tag->value_size,
+	 (size_t) 18 );
+
+	result = memory_compare(
+	          xml_tag->value,
+	          "<a> & \"' AB & &x;",
+	          18 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfplist_xml_tag_decode_value_entity_references(
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &xml_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "xml_tag",
+	 xml_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &xml_tag,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_xml_tag_get_value_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_xml_tag_get_value_data_size(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libfplist_xml_tag_t *xml_tag = NULL;
+	size_t value_data_size       = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &xml_tag,
+	          (uint8_t *) "data",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_tag",
+	 xml_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case with missing value
+	 */
+	result = libfplist_xml_tag_get_value_data_size(
+	          xml_tag,
+	          &value_data_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_xml_tag_set_value(
+	          xml_tag,
+	          (uint8_t *) "\n\tVEVTVA==\n",
+	          11,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_xml_tag_get_value_data_size(
+	          xml_tag,
+	          &value_data_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 (size_t) 4 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "xml_tag->value_data_size_is_set",
+	 xml_tag->value_data_size_is_set,
+	 (uint8_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libfplist_xml_tag_get_value_data_size(
+	          NULL,
+	          &value_data_size,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_xml_tag_get_value_data_size(
+	          xml_tag,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &xml_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "xml_tag",
+	 xml_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &xml_tag,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_xml_tag_copy_value_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_xml_tag_copy_value_data(
+     void )
+{
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error     = NULL;
+	libfplist_xml_tag_t *xml_tag = NULL;
+	size_t value_data_index      = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &xml_tag,
+	          (uint8_t *) "data",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_tag",
+	 xml_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_set_value(
+	          xml_tag,
+	          (uint8_t *) "\n\tVEVTVA==\n",
+	          11,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_xml_tag_copy_value_data(
+	          xml_tag,
+	          value_data,
+	          16,
+	          &value_data_index,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_index",
+	 value_data_index,
+	 (size_t) 4 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          value_data,
+	          "TEST",
+	          4 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "xml_tag->value_data_size_is_set",
+	 xml_tag->value_data_size_is_set,
+	 (uint8_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libfplist_xml_tag_copy_value_data(
+	          NULL,
+	          value_data,
+	          16,
+	          &value_data_index,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_xml_tag_copy_value_data(
+	          xml_tag,
+	          NULL,
+	          16,
+	          &value_data_index,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_xml_tag_copy_value_data(
+	          xml_tag,
+	          value_data,
+	          3,
+	          &value_data_index,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_xml_tag_copy_value_data(
+	          xml_tag,
+	          value_data,
+	          16,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &xml_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "xml_tag",
+	 xml_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &xml_tag,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfplist_xml_tag_get_integer_value function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_xml_tag_get_integer_value(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libfplist_xml_tag_t *xml_tag = NULL;
+	uint64_t lower_64bit         = 0;
+	uint64_t upper_64bit         = 0;
+	uint8_t is_negative          = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &xml_tag,
+	          (uint8_t *) "integer",
+	          7,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_tag",
+	 xml_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case with missing value
+	 */
+	result = libfplist_xml_tag_get_integer_value(
+	          xml_tag,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_xml_tag_set_value(
+	          xml_tag,
+	          (uint8_t *) "-42",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfplist_xml_tag_get_integer_value(
+	          xml_tag,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "upper_64bit",
+	 upper_64bit,
+	 (uint64_t) 0 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "lower_64bit",
+	 lower_64bit,
+	 (uint64_t) 42 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "is_negative",
+	 is_negative,
+	 (uint8_t) 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "xml_tag->integer_value_is_set",
+	 xml_tag->integer_value_is_set,
+	 (uint8_t) 1 );
+
+	result = libfplist_xml_tag_set_value(
+	          xml_tag,
+	          (uint8_t *) "18446744073709551615",
+	          20,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_get_integer_value(
+	          xml_tag,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "upper_64bit",
+	 upper_64bit,
+	 (uint64_t) 0 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "lower_64bit",
+	 lower_64bit,
+	 (uint64_t) 0xffffffffffffffffULL );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "is_negative",
+	 is_negative,
+	 (uint8_t) 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test value that exceeds the default integer size of 64 bits
+	 */
+	result = libfplist_xml_tag_set_value(
+	          xml_tag,
+	          (uint8_t *) "18446744073709551616",
+	          20,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_get_integer_value(
+	          xml_tag,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test value with a size attribute
+	 */
+	result = libfplist_xml_tag_append_attribute(
+	          xml_tag,
+	          (uint8_t *) "size",
+	          4,
+	          (uint8_t *) "128",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_get_integer_value(
+	          xml_tag,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "upper_64bit",
+	 upper_64bit,
+	 (uint64_t) 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT64(
+	 "lower_64bit",
+	 lower_64bit,
+	 (uint64_t) 0 );
+
+	FPLIST_TEST_ASSERT_EQUAL_UINT8(
+	 "is_negative",
+	 is_negative,
+	 (uint8_t) 0 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_xml_tag_get_integer_value(
+	          NULL,
+	          &upper_64bit,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_xml_tag_get_integer_value(
+	          xml_tag,
+	          NULL,
+	          &lower_64bit,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_xml_tag_get_integer_value(
+	          xml_tag,
+	          &upper_64bit,
+	          NULL,
+	          &is_negative,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_xml_tag_get_integer_value(
+	          xml_tag,
+	          &upper_64bit,
+	          &lower_64bit,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &xml_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "xml_tag",
+	 xml_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &xml_tag,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfplist_xml_tag_append_attribute function
  * Returns 1 if successful or 0 if not
  */
@@ -1454,6 +2304,208 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfplist_xml_tag_get_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fplist_test_xml_tag_get_number_of_entries(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfplist_xml_tag_t *element_tag1 = NULL;
+	libfplist_xml_tag_t *xml_tag      = NULL;
+	int number_of_entries             = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfplist_xml_tag_initialize(
+	          &xml_tag,
+	          (uint8_t *) "dict",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_tag",
+	 xml_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag1,
+	          (uint8_t *) "key",
+	          3,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "element_tag1",
+	 element_tag1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          xml_tag,
+	          element_tag1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag1 = NULL;
+
+	result = libfplist_xml_tag_initialize(
+	          &element_tag1,
+	          (uint8_t *) "data",
+	          4,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "element_tag1",
+	 element_tag1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfplist_xml_tag_append_element(
+	          xml_tag,
+	          element_tag1,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_tag1 = NULL;
+
+	/* Test regular cases
+	 */
+	result = libfplist_xml_tag_get_number_of_entries(
+	          xml_tag,
+	          &number_of_entries,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfplist_xml_tag_get_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfplist_xml_tag_get_number_of_entries(
+	          xml_tag,
+	          NULL,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FPLIST_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfplist_xml_tag_free(
+	          &xml_tag,
+	          &error );
+
+	FPLIST_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "xml_tag",
+	 xml_tag );
+
+	FPLIST_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( element_tag1 != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &element_tag1,
+		 NULL );
+	}
+	if( xml_tag != NULL )
+	{
+		libfplist_xml_tag_free(
+		 &xml_tag,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfplist_xml_tag_get_element function
  * Returns 1 if successful or 0 if not
  */
@@ -1662,6 +2714,22 @@ int main(
 	 "libfplist_xml_tag_set_value",
 	 fplist_test_xml_tag_set_value );
 
+	FPLIST_TEST_RUN(
+	 "libfplist_xml_tag_decode_value_entity_references",
+	 fplist_test_xml_tag_decode_value_entity_references );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_xml_tag_get_value_data_size",
+	 fplist_test_xml_tag_get_value_data_size );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_xml_tag_copy_value_data",
+	 fplist_test_xml_tag_copy_value_data );
+
+	FPLIST_TEST_RUN(
+	 "libfplist_xml_tag_get_integer_value",
+	 fplist_test_xml_tag_get_integer_value );
+
 	FPLIST_TEST_RUN(
 	 "libfplist_xml_tag_append_attribute",
 	 fplist_test_xml_tag_append_attribute );
@@ -1674,6 +2742,10 @@ int main(
 	 "libfplist_xml_tag_get_number_of_elements",
 	 fplist_test_xml_tag_get_number_of_elements );
 
+	FPLIST_TEST_RUN(
+	 "libfplist_xml_tag_get_number_of_entries",
+	 fplist_test_xml_tag_get_number_of_entries );
+
 	FPLIST_TEST_RUN(
 	 "libfplist_xml_tag_get_element",
 	 fplist_test_xml_tag_get_element );
@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "error property property_list support xml_attribute xml_parser xml_tag"
+$LibraryTests = "archive base64 binary_parser binary_writer date_time error floating_point integer key_token property property_list support transcoder utf16 uuid xml_attribute xml_parser xml_tag"
 $LibraryTestsWithInput = ""
 $OptionSets = "" -split " "
 